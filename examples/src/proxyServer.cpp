@@ -0,0 +1,131 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file proxyServer.cpp
+* @author Christophe Calmejane
+*/
+
+/** ************************************************************************ **/
+/** AVDECC Proxy Server (IEEE 1722.1 Annex C), bridging a network interface  **/
+/** with remote proxy clients over TCP                                       **/
+/** ************************************************************************ **/
+
+#include <la/avdecc/avdecc.hpp>
+#include <la/avdecc/utils.hpp>
+#include <la/avdecc/executor.hpp>
+
+// Internal API (the proxy server is not part of the public API)
+#include "protocolInterface/proxyProtocol.hpp"
+#include "protocolInterface/proxyServer.hpp"
+
+#include "utils.hpp"
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <cassert>
+
+inline int doJob(std::uint16_t const port)
+{
+	static auto constexpr DefaultExecutorName = "avdecc::protocol::PI";
+
+	auto const protocolInterfaceType = chooseProtocolInterfaceType(la::avdecc::protocol::ProtocolInterface::SupportedProtocolInterfaceTypes{ la::avdecc::protocol::ProtocolInterface::Type::PCap, la::avdecc::protocol::ProtocolInterface::Type::MacOSNative });
+	auto intfc = chooseNetworkInterface();
+
+	if (intfc.type == la::networkInterface::Interface::Type::None || protocolInterfaceType == la::avdecc::protocol::ProtocolInterface::Type::None)
+	{
+		return 1;
+	}
+
+	try
+	{
+		// Create an executor for ProtocolInterface
+		auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+		outputText("Selected interface '" + intfc.alias + "' and protocol interface '" + la::avdecc::protocol::ProtocolInterface::typeToString(protocolInterfaceType) + "':\n");
+
+		auto pi = la::avdecc::protocol::ProtocolInterface::create(protocolInterfaceType, intfc.id, DefaultExecutorName);
+		{
+			auto const server = la::avdecc::protocol::ProxyServer::create(*pi, port);
+
+			outputText("Proxy server listening on port " + std::to_string(server->getPort()) + "\nPress any key to terminate.\n");
+			getch();
+
+			outputText("Disconnecting " + std::to_string(server->getConnectedClientsCount()) + " client(s)\n");
+		}
+		pi->shutdown(); // Not necessary, but best practice
+	}
+	catch (la::avdecc::protocol::ProtocolInterface::Exception const& e)
+	{
+		outputText(std::string("Cannot create ProtocolInterface or ProxyServer: ") + e.what() + "\n");
+		return 1;
+	}
+	catch (std::exception const& e)
+	{
+		assert(false && "Unknown exception (Should not happen anymore)");
+		outputText(std::string("Unknown exception: ") + e.what() + "\n");
+		return 1;
+	}
+	catch (...)
+	{
+		assert(false && "Unknown exception");
+		outputText(std::string("Unknown exception\n"));
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	// Optional port
+	auto port = la::avdecc::protocol::proxy::DefaultPort;
+	if (argc > 1)
+	{
+		auto const value = std::strtoul(argv[1], nullptr, 10);
+		if (value == 0u || value > 65535u)
+		{
+			std::cerr << "Usage: " << argv[0] << " [port]" << std::endl;
+			return -1;
+		}
+		port = static_cast<std::uint16_t>(value);
+	}
+
+	initOutput();
+
+	outputText(std::string("Using Avdecc Library v") + la::avdecc::getVersion() + " with compilation options:\n");
+	for (auto const& info : la::avdecc::getCompileOptionsInfo())
+	{
+		outputText(std::string(" - ") + info.longName + " (" + info.shortName + ")\n");
+	}
+	outputText("\n");
+
+	auto ret = doJob(port);
+	if (ret != 0)
+	{
+		outputText("\nTerminating with an error. Press any key to close\n");
+		getch();
+	}
+
+	deinitOutput();
+
+	return ret;
+}
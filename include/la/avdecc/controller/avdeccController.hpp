@@ -574,6 +574,10 @@ public:
 	virtual void enableEntityModelCache() noexcept = 0;
 	/** Disables the EntityModel cache */
 	virtual void disableEntityModelCache() noexcept = 0;
+	/** Enables the persistence of the EntityModel cache in the specified directory (created if needed): models are written when cached, and the ones already stored are loaded in the background (validated using their mandatory checksum, invalid files are removed). An entity whose model is not loaded yet is enumerated normally. Returns false if the directory cannot be used, or if the library was compiled without JSON support. */
+	virtual bool enableEntityModelCachePersistence(std::string const& directoryPath) noexcept = 0;
+	/** Disables the persistence of the EntityModel cache (already loaded models are kept in the cache) */
+	virtual void disableEntityModelCachePersistence() noexcept = 0;
 	/** Enables complete EntityModel (static part) enumeration. Depending on entities, it might take a much longer time to enumerate. */
 	virtual void enableFullStaticEntityModelEnumeration() noexcept = 0;
 	/** Disables complete EntityModel (static part) enumeration.*/
@@ -582,6 +586,18 @@ public:
 	virtual void enableFastEnumeration() noexcept = 0;
 	/** Disables fast enumeration */
 	virtual void disableFastEnumeration() noexcept = 0;
+	/** Enables lazy decoding of control values. Once an entity has been advertised, the control values it sends through unsolicited notifications are kept packed and only decoded (and validated) when the control is accessed, except for subscribed controls (see subscribeToControlValues) which are decoded right away. Only subscribed controls are notified through Observer::onControlValuesChanged, and diagnostics or compatibility changes detected when decoding are not notified. */
+	virtual void enableLazyControlValuesDecoding() noexcept = 0;
+	/** Disables lazy decoding of control values */
+	virtual void disableLazyControlValuesDecoding() noexcept = 0;
+	/** Subscribes to the values of the specified control (only meaningful when lazy decoding of control values is enabled). Values received but not decoded yet are decoded and notified right away. */
+	virtual void subscribeToControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex) noexcept = 0;
+	/** Unsubscribes from the values of the specified control */
+	virtual void unsubscribeFromControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex) noexcept = 0;
+	/** Sets the maximum count of entities being enumerated at the same time (0 (default) for no limit). Entities discovered while the limit is reached wait for another enumeration to complete, those with a cached EntityModel (see enableEntityModelCache) going first, then those declared with setPriorityEnumerations, then the others in discovery order. */
+	virtual void setMaximumConcurrentEnumerations(std::size_t const maximumConcurrentEnumerations) noexcept = 0;
+	/** Declares the entities to enumerate first when the maximum count of concurrent enumerations is reached, in decreasing order of priority. Only applies to entities discovered after the call. */
+	virtual void setPriorityEnumerations(std::vector<UniqueIdentifier> const& entityIDs) noexcept = 0;
 
 	/* All completion handlers are guaranteed to be called (eventually). */
 	/* Control commands. */
@@ -0,0 +1,263 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controllerCommandBatch.hpp
+* @author Christophe Calmejane
+* @brief Batch of AEM commands sent through a ControllerEntity, with a single completion handler.
+*/
+
+#pragma once
+
+#include "la/avdecc/utils.hpp"
+
+#include "controllerEntity.hpp"
+#include "uniqueIdentifier.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace entity
+{
+namespace controller
+{
+/**
+* @brief Queue of AEM commands (for one or more entities) sent together through a ControllerEntity, with a single completion handler.
+* @details Commands are added with the controller::Interface method to call and its arguments, the result handler being optional:
+*          batch.add(&controller::Interface::setStreamInputFormat, entityID, streamIndex, streamFormat);
+*          With the BestEffort policy, all commands are given to the ControllerEntity at once, so its CommandStateMachine keeps the inflight window full.
+*          With the StopOnFirstError policy, commands are sent one after the other in the order they were added, and the remaining ones are not sent once a command failed.
+*          The completion handler is called once, from the thread calling the result handlers, when all commands have completed (or have been skipped).
+* @note Only the commands whose result handler reports a LocalEntity::AemCommandStatus can be added. The controller must outlive all submitted batches.
+*/
+class CommandBatch final
+{
+public:
+	enum class ErrorPolicy
+	{
+		BestEffort = 0, /**< All commands are sent at once, whatever the result of the others */
+		StopOnFirstError = 1, /**< Commands are sent sequentially, the remaining ones being skipped after a failure */
+	};
+
+	struct Result
+	{
+		UniqueIdentifier targetEntityID{};
+		std::optional<LocalEntity::AemCommandStatus> status{ std::nullopt }; /** Not set if the command was skipped (StopOnFirstError policy, after a failed command) */
+	};
+	using Results = std::vector<Result>; /** In the order the commands were added */
+	using CompletionHandler = std::function<void(Results const& results)>;
+
+	/** Constructor */
+	explicit CommandBatch(Interface const& controller, ErrorPolicy const errorPolicy = ErrorPolicy::BestEffort) noexcept
+		: _controller{ controller }
+		, _errorPolicy{ errorPolicy }
+	{
+	}
+
+	/** Queues a command, method being the controller::Interface method to call for targetEntityID with the specified arguments (its result handler being optional) */
+	template<typename... MethodArgs, typename... Args>
+	CommandBatch& add(void (Interface::*const method)(UniqueIdentifier const, MethodArgs...) const noexcept, UniqueIdentifier const targetEntityID, Args&&... args)
+	{
+		static_assert(sizeof...(MethodArgs) != 0u, "Method has no result handler");
+		constexpr auto ArgumentsCount = sizeof...(MethodArgs) - 1u;
+		static_assert(sizeof...(Args) == ArgumentsCount || sizeof...(Args) == ArgumentsCount + 1u, "Arguments do not match the method parameters");
+		using Handler = std::decay_t<std::tuple_element_t<ArgumentsCount, std::tuple<MethodArgs...>>>;
+		using Arguments = typename FirstTypes<std::tuple<MethodArgs...>, std::make_index_sequence<ArgumentsCount>>::type;
+
+		auto forwardedArgs = std::forward_as_tuple(std::forward<Args>(args)...);
+		auto arguments = makeArguments<Arguments>(forwardedArgs, std::make_index_sequence<ArgumentsCount>{});
+		auto userHandler = Handler{};
+		if constexpr (sizeof...(Args) != ArgumentsCount)
+		{
+			userHandler = std::get<ArgumentsCount>(forwardedArgs);
+		}
+
+		_commands.push_back(Command{ targetEntityID,
+			[method, targetEntityID, arguments = std::move(arguments), userHandler = std::move(userHandler)](Interface const& controller, ResultHandler const& resultHandler)
+			{
+				auto const handler = Handler{ [userHandler, resultHandler](Interface const* const controllerInterface, UniqueIdentifier const entityID, LocalEntity::AemCommandStatus const status, auto const&... results)
+					{
+						utils::invokeProtectedHandler(userHandler, controllerInterface, entityID, status, results...);
+						resultHandler(status);
+					} };
+				std::apply(
+					[&controller, method, targetEntityID, &handler](auto const&... values)
+					{
+						(controller.*method)(targetEntityID, values..., handler);
+					},
+					arguments);
+			} });
+
+		return *this;
+	}
+
+	/** Returns the count of queued commands */
+	std::size_t size() const noexcept
+	{
+		return _commands.size();
+	}
+
+	/** Sends all queued commands (the batch is then empty and can be reused), completionHandler being called once all of them have completed */
+	void submit(CompletionHandler const& completionHandler)
+	{
+		auto const state = std::make_shared<State>(_controller, _errorPolicy, std::move(_commands), completionHandler);
+		_commands.clear();
+
+		state->results.reserve(state->commands.size());
+		for (auto const& command : state->commands)
+		{
+			state->results.push_back(Result{ command.targetEntityID, std::nullopt });
+		}
+
+		if (state->commands.empty())
+		{
+			utils::invokeProtectedHandler(state->completionHandler, state->results);
+			return;
+		}
+
+		if (_errorPolicy == ErrorPolicy::BestEffort)
+		{
+			for (auto index = std::size_t{ 0u }; index < state->commands.size(); ++index)
+			{
+				sendCommand(state, index);
+			}
+		}
+		else
+		{
+			sendCommand(state, 0u);
+		}
+	}
+
+	// Defaulted compiler auto-generated methods
+	CommandBatch(CommandBatch&&) = default;
+	CommandBatch(CommandBatch const&) = default;
+	CommandBatch& operator=(CommandBatch const&) = delete;
+	CommandBatch& operator=(CommandBatch&&) = delete;
+
+private:
+	using ResultHandler = std::function<void(LocalEntity::AemCommandStatus const status)>;
+
+	struct Command
+	{
+		UniqueIdentifier targetEntityID{};
+		std::function<void(Interface const& controller, ResultHandler const& resultHandler)> send{};
+	};
+	using Commands = std::vector<Command>;
+
+	/** Shared by the result handlers of a submitted batch */
+	struct State
+	{
+		State(Interface const& controllerInterface, ErrorPolicy const policy, Commands&& queuedCommands, CompletionHandler const& handler)
+			: controller{ controllerInterface }
+			, errorPolicy{ policy }
+			, commands{ std::move(queuedCommands) }
+			, completionHandler{ handler }
+		{
+		}
+
+		Interface const& controller;
+		ErrorPolicy const errorPolicy{ ErrorPolicy::BestEffort };
+		Commands const commands{};
+		CompletionHandler const completionHandler{};
+		std::mutex lock{};
+		Results results{};
+		std::size_t completedCount{ 0u };
+	};
+
+	/** Tuple of the decayed first types of a tuple */
+	template<typename Tuple, typename Indexes>
+	struct FirstTypes;
+	template<typename Tuple, std::size_t... Indexes>
+	struct FirstTypes<Tuple, std::index_sequence<Indexes...>>
+	{
+		using type = std::tuple<std::decay_t<std::tuple_element_t<Indexes, Tuple>>...>;
+	};
+
+	template<typename Arguments, typename ForwardedArgs, std::size_t... Indexes>
+	static Arguments makeArguments(ForwardedArgs& forwardedArgs, std::index_sequence<Indexes...>)
+	{
+		return Arguments(std::get<Indexes>(forwardedArgs)...);
+	}
+
+	static void sendCommand(std::shared_ptr<State> const& state, std::size_t const index)
+	{
+		state->commands[index].send(state->controller,
+			[state, index](LocalEntity::AemCommandStatus const status)
+			{
+				onCommandResult(state, index, status);
+			});
+	}
+
+	static void onCommandResult(std::shared_ptr<State> const& state, std::size_t const index, LocalEntity::AemCommandStatus const status)
+	{
+		auto isComplete = false;
+		auto nextIndex = std::optional<std::size_t>{};
+		{
+			auto const lg = std::lock_guard{ state->lock };
+			state->results[index].status = status;
+			++state->completedCount;
+
+			if (state->errorPolicy == ErrorPolicy::StopOnFirstError)
+			{
+				if (!!status && (index + 1u) < state->commands.size())
+				{
+					nextIndex = index + 1u;
+				}
+				else
+				{
+					isComplete = true;
+				}
+			}
+			else
+			{
+				isComplete = state->completedCount == state->commands.size();
+			}
+		}
+
+		if (nextIndex)
+		{
+			sendCommand(state, *nextIndex);
+		}
+		else if (isComplete)
+		{
+			// All results have been set, no need to lock anymore
+			utils::invokeProtectedHandler(state->completionHandler, state->results);
+		}
+	}
+
+	Interface const& _controller;
+	ErrorPolicy _errorPolicy{ ErrorPolicy::BestEffort };
+	Commands _commands{};
+};
+
+} // namespace controller
+} // namespace entity
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,787 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controllerCoroutines.hpp
+* @author Christophe Calmejane
+* @brief C++20 coroutines layer over the ControllerEntity commands (opt-in, the rest of the library only requires C++17).
+*/
+
+#pragma once
+
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#	error "controllerCoroutines.hpp requires C++20 coroutines support"
+#endif
+
+#include "la/avdecc/executor.hpp"
+#include "la/avdecc/utils.hpp"
+
+#include "controllerEntity.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace entity
+{
+namespace controller
+{
+namespace coroutine
+{
+/** Exception thrown when awaiting a command whose CancellationToken has been cancelled */
+class CancelledException final : public std::runtime_error
+{
+public:
+	CancelledException() noexcept
+		: std::runtime_error("Command cancelled")
+	{
+	}
+};
+
+/**
+* @brief Shared cancellation flag for one or more awaited commands.
+* @details Copies of a token share the same state. Cancelling it resumes all the commands currently awaited with it (they throw a CancelledException), and the ones awaited afterwards are not sent.
+*          The response of a cancelled command, if it ever comes, is ignored.
+*/
+class CancellationToken final
+{
+public:
+	using CallbackID = std::uint64_t;
+	using Callback = std::function<void()>;
+
+	/** Cancels the token, calling the registered callbacks (only the first call has any effect) */
+	void cancel() const noexcept
+	{
+		auto callbacks = Callbacks{};
+		{
+			auto const lg = std::lock_guard{ _state->lock };
+			if (_state->isCancelled)
+			{
+				return;
+			}
+			_state->isCancelled = true;
+			callbacks = std::move(_state->callbacks);
+			_state->callbacks.clear();
+		}
+		for (auto const& [callbackID, callback] : callbacks)
+		{
+			utils::invokeProtectedHandler(callback);
+		}
+	}
+
+	bool isCancelled() const noexcept
+	{
+		auto const lg = std::lock_guard{ _state->lock };
+		return _state->isCancelled;
+	}
+
+	/** Registers a callback called when the token is cancelled (immediately, from the calling thread, if it already is). Returns std::nullopt in that case */
+	std::optional<CallbackID> registerCallback(Callback const& callback) const noexcept
+	{
+		{
+			auto const lg = std::lock_guard{ _state->lock };
+			if (!_state->isCancelled)
+			{
+				auto const callbackID = _state->nextCallbackID++;
+				_state->callbacks.emplace(callbackID, callback);
+				return callbackID;
+			}
+		}
+		utils::invokeProtectedHandler(callback);
+		return std::nullopt;
+	}
+
+	void unregisterCallback(CallbackID const callbackID) const noexcept
+	{
+		auto const lg = std::lock_guard{ _state->lock };
+		_state->callbacks.erase(callbackID);
+	}
+
+private:
+	using Callbacks = std::unordered_map<CallbackID, Callback>;
+	struct State
+	{
+		std::mutex lock{};
+		bool isCancelled{ false };
+		CallbackID nextCallbackID{ 0u };
+		Callbacks callbacks{};
+	};
+	std::shared_ptr<State> _state{ std::make_shared<State>() };
+};
+
+/** Options of an awaited command */
+struct CommandOptions
+{
+	std::optional<std::chrono::milliseconds> timeout{ std::nullopt }; /** If the result handler has not been called after this delay, the awaited command resumes with a TimedOut status (in addition to the protocol timeouts handled by the ControllerEntity) */
+	std::optional<CancellationToken> cancellationToken{ std::nullopt };
+	std::string executorName{}; /** Name of the Executor (see ExecutorManager) to resume the awaiting coroutine on. If empty (or not registered), the coroutine resumes on the thread that completed the command (the ProtocolInterface executor for a response) */
+};
+
+/**
+* @brief Lazily started coroutine, returning a value of type T.
+* @details The coroutine starts when the Task is awaited (or given to syncWait or whenAll), and resumes its awaiter when it completes.
+*/
+template<typename T = void>
+class Task;
+
+namespace detail
+{
+/** Resumes a coroutine, on the specified Executor if it exists */
+inline void resumeOnExecutor(std::coroutine_handle<> const handle, std::string const& executorName) noexcept
+{
+	if (!executorName.empty())
+	{
+		auto& manager = ExecutorManager::getInstance();
+		if (manager.isExecutorRegistered(executorName))
+		{
+			manager.pushJob(executorName,
+				[handle]()
+				{
+					handle.resume();
+				});
+			return;
+		}
+	}
+	handle.resume();
+}
+
+/** Thread calling the scheduled callbacks once their deadline is reached (used for the command timeouts) */
+class TimeoutScheduler final
+{
+public:
+	using Callback = std::function<void()>;
+
+	static TimeoutScheduler& getInstance() noexcept
+	{
+		static auto s_Instance = TimeoutScheduler{};
+		return s_Instance;
+	}
+
+	void schedule(std::chrono::steady_clock::time_point const deadline, Callback&& callback) noexcept
+	{
+		{
+			auto const lg = std::lock_guard{ _lock };
+			_callbacks.emplace(deadline, std::move(callback));
+			if (!_thread.joinable())
+			{
+				_thread = std::thread(
+					[this]()
+					{
+						utils::setCurrentThreadName("avdecc::coroutine::TimeoutScheduler");
+						run();
+					});
+			}
+		}
+		_condition.notify_all();
+	}
+
+	~TimeoutScheduler() noexcept
+	{
+		{
+			auto const lg = std::lock_guard{ _lock };
+			_shouldTerminate = true;
+		}
+		_condition.notify_all();
+		if (_thread.joinable())
+		{
+			_thread.join();
+		}
+	}
+
+	// Deleted compiler auto-generated methods
+	TimeoutScheduler(TimeoutScheduler const&) = delete;
+	TimeoutScheduler(TimeoutScheduler&&) = delete;
+	TimeoutScheduler& operator=(TimeoutScheduler const&) = delete;
+	TimeoutScheduler& operator=(TimeoutScheduler&&) = delete;
+
+private:
+	TimeoutScheduler() noexcept = default;
+
+	void run() noexcept
+	{
+		auto lock = std::unique_lock{ _lock };
+		while (!_shouldTerminate)
+		{
+			if (_callbacks.empty())
+			{
+				_condition.wait(lock);
+				continue;
+			}
+
+			auto const it = _callbacks.begin();
+			if (std::chrono::steady_clock::now() < it->first)
+			{
+				_condition.wait_until(lock, it->first);
+				continue;
+			}
+
+			auto callback = std::move(it->second);
+			_callbacks.erase(it);
+			lock.unlock();
+			utils::invokeProtectedHandler(callback);
+			lock.lock();
+		}
+	}
+
+	std::mutex _lock{};
+	std::condition_variable _condition{};
+	std::multimap<std::chrono::steady_clock::time_point, Callback> _callbacks{};
+	std::thread _thread{};
+	bool _shouldTerminate{ false };
+};
+
+/** Result of an awaited command: the arguments of its result handler, except the controller::Interface pointer */
+template<typename Handler>
+struct HandlerTraits;
+template<typename Controller, typename... Results>
+struct HandlerTraits<std::function<void(Controller, Results...)>>
+{
+	using Result = std::tuple<std::decay_t<Results>...>;
+};
+
+template<typename T>
+constexpr bool IsCommandStatus = std::is_same_v<T, LocalEntity::AemCommandStatus> || std::is_same_v<T, LocalEntity::AaCommandStatus> || std::is_same_v<T, LocalEntity::MvuCommandStatus> || std::is_same_v<T, LocalEntity::ControlStatus>;
+
+/** Builds the result of a command that timed out: default values with the status set to TimedOut */
+template<typename Result>
+Result makeTimedOutResult() noexcept
+{
+	auto result = Result{};
+	std::apply(
+		[](auto&... values)
+		{
+			(
+				[](auto& value)
+				{
+					if constexpr (IsCommandStatus<std::decay_t<decltype(value)>>)
+					{
+						value = std::decay_t<decltype(value)>::TimedOut;
+					}
+				}(values),
+				...);
+		},
+		result);
+	return result;
+}
+
+/** Common part of the promise of a Task */
+class PromiseBase
+{
+public:
+	/** Resumes the awaiting coroutine (if any) when the Task completes */
+	struct FinalAwaiter
+	{
+		bool await_ready() const noexcept
+		{
+			return false;
+		}
+		template<typename Promise>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> const handle) noexcept
+		{
+			if (auto const continuation = handle.promise()._continuation)
+			{
+				return continuation;
+			}
+			return std::noop_coroutine();
+		}
+		void await_resume() const noexcept {}
+	};
+
+	std::suspend_always initial_suspend() const noexcept
+	{
+		return {};
+	}
+	FinalAwaiter final_suspend() const noexcept
+	{
+		return {};
+	}
+	void unhandled_exception() noexcept
+	{
+		_exception = std::current_exception();
+	}
+	void setContinuation(std::coroutine_handle<> const continuation) noexcept
+	{
+		_continuation = continuation;
+	}
+
+protected:
+	void rethrowIfException() const
+	{
+		if (_exception)
+		{
+			std::rethrow_exception(_exception);
+		}
+	}
+
+private:
+	std::coroutine_handle<> _continuation{};
+	std::exception_ptr _exception{};
+};
+
+template<typename T>
+class Promise final : public PromiseBase
+{
+public:
+	Task<T> get_return_object() noexcept;
+	template<typename Value>
+	void return_value(Value&& value)
+	{
+		_value.emplace(std::forward<Value>(value));
+	}
+	T getResult()
+	{
+		rethrowIfException();
+		return std::move(*_value);
+	}
+
+private:
+	std::optional<T> _value{ std::nullopt };
+};
+
+template<>
+class Promise<void> final : public PromiseBase
+{
+public:
+	Task<void> get_return_object() noexcept;
+	void return_void() const noexcept {}
+	void getResult() const
+	{
+		rethrowIfException();
+	}
+};
+
+/** Eagerly started coroutine destroying itself when complete, used to start Tasks from non-coroutine code */
+struct DetachedTask
+{
+	struct promise_type
+	{
+		DetachedTask get_return_object() const noexcept
+		{
+			return {};
+		}
+		std::suspend_never initial_suspend() const noexcept
+		{
+			return {};
+		}
+		std::suspend_never final_suspend() const noexcept
+		{
+			return {};
+		}
+		void return_void() const noexcept {}
+		void unhandled_exception() const noexcept
+		{
+			std::terminate();
+		}
+	};
+};
+
+/** State shared between an awaited command, its result handler, its timeout and its cancellation token */
+template<typename Result>
+struct CommandState
+{
+	std::atomic_bool isCompleted{ false };
+	std::mutex lock{}; /** Protects cancellationCallbackID */
+	std::coroutine_handle<> continuation{};
+	std::optional<Result> result{ std::nullopt };
+	bool isCancelled{ false };
+	std::string executorName{};
+	std::optional<CancellationToken> cancellationToken{ std::nullopt };
+	std::optional<CancellationToken::CallbackID> cancellationCallbackID{ std::nullopt };
+};
+
+/** State shared between whenAll and the Tasks it awaits */
+template<typename T>
+struct WhenAllState
+{
+	explicit WhenAllState(std::size_t const count) noexcept
+		: remaining{ count + 1u } // Released once all Tasks have been started
+		, results(count)
+	{
+	}
+
+	std::atomic_size_t remaining{ 0u };
+	std::coroutine_handle<> continuation{};
+	std::vector<std::optional<T>> results{};
+	std::mutex lock{};
+	std::exception_ptr exception{};
+};
+
+template<typename T>
+DetachedTask runWhenAllTask(Task<T> task, std::shared_ptr<WhenAllState<T>> state, std::size_t const index)
+{
+	try
+	{
+		state->results[index].emplace(co_await task);
+	}
+	catch (...)
+	{
+		auto const lg = std::lock_guard{ state->lock };
+		if (!state->exception)
+		{
+			state->exception = std::current_exception();
+		}
+	}
+	if (state->remaining.fetch_sub(1u) == 1u)
+	{
+		state->continuation.resume();
+	}
+}
+
+} // namespace detail
+
+template<typename T>
+class Task final
+{
+public:
+	using promise_type = detail::Promise<T>;
+	using Handle = std::coroutine_handle<promise_type>;
+
+	explicit Task(Handle const handle) noexcept
+		: _handle{ handle }
+	{
+	}
+
+	Task(Task&& other) noexcept
+		: _handle{ std::exchange(other._handle, {}) }
+	{
+	}
+
+	Task& operator=(Task&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (_handle)
+			{
+				_handle.destroy();
+			}
+			_handle = std::exchange(other._handle, {});
+		}
+		return *this;
+	}
+
+	~Task() noexcept
+	{
+		if (_handle)
+		{
+			_handle.destroy();
+		}
+	}
+
+	// Awaitable
+	bool await_ready() const noexcept
+	{
+		return !_handle || _handle.done();
+	}
+	std::coroutine_handle<> await_suspend(std::coroutine_handle<> const continuation) noexcept
+	{
+		_handle.promise().setContinuation(continuation);
+		return _handle;
+	}
+	T await_resume()
+	{
+		return _handle.promise().getResult();
+	}
+
+	// Deleted compiler auto-generated methods
+	Task(Task const&) = delete;
+	Task& operator=(Task const&) = delete;
+
+private:
+	Handle _handle{};
+};
+
+template<typename T>
+Task<T> detail::Promise<T>::get_return_object() noexcept
+{
+	return Task<T>{ Task<T>::Handle::from_promise(*this) };
+}
+
+inline Task<void> detail::Promise<void>::get_return_object() noexcept
+{
+	return Task<void>{ Task<void>::Handle::from_promise(*this) };
+}
+
+/**
+* @brief Awaitable sending a controller::Interface command, resuming with the arguments of its result handler (except the controller::Interface pointer).
+* @details Created with the command() functions, the command is sent when awaited:
+*          auto const [entityID, status, configurationIndex, ...] = co_await command(controller, &controller::Interface::getName, entityID, ...);
+*/
+template<typename Result>
+class CommandAwaitable final
+{
+public:
+	using Sender = std::function<void(std::function<void(Result&&)> const& resultHandler)>;
+
+	CommandAwaitable(Sender&& sender, CommandOptions&& options) noexcept
+		: _sender{ std::move(sender) }
+		, _options{ std::move(options) }
+	{
+	}
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void await_suspend(std::coroutine_handle<> const continuation)
+	{
+		// The command may complete (and the awaiting coroutine resume) as soon as the first of these is registered, so only local copies can be used past this point
+		auto const state = _state;
+		auto const sender = _sender;
+		auto const timeout = _options.timeout;
+		auto const cancellationToken = _options.cancellationToken;
+		state->continuation = continuation;
+		state->executorName = _options.executorName;
+		state->cancellationToken = cancellationToken;
+
+		if (cancellationToken)
+		{
+			auto const callbackID = cancellationToken->registerCallback(
+				[weakState = std::weak_ptr<State>{ state }]()
+				{
+					if (auto const s = weakState.lock())
+					{
+						complete(s, std::nullopt, true);
+					}
+				});
+			if (!callbackID)
+			{
+				// Already cancelled, do not send the command
+				return;
+			}
+			auto const lg = std::lock_guard{ state->lock };
+			state->cancellationCallbackID = callbackID;
+		}
+		if (timeout)
+		{
+			detail::TimeoutScheduler::getInstance().schedule(std::chrono::steady_clock::now() + *timeout,
+				[weakState = std::weak_ptr<State>{ state }]()
+				{
+					if (auto const s = weakState.lock())
+					{
+						complete(s, detail::makeTimedOutResult<Result>(), false);
+					}
+				});
+		}
+		sender(
+			[state](Result&& result)
+			{
+				complete(state, std::move(result), false);
+			});
+	}
+
+	Result await_resume()
+	{
+		if (_state->isCancelled)
+		{
+			throw CancelledException{};
+		}
+		return std::move(*_state->result);
+	}
+
+private:
+	using State = detail::CommandState<Result>;
+
+	/** Completes the command (only the first call has any effect, the other ones being a late response, timeout or cancellation) */
+	static void complete(std::shared_ptr<State> const& state, std::optional<Result>&& result, bool const isCancelled) noexcept
+	{
+		if (state->isCompleted.exchange(true))
+		{
+			return;
+		}
+		state->result = std::move(result);
+		state->isCancelled = isCancelled;
+		if (state->cancellationToken && !isCancelled)
+		{
+			// The result handler may be called from the ProtocolInterface thread while await_suspend is still registering the callback
+			auto const lg = std::lock_guard{ state->lock };
+			if (state->cancellationCallbackID)
+			{
+				state->cancellationToken->unregisterCallback(*state->cancellationCallbackID);
+			}
+		}
+		detail::resumeOnExecutor(state->continuation, state->executorName);
+	}
+
+	Sender _sender{};
+	CommandOptions _options{};
+	std::shared_ptr<State> _state{ std::make_shared<State>() };
+};
+
+/** Returns an awaitable sending the specified controller::Interface command (any AECP or ACMP command of the interface), with the specified arguments (without the result handler) */
+template<typename... MethodArgs, typename... Args>
+auto command(Interface const& controller, CommandOptions options, void (Interface::*const method)(MethodArgs...) const noexcept, Args&&... args)
+{
+	static_assert(sizeof...(MethodArgs) != 0u, "Method has no result handler");
+	constexpr auto ArgumentsCount = sizeof...(MethodArgs) - 1u;
+	static_assert(sizeof...(Args) == ArgumentsCount, "Arguments do not match the method parameters (the result handler must not be specified)");
+	using Handler = std::decay_t<std::tuple_element_t<ArgumentsCount, std::tuple<MethodArgs...>>>;
+	using Result = typename detail::HandlerTraits<Handler>::Result;
+
+	auto sender = typename CommandAwaitable<Result>::Sender{ [&controller, method, arguments = std::make_tuple(std::forward<Args>(args)...)](std::function<void(Result&&)> const& resultHandler)
+		{
+			auto const handler = Handler{ [resultHandler](Interface const* const, auto const&... results)
+				{
+					resultHandler(Result{ results... });
+				} };
+			std::apply(
+				[&controller, method, &handler](auto const&... values)
+				{
+					(controller.*method)(values..., handler);
+				},
+				arguments);
+		} };
+	return CommandAwaitable<Result>{ std::move(sender), std::move(options) };
+}
+
+/** Returns an awaitable sending the specified controller::Interface command with default CommandOptions */
+template<typename... MethodArgs, typename... Args>
+auto command(Interface const& controller, void (Interface::*const method)(MethodArgs...) const noexcept, Args&&... args)
+{
+	return command(controller, CommandOptions{}, method, std::forward<Args>(args)...);
+}
+
+/** Returns an awaitable resuming the awaiting coroutine on the specified Executor (see ExecutorManager), or immediately if it is not registered */
+inline auto resumeOn(std::string const& executorName) noexcept
+{
+	struct Awaitable
+	{
+		bool await_ready() const noexcept
+		{
+			return !ExecutorManager::getInstance().isExecutorRegistered(executorName);
+		}
+		void await_suspend(std::coroutine_handle<> const continuation) const noexcept
+		{
+			detail::resumeOnExecutor(continuation, executorName);
+		}
+		void await_resume() const noexcept {}
+
+		std::string executorName{};
+	};
+	return Awaitable{ executorName };
+}
+
+/**
+* @brief Runs all the Tasks concurrently (their commands are all inflight at once), and returns their results in the same order.
+* @details The awaiting coroutine resumes from the thread that completed the last Task. If some of the Tasks threw, the first exception is rethrown once all of them have completed.
+*/
+template<typename T>
+Task<std::vector<T>> whenAll(std::vector<Task<T>> tasks)
+{
+	static_assert(!std::is_void_v<T>, "whenAll requires Tasks returning a value");
+
+	auto const state = std::make_shared<detail::WhenAllState<T>>(tasks.size());
+
+	struct Awaitable
+	{
+		bool await_ready() const noexcept
+		{
+			return tasks.empty();
+		}
+		bool await_suspend(std::coroutine_handle<> const continuation) noexcept
+		{
+			state->continuation = continuation;
+			for (auto index = std::size_t{ 0u }; index < tasks.size(); ++index)
+			{
+				detail::runWhenAllTask(std::move(tasks[index]), state, index);
+			}
+			// Only suspend if some of the Tasks are still running
+			return state->remaining.fetch_sub(1u) != 1u;
+		}
+		void await_resume() const noexcept {}
+
+		std::vector<Task<T>>& tasks;
+		std::shared_ptr<detail::WhenAllState<T>> state{};
+	};
+	auto awaitable = Awaitable{ tasks, state }; // Not a temporary of the co_await expression, some compilers destroy those twice
+	co_await awaitable;
+
+	if (state->exception)
+	{
+		std::rethrow_exception(state->exception);
+	}
+
+	auto results = std::vector<T>{};
+	results.reserve(state->results.size());
+	for (auto& result : state->results)
+	{
+		results.push_back(std::move(*result));
+	}
+	co_return results;
+}
+
+/**
+* @brief Runs the Task from non-coroutine code, blocking the calling thread until it completes, and returns its result (or rethrows its exception).
+* @warning Must not be called from the thread resuming the Task (the ProtocolInterface executor, or the executor specified in CommandOptions), it would deadlock.
+*/
+template<typename T>
+T syncWait(Task<T> task)
+{
+	auto promise = std::promise<T>{};
+	auto future = promise.get_future();
+
+	[](Task<T>& t, std::promise<T>& p) -> detail::DetachedTask
+	{
+		try
+		{
+			if constexpr (std::is_void_v<T>)
+			{
+				co_await t;
+				p.set_value();
+			}
+			else
+			{
+				p.set_value(co_await t);
+			}
+		}
+		catch (...)
+		{
+			p.set_exception(std::current_exception());
+		}
+	}(task, promise);
+
+	return future.get();
+}
+
+} // namespace coroutine
+} // namespace controller
+} // namespace entity
+} // namespace avdecc
+} // namespace la
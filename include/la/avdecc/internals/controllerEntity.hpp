@@ -34,6 +34,7 @@
 #include "entityAddressAccessTypes.hpp"
 #include "exports.hpp"
 
+#include <any>
 #include <thread>
 #include <unordered_map>
 #include <string>
@@ -783,6 +784,10 @@ public:
 
 	/* Other methods */
 	virtual void setControllerDelegate(controller::Delegate* const delegate) noexcept = 0;
+	/** Notifies the entity that descriptors have been added to or removed from the EntityTree it was created with, so the descriptors served to remote controllers are rebuilt. Modified dynamic fields (names, formats, ...) are detected without calling this method. Does nothing by default. */
+	virtual void notifyEntityModelChanged() noexcept {}
+	/** Notifies the entity that the current values of a CONTROL (of the current configuration) of the EntityTree it was created with have been modified, so the controllers registered for unsolicited notifications are informed. Rapid changes of the same CONTROL are coalesced. Does nothing by default. */
+	virtual void notifyControlValuesChanged(model::ControlIndex const /*controlIndex*/) noexcept {}
 
 	// Deleted compiler auto-generated methods
 	ControllerEntity(ControllerEntity&&) = delete;
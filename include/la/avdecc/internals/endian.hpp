@@ -72,6 +72,7 @@
 #endif
 
 #include <climits>
+#include <cstddef>
 #include <cstdint>
 
 namespace la
@@ -21,7 +21,7 @@
 * @file entityModelControlValues.hpp
 * @author Christophe Calmejane
 * @brief Avdecc entity model control descriptor values.
-* @warning All structures have to be exported on unix-like systems (using LA_AVDECC_TYPE_INFO_EXPORT) so type_info is correctly visible outside the shared library (required for std::any_cast to work)
+* @note All structures are exported on unix-like systems (using LA_AVDECC_TYPE_INFO_EXPORT) so type_info is correctly visible outside the shared library.
 */
 
 #pragma once
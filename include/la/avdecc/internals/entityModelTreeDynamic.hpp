@@ -411,7 +411,7 @@ struct ConfigurationNodeDynamicModel
 	// Internal variables
 	StringsIndex selectedLocaleBaseIndex{ StringsIndex{ 0u } }; /** Base StringIndex for the selected locale */
 	StringsIndex selectedLocaleCountIndexes{ StringsIndex{ 0u } }; /** Count StringIndexes for the selected locale */
-	std::unordered_map<StringsIndex, AvdeccFixedString> localizedStrings{}; /** Aggregated copy of all loaded localized strings */
+	std::unordered_map<StringsIndex, InternedAvdeccFixedString> localizedStrings{}; /** Aggregated copy of all loaded localized strings (shared with all entities through the strings pool) */
 };
 
 struct EntityNodeDynamicModel
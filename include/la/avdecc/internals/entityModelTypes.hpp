@@ -30,8 +30,10 @@
 #include "uniqueIdentifier.hpp"
 #include "exports.hpp"
 
-#include <any>
 #include <cstdint>
+#include <cstddef> // max_align_t
+#include <new> // placement new / launder
+#include <type_traits>
 #include <string>
 #include <array>
 #include <vector>
@@ -39,8 +41,11 @@
 #include <iostream>
 #include <optional>
 #include <cstring> // std::memcpy
+#include <functional> // std::hash
+#include <typeinfo>
 #include <tuple>
 #include <bitset>
+#include <atomic>
 
 namespace la
 {
@@ -654,6 +659,78 @@ private:
 	std::array<value_type, MaxLength> _buffer{};
 };
 
+/**
+* @brief Handle to an AvdeccFixedString stored in a pool of unique strings.
+* @details The pool is shared by the whole process (all entities) and is thread safe.
+*          Identical strings share the same storage, so copying, comparing and hashing a handle never touches the string bytes.
+*          Pooled strings are reference counted, a string is removed from the pool when its last handle is destroyed.
+*/
+class LA_AVDECC_API InternedAvdeccFixedString final
+{
+public:
+	/** Hash functor to be used for std::hash */
+	struct hash
+	{
+		std::size_t operator()(InternedAvdeccFixedString const& str) const noexcept
+		{
+			return std::hash<PooledString const*>{}(str._pooledString);
+		}
+	};
+
+	/** Default constructor, refers to the empty string */
+	InternedAvdeccFixedString() noexcept;
+
+	/** Constructor from an AvdeccFixedString, adding it to the pool if not already present (may throw std::bad_alloc) */
+	explicit InternedAvdeccFixedString(AvdeccFixedString const& str);
+
+	/** Destructor, removes the string from the pool if this is its last handle */
+	~InternedAvdeccFixedString() noexcept;
+
+	/** Returns the pooled string */
+	AvdeccFixedString const& get() const noexcept
+	{
+		return _pooledString->str;
+	}
+
+	/** Returns the pooled string */
+	operator AvdeccFixedString const&() const noexcept
+	{
+		return _pooledString->str;
+	}
+
+	/** operator== (compares the handles only) */
+	bool operator==(InternedAvdeccFixedString const& other) const noexcept
+	{
+		return _pooledString == other._pooledString;
+	}
+
+	/** operator!= (compares the handles only) */
+	bool operator!=(InternedAvdeccFixedString const& other) const noexcept
+	{
+		return !operator==(other);
+	}
+
+	/** Returns the count of unique strings currently in the pool */
+	static std::size_t getPoolSize() noexcept;
+
+	// Compiler auto-generated methods (handles are reference counted)
+	InternedAvdeccFixedString(InternedAvdeccFixedString&& other) noexcept;
+	InternedAvdeccFixedString(InternedAvdeccFixedString const& other) noexcept;
+	InternedAvdeccFixedString& operator=(InternedAvdeccFixedString const& other) noexcept;
+	InternedAvdeccFixedString& operator=(InternedAvdeccFixedString&& other) noexcept;
+
+private:
+	/** A string of the pool, along with the count of handles referring to it */
+	struct PooledString
+	{
+		AvdeccFixedString str{};
+		std::atomic<std::uint32_t> refCount{ 0u };
+	};
+	friend class FixedStringsPool;
+
+	PooledString* _pooledString{ nullptr };
+};
+
 /** Sampling Rate - IEEE1722.1-2013 Clause 7.3.1 */
 class LA_AVDECC_API SamplingRate final
 {
@@ -1404,29 +1481,29 @@ public:
 	constexpr ControlValues() noexcept {}
 
 	template<class ValueDetailsType, typename Traits = control_value_details_traits<std::decay_t<ValueDetailsType>>, typename = std::enable_if_t<!std::is_same_v<std::decay_t<ValueDetailsType>, ControlValues>>>
-	explicit ControlValues(ValueDetailsType const& values) noexcept
+	explicit ControlValues(ValueDetailsType const& values)
 		: _isValid{ true }
 		, _type{ Traits::control_value_type }
 		, _areDynamic{ Traits::is_dynamic }
 		, _countMustBeIdentical{ Traits::static_dynamic_counts_identical ? *Traits::static_dynamic_counts_identical : false } // Check for optional presence delayed to body so we have a nicer message than with an enable_if template parameter
 		, _countValues{ values.countValues() }
-		, _values{ values }
 	{
 		static_assert(Traits::is_value_details, "ControlValues::ControlValues, control_value_details_traits::is_value_details trait not defined for requested ValueDetailsType. Did you include entityModelControlValuesTraits.hpp?");
 		static_assert(Traits::static_dynamic_counts_identical.has_value(), "ControlValues::ControlValues, control_value_details_traits::static_dynamic_counts_identical trait not defined for requested ValueDetailsType.");
+		constructValues<std::decay_t<ValueDetailsType>>(values);
 	}
 
 	template<class ValueDetailsType, typename Traits = control_value_details_traits<std::decay_t<ValueDetailsType>>, typename = std::enable_if_t<!std::is_same_v<std::decay_t<ValueDetailsType>, ControlValues>>>
-	explicit ControlValues(ValueDetailsType&& values) noexcept
+	explicit ControlValues(ValueDetailsType&& values)
 		: _isValid{ true }
 		, _type{ Traits::control_value_type }
 		, _areDynamic{ Traits::is_dynamic }
 		, _countMustBeIdentical{ Traits::static_dynamic_counts_identical ? *Traits::static_dynamic_counts_identical : false } // Check for optional presence delayed to body so we have a nicer message than with an enable_if template parameter
-		, _countValues{ values.countValues() } // Careful with order here, we are moving 'values'
-		, _values{ std::forward<ValueDetailsType>(values) }
+		, _countValues{ values.countValues() }
 	{
 		static_assert(Traits::is_value_details, "ControlValues::ControlValues, control_value_details_traits::is_value_details trait not defined for requested ValueDetailsType. Did you include entityModelControlValuesTraits.hpp?");
 		static_assert(Traits::static_dynamic_counts_identical.has_value(), "ControlValues::ControlValues, control_value_details_traits::static_dynamic_counts_identical trait not defined for requested ValueDetailsType.");
+		constructValues<std::decay_t<ValueDetailsType>>(std::forward<ValueDetailsType>(values)); // Careful with order here, we are moving 'values'
 	}
 
 	constexpr ControlValueType::Type getType() const noexcept
@@ -1472,20 +1549,7 @@ public:
 	template<class ValueDetailsType, typename Traits = control_value_details_traits<std::decay_t<ValueDetailsType>>>
 	std::decay_t<ValueDetailsType> getValues() const
 	{
-		static_assert(Traits::is_value_details, "ControlValues::getValues, control_value_details_traits::is_value_details trait not defined for requested ValueDetailsType. Did you include entityModelControlValuesTraits.hpp?");
-		if (!isValid())
-		{
-			throw std::invalid_argument("ControlValues::getValues, no valid values to get");
-		}
-		if (_type != Traits::control_value_type)
-		{
-			throw std::invalid_argument("ControlValues::getValues, incorrect ControlValueType::Type");
-		}
-		if (_areDynamic != Traits::is_dynamic)
-		{
-			throw std::invalid_argument("ControlValues::getValues, static/dynamic mismatch");
-		}
-		return std::any_cast<std::decay_t<ValueDetailsType>>(_values);
+		return getValuesReference<ValueDetailsType>();
 	}
 
 	// Comparison operators
@@ -1509,22 +1573,225 @@ public:
 			return false;
 		}
 		// Now compare the actual values
-		return getValues<ValueDetailsType>() == other.getValues<ValueDetailsType>();
+		return getValuesReference<ValueDetailsType>() == other.getValuesReference<ValueDetailsType>();
 	}
 
-	// Defaulted compiler auto-generated methods
-	ControlValues(ControlValues const&) = default;
-	ControlValues(ControlValues&&) = default;
-	ControlValues& operator=(ControlValues const&) = default;
-	ControlValues& operator=(ControlValues&&) = default;
+	~ControlValues() noexcept
+	{
+		destroyValues();
+	}
+
+	ControlValues(ControlValues const& other)
+		: _isValid{ other._isValid }
+		, _type{ other._type }
+		, _areDynamic{ other._areDynamic }
+		, _countMustBeIdentical{ other._countMustBeIdentical }
+		, _countValues{ other._countValues }
+	{
+		if (other._operations != nullptr)
+		{
+			other._operations->copyConstruct(_storage.data(), other._storage.data());
+			_operations = other._operations;
+		}
+	}
+
+	ControlValues(ControlValues&& other) noexcept
+		: _isValid{ other._isValid }
+		, _type{ other._type }
+		, _areDynamic{ other._areDynamic }
+		, _countMustBeIdentical{ other._countMustBeIdentical }
+		, _countValues{ other._countValues }
+	{
+		moveValuesFrom(other);
+	}
+
+	ControlValues& operator=(ControlValues const& other)
+	{
+		if (this != &other)
+		{
+			// Same ValueDetailsType: assign in place, reusing already allocated memory
+			if (_operations != nullptr && _operations == other._operations)
+			{
+				_operations->copyAssign(_storage.data(), other._storage.data());
+			}
+			else
+			{
+				destroyValues();
+				if (other._operations != nullptr)
+				{
+					other._operations->copyConstruct(_storage.data(), other._storage.data());
+					_operations = other._operations;
+				}
+			}
+			_isValid = other._isValid;
+			_type = other._type;
+			_areDynamic = other._areDynamic;
+			_countMustBeIdentical = other._countMustBeIdentical;
+			_countValues = other._countValues;
+		}
+		return *this;
+	}
+
+	ControlValues& operator=(ControlValues&& other) noexcept
+	{
+		if (this != &other)
+		{
+			destroyValues();
+			moveValuesFrom(other);
+			_isValid = other._isValid;
+			_type = other._type;
+			_areDynamic = other._areDynamic;
+			_countMustBeIdentical = other._countMustBeIdentical;
+			_countValues = other._countValues;
+		}
+		return *this;
+	}
 
 private:
+	/** Size of the inline storage, large enough for all ValueDetails types but UTF8StringValueDynamic (which is stored on the heap) */
+	static constexpr std::size_t InlineStorageSize = 48u;
+
+	/** Type-specific operations on the stored ValueDetails, one static instance per ValueDetails type */
+	struct StorageOperations
+	{
+		void (*copyConstruct)(void* const destination, void const* const source);
+		void (*copyAssign)(void* const destination, void const* const source);
+		void (*moveConstruct)(void* const destination, void* const source) noexcept; // Source still has to be destroyed
+		void (*destroy)(void* const storage) noexcept;
+		std::size_t typeHash; // typeid hash_code of the stored ValueDetails type
+	};
+
+	template<typename ValueDetailsType>
+	static constexpr bool isStoredInline() noexcept
+	{
+		return sizeof(ValueDetailsType) <= InlineStorageSize && alignof(ValueDetailsType) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<ValueDetailsType>;
+	}
+
+	template<typename ValueDetailsType>
+	static StorageOperations const* getStorageOperations() noexcept
+	{
+		if constexpr (isStoredInline<ValueDetailsType>())
+		{
+			static auto const s_Operations = StorageOperations{
+				[](void* const destination, void const* const source)
+				{
+					new (destination) ValueDetailsType{ *static_cast<ValueDetailsType const*>(source) };
+				},
+				[](void* const destination, void const* const source)
+				{
+					*std::launder(static_cast<ValueDetailsType*>(destination)) = *std::launder(static_cast<ValueDetailsType const*>(source));
+				},
+				[](void* const destination, void* const source) noexcept
+				{
+					new (destination) ValueDetailsType{ std::move(*std::launder(static_cast<ValueDetailsType*>(source))) };
+				},
+				[](void* const storage) noexcept
+				{
+					std::launder(static_cast<ValueDetailsType*>(storage))->~ValueDetailsType();
+				},
+				typeid(ValueDetailsType).hash_code(),
+			};
+			return &s_Operations;
+		}
+		else
+		{
+			// Storage holds a pointer to the heap allocated ValueDetails
+			static auto const s_Operations = StorageOperations{
+				[](void* const destination, void const* const source)
+				{
+					*static_cast<ValueDetailsType**>(destination) = new ValueDetailsType{ **static_cast<ValueDetailsType* const*>(source) };
+				},
+				[](void* const destination, void const* const source)
+				{
+					**static_cast<ValueDetailsType**>(destination) = **static_cast<ValueDetailsType* const*>(source);
+				},
+				[](void* const destination, void* const source) noexcept
+				{
+					*static_cast<ValueDetailsType**>(destination) = *static_cast<ValueDetailsType**>(source);
+					*static_cast<ValueDetailsType**>(source) = nullptr;
+				},
+				[](void* const storage) noexcept
+				{
+					delete *static_cast<ValueDetailsType**>(storage);
+				},
+				typeid(ValueDetailsType).hash_code(),
+			};
+			return &s_Operations;
+		}
+	}
+
+	template<typename ValueDetailsType, typename ValuesType>
+	void constructValues(ValuesType&& values)
+	{
+		if constexpr (isStoredInline<ValueDetailsType>())
+		{
+			new (_storage.data()) ValueDetailsType{ std::forward<ValuesType>(values) };
+		}
+		else
+		{
+			new (_storage.data()) ValueDetailsType*{ new ValueDetailsType{ std::forward<ValuesType>(values) } };
+		}
+		_operations = getStorageOperations<ValueDetailsType>();
+	}
+
+	void moveValuesFrom(ControlValues& other) noexcept
+	{
+		if (other._operations != nullptr)
+		{
+			other._operations->moveConstruct(_storage.data(), other._storage.data());
+			other._operations->destroy(other._storage.data());
+			_operations = other._operations;
+			other._operations = nullptr;
+		}
+	}
+
+	void destroyValues() noexcept
+	{
+		if (_operations != nullptr)
+		{
+			_operations->destroy(_storage.data());
+			_operations = nullptr;
+		}
+	}
+
+	template<class ValueDetailsType, typename Traits = control_value_details_traits<std::decay_t<ValueDetailsType>>>
+	std::decay_t<ValueDetailsType> const& getValuesReference() const
+	{
+		using Type = std::decay_t<ValueDetailsType>;
+		static_assert(Traits::is_value_details, "ControlValues::getValues, control_value_details_traits::is_value_details trait not defined for requested ValueDetailsType. Did you include entityModelControlValuesTraits.hpp?");
+		if (!isValid() || _operations == nullptr)
+		{
+			throw std::invalid_argument("ControlValues::getValues, no valid values to get");
+		}
+		if (_type != Traits::control_value_type)
+		{
+			throw std::invalid_argument("ControlValues::getValues, incorrect ControlValueType::Type");
+		}
+		if (_areDynamic != Traits::is_dynamic)
+		{
+			throw std::invalid_argument("ControlValues::getValues, static/dynamic mismatch");
+		}
+		if (_operations->typeHash != typeid(Type).hash_code())
+		{
+			throw std::invalid_argument("ControlValues::getValues, incorrect ValueDetails type");
+		}
+		if constexpr (isStoredInline<Type>())
+		{
+			return *std::launder(reinterpret_cast<Type const*>(_storage.data()));
+		}
+		else
+		{
+			return **std::launder(reinterpret_cast<Type* const*>(_storage.data()));
+		}
+	}
+
 	bool _isValid{ false };
 	ControlValueType::Type _type{};
 	bool _areDynamic{ false };
 	bool _countMustBeIdentical{ false };
 	std::uint16_t _countValues{ 0u };
-	std::any _values{};
+	StorageOperations const* _operations{ nullptr };
+	alignas(std::max_align_t) std::array<std::uint8_t, InlineStorageSize> _storage{};
 };
 
 /** Stream Identification (EntityID/StreamIndex couple) */
@@ -80,21 +80,23 @@ public:
 	LA_AVDECC_API bool LA_AVDECC_CALL_CONVENTION getUnsolicited() const noexcept;
 	LA_AVDECC_API AemCommandType LA_AVDECC_CALL_CONVENTION getCommandType() const noexcept;
 	LA_AVDECC_API Payload LA_AVDECC_CALL_CONVENTION getPayload() const noexcept;
+	/** Returns true if the payload references the buffer it was deserialized from (see DeserializationBuffer::setBorrowingAllowed), in which case it is only valid as long as that buffer */
+	LA_AVDECC_API bool LA_AVDECC_CALL_CONVENTION isPayloadBorrowed() const noexcept;
 
 	/** Serialization method */
 	virtual LA_AVDECC_API void LA_AVDECC_CALL_CONVENTION serialize(SerializationBuffer& buffer) const override;
 
-	/** Deserialization method */
+	/** Deserialization method. If the buffer allows it, the payload is not copied but references the buffer */
 	virtual LA_AVDECC_API void LA_AVDECC_CALL_CONVENTION deserialize(DeserializationBuffer& buffer) override;
 
 	/** Contruct a Response message to this Command (only changing the messageType to be of Response kind). Returns nullptr if the message is not a Command or if no Response is possible for this messageType */
 	virtual LA_AVDECC_API UniquePointer LA_AVDECC_CALL_CONVENTION responseCopy() const override;
 
-	// Defaulted compiler auto-generated methods
-	AemAecpdu(AemAecpdu&&) = default;
-	AemAecpdu(AemAecpdu const&) = default;
-	AemAecpdu& operator=(AemAecpdu const&) = default;
-	AemAecpdu& operator=(AemAecpdu&&) = default;
+	// Compiler auto-generated methods (copies always own their payload)
+	LA_AVDECC_API AemAecpdu(AemAecpdu&&);
+	LA_AVDECC_API AemAecpdu(AemAecpdu const&);
+	LA_AVDECC_API AemAecpdu& LA_AVDECC_CALL_CONVENTION operator=(AemAecpdu const&);
+	LA_AVDECC_API AemAecpdu& LA_AVDECC_CALL_CONVENTION operator=(AemAecpdu&&);
 
 private:
 	/** Entry point */
@@ -108,6 +110,7 @@ private:
 	AemCommandType _commandType{ AemCommandType::InvalidCommandType };
 	std::array<std::uint8_t, MaximumPayloadBufferLength> _commandSpecificData{};
 	size_t _commandSpecificDataLength{ 0u };
+	std::uint8_t const* _borrowedCommandSpecificData{ nullptr }; /** Payload referencing the deserialization buffer, if any */
 };
 
 } // namespace protocol
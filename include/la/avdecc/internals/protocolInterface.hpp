@@ -68,6 +68,7 @@ public:
 		Virtual = 1u << 3, /**< Virtual protocol interface. */
 		Serial = 1u << 4, /**< Serial port protocol interface. */
 		Local = 1u << 5, /**< Local domain socket protocol interface. */
+		Replay = 1u << 6, /**< Capture file (pcap/pcapng) replay protocol interface. */
 	};
 
 	/** Possible Error status returned (or thrown) by a ProtocolInterface */
@@ -112,6 +113,31 @@ public:
 	using AecpCommandResultHandler = std::function<void(la::avdecc::protocol::Aecpdu const* const response, la::avdecc::protocol::ProtocolInterface::Error const error)>;
 	using AcmpCommandResultHandler = std::function<void(la::avdecc::protocol::Acmpdu const* const response, la::avdecc::protocol::ProtocolInterface::Error const error)>;
 
+	/** Direction of a recorded frame */
+	enum class FrameDirection
+	{
+		Inbound = 1, /**< Frame received by the ProtocolInterface. */
+		Outbound = 2, /**< Frame sent by the ProtocolInterface. */
+	};
+
+	/** Frame recorder configuration */
+	struct FrameRecorderConfiguration
+	{
+		std::size_t ringSize{ 1024u }; /**< Number of frames that can be pending before new frames are dropped (rounded up to the next power of 2). */
+		std::size_t snapLength{ 1522u }; /**< Maximum number of bytes recorded for each frame, longer frames are truncated. */
+		std::uint64_t maxFileSize{ 64u * 1024u * 1024u }; /**< Size (in bytes) after which the file is rotated. 0 to disable rotation. */
+		std::size_t maxFiles{ 4u }; /**< Number of files kept when rotating, including the current one (older files are named 'name.N.ext'). */
+	};
+
+	/** Frame recorder statistics */
+	struct FrameRecorderStatistics
+	{
+		std::uint64_t recordedFrames{ 0u }; /**< Number of frames written to disk. */
+		std::uint64_t droppedFrames{ 0u }; /**< Number of frames dropped because the writer could not keep up (or a write error occured). */
+		std::uint64_t writtenBytes{ 0u }; /**< Number of bytes written to disk, all files included. */
+		std::uint32_t rotations{ 0u }; /**< Number of times the file has been rotated. */
+	};
+
 	/** Interface definition for ProtocolInterface events observation */
 	class Observer : public la::avdecc::utils::Observer<ProtocolInterface>
 	{
@@ -235,6 +261,24 @@ public:
 		return UniquePointer(createRawProtocolInterface(protocolInterfaceType, networkInterfaceID, executorName), deleter);
 	}
 
+	/**
+	* @brief Factory method to create a new composite ProtocolInterface, aggregating several ProtocolInterfaces.
+	* @details Creates a new ProtocolInterface as a unique pointer, taking ownership of the specified ProtocolInterfaces (for example the primary and secondary interfaces of a redundant network).
+	*          The composite ProtocolInterface uses the MacAddress of the first (primary) interface. ADP and ACMP messages are sent on all interfaces and are only processed once when received on several of them.
+	*          AECP messages are sent on the interface the destination was last seen on, so responses are routed back on the interface the command arrived on.
+	* @param[in] protocolInterfaces The ProtocolInterfaces to aggregate. They must all support direct messages and use the same executor.
+	* @return A new ProtocolInterface as a ProtocolInterface::UniquePointer.
+	* @note Might throw an Exception.
+	*/
+	static UniquePointer createComposite(std::vector<UniquePointer>&& protocolInterfaces)
+	{
+		auto deleter = [](ProtocolInterface* self)
+		{
+			self->destroy();
+		};
+		return UniquePointer(createRawCompositeProtocolInterface(std::move(protocolInterfaces)), deleter);
+	}
+
 	/* ************************************************************ */
 	/* General entry points                                         */
 	/* ************************************************************ */
@@ -303,6 +347,23 @@ public:
 	/** Sends an ACMP response message. Only registered LocalEntities are allowed to call this method. */
 	virtual Error sendAcmpResponse(Acmpdu::UniquePointer&& acmpdu) const noexcept = 0;
 
+	/* ************************************************************ */
+	/* Frame recording entry points                                 */
+	/* ************************************************************ */
+	/**
+	* @brief Starts recording all raw frames sent and received by this ProtocolInterface into a pcapng file.
+	* @details Frames are copied into a bounded ring and written to disk by a background thread. If the writer cannot keep up, frames are dropped (never blocking the network threads).
+	*          Any previously started recording is stopped first.
+	* @param[in] filePath The pcapng file to create (UTF-8 encoded).
+	* @param[in] configuration The recorder configuration.
+	* @return Error::InvalidParameters if the configuration is invalid or the file cannot be created.
+	*/
+	LA_AVDECC_API Error LA_AVDECC_CALL_CONVENTION startFrameRecording(std::string const& filePath, FrameRecorderConfiguration const& configuration) noexcept;
+	/** Stops the current recording (if any) after all pending frames have been written to disk, and returns the final statistics. */
+	LA_AVDECC_API FrameRecorderStatistics LA_AVDECC_CALL_CONVENTION stopFrameRecording() noexcept;
+	/** Returns the statistics of the current recording (or default values if not recording). */
+	LA_AVDECC_API FrameRecorderStatistics LA_AVDECC_CALL_CONVENTION getFrameRecorderStatistics() const noexcept;
+
 	/* ************************************************************ */
 	/* Misc entry points                                            */
 	/* ************************************************************ */
@@ -354,6 +415,9 @@ protected:
 	/** Returns true is the specified AecpMessageType is a Response kind, false if it's a Command kind. */
 	static bool isAecpResponseMessageType(AecpMessageType const messageType) noexcept;
 
+	/** Generates a dynamic EntityID from the MAC address of the interface and a random 16-bit value (never 0x0000 nor 0xFFFF). */
+	UniqueIdentifier generateDynamicEID() const noexcept;
+
 	/** Returns the Command Timeout (in msec) for the specified VendorUnique ProtocolIdentifier and VuAecpdu. */
 	std::uint32_t getVendorUniqueCommandTimeout(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept;
 
@@ -366,11 +430,31 @@ protected:
 	/** Returns the VendorUniqueDelegate handling the specified protocolIdentifier, or nullptr if none has been registered. WARNING: Once returned, the pointed object is NOT locked. */
 	VendorUniqueDelegate* getVendorUniqueDelegate(VuAecpdu::ProtocolIdentifier const& protocolIdentifier) const noexcept;
 
+	/** Returns true if frames are currently being recorded. Cheap check for the hot path. */
+	bool isRecordingFrames() const noexcept;
+
+	/** Forwards a raw Ethernet frame to the frame recorder (if recording). */
+	void recordFrame(FrameDirection const direction, std::uint8_t const* const frame, std::size_t const frameSize) const noexcept
+	{
+		if (isRecordingFrames())
+		{
+			recordFrame(direction, frame, frameSize, nullptr, 0u);
+		}
+	}
+
+	/** Forwards a raw Ethernet frame, made of a separate header and payload, to the frame recorder (if recording). */
+	void recordFrame(FrameDirection const direction, std::uint8_t const* const header, std::size_t const headerSize, std::uint8_t const* const payload, std::size_t const payloadSize) const noexcept;
+
+	/** Forwards a raw AVTPDU to the frame recorder (if recording), prefixed with an Ethernet header built from etherLayer2. For ProtocolInterfaces not transporting the Ethernet header. */
+	void recordFrame(FrameDirection const direction, EtherLayer2 const& etherLayer2, std::uint8_t const* const avtpdu, std::size_t const avtpduSize) const noexcept;
+
 	std::string const _networkInterfaceID{};
 
 private:
 	/** Entry point */
 	static LA_AVDECC_API ProtocolInterface* LA_AVDECC_CALL_CONVENTION createRawProtocolInterface(Type const protocolInterfaceType, std::string const& networkInterfaceID, std::string const& executorName);
+	/** Composite entry point */
+	static LA_AVDECC_API ProtocolInterface* LA_AVDECC_CALL_CONVENTION createRawCompositeProtocolInterface(std::vector<UniquePointer>&& protocolInterfaces);
 
 	/** Destroy method for COM-like interface */
 	virtual void destroy() noexcept = 0;
@@ -378,6 +462,8 @@ private:
 	networkInterface::MacAddress _networkInterfaceMacAddress{};
 	std::unordered_map<VuAecpdu::ProtocolIdentifier, VendorUniqueDelegate*, VuAecpdu::ProtocolIdentifier::hash> _vendorUniqueDelegates{};
 	std::string _executorName{};
+	struct FrameRecording;
+	std::shared_ptr<FrameRecording> _frameRecording{}; // Opaque frame recording state, defined in the library (shared_ptr so the type can remain incomplete here)
 };
 
 /* Operator overloads */
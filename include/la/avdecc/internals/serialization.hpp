@@ -214,6 +214,23 @@ public:
 		return *this;
 	}
 
+	/** Returns a pointer to the next size bytes of the buffer and advances the position, so that the caller can write them in place */
+	std::uint8_t* reserveBuffer(size_t const size)
+	{
+		// Check enough room in buffer
+		if (remaining() < size)
+		{
+			throw std::invalid_argument("Not enough room to serialize");
+		}
+
+		auto* const ptr = _buffer.data() + _pos;
+
+		// Advance data pointer
+		_pos += size;
+
+		return ptr;
+	}
+
 	/** Append a serializer to this one (without changing endianess) */
 	template<size_t OtherMaximumSize>
 	Serializer& operator+=(Serializer<OtherMaximumSize> const& other)
@@ -462,6 +479,34 @@ public:
 		return static_cast<std::uint8_t const*>(_ptr) + _pos;
 	}
 
+	/** Returns a pointer to the next size bytes of the buffer and advances the position, without copying the data */
+	void const* borrowBuffer(size_t const size)
+	{
+		// Check enough remaining data in buffer
+		if (remaining() < size)
+		{
+			throw std::invalid_argument("Not enough data to deserialize");
+		}
+
+		auto const* const ptr = currentData();
+
+		// Advance data pointer
+		_pos += size;
+
+		return ptr;
+	}
+
+	/** Allows objects deserialized from this buffer to reference (borrow) its data instead of copying it. Only enable this if the underlying memory outlives the deserialized objects (copies of the objects always own their data). */
+	void setBorrowingAllowed(bool const allowed) noexcept
+	{
+		_borrowingAllowed = allowed;
+	}
+
+	bool isBorrowingAllowed() const noexcept
+	{
+		return _borrowingAllowed;
+	}
+
 	bool operator==(Deserializer const& other) const
 	{
 		return _ptr == other._ptr && _pos == other._pos && _size == other._size;
@@ -475,6 +520,7 @@ private:
 	size_t _pos{ 0 };
 	void const* _ptr{ nullptr };
 	size_t _size{ 0 };
+	bool _borrowingAllowed{ false };
 };
 
 } // namespace avdecc
@@ -136,6 +136,7 @@ enum avdecc_protocol_interface_type_e
 	avdecc_protocol_interface_type_virtual = 1u << 3, /**< Virtual protocol interface. */
 	avdecc_protocol_interface_type_serial = 1u << 4, /**< Serial port protocol interface. */
 	avdecc_protocol_interface_type_local = 1u << 5, /**< Local domain socket protocol interface. */
+	avdecc_protocol_interface_type_replay = 1u << 6, /**< Capture file (pcap/pcapng) replay protocol interface. */
 };
 
 /** Valid values for avdecc_protocol_interface_error_t */
@@ -42,7 +42,14 @@
 #include <stdexcept> // out_of_range / invalid_argument / logic_error
 #include <set>
 #include <vector>
+#include <array>
+#include <initializer_list>
 #include <mutex>
+#include <new> // bad_alloc / bad_array_new_length
+#include <cstddef> // max_align_t
+#include <cstdint>
+#include <algorithm> // clamp
+#include <utility> // pair
 
 #if !defined(__GNUC__) || __GNUC__ >= 10 /* <version> is not present in earier versions of gcc (not sure which version exactly, using 10 here) */
 #	include <version>
@@ -1099,6 +1106,587 @@ private:
 	value_type _value{};
 };
 
+/**
+* @brief Dense dispatch table of plain function pointers, indexed by an integral key (usually the value of a TypedDefine).
+* @details Lookup is a bounds check followed by an array access. Keys outside of the table or without a registered handler return nullptr, leaving the caller to handle unknown values.
+*          Handlers are typically specified as captureless lambdas, which implicitly convert to the function pointer type.
+*/
+template<typename Signature, std::size_t Size, typename = std::enable_if_t<std::is_function_v<Signature>>>
+class DispatchTable final
+{
+public:
+	using key_type = std::size_t;
+	using handler_type = Signature*;
+
+	struct Entry
+	{
+		key_type key{ 0u };
+		handler_type handler{ nullptr };
+	};
+
+	/** Builds the table from a list of {key, handler} entries. Throws std::out_of_range if a key does not fit in the table, or std::invalid_argument if a key is registered twice. */
+	constexpr DispatchTable(std::initializer_list<Entry> const entries)
+	{
+		for (auto const& entry : entries)
+		{
+			if (entry.key >= Size)
+			{
+				throw std::out_of_range("DispatchTable key out of range");
+			}
+			if (_handlers[entry.key] != nullptr)
+			{
+				throw std::invalid_argument("DispatchTable key already registered");
+			}
+			_handlers[entry.key] = entry.handler;
+		}
+	}
+
+	/** Returns the handler registered for the specified key, or nullptr if there is none */
+	constexpr handler_type find(key_type const key) const noexcept
+	{
+		if (key < Size)
+		{
+			return _handlers[key];
+		}
+		return nullptr;
+	}
+
+	static constexpr std::size_t size() noexcept
+	{
+		return Size;
+	}
+
+	// Defaulted compiler auto-generated methods
+	constexpr DispatchTable(DispatchTable&&) = default;
+	constexpr DispatchTable(DispatchTable const&) = default;
+	constexpr DispatchTable& operator=(DispatchTable const&) = default;
+	constexpr DispatchTable& operator=(DispatchTable&&) = default;
+
+private:
+	std::array<handler_type, Size> _handlers{};
+};
+
+/**
+* @brief Memory arena for small node-based containers that are filled and emptied many times during the life of their owner.
+* @details Chunks are carved from blocks of blockSize bytes. Freed chunks up to a quarter of a block are kept in per size class free lists and reused by the next allocations of the same class.
+*          Size classes are exact (aligned) sizes up to MaxExactClassSize bytes, then powers of 2 (bucket arrays of hashed containers being reallocated with varying sizes). Chunks bigger than a quarter of a block are directly allocated from the heap.
+*          An initial buffer can be provided (usually stored next to the arena), which is used before any block is allocated.
+*          All blocks are released at once when the arena is destroyed (or by releaseIfUnused), so it must outlive all the containers using it. This class is not thread safe.
+*/
+class MemoryArena final
+{
+public:
+	static constexpr std::size_t Alignment = alignof(std::max_align_t);
+	static constexpr std::size_t DefaultBlockSize = 4096u;
+	static constexpr std::size_t MaxExactClassSize = 256u;
+	static constexpr std::size_t MaxBlockSize = 1024u * 1024u;
+
+	explicit MemoryArena(std::size_t const blockSize = DefaultBlockSize) noexcept
+		: _blockSize{ roundUp(std::clamp(blockSize, 4 * MaxExactClassSize, MaxBlockSize)) }
+	{
+	}
+
+	/** Constructs an arena first allocating from initialBuffer, which must outlive the arena */
+	MemoryArena(void* const initialBuffer, std::size_t const initialBufferSize, std::size_t const blockSize = DefaultBlockSize) noexcept
+		: MemoryArena{ blockSize }
+	{
+		auto const address = reinterpret_cast<std::uintptr_t>(initialBuffer);
+		auto const padding = static_cast<std::size_t>(roundUp(address) - address);
+		if (initialBuffer != nullptr && initialBufferSize > padding)
+		{
+			_initialBuffer = static_cast<std::uint8_t*>(initialBuffer) + padding;
+			_initialBufferSize = (initialBufferSize - padding) & ~(Alignment - 1);
+			_current = _initialBuffer;
+			_remaining = _initialBufferSize;
+		}
+	}
+
+	~MemoryArena() noexcept
+	{
+		freeBlocks();
+	}
+
+	/** Returns a chunk of at least size bytes, aligned on Alignment. Throws std::bad_alloc if memory cannot be allocated. */
+	void* allocate(std::size_t const size)
+	{
+		auto const [chunkSize, classIndex] = getSizeClass(size);
+		if (chunkSize > _blockSize / 4)
+		{
+			return ::operator new(chunkSize);
+		}
+
+		auto& freeList = _freeLists[classIndex];
+		if (freeList != nullptr)
+		{
+			auto* const chunk = freeList;
+			freeList = chunk->next;
+			++_usedChunks;
+			return chunk;
+		}
+
+		if (chunkSize > _remaining)
+		{
+			auto* const block = static_cast<Link*>(::operator new(BlockHeaderSize + _blockSize));
+			block->next = _blocks;
+			_blocks = block;
+			_current = reinterpret_cast<std::uint8_t*>(block) + BlockHeaderSize;
+			_remaining = _blockSize;
+		}
+
+		auto* const chunk = _current;
+		_current += chunkSize;
+		_remaining -= chunkSize;
+		++_usedChunks;
+		return chunk;
+	}
+
+	/** Gives back a chunk previously returned by allocate with the same size */
+	void deallocate(void* const ptr, std::size_t const size) noexcept
+	{
+		if (ptr == nullptr)
+		{
+			return;
+		}
+
+		auto const [chunkSize, classIndex] = getSizeClass(size);
+		if (chunkSize > _blockSize / 4)
+		{
+			::operator delete(ptr);
+			return;
+		}
+
+		auto& freeList = _freeLists[classIndex];
+		auto* const chunk = static_cast<Link*>(ptr);
+		chunk->next = freeList;
+		freeList = chunk;
+		--_usedChunks;
+	}
+
+	/** Releases all the allocated blocks if no chunk is currently in use (the initial buffer being used again by the next allocations). Returns false if some chunks are still in use. */
+	bool releaseIfUnused() noexcept
+	{
+		if (_usedChunks != 0u)
+		{
+			return false;
+		}
+
+		freeBlocks();
+		_freeLists = {};
+		_current = _initialBuffer;
+		_remaining = _initialBufferSize;
+		return true;
+	}
+
+	// Deleted compiler auto-generated methods
+	MemoryArena(MemoryArena&&) = delete;
+	MemoryArena(MemoryArena const&) = delete;
+	MemoryArena& operator=(MemoryArena const&) = delete;
+	MemoryArena& operator=(MemoryArena&&) = delete;
+
+private:
+	struct Link
+	{
+		Link* next{ nullptr };
+	};
+
+	template<typename T>
+	static constexpr T roundUp(T const size) noexcept
+	{
+		return (size + Alignment - 1) & ~static_cast<T>(Alignment - 1);
+	}
+
+	static constexpr std::size_t BlockHeaderSize = (sizeof(Link) + Alignment - 1) & ~(Alignment - 1);
+	static constexpr std::size_t ExactClassesCount = MaxExactClassSize / Alignment;
+	static constexpr std::size_t PowerOf2ClassesCount = 12u; // Up to MaxExactClassSize << 12, more than a quarter of MaxBlockSize
+
+	/** Returns the size of the chunk to allocate for a request of size bytes, and the index of its free list (if not allocated from the heap) */
+	static constexpr std::pair<std::size_t, std::size_t> getSizeClass(std::size_t const size) noexcept
+	{
+		auto const alignedSize = roundUp(size == 0u ? std::size_t{ 1u } : size);
+		if (alignedSize <= MaxExactClassSize)
+		{
+			return { alignedSize, alignedSize / Alignment - 1 };
+		}
+
+		auto classSize = MaxExactClassSize * 2;
+		auto classIndex = ExactClassesCount;
+		while (classSize < alignedSize && classIndex < (ExactClassesCount + PowerOf2ClassesCount - 1))
+		{
+			classSize *= 2;
+			++classIndex;
+		}
+		// Too big for any class, will be allocated from the heap
+		if (classSize < alignedSize)
+		{
+			return { alignedSize, 0u };
+		}
+		return { classSize, classIndex };
+	}
+
+	void freeBlocks() noexcept
+	{
+		while (_blocks != nullptr)
+		{
+			auto* const next = _blocks->next;
+			::operator delete(_blocks);
+			_blocks = next;
+		}
+	}
+
+	std::size_t const _blockSize{ DefaultBlockSize };
+	std::uint8_t* _initialBuffer{ nullptr };
+	std::size_t _initialBufferSize{ 0u };
+	Link* _blocks{ nullptr };
+	std::uint8_t* _current{ nullptr };
+	std::size_t _remaining{ 0u };
+	std::size_t _usedChunks{ 0u };
+	std::array<Link*, ExactClassesCount + PowerOf2ClassesCount> _freeLists{};
+};
+
+/**
+* @brief Allocator allocating from a MemoryArena, for standard containers.
+* @details The allocator is not propagated when containers are copied, moved or swapped, so a container always allocates from the arena it was constructed with.
+*/
+template<typename T>
+class ArenaAllocator final
+{
+public:
+	static_assert(alignof(T) <= MemoryArena::Alignment, "Over-aligned types are not supported");
+
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::false_type;
+	using propagate_on_container_move_assignment = std::false_type;
+	using propagate_on_container_swap = std::false_type;
+
+	explicit ArenaAllocator(MemoryArena& arena) noexcept
+		: _arena{ &arena }
+	{
+	}
+
+	template<typename U>
+	ArenaAllocator(ArenaAllocator<U> const& other) noexcept
+		: _arena{ other._arena }
+	{
+	}
+
+	T* allocate(std::size_t const count)
+	{
+		if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+		{
+			throw std::bad_array_new_length{};
+		}
+		return static_cast<T*>(_arena->allocate(count * sizeof(T)));
+	}
+
+	void deallocate(T* const ptr, std::size_t const count) noexcept
+	{
+		_arena->deallocate(ptr, count * sizeof(T));
+	}
+
+	friend bool operator==(ArenaAllocator const& lhs, ArenaAllocator const& rhs) noexcept
+	{
+		return lhs._arena == rhs._arena;
+	}
+
+	friend bool operator!=(ArenaAllocator const& lhs, ArenaAllocator const& rhs) noexcept
+	{
+		return lhs._arena != rhs._arena;
+	}
+
+	// Defaulted compiler auto-generated methods
+	ArenaAllocator(ArenaAllocator&&) = default;
+	ArenaAllocator(ArenaAllocator const&) = default;
+	ArenaAllocator& operator=(ArenaAllocator const&) = default;
+	ArenaAllocator& operator=(ArenaAllocator&&) = default;
+
+private:
+	template<typename U>
+	friend class ArenaAllocator;
+
+	MemoryArena* _arena{ nullptr };
+};
+
+/**
+* @brief Process wide pool of memory blocks for the targets that do not fit in an InlineFunction.
+* @details Blocks are grouped in size classes of BlockGranularity bytes, released blocks (up to MaxCachedBlocks per class) are kept and reused by the next targets of the same class.
+*          Targets bigger than MaxPooledSize are directly allocated from the heap.
+* @note Thread-safe.
+*/
+class InlineFunctionBlockPool final
+{
+public:
+	static constexpr std::size_t BlockGranularity = 64u;
+	static constexpr std::size_t MaxPooledSize = 1024u;
+	static constexpr std::size_t MaxCachedBlocks = 256u;
+
+	/** Returns a block of at least size bytes, aligned on alignof(std::max_align_t). Throws std::bad_alloc if memory cannot be allocated. */
+	static void* acquire(std::size_t const size)
+	{
+		auto const classIndex = getClassIndex(size);
+		if (classIndex >= ClassesCount)
+		{
+			return ::operator new(size);
+		}
+
+		auto& pool = getInstance();
+		{
+			// Lock to protect _freeLists
+			auto const lg = std::lock_guard{ pool._lock };
+			auto& freeList = pool._freeLists[classIndex];
+			if (freeList.head != nullptr)
+			{
+				auto* const block = freeList.head;
+				freeList.head = block->next;
+				--freeList.count;
+				return block;
+			}
+		}
+		return ::operator new((classIndex + 1) * BlockGranularity);
+	}
+
+	/** Gives back a block previously returned by acquire with the same size */
+	static void release(void* const block, std::size_t const size) noexcept
+	{
+		auto const classIndex = getClassIndex(size);
+		if (classIndex < ClassesCount)
+		{
+			auto& pool = getInstance();
+
+			// Lock to protect _freeLists
+			auto const lg = std::lock_guard{ pool._lock };
+			auto& freeList = pool._freeLists[classIndex];
+			if (freeList.count < MaxCachedBlocks)
+			{
+				auto* const link = static_cast<Link*>(block);
+				link->next = freeList.head;
+				freeList.head = link;
+				++freeList.count;
+				return;
+			}
+		}
+		::operator delete(block);
+	}
+
+	// Deleted compiler auto-generated methods
+	InlineFunctionBlockPool(InlineFunctionBlockPool&&) = delete;
+	InlineFunctionBlockPool(InlineFunctionBlockPool const&) = delete;
+	InlineFunctionBlockPool& operator=(InlineFunctionBlockPool const&) = delete;
+	InlineFunctionBlockPool& operator=(InlineFunctionBlockPool&&) = delete;
+
+private:
+	struct Link
+	{
+		Link* next{ nullptr };
+	};
+	struct FreeList
+	{
+		Link* head{ nullptr };
+		std::size_t count{ 0u };
+	};
+
+	static constexpr std::size_t ClassesCount = MaxPooledSize / BlockGranularity;
+
+	static constexpr std::size_t getClassIndex(std::size_t const size) noexcept
+	{
+		return size == 0u ? 0u : (size - 1u) / BlockGranularity;
+	}
+
+	// The pool is created on first use and never destroyed, so that blocks released during static destruction are still handled properly
+	static InlineFunctionBlockPool& getInstance() noexcept
+	{
+		static auto* const s_Instance = new InlineFunctionBlockPool{};
+		return *s_Instance;
+	}
+
+	InlineFunctionBlockPool() noexcept = default;
+	~InlineFunctionBlockPool() noexcept = default;
+
+	std::mutex _lock{};
+	std::array<FreeList, ClassesCount> _freeLists{};
+};
+
+/**
+* @brief Move-only callable wrapper that does not allocate from the heap once warmed up.
+* @details Callables up to InlineSize bytes (and nothrow move constructible) are stored in the object itself, bigger ones are stored in a block taken from the InlineFunctionBlockPool.
+*          Unlike std::function, a callable is never copied once stored, which makes it suitable for continuations holding user handlers.
+*/
+template<typename Signature, std::size_t InlineSize = 64u>
+class InlineFunction;
+
+template<typename Ret, typename... Args, std::size_t InlineSize>
+class InlineFunction<Ret(Args...), InlineSize> final
+{
+public:
+	/** Default constructor, creating an empty InlineFunction */
+	constexpr InlineFunction() noexcept = default;
+
+	/** Constructor from nullptr, creating an empty InlineFunction */
+	constexpr InlineFunction(std::nullptr_t) noexcept {}
+
+	/** Constructor from any callable invocable with Args and returning Ret */
+	template<typename Callable, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, InlineFunction> && std::is_invocable_r_v<Ret, std::decay_t<Callable>&, Args...>>>
+	InlineFunction(Callable&& callable)
+	{
+		using Target = std::decay_t<Callable>;
+		if constexpr (isStoredInline<Target>())
+		{
+			new (&_storage) Target(std::forward<Callable>(callable));
+		}
+		else
+		{
+			auto* const block = InlineFunctionBlockPool::acquire(sizeof(Target));
+			try
+			{
+				new (block) Target(std::forward<Callable>(callable));
+			}
+			catch (...)
+			{
+				InlineFunctionBlockPool::release(block, sizeof(Target));
+				throw;
+			}
+			*reinterpret_cast<void**>(&_storage) = block;
+		}
+		_operations = &s_Operations<Target>;
+	}
+
+	/** Move constructor */
+	InlineFunction(InlineFunction&& other) noexcept
+	{
+		moveFrom(other);
+	}
+
+	/** Move assignment operator */
+	InlineFunction& operator=(InlineFunction&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			moveFrom(other);
+		}
+		return *this;
+	}
+
+	/** Destructor */
+	~InlineFunction() noexcept
+	{
+		reset();
+	}
+
+	/** Destroys the stored callable, if any */
+	void reset() noexcept
+	{
+		if (_operations != nullptr)
+		{
+			_operations->destroy(&_storage);
+			_operations = nullptr;
+		}
+	}
+
+	/** Invokes the stored callable. Throws std::bad_function_call if empty. */
+	Ret operator()(Args... args) const
+	{
+		if (_operations == nullptr)
+		{
+			throw std::bad_function_call{};
+		}
+		return _operations->invoke(const_cast<Storage*>(&_storage), std::forward<Args>(args)...);
+	}
+
+	/** Returns true if a callable is stored */
+	explicit operator bool() const noexcept
+	{
+		return _operations != nullptr;
+	}
+
+	friend bool operator==(InlineFunction const& lhs, std::nullptr_t) noexcept
+	{
+		return !lhs;
+	}
+
+	friend bool operator!=(InlineFunction const& lhs, std::nullptr_t) noexcept
+	{
+		return !!lhs;
+	}
+
+	/** Returns true if a callable of type Callable is stored in the object itself */
+	template<typename Callable>
+	static constexpr bool isStoredInline() noexcept
+	{
+		return sizeof(Callable) <= InlineSize && alignof(Callable) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Callable>;
+	}
+
+	// Deleted compiler auto-generated methods
+	InlineFunction(InlineFunction const&) = delete;
+	InlineFunction& operator=(InlineFunction const&) = delete;
+
+private:
+	using Storage = std::aligned_storage_t<(InlineSize < sizeof(void*) ? sizeof(void*) : InlineSize), alignof(std::max_align_t)>;
+
+	struct Operations
+	{
+		Ret (*invoke)(Storage* const storage, Args&&... args);
+		void (*move)(Storage* const dst, Storage* const src) noexcept; // Move-constructs dst from src, then destroys src
+		void (*destroy)(Storage* const storage) noexcept;
+	};
+
+	template<typename Target>
+	static Target* getTarget(Storage* const storage) noexcept
+	{
+		if constexpr (isStoredInline<Target>())
+		{
+			return std::launder(reinterpret_cast<Target*>(storage));
+		}
+		else
+		{
+			return static_cast<Target*>(*reinterpret_cast<void**>(storage));
+		}
+	}
+
+	template<typename Target>
+	static inline Operations const s_Operations{
+		[](Storage* const storage, Args&&... args) -> Ret
+		{
+			return static_cast<Ret>((*getTarget<Target>(storage))(std::forward<Args>(args)...));
+		},
+		[](Storage* const dst, Storage* const src) noexcept
+		{
+			if constexpr (isStoredInline<Target>())
+			{
+				auto* const target = getTarget<Target>(src);
+				new (dst) Target(std::move(*target));
+				target->~Target();
+			}
+			else
+			{
+				// Only the pointer to the block is moved
+				*reinterpret_cast<void**>(dst) = *reinterpret_cast<void**>(src);
+			}
+		},
+		[](Storage* const storage) noexcept
+		{
+			auto* const target = getTarget<Target>(storage);
+			target->~Target();
+			if constexpr (!isStoredInline<Target>())
+			{
+				InlineFunctionBlockPool::release(target, sizeof(Target));
+			}
+		},
+	};
+
+	void moveFrom(InlineFunction& other) noexcept
+	{
+		if (other._operations != nullptr)
+		{
+			other._operations->move(&_storage, &other._storage);
+			_operations = other._operations;
+			other._operations = nullptr;
+		}
+	}
+
+	Storage _storage;
+	Operations const* _operations{ nullptr };
+};
+
 } // namespace utils
 } // namespace avdecc
 } // namespace la
@@ -86,29 +86,29 @@ private:
 	/* **** AECP notifications **** */
 	virtual void onAecpCommand(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
 	{
-		static auto const s_Dispatch = std::unordered_map<la::avdecc::protocol::AecpMessageType, std::function<void(Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu)>, la::avdecc::protocol::AecpMessageType::Hash>{
-			{ la::avdecc::protocol::AecpMessageType::AemCommand,
+		static auto const s_Dispatch = la::avdecc::utils::DispatchTable<void(Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu), 0x10>{ // AECP message_type is a 4 bits field
+			{ la::avdecc::protocol::AecpMessageType::AemCommand.getValue(),
 				[](Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu)
 				{
 					auto aecp = la::avdecc::bindings::fromCppToC::make_aem_aecpdu(static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu));
 					la::avdecc::utils::invokeProtectedHandler(obs->_observer->onAecpAemCommand, obs->_handle, &aecp);
 				} },
-			{ la::avdecc::protocol::AecpMessageType::AddressAccessCommand,
+			{ la::avdecc::protocol::AecpMessageType::AddressAccessCommand.getValue(),
 				[](Observer* const /*obs*/, la::avdecc::protocol::Aecpdu const& /*aecpdu*/)
 				{
 					//
 				} },
-			{ la::avdecc::protocol::AecpMessageType::VendorUniqueResponse,
+			{ la::avdecc::protocol::AecpMessageType::VendorUniqueResponse.getValue(),
 				[](Observer* const /*obs*/, la::avdecc::protocol::Aecpdu const& /*aecpdu*/)
 				{
 					//
 				} },
 		};
 
-		auto const& it = s_Dispatch.find(aecpdu.getMessageType());
-		if (it != s_Dispatch.end())
+		auto const dispatchHandler = s_Dispatch.find(aecpdu.getMessageType().getValue());
+		if (dispatchHandler != nullptr)
 		{
-			it->second(this, aecpdu);
+			dispatchHandler(this, aecpdu);
 		}
 	}
 	virtual void onAecpAemUnsolicitedResponse(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::AemAecpdu const& aecpdu) noexcept override
@@ -142,29 +142,29 @@ private:
 	}
 	virtual void onAecpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
 	{
-		static auto const s_Dispatch = std::unordered_map<la::avdecc::protocol::AecpMessageType, std::function<void(Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu)>, la::avdecc::protocol::AecpMessageType::Hash>{
-			{ la::avdecc::protocol::AecpMessageType::AemCommand,
+		static auto const s_Dispatch = la::avdecc::utils::DispatchTable<void(Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu), 0x10>{ // AECP message_type is a 4 bits field
+			{ la::avdecc::protocol::AecpMessageType::AemCommand.getValue(),
 				[](Observer* const obs, la::avdecc::protocol::Aecpdu const& aecpdu)
 				{
 					auto aecp = la::avdecc::bindings::fromCppToC::make_aem_aecpdu(static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu));
 					la::avdecc::utils::invokeProtectedHandler(obs->_observer->onAemAecpduReceived, obs->_handle, &aecp);
 				} },
-			{ la::avdecc::protocol::AecpMessageType::AddressAccessCommand,
+			{ la::avdecc::protocol::AecpMessageType::AddressAccessCommand.getValue(),
 				[](Observer* const /*obs*/, la::avdecc::protocol::Aecpdu const& /*aecpdu*/)
 				{
 					//
 				} },
-			{ la::avdecc::protocol::AecpMessageType::VendorUniqueResponse,
+			{ la::avdecc::protocol::AecpMessageType::VendorUniqueResponse.getValue(),
 				[](Observer* const obs, la::avdecc::protocol::Aecpdu const& /*aecpdu*/)
 				{
 					la::avdecc::utils::invokeProtectedHandler(obs->_observer->onMvuAecpduReceived, obs->_handle, nullptr); // TODO: Create correct VU
 				} },
 		};
 
-		auto const& it = s_Dispatch.find(aecpdu.getMessageType());
-		if (it != s_Dispatch.end())
+		auto const dispatchHandler = s_Dispatch.find(aecpdu.getMessageType().getValue());
+		if (dispatchHandler != nullptr)
 		{
-			it->second(this, aecpdu);
+			dispatchHandler(this, aecpdu);
 		}
 	}
 	virtual void onAcmpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Acmpdu const& acmpdu) noexcept override
@@ -336,22 +336,27 @@ model::ChannelConnections const& ControlledEntityImpl::getChannelConnections() c
 
 model::EntityNode const& ControlledEntityImpl::getEntityNode() const
 {
+	decodeAllPackedControlValues();
 	return *_treeModelAccess->getEntityNode(TreeModelAccessStrategy::NotFoundBehavior::Throw);
 }
 
 model::ConfigurationNode const& ControlledEntityImpl::getConfigurationNode(entity::model::ConfigurationIndex const configurationIndex) const
 {
+	decodeAllPackedControlValues();
 	return *_treeModelAccess->getConfigurationNode(configurationIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
 }
 
 model::ConfigurationNode const& ControlledEntityImpl::getCurrentConfigurationNode() const
 {
+	decodeAllPackedControlValues();
 	return *_treeModelAccess->getConfigurationNode(getCurrentConfigurationIndex(), TreeModelAccessStrategy::NotFoundBehavior::Throw);
 }
 
 model::AudioUnitNode const& ControlledEntityImpl::getAudioUnitNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::AudioUnitIndex const audioUnitIndex) const
 {
-	return *_treeModelAccess->getAudioUnitNode(configurationIndex, audioUnitIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	auto const& audioUnitNode = *_treeModelAccess->getAudioUnitNode(configurationIndex, audioUnitIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	decodePackedControlValues(audioUnitNode.controls);
+	return audioUnitNode;
 }
 
 model::StreamInputNode const& ControlledEntityImpl::getStreamInputNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::StreamIndex const streamIndex) const
@@ -378,12 +383,16 @@ model::RedundantStreamNode const& ControlledEntityImpl::getRedundantStreamOutput
 
 model::JackInputNode const& ControlledEntityImpl::getJackInputNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::JackIndex const jackIndex) const
 {
-	return *_treeModelAccess->getJackInputNode(configurationIndex, jackIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	auto const& jackNode = *_treeModelAccess->getJackInputNode(configurationIndex, jackIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	decodePackedControlValues(jackNode.controls);
+	return jackNode;
 }
 
 model::JackOutputNode const& ControlledEntityImpl::getJackOutputNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::JackIndex const jackIndex) const
 {
-	return *_treeModelAccess->getJackOutputNode(configurationIndex, jackIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	auto const& jackNode = *_treeModelAccess->getJackOutputNode(configurationIndex, jackIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	decodePackedControlValues(jackNode.controls);
+	return jackNode;
 }
 
 model::AvbInterfaceNode const& ControlledEntityImpl::getAvbInterfaceNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::AvbInterfaceIndex const avbInterfaceIndex) const
@@ -398,12 +407,16 @@ model::ClockSourceNode const& ControlledEntityImpl::getClockSourceNode(entity::m
 
 model::StreamPortNode const& ControlledEntityImpl::getStreamPortInputNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::StreamPortIndex const streamPortIndex) const
 {
-	return *_treeModelAccess->getStreamPortInputNode(configurationIndex, streamPortIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	auto const& streamPortNode = *_treeModelAccess->getStreamPortInputNode(configurationIndex, streamPortIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	decodePackedControlValues(streamPortNode.controls);
+	return streamPortNode;
 }
 
 model::StreamPortNode const& ControlledEntityImpl::getStreamPortOutputNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::StreamPortIndex const streamPortIndex) const
 {
-	return *_treeModelAccess->getStreamPortOutputNode(configurationIndex, streamPortIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	auto const& streamPortNode = *_treeModelAccess->getStreamPortOutputNode(configurationIndex, streamPortIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	decodePackedControlValues(streamPortNode.controls);
+	return streamPortNode;
 }
 
 model::AudioClusterNode const& ControlledEntityImpl::getAudioClusterNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::ClusterIndex const clusterIndex) const
@@ -427,7 +440,12 @@ model::AudioMapNode const& ControlledEntityImpl::getAudioMapNode(entity::model::
 
 model::ControlNode const& ControlledEntityImpl::getControlNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::ControlIndex const controlIndex) const
 {
-	return *_treeModelAccess->getControlNode(configurationIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	auto const& controlNode = *_treeModelAccess->getControlNode(configurationIndex, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	if (auto const packedIt = _packedControlValues.find(controlIndex); packedIt != _packedControlValues.end())
+	{
+		decodePackedControlValues(controlIndex, packedIt->second);
+	}
+	return controlNode;
 }
 
 model::ClockDomainNode const& ControlledEntityImpl::getClockDomainNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::ClockDomainIndex const clockDomainIndex) const
@@ -442,7 +460,9 @@ model::TimingNode const& ControlledEntityImpl::getTimingNode(entity::model::Conf
 
 model::PtpInstanceNode const& ControlledEntityImpl::getPtpInstanceNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::PtpInstanceIndex const ptpInstanceIndex) const
 {
-	return *_treeModelAccess->getPtpInstanceNode(configurationIndex, ptpInstanceIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	auto const& ptpInstanceNode = *_treeModelAccess->getPtpInstanceNode(configurationIndex, ptpInstanceIndex, TreeModelAccessStrategy::NotFoundBehavior::Throw);
+	decodePackedControlValues(ptpInstanceNode.controls);
+	return ptpInstanceNode;
 }
 
 model::PtpPortNode const& ControlledEntityImpl::getPtpPortNode(entity::model::ConfigurationIndex const configurationIndex, entity::model::PtpPortIndex const ptpPortIndex) const
@@ -484,7 +504,7 @@ entity::model::AvdeccFixedString const& ControlledEntityImpl::getLocalizedString
 			// It may happen that the string is not in the map (eg. device failed to load it), so we have to check
 			if (auto const it = configurationDynamicModel->localizedStrings.find(entity::model::StringsIndex(globalOffset)); it != configurationDynamicModel->localizedStrings.end())
 			{
-				return it->second;
+				return it->second.get();
 			}
 			else
 			{
@@ -1182,6 +1202,10 @@ void ControlledEntityImpl::setCurrentConfiguration(entity::model::ConfigurationI
 		{
 			entityNode->dynamicModel.currentConfiguration = configurationIndex;
 
+			// Values waiting to be decoded were for the previous configuration
+			_packedControlValues.clear();
+			_dirtyPackedControlValuesCount = 0u;
+
 			// Set isActiveConfiguration for each configuration
 			for (auto& confIt : entityNode->configurations)
 			{
@@ -1543,6 +1567,36 @@ void ControlledEntityImpl::setControlValues(entity::model::ControlIndex const co
 			dynamicModel->values = controlValues;
 		}
 	}
+
+	// Values received before these ones (if any) are now outdated
+	if (auto const packedIt = _packedControlValues.find(controlIndex); packedIt != _packedControlValues.end() && packedIt->second.isDirty)
+	{
+		packedIt->second.isDirty = false;
+		--_dirtyPackedControlValuesCount;
+	}
+}
+
+void ControlledEntityImpl::setPackedControlValues(entity::model::ControlIndex const controlIndex, entity::model::ControlValueType::Type const controlValueType, std::uint16_t const numberOfValues, MemoryBuffer const& packedControlValues, PackedControlValuesDecodedHandler const onDecoded) noexcept
+{
+	auto& packed = _packedControlValues[controlIndex];
+	packed.controlValueType = controlValueType;
+	packed.numberOfValues = numberOfValues;
+	packed.packedValues.assign(packedControlValues.data(), packedControlValues.size());
+	packed.onDecoded = onDecoded;
+	if (!packed.isDirty)
+	{
+		packed.isDirty = true;
+		++_dirtyPackedControlValuesCount;
+	}
+}
+
+std::optional<entity::model::ControlValues> ControlledEntityImpl::decodePackedControlValues(entity::model::ControlIndex const controlIndex) noexcept
+{
+	if (auto const packedIt = _packedControlValues.find(controlIndex); packedIt != _packedControlValues.end())
+	{
+		return decodePackedControlValues(controlIndex, packedIt->second);
+	}
+	return std::nullopt;
 }
 
 void ControlledEntityImpl::setMemoryObjectLength(entity::model::ConfigurationIndex const configurationIndex, entity::model::MemoryObjectIndex const memoryObjectIndex, std::uint64_t const length, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior)
@@ -1676,7 +1730,7 @@ void ControlledEntityImpl::setDiagnostics(Diagnostics const& diags) noexcept
 }
 
 // Setters of the Model from AEM Descriptors (including DescriptorDynamic info)
-bool ControlledEntityImpl::setCachedEntityNode(model::EntityNode&& cachedNode, entity::model::EntityDescriptor const& descriptor, bool const forAllConfiguration) noexcept
+bool ControlledEntityImpl::setCachedEntityNode(model::EntityNode const& cachedNode, entity::model::EntityDescriptor const& descriptor, bool const forAllConfiguration) noexcept
 {
 	// Check if static information in EntityDescriptor are identical
 	auto const& cachedDescriptor = cachedNode.staticModel;
@@ -1708,7 +1762,8 @@ bool ControlledEntityImpl::setCachedEntityNode(model::EntityNode&& cachedNode, e
 	}
 
 	// Ok the static information from EntityDescriptor are identical, we cannot check more than this so we have to assume it's correct, copy the whole model
-	_entityNode = std::move(cachedNode);
+	// Each entity still owns its copy (static and dynamic models), as public model nodes hold their staticModel by value; only the cached model itself is shared
+	_entityNode = cachedNode;
 
 	// Success, switch to Cached Model Strategy
 	switchToCachedTreeModelAccessStrategy();
@@ -2094,7 +2149,7 @@ void ControlledEntityImpl::setLocalizedStrings(entity::model::ConfigurationIndex
 	for (auto strIndex = 0u; strIndex < strings.size(); ++strIndex)
 	{
 		auto const localizedStringIndex = entity::model::LocalizedStringReference{ relativeStringsIndex, static_cast<std::uint8_t>(strIndex) }.getGlobalOffset();
-		configDynamicModel->localizedStrings[localizedStringIndex] = strings.at(strIndex);
+		configDynamicModel->localizedStrings[localizedStringIndex] = entity::model::InternedAvdeccFixedString{ strings.at(strIndex) };
 	}
 }
 
@@ -2566,7 +2621,7 @@ void ControlledEntityImpl::setDescriptorExpected(entity::model::ConfigurationInd
 {
 	AVDECC_ASSERT(_sharedLock->_lockedCount > 0, "ControlledEntity should be locked");
 
-	auto& conf = _expectedDescriptors[configurationIndex];
+	auto& conf = _expectedDescriptors.try_emplace(configurationIndex, ExpectedKeys<DescriptorKey>::allocator_type{ _expectedQueriesArena }).first->second;
 
 	auto const key = makeDescriptorKey(descriptorType, descriptorIndex);
 	conf.insert(key);
@@ -2622,7 +2677,7 @@ void ControlledEntityImpl::setDynamicInfoExpected(entity::model::ConfigurationIn
 {
 	AVDECC_ASSERT(_sharedLock->_lockedCount > 0, "ControlledEntity should be locked");
 
-	auto& conf = _expectedDynamicInfo[configurationIndex];
+	auto& conf = _expectedDynamicInfo.try_emplace(configurationIndex, ExpectedKeys<DynamicInfoKey>::allocator_type{ _expectedQueriesArena }).first->second;
 
 	auto const key = makeDynamicInfoKey(dynamicInfoType, descriptorIndex, subIndex);
 	conf.insert(key);
@@ -2685,7 +2740,7 @@ void ControlledEntityImpl::setDescriptorDynamicInfoExpected(entity::model::Confi
 {
 	AVDECC_ASSERT(_sharedLock->_lockedCount > 0, "ControlledEntity should be locked");
 
-	auto& conf = _expectedDescriptorDynamicInfo[configurationIndex];
+	auto& conf = _expectedDescriptorDynamicInfo.try_emplace(configurationIndex, ExpectedKeys<DescriptorDynamicInfoKey>::allocator_type{ _expectedQueriesArena }).first->second;
 
 	auto const key = makeDescriptorDynamicInfoKey(descriptorDynamicInfoType, descriptorIndex);
 	conf.insert(key);
@@ -2720,6 +2775,33 @@ std::pair<bool, std::chrono::milliseconds> ControlledEntityImpl::getQueryDescrip
 	return std::make_pair(true, std::chrono::milliseconds{ QueryRetryMillisecondDelay });
 }
 
+void ControlledEntityImpl::releaseExpectedQueriesMemory() noexcept
+{
+	AVDECC_ASSERT(_sharedLock->_lockedCount > 0, "ControlledEntity should be locked");
+
+	// Some queries are still in flight (resync of some dynamic information for example)
+	if (!_expectedPackedDynamicInfo.empty() || !_expectedMilanInfo.empty() || !gotAllExpectedDescriptors() || !gotAllExpectedDynamicInfo() || !gotAllExpectedDescriptorDynamicInfo())
+	{
+		return;
+	}
+
+	// Swap with fresh containers so that the nodes and buckets are given back to the arena (clear doesn't release the buckets)
+	auto const resetContainer = [this](auto& container)
+	{
+		using Container = std::decay_t<decltype(container)>;
+		auto fresh = Container{ typename Container::allocator_type{ _expectedQueriesArena } };
+		fresh.swap(container);
+	};
+	resetContainer(_expectedPackedDynamicInfo);
+	resetContainer(_expectedMilanInfo);
+	resetContainer(_expectedDescriptors);
+	resetContainer(_expectedDynamicInfo);
+	resetContainer(_expectedDescriptorDynamicInfo);
+
+	// Release the arena blocks (kept if the standard library allocates for empty containers)
+	_expectedQueriesArena.releaseIfUnused();
+}
+
 entity::Entity& ControlledEntityImpl::getEntity() noexcept
 {
 	return _entity;
@@ -2899,6 +2981,69 @@ bool ControlledEntityImpl::hasLostUnsolicitedNotification(protocol::AecpSequence
 	return unmatched;
 }
 
+std::optional<entity::model::ControlValues> ControlledEntityImpl::decodePackedControlValues(entity::model::ControlIndex const controlIndex, PackedControlValues& packedControlValues) const noexcept
+{
+	if (!packedControlValues.isDirty)
+	{
+		return std::nullopt;
+	}
+	packedControlValues.isDirty = false;
+	--_dirtyPackedControlValuesCount;
+
+	auto* const entityNode = _treeModelAccess->getEntityNode(TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+	if (entityNode)
+	{
+		auto* const dynamicModel = _treeModelAccess->getControlNodeDynamicModel(entityNode->dynamicModel.currentConfiguration, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+		if (dynamicModel)
+		{
+			auto controlValuesOpt = entity::model::unpackDynamicControlValues(packedControlValues.packedValues, packedControlValues.controlValueType, packedControlValues.numberOfValues);
+			if (controlValuesOpt)
+			{
+				dynamicModel->values = *controlValuesOpt;
+				// Values are validated when decoded
+				if (packedControlValues.onDecoded)
+				{
+					packedControlValues.onDecoded(const_cast<ControlledEntityImpl&>(*this), controlIndex, *controlValuesOpt);
+				}
+				return controlValuesOpt;
+			}
+			LOG_CONTROLLER_WARN(_entity.getEntityID(), "Cannot decode packed values of CONTROL {}", controlIndex);
+		}
+	}
+	return std::nullopt;
+}
+
+void ControlledEntityImpl::decodePackedControlValues(std::map<entity::model::ControlIndex, model::ControlNode> const& controls) const noexcept
+{
+	// Fast path, nothing to decode
+	if (_dirtyPackedControlValuesCount == 0u)
+	{
+		return;
+	}
+
+	for (auto const& controlKV : controls)
+	{
+		if (auto const packedIt = _packedControlValues.find(controlKV.first); packedIt != _packedControlValues.end())
+		{
+			decodePackedControlValues(controlKV.first, packedIt->second);
+		}
+	}
+}
+
+void ControlledEntityImpl::decodeAllPackedControlValues() const noexcept
+{
+	// Fast path, nothing to decode
+	if (_dirtyPackedControlValuesCount == 0u)
+	{
+		return;
+	}
+
+	for (auto& [controlIndex, packedControlValues] : _packedControlValues)
+	{
+		decodePackedControlValues(controlIndex, packedControlValues);
+	}
+}
+
 bool ControlledEntityImpl::hasLostAemUnsolicitedNotification(protocol::AecpSequenceID const sequenceID) noexcept
 {
 	return hasLostUnsolicitedNotification(sequenceID, _expectedAemSequenceID);
@@ -3670,390 +3815,391 @@ void ControlledEntityImpl::buildEntityModelGraph(entity::model::EntityTree const
 	}
 }
 
-entity::model::EntityTree const& ControlledEntityImpl::getEntityModelTree() const noexcept
+/** Builds an EntityTree (static and dynamic models) from the EntityModel graph of a ControlledEntity */
+class FullModelVisitor : public la::avdecc::controller::model::EntityModelVisitor
 {
-	class FullModelVisitor : public la::avdecc::controller::model::EntityModelVisitor
+public:
+	FullModelVisitor(std::optional<entity::model::EntityTree>& entityTree) noexcept
+		: _entityTree{ entityTree }
 	{
-	public:
-		FullModelVisitor(ControlledEntityImpl const& entity) noexcept
-			: _entity{ entity }
-		{
-		}
+	}
 
-		// Deleted compiler auto-generated methods
-		FullModelVisitor(FullModelVisitor const&) = delete;
-		FullModelVisitor(FullModelVisitor&&) = delete;
-		FullModelVisitor& operator=(FullModelVisitor const&) = delete;
-		FullModelVisitor& operator=(FullModelVisitor&&) = delete;
+	// Deleted compiler auto-generated methods
+	FullModelVisitor(FullModelVisitor const&) = delete;
+	FullModelVisitor(FullModelVisitor&&) = delete;
+	FullModelVisitor& operator=(FullModelVisitor const&) = delete;
+	FullModelVisitor& operator=(FullModelVisitor&&) = delete;
 
-	private:
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::EntityNode const& node) noexcept override
-		{
-			// Create tree
-			auto entityTree = entity::model::EntityTree{};
+private:
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::EntityNode const& node) noexcept override
+	{
+		// Create tree
+		auto entityTree = entity::model::EntityTree{};
 
-			// Copy static and dynamic models
-			entityTree.staticModel = node.staticModel;
-			entityTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		entityTree.staticModel = node.staticModel;
+		entityTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree = std::move(entityTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::EntityNode const* const /*parent*/, la::avdecc::controller::model::ConfigurationNode const& node) noexcept override
-		{
-			// Create tree
-			auto configTree = entity::model::ConfigurationTree{};
+		// Save
+		_entityTree = std::move(entityTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::EntityNode const* const /*parent*/, la::avdecc::controller::model::ConfigurationNode const& node) noexcept override
+	{
+		// Create tree
+		auto configTree = entity::model::ConfigurationTree{};
 
-			// Copy static and dynamic models
-			configTree.staticModel = node.staticModel;
-			configTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		configTree.staticModel = node.staticModel;
+		configTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[node.descriptorIndex] = std::move(configTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::AudioUnitNode const& node) noexcept override
-		{
-			// Create tree
-			auto audioUnitTree = entity::model::AudioUnitTree{};
+		// Save
+		_entityTree->configurationTrees[node.descriptorIndex] = std::move(configTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::AudioUnitNode const& node) noexcept override
+	{
+		// Create tree
+		auto audioUnitTree = entity::model::AudioUnitTree{};
 
-			// Copy static and dynamic models
-			audioUnitTree.staticModel = node.staticModel;
-			audioUnitTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		audioUnitTree.staticModel = node.staticModel;
+		audioUnitTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].audioUnitTrees[node.descriptorIndex] = std::move(audioUnitTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::StreamInputNode const& node) noexcept override
-		{
-			// Create tree
-			auto streamInputTree = entity::model::StreamInputNodeModels{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].audioUnitTrees[node.descriptorIndex] = std::move(audioUnitTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::StreamInputNode const& node) noexcept override
+	{
+		// Create tree
+		auto streamInputTree = entity::model::StreamInputNodeModels{};
 
-			// Copy static and dynamic models
-			streamInputTree.staticModel = node.staticModel;
-			streamInputTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		streamInputTree.staticModel = node.staticModel;
+		streamInputTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].streamInputModels[node.descriptorIndex] = std::move(streamInputTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::StreamOutputNode const& node) noexcept override
-		{
-			// Create tree
-			auto streamOutputTree = entity::model::StreamOutputNodeModels{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].streamInputModels[node.descriptorIndex] = std::move(streamInputTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::StreamOutputNode const& node) noexcept override
+	{
+		// Create tree
+		auto streamOutputTree = entity::model::StreamOutputNodeModels{};
 
-			// Copy static and dynamic models
-			streamOutputTree.staticModel = node.staticModel;
-			streamOutputTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		streamOutputTree.staticModel = node.staticModel;
+		streamOutputTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].streamOutputModels[node.descriptorIndex] = std::move(streamOutputTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::JackInputNode const& node) noexcept override
-		{
-			// Create tree
-			auto jackTree = entity::model::JackTree{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].streamOutputModels[node.descriptorIndex] = std::move(streamOutputTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::JackInputNode const& node) noexcept override
+	{
+		// Create tree
+		auto jackTree = entity::model::JackTree{};
 
-			// Copy static and dynamic models
-			jackTree.staticModel = node.staticModel;
-			jackTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		jackTree.staticModel = node.staticModel;
+		jackTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].jackInputTrees[node.descriptorIndex] = std::move(jackTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::JackOutputNode const& node) noexcept override
-		{
-			// Create tree
-			auto jackTree = entity::model::JackTree{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].jackInputTrees[node.descriptorIndex] = std::move(jackTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::JackOutputNode const& node) noexcept override
+	{
+		// Create tree
+		auto jackTree = entity::model::JackTree{};
 
-			// Copy static and dynamic models
-			jackTree.staticModel = node.staticModel;
-			jackTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		jackTree.staticModel = node.staticModel;
+		jackTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].jackOutputTrees[node.descriptorIndex] = std::move(jackTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::JackNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
-		{
-			// Create tree
-			auto controlTree = entity::model::ControlNodeModels{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].jackOutputTrees[node.descriptorIndex] = std::move(jackTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::JackNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
+	{
+		// Create tree
+		auto controlTree = entity::model::ControlNodeModels{};
 
-			// Copy static and dynamic models
-			controlTree.staticModel = node.staticModel;
-			controlTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		controlTree.staticModel = node.staticModel;
+		controlTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			if (parent->descriptorType == entity::model::DescriptorType::JackInput)
-			{
-				_entity._entityTree->configurationTrees[grandParent->descriptorIndex].jackInputTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
-			}
-			else if (parent->descriptorType == entity::model::DescriptorType::JackOutput)
-			{
-				_entity._entityTree->configurationTrees[grandParent->descriptorIndex].jackOutputTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
-			}
-			else
-			{
-				AVDECC_ASSERT(false, "Unsupported DescriptorType");
-			}
+		// Save
+		if (parent->descriptorType == entity::model::DescriptorType::JackInput)
+		{
+			_entityTree->configurationTrees[grandParent->descriptorIndex].jackInputTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
 		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::AvbInterfaceNode const& node) noexcept override
+		else if (parent->descriptorType == entity::model::DescriptorType::JackOutput)
 		{
-			// Create tree
-			auto avbInterfaceTree = entity::model::AvbInterfaceNodeModels{};
-
-			// Copy static and dynamic models
-			avbInterfaceTree.staticModel = node.staticModel;
-			avbInterfaceTree.dynamicModel = node.dynamicModel;
-
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].avbInterfaceModels[node.descriptorIndex] = std::move(avbInterfaceTree);
+			_entityTree->configurationTrees[grandParent->descriptorIndex].jackOutputTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
 		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::ClockSourceNode const& node) noexcept override
+		else
 		{
-			// Create tree
-			auto clockSourceTree = entity::model::ClockSourceNodeModels{};
+			AVDECC_ASSERT(false, "Unsupported DescriptorType");
+		}
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::AvbInterfaceNode const& node) noexcept override
+	{
+		// Create tree
+		auto avbInterfaceTree = entity::model::AvbInterfaceNodeModels{};
 
-			// Copy static and dynamic models
-			clockSourceTree.staticModel = node.staticModel;
-			clockSourceTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		avbInterfaceTree.staticModel = node.staticModel;
+		avbInterfaceTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].clockSourceModels[node.descriptorIndex] = std::move(clockSourceTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::MemoryObjectNode const& node) noexcept override
-		{
-			// Create tree
-			auto memoryObjectTree = entity::model::MemoryObjectNodeModels{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].avbInterfaceModels[node.descriptorIndex] = std::move(avbInterfaceTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::ClockSourceNode const& node) noexcept override
+	{
+		// Create tree
+		auto clockSourceTree = entity::model::ClockSourceNodeModels{};
 
-			// Copy static and dynamic models
-			memoryObjectTree.staticModel = node.staticModel;
-			memoryObjectTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		clockSourceTree.staticModel = node.staticModel;
+		clockSourceTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].memoryObjectModels[node.descriptorIndex] = std::move(memoryObjectTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::LocaleNode const& node) noexcept override
-		{
-			// Create tree
-			auto localeTree = entity::model::LocaleTree{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].clockSourceModels[node.descriptorIndex] = std::move(clockSourceTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::MemoryObjectNode const& node) noexcept override
+	{
+		// Create tree
+		auto memoryObjectTree = entity::model::MemoryObjectNodeModels{};
 
-			// Copy static and dynamic models
-			localeTree.staticModel = node.staticModel;
+		// Copy static and dynamic models
+		memoryObjectTree.staticModel = node.staticModel;
+		memoryObjectTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].localeTrees[node.descriptorIndex] = std::move(localeTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::LocaleNode const* const parent, la::avdecc::controller::model::StringsNode const& node) noexcept override
-		{
-			// Create tree
-			auto stringsTree = entity::model::StringsNodeModels{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].memoryObjectModels[node.descriptorIndex] = std::move(memoryObjectTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::LocaleNode const& node) noexcept override
+	{
+		// Create tree
+		auto localeTree = entity::model::LocaleTree{};
 
-			// Copy static and dynamic models
-			stringsTree.staticModel = node.staticModel;
+		// Copy static and dynamic models
+		localeTree.staticModel = node.staticModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[grandParent->descriptorIndex].localeTrees[parent->descriptorIndex].stringsModels[node.descriptorIndex] = std::move(stringsTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::AudioUnitNode const* const parent, la::avdecc::controller::model::StreamPortInputNode const& node) noexcept override
-		{
-			// Create tree
-			auto streamPortTree = entity::model::StreamPortTree{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].localeTrees[node.descriptorIndex] = std::move(localeTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::LocaleNode const* const parent, la::avdecc::controller::model::StringsNode const& node) noexcept override
+	{
+		// Create tree
+		auto stringsTree = entity::model::StringsNodeModels{};
 
-			// Copy static and dynamic models
-			streamPortTree.staticModel = node.staticModel;
-			streamPortTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		stringsTree.staticModel = node.staticModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[grandParent->descriptorIndex].audioUnitTrees[parent->descriptorIndex].streamPortInputTrees[node.descriptorIndex] = std::move(streamPortTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::AudioUnitNode const* const parent, la::avdecc::controller::model::StreamPortOutputNode const& node) noexcept override
-		{
-			// Create tree
-			auto streamPortTree = entity::model::StreamPortTree{};
+		// Save
+		_entityTree->configurationTrees[grandParent->descriptorIndex].localeTrees[parent->descriptorIndex].stringsModels[node.descriptorIndex] = std::move(stringsTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::AudioUnitNode const* const parent, la::avdecc::controller::model::StreamPortInputNode const& node) noexcept override
+	{
+		// Create tree
+		auto streamPortTree = entity::model::StreamPortTree{};
 
-			// Copy static and dynamic models
-			streamPortTree.staticModel = node.staticModel;
-			streamPortTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		streamPortTree.staticModel = node.staticModel;
+		streamPortTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[grandParent->descriptorIndex].audioUnitTrees[parent->descriptorIndex].streamPortOutputTrees[node.descriptorIndex] = std::move(streamPortTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandGrandParent, la::avdecc::controller::model::AudioUnitNode const* const grandParent, la::avdecc::controller::model::StreamPortNode const* const parent, la::avdecc::controller::model::AudioClusterNode const& node) noexcept override
-		{
-			// Create tree
-			auto audioClusterTree = entity::model::AudioClusterNodeModels{};
+		// Save
+		_entityTree->configurationTrees[grandParent->descriptorIndex].audioUnitTrees[parent->descriptorIndex].streamPortInputTrees[node.descriptorIndex] = std::move(streamPortTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::AudioUnitNode const* const parent, la::avdecc::controller::model::StreamPortOutputNode const& node) noexcept override
+	{
+		// Create tree
+		auto streamPortTree = entity::model::StreamPortTree{};
 
-			// Copy static and dynamic models
-			audioClusterTree.staticModel = node.staticModel;
-			audioClusterTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		streamPortTree.staticModel = node.staticModel;
+		streamPortTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			if (parent->descriptorType == entity::model::DescriptorType::StreamPortInput)
-			{
-				_entity._entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortInputTrees[parent->descriptorIndex].audioClusterModels[node.descriptorIndex] = std::move(audioClusterTree);
-			}
-			else if (parent->descriptorType == entity::model::DescriptorType::StreamPortOutput)
-			{
-				_entity._entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortOutputTrees[parent->descriptorIndex].audioClusterModels[node.descriptorIndex] = std::move(audioClusterTree);
-			}
-			else
-			{
-				AVDECC_ASSERT(false, "Unsupported DescriptorType");
-			}
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandGrandParent, la::avdecc::controller::model::AudioUnitNode const* const grandParent, la::avdecc::controller::model::StreamPortNode const* const parent, la::avdecc::controller::model::AudioMapNode const& node) noexcept override
-		{
-			// Create tree
-			auto audioMapTree = entity::model::AudioMapNodeModels{};
+		// Save
+		_entityTree->configurationTrees[grandParent->descriptorIndex].audioUnitTrees[parent->descriptorIndex].streamPortOutputTrees[node.descriptorIndex] = std::move(streamPortTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandGrandParent, la::avdecc::controller::model::AudioUnitNode const* const grandParent, la::avdecc::controller::model::StreamPortNode const* const parent, la::avdecc::controller::model::AudioClusterNode const& node) noexcept override
+	{
+		// Create tree
+		auto audioClusterTree = entity::model::AudioClusterNodeModels{};
 
-			// Copy static and dynamic models
-			audioMapTree.staticModel = node.staticModel;
+		// Copy static and dynamic models
+		audioClusterTree.staticModel = node.staticModel;
+		audioClusterTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			if (parent->descriptorType == entity::model::DescriptorType::StreamPortInput)
-			{
-				_entity._entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortInputTrees[parent->descriptorIndex].audioMapModels[node.descriptorIndex] = std::move(audioMapTree);
-			}
-			else if (parent->descriptorType == entity::model::DescriptorType::StreamPortOutput)
-			{
-				_entity._entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortOutputTrees[parent->descriptorIndex].audioMapModels[node.descriptorIndex] = std::move(audioMapTree);
-			}
-			else
-			{
-				AVDECC_ASSERT(false, "Unsupported DescriptorType");
-			}
+		// Save
+		if (parent->descriptorType == entity::model::DescriptorType::StreamPortInput)
+		{
+			_entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortInputTrees[parent->descriptorIndex].audioClusterModels[node.descriptorIndex] = std::move(audioClusterTree);
 		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandGrandParent, la::avdecc::controller::model::AudioUnitNode const* const grandParent, la::avdecc::controller::model::StreamPortNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
+		else if (parent->descriptorType == entity::model::DescriptorType::StreamPortOutput)
 		{
-			// Create tree
-			auto controlTree = entity::model::ControlNodeModels{};
-
-			// Copy static and dynamic models
-			controlTree.staticModel = node.staticModel;
-			controlTree.dynamicModel = node.dynamicModel;
-
-			// Save
-			if (parent->descriptorType == entity::model::DescriptorType::StreamPortInput)
-			{
-				_entity._entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortInputTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
-			}
-			else if (parent->descriptorType == entity::model::DescriptorType::StreamPortOutput)
-			{
-				_entity._entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortOutputTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
-			}
-			else
-			{
-				AVDECC_ASSERT(false, "Unsupported DescriptorType");
-			}
+			_entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortOutputTrees[parent->descriptorIndex].audioClusterModels[node.descriptorIndex] = std::move(audioClusterTree);
 		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::AudioUnitNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
+		else
 		{
-			// Create tree
-			auto controlTree = entity::model::ControlNodeModels{};
+			AVDECC_ASSERT(false, "Unsupported DescriptorType");
+		}
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandGrandParent, la::avdecc::controller::model::AudioUnitNode const* const grandParent, la::avdecc::controller::model::StreamPortNode const* const parent, la::avdecc::controller::model::AudioMapNode const& node) noexcept override
+	{
+		// Create tree
+		auto audioMapTree = entity::model::AudioMapNodeModels{};
 
-			// Copy static and dynamic models
-			controlTree.staticModel = node.staticModel;
-			controlTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		audioMapTree.staticModel = node.staticModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[grandParent->descriptorIndex].audioUnitTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
+		// Save
+		if (parent->descriptorType == entity::model::DescriptorType::StreamPortInput)
+		{
+			_entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortInputTrees[parent->descriptorIndex].audioMapModels[node.descriptorIndex] = std::move(audioMapTree);
 		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
+		else if (parent->descriptorType == entity::model::DescriptorType::StreamPortOutput)
 		{
-			// Create tree
-			auto controlTree = entity::model::ControlNodeModels{};
-
-			// Copy static and dynamic models
-			controlTree.staticModel = node.staticModel;
-			controlTree.dynamicModel = node.dynamicModel;
-
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
+			_entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortOutputTrees[parent->descriptorIndex].audioMapModels[node.descriptorIndex] = std::move(audioMapTree);
 		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::ClockDomainNode const& node) noexcept override
+		else
 		{
-			// Create tree
-			auto clockDomainTree = entity::model::ClockDomainNodeModels{};
+			AVDECC_ASSERT(false, "Unsupported DescriptorType");
+		}
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandGrandParent, la::avdecc::controller::model::AudioUnitNode const* const grandParent, la::avdecc::controller::model::StreamPortNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
+	{
+		// Create tree
+		auto controlTree = entity::model::ControlNodeModels{};
 
-			// Copy static and dynamic models
-			clockDomainTree.staticModel = node.staticModel;
-			clockDomainTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		controlTree.staticModel = node.staticModel;
+		controlTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].clockDomainModels[node.descriptorIndex] = std::move(clockDomainTree);
+		// Save
+		if (parent->descriptorType == entity::model::DescriptorType::StreamPortInput)
+		{
+			_entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortInputTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
 		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandParent*/, la::avdecc::controller::model::ClockDomainNode const* const /*parent*/, la::avdecc::controller::model::ClockSourceNode const& /*node*/) noexcept override
+		else if (parent->descriptorType == entity::model::DescriptorType::StreamPortOutput)
 		{
-			// Ignore virtual parenting
+			_entityTree->configurationTrees[grandGrandParent->descriptorIndex].audioUnitTrees[grandParent->descriptorIndex].streamPortOutputTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
 		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::TimingNode const& node) noexcept override
+		else
 		{
-			// Create tree
-			auto timingTree = entity::model::TimingNodeModels{};
+			AVDECC_ASSERT(false, "Unsupported DescriptorType");
+		}
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::AudioUnitNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
+	{
+		// Create tree
+		auto controlTree = entity::model::ControlNodeModels{};
 
-			// Copy static and dynamic models
-			timingTree.staticModel = node.staticModel;
-			timingTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		controlTree.staticModel = node.staticModel;
+		controlTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].timingModels[node.descriptorIndex] = std::move(timingTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::PtpInstanceNode const& node) noexcept override
-		{
-			// Create tree
-			auto ptpInstanceTree = entity::model::PtpInstanceTree{};
+		// Save
+		_entityTree->configurationTrees[grandParent->descriptorIndex].audioUnitTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
+	{
+		// Create tree
+		auto controlTree = entity::model::ControlNodeModels{};
 
-			// Copy static and dynamic models
-			ptpInstanceTree.staticModel = node.staticModel;
-			ptpInstanceTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		controlTree.staticModel = node.staticModel;
+		controlTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[parent->descriptorIndex].ptpInstanceTrees[node.descriptorIndex] = std::move(ptpInstanceTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandParent*/, la::avdecc::controller::model::TimingNode const* const /*parent*/, la::avdecc::controller::model::PtpInstanceNode const& /*node*/) noexcept override
-		{
-			// Ignore virtual parenting
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::PtpInstanceNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
-		{
-			// Create tree
-			auto controlTree = entity::model::ControlNodeModels{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::ClockDomainNode const& node) noexcept override
+	{
+		// Create tree
+		auto clockDomainTree = entity::model::ClockDomainNodeModels{};
 
-			// Copy static and dynamic models
-			controlTree.staticModel = node.staticModel;
-			controlTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		clockDomainTree.staticModel = node.staticModel;
+		clockDomainTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[grandParent->descriptorIndex].ptpInstanceTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::PtpInstanceNode const* const parent, la::avdecc::controller::model::PtpPortNode const& node) noexcept override
-		{
-			// Create tree
-			auto ptpPortTree = entity::model::PtpPortNodeModels{};
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].clockDomainModels[node.descriptorIndex] = std::move(clockDomainTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandParent*/, la::avdecc::controller::model::ClockDomainNode const* const /*parent*/, la::avdecc::controller::model::ClockSourceNode const& /*node*/) noexcept override
+	{
+		// Ignore virtual parenting
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::TimingNode const& node) noexcept override
+	{
+		// Create tree
+		auto timingTree = entity::model::TimingNodeModels{};
 
-			// Copy static and dynamic models
-			ptpPortTree.staticModel = node.staticModel;
-			ptpPortTree.dynamicModel = node.dynamicModel;
+		// Copy static and dynamic models
+		timingTree.staticModel = node.staticModel;
+		timingTree.dynamicModel = node.dynamicModel;
 
-			// Save
-			_entity._entityTree->configurationTrees[grandParent->descriptorIndex].ptpInstanceTrees[parent->descriptorIndex].ptpPortModels[node.descriptorIndex] = std::move(ptpPortTree);
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandGrandParent*/, la::avdecc::controller::model::TimingNode const* const /*grandParent*/, la::avdecc::controller::model::PtpInstanceNode const* const /*parent*/, la::avdecc::controller::model::ControlNode const& /*node*/) noexcept override
-		{
-			// Ignore virtual parenting
-		}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandGrandParent*/, la::avdecc::controller::model::TimingNode const* const /*grandParent*/, la::avdecc::controller::model::PtpInstanceNode const* const /*parent*/, la::avdecc::controller::model::PtpPortNode const& /*node*/) noexcept override
-		{
-			// Ignore virtual parenting
-		}
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].timingModels[node.descriptorIndex] = std::move(timingTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const parent, la::avdecc::controller::model::PtpInstanceNode const& node) noexcept override
+	{
+		// Create tree
+		auto ptpInstanceTree = entity::model::PtpInstanceTree{};
+
+		// Copy static and dynamic models
+		ptpInstanceTree.staticModel = node.staticModel;
+		ptpInstanceTree.dynamicModel = node.dynamicModel;
+
+		// Save
+		_entityTree->configurationTrees[parent->descriptorIndex].ptpInstanceTrees[node.descriptorIndex] = std::move(ptpInstanceTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandParent*/, la::avdecc::controller::model::TimingNode const* const /*parent*/, la::avdecc::controller::model::PtpInstanceNode const& /*node*/) noexcept override
+	{
+		// Ignore virtual parenting
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::PtpInstanceNode const* const parent, la::avdecc::controller::model::ControlNode const& node) noexcept override
+	{
+		// Create tree
+		auto controlTree = entity::model::ControlNodeModels{};
+
+		// Copy static and dynamic models
+		controlTree.staticModel = node.staticModel;
+		controlTree.dynamicModel = node.dynamicModel;
+
+		// Save
+		_entityTree->configurationTrees[grandParent->descriptorIndex].ptpInstanceTrees[parent->descriptorIndex].controlModels[node.descriptorIndex] = std::move(controlTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const grandParent, la::avdecc::controller::model::PtpInstanceNode const* const parent, la::avdecc::controller::model::PtpPortNode const& node) noexcept override
+	{
+		// Create tree
+		auto ptpPortTree = entity::model::PtpPortNodeModels{};
+
+		// Copy static and dynamic models
+		ptpPortTree.staticModel = node.staticModel;
+		ptpPortTree.dynamicModel = node.dynamicModel;
+
+		// Save
+		_entityTree->configurationTrees[grandParent->descriptorIndex].ptpInstanceTrees[parent->descriptorIndex].ptpPortModels[node.descriptorIndex] = std::move(ptpPortTree);
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandGrandParent*/, la::avdecc::controller::model::TimingNode const* const /*grandParent*/, la::avdecc::controller::model::PtpInstanceNode const* const /*parent*/, la::avdecc::controller::model::ControlNode const& /*node*/) noexcept override
+	{
+		// Ignore virtual parenting
+	}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandGrandParent*/, la::avdecc::controller::model::TimingNode const* const /*grandParent*/, la::avdecc::controller::model::PtpInstanceNode const* const /*parent*/, la::avdecc::controller::model::PtpPortNode const& /*node*/) noexcept override
+	{
+		// Ignore virtual parenting
+	}
 #ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*parent*/, la::avdecc::controller::model::RedundantStreamInputNode const& /*node*/) noexcept override {}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*parent*/, la::avdecc::controller::model::RedundantStreamOutputNode const& /*node*/) noexcept override {}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandParent*/, la::avdecc::controller::model::RedundantStreamNode const* const /*parent*/, la::avdecc::controller::model::StreamInputNode const& /*node*/) noexcept override {}
-		virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandParent*/, la::avdecc::controller::model::RedundantStreamNode const* const /*parent*/, la::avdecc::controller::model::StreamOutputNode const& /*node*/) noexcept override {}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*parent*/, la::avdecc::controller::model::RedundantStreamInputNode const& /*node*/) noexcept override {}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*parent*/, la::avdecc::controller::model::RedundantStreamOutputNode const& /*node*/) noexcept override {}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandParent*/, la::avdecc::controller::model::RedundantStreamNode const* const /*parent*/, la::avdecc::controller::model::StreamInputNode const& /*node*/) noexcept override {}
+	virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*grandParent*/, la::avdecc::controller::model::RedundantStreamNode const* const /*parent*/, la::avdecc::controller::model::StreamOutputNode const& /*node*/) noexcept override {}
 #endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
 
-		ControlledEntityImpl const& _entity;
-	};
+	std::optional<entity::model::EntityTree>& _entityTree;
+};
 
+entity::model::EntityTree const& ControlledEntityImpl::getEntityModelTree() const noexcept
+{
 	class DynamicModelVisitor : public la::avdecc::controller::model::EntityModelVisitor
 	{
 	public:
@@ -4323,7 +4469,7 @@ entity::model::EntityTree const& ControlledEntityImpl::getEntityModelTree() cons
 	if (!_entityTree)
 	{
 		// Visit the complete model, create static tree if not already created, and update dynamic info
-		auto visitor = FullModelVisitor{ *this };
+		auto visitor = FullModelVisitor{ _entityTree };
 		accept(&visitor, true);
 	}
 	else
@@ -4341,6 +4487,19 @@ entity::model::EntityTree const& ControlledEntityImpl::getEntityModelTree() cons
 	return *_entityTree;
 }
 
+entity::model::EntityTree ControlledEntityImpl::buildEntityModelTree() const noexcept
+{
+	auto entityTree = std::optional<entity::model::EntityTree>{};
+	auto visitor = FullModelVisitor{ entityTree };
+	accept(&visitor, true);
+
+	if (!entityTree)
+	{
+		return {};
+	}
+	return std::move(*entityTree);
+}
+
 void ControlledEntityImpl::switchToCachedTreeModelAccessStrategy() noexcept
 {
 	if (!_hasSwitchedToCachedTreeModelAccessStrategy)
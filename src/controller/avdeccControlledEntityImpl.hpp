@@ -41,6 +41,8 @@
 #include <thread>
 #include <tuple>
 #include <optional>
+#include <array>
+#include <cstddef>
 
 namespace la
 {
@@ -123,6 +125,7 @@ public:
 		GetStaticModel = 1u << 3, /** To get the static model (at least always retrieve the ENTITY_DESCRIPTOR) */
 		GetDescriptorDynamicInfo = 1u << 4, /** To get descriptor dynamic information in case we used a cached version of the static model */
 		GetDynamicInfo = 1u << 5, /** To get all other dynamic information (not directly contained in descriptors) */
+		ResyncDynamicInfo = 1u << 6, /** To get again all the dynamic information, after an unsolicited notification loss */
 	};
 	using EnumerationSteps = utils::EnumBitfield<EnumerationStep>;
 
@@ -190,6 +193,7 @@ public:
 	static_assert(sizeof(DynamicInfoKey) >= sizeof(DynamicInfoType) + sizeof(entity::model::DescriptorIndex) + sizeof(std::uint16_t), "DynamicInfoKey size must be greater or equal to DynamicInfoType + DescriptorIndex + std::uint16_t");
 	using DescriptorDynamicInfoKey = std::uint64_t;
 	static_assert(sizeof(DescriptorDynamicInfoKey) >= sizeof(DescriptorDynamicInfoType) + sizeof(entity::model::DescriptorIndex), "DescriptorDynamicInfoKey size must be greater or equal to DescriptorDynamicInfoType + DescriptorIndex");
+	using PackedControlValuesDecodedHandler = void (*)(ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, entity::model::ControlValues const& controlValues);
 
 	/** Constructor */
 	ControlledEntityImpl(la::avdecc::entity::Entity const& entity, LockInformation::SharedPointer const& sharedLock, bool const isVirtual) noexcept;
@@ -331,6 +335,8 @@ public:
 	void removeStreamPortOutputAudioMappings(entity::model::StreamPortIndex const streamPortIndex, entity::model::AudioMappings const& mappings, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior);
 	void setClockSource(entity::model::ClockDomainIndex const clockDomainIndex, entity::model::ClockSourceIndex const clockSourceIndex, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior);
 	void setControlValues(entity::model::ControlIndex const controlIndex, entity::model::ControlValues const& controlValues, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior);
+	void setPackedControlValues(entity::model::ControlIndex const controlIndex, entity::model::ControlValueType::Type const controlValueType, std::uint16_t const numberOfValues, MemoryBuffer const& packedControlValues, PackedControlValuesDecodedHandler const onDecoded) noexcept; // Stores the values to be decoded on first access (lazy control values decoding), onDecoded being called once they are
+	std::optional<entity::model::ControlValues> decodePackedControlValues(entity::model::ControlIndex const controlIndex) noexcept; // Decodes the values stored by setPackedControlValues, if not decoded yet, and returns them
 	void setMemoryObjectLength(entity::model::ConfigurationIndex const configurationIndex, entity::model::MemoryObjectIndex const memoryObjectIndex, std::uint64_t const length, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior);
 
 	// Setters of the global state
@@ -359,7 +365,7 @@ public:
 	void setDiagnostics(Diagnostics const& diags) noexcept;
 
 	// Setters of the Model from AEM Descriptors (including DescriptorDynamic info)
-	bool setCachedEntityNode(model::EntityNode&& cachedNode, entity::model::EntityDescriptor const& descriptor, bool const forAllConfiguration) noexcept; // Returns true if the cached EntityNode is accepted (and set) for this entity
+	bool setCachedEntityNode(model::EntityNode const& cachedNode, entity::model::EntityDescriptor const& descriptor, bool const forAllConfiguration) noexcept; // Returns true if the cached EntityNode is accepted (and copied) for this entity
 	void setEntityDescriptor(entity::model::EntityDescriptor const& descriptor) noexcept;
 	void setConfigurationDescriptor(entity::model::ConfigurationDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex) noexcept;
 	void setAudioUnitDescriptor(entity::model::AudioUnitDescriptor const& descriptor, entity::model::ConfigurationIndex const configurationIndex, entity::model::AudioUnitIndex const audioUnitIndex) noexcept;
@@ -440,6 +446,9 @@ public:
 	bool gotAllExpectedDescriptorDynamicInfo() const noexcept;
 	std::pair<bool, std::chrono::milliseconds> getQueryDescriptorDynamicInfoRetryTimer() noexcept;
 
+	// Releases the memory used by the expected queries (only if none is still expected)
+	void releaseExpectedQueriesMemory() noexcept;
+
 	// Other getters/setters
 	entity::Entity& getEntity() noexcept;
 	void setIdentifyControlIndex(entity::model::ControlIndex const identifyControlIndex) noexcept;
@@ -469,7 +478,8 @@ public:
 	Diagnostics& getDiagnostics() noexcept;
 	bool hasLostAemUnsolicitedNotification(protocol::AecpSequenceID const sequenceID) noexcept;
 	bool hasLostMvuUnsolicitedNotification(protocol::AecpSequenceID const sequenceID) noexcept;
-	entity::model::EntityTree const& getEntityModelTree() const noexcept;
+	entity::model::EntityTree const& getEntityModelTree() const noexcept; // Kept and refreshed by subsequent calls (for repeated serializations)
+	entity::model::EntityTree buildEntityModelTree() const noexcept; // Not kept by the entity (for one-time uses)
 	void buildEntityModelGraph(entity::model::EntityTree const& entityTree) noexcept;
 
 	// Static methods
@@ -490,6 +500,20 @@ protected:
 	using RedundantStreamCategory = std::unordered_map<entity::model::StreamIndex, entity::model::StreamIndex>;
 
 private:
+	// Private types
+	struct PackedControlValues
+	{
+		entity::model::ControlValueType::Type controlValueType{ entity::model::ControlValueType::Type::Expansion };
+		std::uint16_t numberOfValues{ 0u };
+		MemoryBuffer packedValues{}; // Buffer is kept between updates of the same control
+		PackedControlValuesDecodedHandler onDecoded{ nullptr };
+		bool isDirty{ false }; // True if packedValues have not been decoded yet
+	};
+	template<typename Key>
+	using ExpectedKeys = std::unordered_set<Key, std::hash<Key>, std::equal_to<Key>, utils::ArenaAllocator<Key>>;
+	template<typename Key>
+	using ExpectedKeysPerConfiguration = std::unordered_map<entity::model::ConfigurationIndex, ExpectedKeys<Key>, std::hash<entity::model::ConfigurationIndex>, std::equal_to<entity::model::ConfigurationIndex>, utils::ArenaAllocator<std::pair<entity::model::ConfigurationIndex const, ExpectedKeys<Key>>>>;
+
 	// Private methods
 	void switchToCachedTreeModelAccessStrategy() noexcept;
 	std::tuple<bool, entity::model::ConfigurationIndex> isEntityModelComplete(model::EntityNode const& entityNode, std::uint16_t const configurationsCount) const noexcept;
@@ -500,6 +524,9 @@ private:
 	void fixStreamPortMappings(model::ConfigurationNode& configNode) noexcept;
 	void setDefaultPresentationTimes(model::ConfigurationNode& configNode) noexcept;
 	bool hasLostUnsolicitedNotification(protocol::AecpSequenceID const sequenceID, std::optional<protocol::AecpSequenceID>& expectedSequenceID) noexcept;
+	std::optional<entity::model::ControlValues> decodePackedControlValues(entity::model::ControlIndex const controlIndex, PackedControlValues& packedControlValues) const noexcept;
+	void decodePackedControlValues(std::map<entity::model::ControlIndex, model::ControlNode> const& controls) const noexcept; // Decodes the values of the specified controls stored by setPackedControlValues and not decoded yet
+	void decodeAllPackedControlValues() const noexcept; // Decodes all the values stored by setPackedControlValues and not decoded yet
 #ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
 	void buildRedundancyNodes(model::ConfigurationNode& configNode) noexcept;
 #endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
@@ -529,11 +556,12 @@ private:
 	bool _advertised{ false }; // Has the entity been advertised to the observers
 	bool _expectedCheckDynamicInfoSupported{ false };
 	bool _expectedRegisterUnsol{ false };
-	std::unordered_set<std::uint16_t> _expectedPackedDynamicInfo{};
-	std::unordered_set<MilanInfoKey> _expectedMilanInfo{};
-	std::unordered_map<entity::model::ConfigurationIndex, std::unordered_set<DescriptorKey>> _expectedDescriptors{};
-	std::unordered_map<entity::model::ConfigurationIndex, std::unordered_set<DynamicInfoKey>> _expectedDynamicInfo{};
-	std::unordered_map<entity::model::ConfigurationIndex, std::unordered_set<DescriptorDynamicInfoKey>> _expectedDescriptorDynamicInfo{};
+	utils::MemoryArena _expectedQueriesArena{}; // Expected queries are set and cleared for each descriptor during enumeration (must be declared before the containers using it), its blocks are released once enumeration is complete
+	ExpectedKeys<std::uint16_t> _expectedPackedDynamicInfo{ ExpectedKeys<std::uint16_t>::allocator_type{ _expectedQueriesArena } };
+	ExpectedKeys<MilanInfoKey> _expectedMilanInfo{ ExpectedKeys<MilanInfoKey>::allocator_type{ _expectedQueriesArena } };
+	ExpectedKeysPerConfiguration<DescriptorKey> _expectedDescriptors{ ExpectedKeysPerConfiguration<DescriptorKey>::allocator_type{ _expectedQueriesArena } };
+	ExpectedKeysPerConfiguration<DynamicInfoKey> _expectedDynamicInfo{ ExpectedKeysPerConfiguration<DynamicInfoKey>::allocator_type{ _expectedQueriesArena } };
+	ExpectedKeysPerConfiguration<DescriptorDynamicInfoKey> _expectedDescriptorDynamicInfo{ ExpectedKeysPerConfiguration<DescriptorDynamicInfoKey>::allocator_type{ _expectedQueriesArena } };
 	std::unordered_map<entity::model::AvbInterfaceIndex, InterfaceLinkStatus> _avbInterfaceLinkStatus{}; // Link status for each AvbInterface (true = up or unknown, false = down)
 	model::AcquireState _acquireState{ model::AcquireState::Undefined };
 	UniqueIdentifier _owningControllerID{}; // EID of the controller currently owning (who acquired) this entity
@@ -555,6 +583,8 @@ private:
 	TreeModelAccessStrategy::UniquePointer _treeModelAccess{ nullptr };
 	// Cached Information
 	mutable std::optional<entity::model::EntityTree> _entityTree{};
+	mutable std::unordered_map<entity::model::ControlIndex, PackedControlValues> _packedControlValues{}; // Control values of the current configuration waiting to be decoded
+	mutable std::size_t _dirtyPackedControlValuesCount{ 0u }; // Count of PackedControlValues that are isDirty
 	RedundantStreamCategory _redundantPrimaryStreamInputs{}; // Cached indexes of all Redundant Primary Streams (a non-redundant stream won't be listed here)
 	RedundantStreamCategory _redundantPrimaryStreamOutputs{}; // Cached indexes of all Redundant Primary Streams (a non-redundant stream won't be listed here)
 	RedundantStreamCategory _redundantSecondaryStreamInputs{}; // Cached indexes of all Redundant Secondary Streams
@@ -43,6 +43,7 @@
 #include <la/avdecc/executor.hpp>
 #include <la/avdecc/utils.hpp>
 
+#include <filesystem>
 #include <fstream>
 #include <unordered_set>
 #include <map>
@@ -1210,7 +1211,58 @@ void ControllerImpl::updateClockSource(ControlledEntityImpl& controlledEntity, e
 	}
 }
 
-bool ControllerImpl::updateControlValues(ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, MemoryBuffer const& packedControlValues, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept
+/** Returns the size of the packed dynamic values of the specified type, if it does not depend on the values themselves */
+static std::optional<size_t> getPackedControlValuesSize(entity::model::ControlValueType::Type const controlValueType, std::uint16_t const numberOfValues) noexcept
+{
+	switch (controlValueType)
+	{
+		// Linear and Array Values - IEEE1722.1-2013 Clause 7.3.5.2.1 and 7.3.5.2.3 (one current value per value)
+		case entity::model::ControlValueType::Type::ControlLinearInt8:
+		case entity::model::ControlValueType::Type::ControlLinearUInt8:
+		case entity::model::ControlValueType::Type::ControlArrayInt8:
+		case entity::model::ControlValueType::Type::ControlArrayUInt8:
+			return numberOfValues * sizeof(std::uint8_t);
+		case entity::model::ControlValueType::Type::ControlLinearInt16:
+		case entity::model::ControlValueType::Type::ControlLinearUInt16:
+		case entity::model::ControlValueType::Type::ControlArrayInt16:
+		case entity::model::ControlValueType::Type::ControlArrayUInt16:
+			return numberOfValues * sizeof(std::uint16_t);
+		case entity::model::ControlValueType::Type::ControlLinearInt32:
+		case entity::model::ControlValueType::Type::ControlLinearUInt32:
+		case entity::model::ControlValueType::Type::ControlLinearFloat:
+		case entity::model::ControlValueType::Type::ControlArrayInt32:
+		case entity::model::ControlValueType::Type::ControlArrayUInt32:
+		case entity::model::ControlValueType::Type::ControlArrayFloat:
+			return numberOfValues * sizeof(std::uint32_t);
+		case entity::model::ControlValueType::Type::ControlLinearInt64:
+		case entity::model::ControlValueType::Type::ControlLinearUInt64:
+		case entity::model::ControlValueType::Type::ControlLinearDouble:
+		case entity::model::ControlValueType::Type::ControlArrayInt64:
+		case entity::model::ControlValueType::Type::ControlArrayUInt64:
+		case entity::model::ControlValueType::Type::ControlArrayDouble:
+			return numberOfValues * sizeof(std::uint64_t);
+		// Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 (always one current value)
+		case entity::model::ControlValueType::Type::ControlSelectorInt8:
+		case entity::model::ControlValueType::Type::ControlSelectorUInt8:
+			return sizeof(std::uint8_t);
+		case entity::model::ControlValueType::Type::ControlSelectorInt16:
+		case entity::model::ControlValueType::Type::ControlSelectorUInt16:
+		case entity::model::ControlValueType::Type::ControlSelectorString:
+			return sizeof(std::uint16_t);
+		case entity::model::ControlValueType::Type::ControlSelectorInt32:
+		case entity::model::ControlValueType::Type::ControlSelectorUInt32:
+		case entity::model::ControlValueType::Type::ControlSelectorFloat:
+			return sizeof(std::uint32_t);
+		case entity::model::ControlValueType::Type::ControlSelectorInt64:
+		case entity::model::ControlValueType::Type::ControlSelectorUInt64:
+		case entity::model::ControlValueType::Type::ControlSelectorDouble:
+			return sizeof(std::uint64_t);
+		default:
+			return std::nullopt;
+	}
+}
+
+bool ControllerImpl::updateControlValues(ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, MemoryBuffer const& packedControlValues, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior, bool const allowLazyDecoding) const noexcept
 {
 	AVDECC_ASSERT(_controller->isSelfLocked(), "Should only be called from the network thread (where ProtocolInterface is locked)");
 
@@ -1225,29 +1277,34 @@ bool ControllerImpl::updateControlValues(ControlledEntityImpl& controlledEntity,
 	{
 		auto const controlValueType = controlStaticModel->controlValueType.getType();
 		auto const numberOfValues = controlStaticModel->numberOfValues;
-		auto const controlValuesOpt = entity::model::unpackDynamicControlValues(packedControlValues, controlValueType, numberOfValues);
 		auto const controlType = controlStaticModel->controlType;
+		auto const isIdentifyControl = entity::model::StandardControlType::Identify == controlType.getValue();
+
+		// Lazy decoding: keep the values packed until they are accessed (they are validated when decoded). Identify control is always decoded as it triggers identification notifications
+		if (allowLazyDecoding && _lazyControlValuesDecoding && controlledEntity.wasAdvertised() && !isIdentifyControl && !isSubscribedToControlValues(controlledEntity.getEntity().getEntityID(), controlIndex))
+		{
+			// Values of unknown size cannot be checked without being decoded, decode them right away
+			if (auto const packedSizeOpt = getPackedControlValuesSize(controlValueType, numberOfValues))
+			{
+				// Reject values that could not be decoded, the same way unpacking them does
+				if (packedControlValues.size() < *packedSizeOpt)
+				{
+					LOG_CONTROLLER_WARN(controlledEntity.getEntity().getEntityID(), "Packed values of CONTROL {} are too small ({} bytes, expected {})", controlIndex, packedControlValues.size(), *packedSizeOpt);
+					return false;
+				}
+				controlledEntity.setPackedControlValues(controlIndex, controlValueType, numberOfValues, packedControlValues, &ControllerImpl::onPackedControlValuesDecoded);
+				return true;
+			}
+		}
+
+		auto const controlValuesOpt = entity::model::unpackDynamicControlValues(packedControlValues, controlValueType, numberOfValues);
 
 		if (controlValuesOpt)
 		{
 			auto const& controlValues = *controlValuesOpt;
 
 			// Validate ControlValues
-			auto const [validationResult, specClause, message] = validateControlValues(controlledEntity.getEntity().getEntityID(), controlIndex, controlType, controlValueType, controlStaticModel->values, controlValues);
-			auto isOutOfBounds = false;
-			switch (validationResult)
-			{
-				case DynamicControlValuesValidationResultKind::InvalidValues:
-					// Flag the entity as "Not fully IEEE1722.1 compliant"
-					removeCompatibilityFlag(this, controlledEntity, ControlledEntity::CompatibilityFlag::IEEE17221, specClause, message);
-					break;
-				case DynamicControlValuesValidationResultKind::CurrentValueOutOfRange:
-					isOutOfBounds = true;
-					break;
-				default:
-					break;
-			}
-			updateControlCurrentValueOutOfBounds(this, controlledEntity, controlIndex, isOutOfBounds);
+			checkControlValues(this, controlledEntity, controlIndex, *controlStaticModel, controlValues);
 			controlledEntity.setControlValues(controlIndex, controlValues, notFoundBehavior);
 
 			// Entity was advertised to the user, notify observers
@@ -1256,7 +1313,7 @@ bool ControllerImpl::updateControlValues(ControlledEntityImpl& controlledEntity,
 				notifyObserversMethod<Controller::Observer>(&Controller::Observer::onControlValuesChanged, this, &controlledEntity, controlIndex, controlValues);
 
 				// Check for Identify Control
-				if (entity::model::StandardControlType::Identify == controlType.getValue() && controlValueType == entity::model::ControlValueType::Type::ControlLinearUInt8 && numberOfValues == 1)
+				if (isIdentifyControl && controlValueType == entity::model::ControlValueType::Type::ControlLinearUInt8 && numberOfValues == 1)
 				{
 					auto const identifyOpt = getIdentifyControlValue(controlValues);
 					if (identifyOpt)
@@ -1280,6 +1337,18 @@ bool ControllerImpl::updateControlValues(ControlledEntityImpl& controlledEntity,
 	return false;
 }
 
+bool ControllerImpl::isSubscribedToControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex) const noexcept
+{
+	// Lock to protect _controlValuesSubscriptions
+	auto const lg = std::lock_guard{ _lock };
+
+	if (auto const it = _controlValuesSubscriptions.find(entityID); it != _controlValuesSubscriptions.end())
+	{
+		return it->second.count(controlIndex) != 0;
+	}
+	return false;
+}
+
 void ControllerImpl::updateStreamInputRunningStatus(ControlledEntityImpl& controlledEntity, entity::model::StreamIndex const streamIndex, bool const isRunning, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept
 {
 	AVDECC_ASSERT(_controller->isSelfLocked(), "Should only be called from the network thread (where ProtocolInterface is locked)");
@@ -2190,6 +2259,41 @@ void ControllerImpl::updateControlCurrentValueOutOfBounds(ControllerImpl const*
 	}
 }
 
+void ControllerImpl::checkControlValues(ControllerImpl const* const controller, ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, entity::model::ControlNodeStaticModel const& controlStaticModel, entity::model::ControlValues const& controlValues) noexcept
+{
+	auto const [validationResult, specClause, message] = validateControlValues(controlledEntity.getEntity().getEntityID(), controlIndex, controlStaticModel.controlType, controlStaticModel.controlValueType.getType(), controlStaticModel.values, controlValues);
+	auto isOutOfBounds = false;
+	switch (validationResult)
+	{
+		case DynamicControlValuesValidationResultKind::InvalidValues:
+			// Flag the entity as "Not fully IEEE1722.1 compliant"
+			removeCompatibilityFlag(controller, controlledEntity, ControlledEntity::CompatibilityFlag::IEEE17221, specClause, message);
+			break;
+		case DynamicControlValuesValidationResultKind::CurrentValueOutOfRange:
+			isOutOfBounds = true;
+			break;
+		default:
+			break;
+	}
+	updateControlCurrentValueOutOfBounds(controller, controlledEntity, controlIndex, isOutOfBounds);
+}
+
+void ControllerImpl::onPackedControlValuesDecoded(ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, entity::model::ControlValues const& controlValues) noexcept
+{
+	auto const currentConfigurationIndexOpt = controlledEntity.getCurrentConfigurationIndex(TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+	if (!currentConfigurationIndexOpt)
+	{
+		return;
+	}
+
+	auto const* const controlStaticModel = controlledEntity.getModelAccessStrategy().getControlNodeStaticModel(*currentConfigurationIndexOpt, controlIndex, TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+	if (controlStaticModel)
+	{
+		// Values are decoded when the model is accessed, not from the network thread: update the entity but do not notify (the values themselves are not notified either)
+		checkControlValues(nullptr, controlledEntity, controlIndex, *controlStaticModel, controlValues);
+	}
+}
+
 void ControllerImpl::updateStreamInputLatency(ControlledEntityImpl& controlledEntity, entity::model::StreamIndex const streamIndex, bool const isOverLatency) const noexcept
 {
 	AVDECC_ASSERT(_controller->isSelfLocked(), "Should only be called from the network thread (where ProtocolInterface is locked)");
@@ -3297,7 +3401,7 @@ void ControllerImpl::getStaticModel(ControlledEntityImpl* const entity) noexcept
 	queryInformation(entity, 0, entity::model::DescriptorType::Entity, 0);
 }
 
-void ControllerImpl::getDynamicInfo(ControlledEntityImpl* const entity) noexcept
+entity::controller::DynamicInfoParameters ControllerImpl::queryDynamicInfo(ControlledEntityImpl* const entity) noexcept
 {
 	class DynamicInfoVisitor : public model::EntityModelVisitor
 	{
@@ -3534,8 +3638,14 @@ void ControllerImpl::getDynamicInfo(ControlledEntityImpl* const entity) noexcept
 	// Visit all known descriptor and get associated dynamic information
 	auto visitor = DynamicInfoVisitor{ this, entity };
 	entity->accept(&visitor, false);
-	// Flush all packed dynamic info queries
-	flushPackedDynamicInfoQueries(entity, visitor.getDynamicInfoParameters(), ControlledEntityImpl::EnumerationStep::GetDynamicInfo);
+
+	return visitor.getDynamicInfoParameters();
+}
+
+void ControllerImpl::getDynamicInfo(ControlledEntityImpl* const entity) noexcept
+{
+	// Query dynamic information and flush all packed dynamic info queries
+	flushPackedDynamicInfoQueries(entity, queryDynamicInfo(entity), ControlledEntityImpl::EnumerationStep::GetDynamicInfo);
 
 	// Got all expected dynamic information
 	if (entity->gotAllExpectedDynamicInfo())
@@ -3546,7 +3656,7 @@ void ControllerImpl::getDynamicInfo(ControlledEntityImpl* const entity) noexcept
 	}
 }
 
-void ControllerImpl::getDescriptorDynamicInfo(ControlledEntityImpl* const entity) noexcept
+entity::controller::DynamicInfoParameters ControllerImpl::queryDescriptorDynamicInfo(ControlledEntityImpl* const entity) noexcept
 {
 	auto const caps = entity->getEntity().getEntityCapabilities();
 	// Check if AEM is supported by this entity
@@ -4018,10 +4128,18 @@ void ControllerImpl::getDescriptorDynamicInfo(ControlledEntityImpl* const entity
 		// Visit the model, and retrieve dynamic info
 		auto visitor = DynamicInfoModelVisitor{ this, entity };
 		entity->accept(&visitor, true);
-		// Flush all packed dynamic info queries
-		flushPackedDynamicInfoQueries(entity, visitor.getDynamicInfoParameters(), ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo);
+
+		return visitor.getDynamicInfoParameters();
 	}
 
+	return {};
+}
+
+void ControllerImpl::getDescriptorDynamicInfo(ControlledEntityImpl* const entity) noexcept
+{
+	// Query descriptor dynamic information and flush all packed dynamic info queries
+	flushPackedDynamicInfoQueries(entity, queryDescriptorDynamicInfo(entity), ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo);
+
 	// Get all expected descriptor dynamic information
 	if (entity->gotAllExpectedDescriptorDynamicInfo())
 	{
@@ -4031,6 +4149,51 @@ void ControllerImpl::getDescriptorDynamicInfo(ControlledEntityImpl* const entity
 	}
 }
 
+void ControllerImpl::resyncDynamicInfo(ControlledEntityImpl* const entity) noexcept
+{
+	// Clear this enumeration step right away, a notification lost while the queries are inflight will schedule a new resync
+	entity->clearEnumerationStep(ControlledEntityImpl::EnumerationStep::ResyncDynamicInfo);
+
+	// Query all descriptor dynamic information and dynamic information, the same way a full enumeration using a cached model does
+	auto dynamicInfoParameters = queryDescriptorDynamicInfo(entity);
+	auto const otherDynamicInfoParameters = queryDynamicInfo(entity);
+	dynamicInfoParameters.insert(dynamicInfoParameters.end(), otherDynamicInfoParameters.begin(), otherDynamicInfoParameters.end());
+
+	// Flush all packed dynamic info queries
+	flushPackedDynamicInfoQueries(entity, dynamicInfoParameters, ControlledEntityImpl::EnumerationStep::ResyncDynamicInfo);
+
+	// Got all expected dynamic information (nothing had to be queried)
+	if (entity->gotAllExpectedPackedDynamicInfo() && entity->gotAllExpectedDynamicInfo() && entity->gotAllExpectedDescriptorDynamicInfo())
+	{
+		checkEnumerationSteps(entity);
+	}
+}
+
+void ControllerImpl::scheduleDynamicInfoResync(ControlledEntityImpl* const entity) noexcept
+{
+	// The entity will not be advertised, no need to resync
+	if (entity->gotFatalEnumerationError())
+	{
+		return;
+	}
+
+	// Already scheduled
+	auto const steps = entity->getEnumerationSteps();
+	if (steps.test(ControlledEntityImpl::EnumerationStep::ResyncDynamicInfo))
+	{
+		return;
+	}
+
+	LOG_CONTROLLER_WARN(entity->getEntity().getEntityID(), "Resyncing dynamic information");
+
+	// Resync as the last enumeration step, right now if the entity is already fully enumerated
+	entity->addEnumerationStep(ControlledEntityImpl::EnumerationStep::ResyncDynamicInfo);
+	if (steps.empty())
+	{
+		checkEnumerationSteps(entity);
+	}
+}
+
 void ControllerImpl::flushPackedDynamicInfoQueries(ControlledEntityImpl* const entity, entity::controller::DynamicInfoParameters const& dynamicInfoParameters, ControlledEntityImpl::EnumerationStep const step) noexcept
 {
 	if (dynamicInfoParameters.empty())
@@ -4393,6 +4556,189 @@ private:
 };
 
 
+bool ControllerImpl::requestEnumeration(ControlledEntityImpl const& entity) noexcept
+{
+	auto const& e = entity.getEntity();
+	auto const entityID = e.getEntityID();
+	auto const entityModelID = e.getEntityModelID();
+	auto priority = EnumerationScheduler::Priority::Default;
+	auto rank = std::size_t{ 0u };
+
+	// Lock to protect _enumerationScheduler and _priorityEnumerations
+	auto const lg = std::lock_guard{ _lock };
+
+	// Entities with a cached EntityModel are the fastest to enumerate, start them first
+	if (auto const& entityModelCache = EntityModelCache::getInstance(); entityModelCache.isCacheEnabled() && entityModelID && !entityModelID.isGroupIdentifier() && EntityModelCache::isValidEntityModelID(entityModelID) && entityModelCache.hasCachedEntityModel(entityModelID))
+	{
+		priority = EnumerationScheduler::Priority::CachedModel;
+	}
+	else if (auto const priorityIt = std::find(_priorityEnumerations.begin(), _priorityEnumerations.end(), entityID); priorityIt != _priorityEnumerations.end())
+	{
+		priority = EnumerationScheduler::Priority::UserDeclared;
+		rank = static_cast<std::size_t>(std::distance(_priorityEnumerations.begin(), priorityIt));
+	}
+
+	return _enumerationScheduler.requestEnumeration(entityID, priority, rank);
+}
+
+void ControllerImpl::releaseEnumeration(UniqueIdentifier const entityID) noexcept
+{
+	auto entitiesToStart = std::vector<UniqueIdentifier>{};
+	{
+		// Lock to protect _enumerationScheduler
+		auto const lg = std::lock_guard{ _lock };
+		entitiesToStart = _enumerationScheduler.releaseEnumeration(entityID);
+	}
+
+	startEnumerations(entitiesToStart);
+}
+
+void ControllerImpl::startEnumerations(std::vector<UniqueIdentifier> const& entityIDs) noexcept
+{
+	for (auto const entityID : entityIDs)
+	{
+		// Take a "scoped locked" shared copy of the ControlledEntity
+		auto controlledEntity = getControlledEntityImplGuard(entityID);
+
+		if (controlledEntity)
+		{
+			LOG_CONTROLLER_TRACE(entityID, "Starting delayed enumeration");
+
+			// Save the time we start enumeration
+			controlledEntity->setStartEnumerationTime(std::chrono::steady_clock::now());
+
+			// Check first enumeration step
+			checkEnumerationSteps(controlledEntity.get());
+		}
+		else
+		{
+			// Entity is gone, free its slot
+			releaseEnumeration(entityID);
+		}
+	}
+}
+
+void ControllerImpl::setFatalEnumerationError(ControlledEntityImpl* const entity) noexcept
+{
+	entity->setGetFatalEnumerationError();
+
+	// Enumeration is stopped, let a waiting entity start its own
+	releaseEnumeration(entity->getEntity().getEntityID());
+}
+
+void ControllerImpl::loadPersistedEntityModels([[maybe_unused]] std::string const& directoryPath, [[maybe_unused]] std::vector<UniqueIdentifier> const& entityModelIDs) noexcept
+{
+#ifdef ENABLE_AVDECC_FEATURE_JSON
+	auto& entityModelCache = EntityModelCache::getInstance();
+
+	for (auto const entityModelID : entityModelIDs)
+	{
+		// Persistence disabled (or controller destroyed) in the meantime
+		if (_shouldStopLoadingPersistedModels || !entityModelCache.isCacheEnabled())
+		{
+			return;
+		}
+
+		// Already loaded, or enumerated from an entity in the meantime
+		if (!entityModelCache.isPersistedEntityModel(entityModelID))
+		{
+			continue;
+		}
+
+		if (auto persistedModel = loadPersistedEntityModel(directoryPath, entityModelID); persistedModel)
+		{
+			auto& [entityNode, isFullModel] = *persistedModel;
+			entityModelCache.cacheEntityModel(entityModelID, std::move(entityNode), isFullModel);
+			LOG_CONTROLLER_INFO(_controller->getEntityID(), "AEM-CACHE: Loaded persisted model for EntityModelID {}", utils::toHexString(entityModelID, true, false));
+		}
+		// Invalid (or outdated) file, discard it unless the model has been enumerated (and persisted again) in the meantime
+		else if (!entityModelCache.getCachedEntityModel(entityModelID))
+		{
+			entityModelCache.setPersistedEntityModel(entityModelID, false);
+			auto ec = std::error_code{};
+			std::filesystem::remove(utils::filePathFromUTF8String(directoryPath) / EntityModelCache::getPersistedEntityModelFileName(entityModelID), ec);
+			LOG_CONTROLLER_WARN(_controller->getEntityID(), "AEM-CACHE: Discarded invalid persisted model for EntityModelID {}", utils::toHexString(entityModelID, true, false));
+		}
+	}
+#endif // ENABLE_AVDECC_FEATURE_JSON
+}
+
+void ControllerImpl::stopLoadingPersistedEntityModels() noexcept
+{
+	_shouldStopLoadingPersistedModels = true;
+	if (_persistedModelsLoaderThread.joinable())
+	{
+		_persistedModelsLoaderThread.join();
+	}
+	_shouldStopLoadingPersistedModels = false;
+}
+
+void ControllerImpl::persistEntityModel([[maybe_unused]] ControlledEntityImpl const& controlledEntity, [[maybe_unused]] bool const isFullModel) const noexcept
+{
+#ifdef ENABLE_AVDECC_FEATURE_JSON
+	auto& entityModelCache = EntityModelCache::getInstance();
+	auto const directoryPath = entityModelCache.getPersistenceDirectory();
+	if (!directoryPath)
+	{
+		return;
+	}
+
+	auto const& e = controlledEntity.getEntity();
+	auto const entityID = e.getEntityID();
+	auto const entityModelID = e.getEntityModelID();
+
+	try
+	{
+		auto object = json{};
+		object[jsonSerializer::keyName::EntityModelCache_DumpVersion] = jsonSerializer::keyValue::EntityModelCache_DumpVersion;
+		object[jsonSerializer::keyName::ControlledEntity_EntityModelID] = entityModelID;
+		object[jsonSerializer::keyName::EntityModelCache_FullModel] = isFullModel;
+		// A persisted model is always validated against its checksum when loaded
+		auto const checksum = Controller::computeEntityModelChecksum(controlledEntity, jsonSerializer::keyValue::EntityModelCache_ChecksumVersion);
+		if (!checksum)
+		{
+			LOG_CONTROLLER_WARN(entityID, "AEM-CACHE: Failed to persist model for EntityModelID {}: Cannot compute its checksum", utils::toHexString(entityModelID, true, false));
+			return;
+		}
+		object[jsonSerializer::keyName::EntityModelCache_Checksum] = *checksum;
+		object[jsonSerializer::keyName::ControlledEntity_EntityModel] = entity::model::jsonSerializer::createJsonObject(controlledEntity.buildEntityModelTree(), entity::model::jsonSerializer::Flags{ entity::model::jsonSerializer::Flag::ProcessStaticModel, entity::model::jsonSerializer::Flag::BinaryFormat });
+		auto const binary = json::to_msgpack(object);
+
+		// Write to a temporary file first, then rename it so a persisted model is never partially written
+		auto const filePath = utils::filePathFromUTF8String(*directoryPath) / EntityModelCache::getPersistedEntityModelFileName(entityModelID);
+		auto tempFilePath = filePath;
+		tempFilePath += ".tmp";
+		{
+			auto ofs = std::ofstream{ tempFilePath, std::ios::binary | std::ios::out };
+			ofs.write(reinterpret_cast<char const*>(binary.data()), binary.size() * sizeof(decltype(binary)::value_type));
+			ofs.close();
+			if (!ofs)
+			{
+				auto ec = std::error_code{};
+				std::filesystem::remove(tempFilePath, ec);
+				LOG_CONTROLLER_WARN(entityID, "AEM-CACHE: Failed to persist model for EntityModelID {}: Cannot write to {}", utils::toHexString(entityModelID, true, false), *directoryPath);
+				return;
+			}
+		}
+		auto ec = std::error_code{};
+		std::filesystem::rename(tempFilePath, filePath, ec);
+		if (ec)
+		{
+			std::filesystem::remove(tempFilePath, ec);
+			LOG_CONTROLLER_WARN(entityID, "AEM-CACHE: Failed to persist model for EntityModelID {}: {}", utils::toHexString(entityModelID, true, false), ec.message());
+			return;
+		}
+
+		entityModelCache.setPersistedEntityModel(entityModelID, true);
+		LOG_CONTROLLER_INFO(entityID, "AEM-CACHE: Persisted model for EntityModelID {}", utils::toHexString(entityModelID, true, false));
+	}
+	catch (std::exception const& e)
+	{
+		LOG_CONTROLLER_WARN(entityID, "AEM-CACHE: Failed to persist model for EntityModelID {}: {}", utils::toHexString(entityModelID, true, false), e.what());
+	}
+#endif // ENABLE_AVDECC_FEATURE_JSON
+}
+
 void ControllerImpl::checkEnumerationSteps(ControlledEntityImpl* const controlledEntity) noexcept
 {
 	auto& entity = *controlledEntity;
@@ -4436,6 +4782,18 @@ void ControllerImpl::checkEnumerationSteps(ControlledEntityImpl* const controlle
 		getDynamicInfo(controlledEntity);
 		return;
 	}
+	// Get again the dynamic information possibly changed by a lost unsolicited notification
+	if (steps.test(ControlledEntityImpl::EnumerationStep::ResyncDynamicInfo))
+	{
+		resyncDynamicInfo(controlledEntity);
+		return;
+	}
+
+	// Enumeration is complete, let a waiting entity start its own
+	releaseEnumeration(entity.getEntity().getEntityID());
+
+	// No more queries are expected, give their memory back
+	entity.releaseExpectedQueriesMemory();
 
 	// Ready to advertise the entity
 	if (!entity.wasAdvertised())
@@ -4467,13 +4825,21 @@ void ControllerImpl::checkEnumerationSteps(ControlledEntityImpl* const controlle
 			{
 				if (EntityModelCache::isValidEntityModelID(entityModelID))
 				{
-					// Create a copy of the static part of EntityModel
-					auto visitor = CreateCachedModelVisitor{};
-					controlledEntity->accept(&visitor, true); // Always visit all configurations, we need to retrieve the locales/strings from all configurations regardless of full static model enumeration
+					// Only copy the model if the cache needs it (identical entities share the already cached one)
+					if (entityModelCache.shouldCacheEntityModel(entityModelID, _fullStaticModelEnumeration))
+					{
+						// Create a copy of the static part of EntityModel
+						auto visitor = CreateCachedModelVisitor{};
+						controlledEntity->accept(&visitor, true); // Always visit all configurations, we need to retrieve the locales/strings from all configurations regardless of full static model enumeration
 
-					// Store EntityModel in the cache for later use
-					entityModelCache.cacheEntityModel(entityModelID, visitor.getModel(), _fullStaticModelEnumeration);
-					LOG_CONTROLLER_INFO(entityID, "AEM-CACHE: Cached model for EntityModelID {}", utils::toHexString(entityModelID, true, false));
+						// Store EntityModel in the cache for later use
+						if (entityModelCache.cacheEntityModel(entityModelID, visitor.getModel(), _fullStaticModelEnumeration))
+						{
+							// Also store it on disk, if persistence is enabled
+							persistEntityModel(entity, _fullStaticModelEnumeration);
+						}
+						LOG_CONTROLLER_INFO(entityID, "AEM-CACHE: Cached model for EntityModelID {}", utils::toHexString(entityModelID, true, false));
+					}
 				}
 				else
 				{
@@ -4997,8 +5363,8 @@ void ControllerImpl::validateEntityModel(ControlledEntityImpl& controlledEntity)
 #ifdef ENABLE_AVDECC_FEATURE_JSON
 		try
 		{
-			// Try to serialize the entity model and check for errors
-			entity::model::jsonSerializer::createJsonObject(controlledEntity.getEntityModelTree(), entity::model::jsonSerializer::Flags{ entity::model::jsonSerializer::Flag::ProcessStaticModel, entity::model::jsonSerializer::Flag::ProcessDynamicModel });
+			// Try to serialize the entity model and check for errors (using a temporary EntityTree, so each entity does not keep a copy of its model)
+			entity::model::jsonSerializer::createJsonObject(controlledEntity.buildEntityModelTree(), entity::model::jsonSerializer::Flags{ entity::model::jsonSerializer::Flag::ProcessStaticModel, entity::model::jsonSerializer::Flag::ProcessDynamicModel });
 		}
 		catch (json::exception const&)
 		{
@@ -6506,6 +6872,14 @@ ControllerImpl::PackedDynamicInfoFailureAction ControllerImpl::processGetDynamic
 			LOG_CONTROLLER_ERROR(entityID, "Error getting DynamicInfo using fast enumeration mode, falling back to normal enumeration mode");
 			AVDECC_ASSERT(!entity->getEnumerationSteps().test(ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo), "GetDescriptorDynamicInfo step should not be set");
 		}
+		else if (step == ControlledEntityImpl::EnumerationStep::ResyncDynamicInfo)
+		{
+			// Resyncing without GET_DYNAMIC_INFO is too expensive, fallback to unsubscribing from unsolicited notifications (other inflight queries are still processed)
+			LOG_CONTROLLER_ERROR(entityID, "Error resyncing DynamicInfo using fast enumeration mode, unsubscribing from unsolicited notifications");
+			updateUnsolicitedNotificationsSubscription(*entity, false, false);
+			unregisterUnsol(entity);
+			return PackedDynamicInfoFailureAction::Continue;
+		}
 		else
 		{
 			entity->setNotUsingCachedEntityModel();
@@ -7978,6 +8352,65 @@ std::tuple<avdecc::jsonSerializer::DeserializationError, std::string, entity::mo
 	}
 }
 
+std::optional<std::tuple<model::EntityNode, bool>> ControllerImpl::loadPersistedEntityModel(std::string const& directoryPath, UniqueIdentifier const entityModelID) noexcept
+{
+	// Try to open the input file
+	auto const mode = std::ios::binary | std::ios::in;
+	auto ifs = std::ifstream{ utils::filePathFromUTF8String(directoryPath) / EntityModelCache::getPersistedEntityModelFileName(entityModelID), mode };
+
+	// Failed to open file for reading
+	if (!ifs.is_open())
+	{
+		return std::nullopt;
+	}
+
+	try
+	{
+		// Load the JSON object from disk
+		auto const object = json::from_msgpack(ifs);
+
+		// Check the file is for the requested EntityModel and in a supported version
+		if (object.at(jsonSerializer::keyName::EntityModelCache_DumpVersion).get<std::uint32_t>() != jsonSerializer::keyValue::EntityModelCache_DumpVersion || object.at(jsonSerializer::keyName::ControlledEntity_EntityModelID).get<UniqueIdentifier>() != entityModelID)
+		{
+			return std::nullopt;
+		}
+		auto const isFullModel = object.at(jsonSerializer::keyName::EntityModelCache_FullModel).get<bool>();
+
+		// Read Entity Tree
+		auto const entityTree = entity::model::jsonSerializer::createEntityTree(object.at(jsonSerializer::keyName::ControlledEntity_EntityModel), entity::model::jsonSerializer::Flags{ entity::model::jsonSerializer::Flag::ProcessStaticModel, entity::model::jsonSerializer::Flag::BinaryFormat });
+
+		// Build a temporary ControlledEntity from the tree
+		auto const commonInfo = entity::Entity::CommonInformation{ UniqueIdentifier::getNullUniqueIdentifier(), entityModelID, entity::EntityCapabilities{ entity::EntityCapability::AemSupported } };
+		auto const intfcsInfo = entity::Entity::InterfacesInformation{ { entity::Entity::GlobalAvbInterfaceIndex, entity::Entity::InterfaceInformation{} } };
+		auto controlledEntity = ControlledEntityImpl{ entity::Entity{ commonInfo, intfcsInfo }, std::make_shared<ControlledEntityImpl::LockInformation>(), true };
+		controlledEntity.buildEntityModelGraph(entityTree);
+
+		// Validate the model against its checksum (mandatory)
+		if (Controller::computeEntityModelChecksum(controlledEntity, jsonSerializer::keyValue::EntityModelCache_ChecksumVersion) != object.at(jsonSerializer::keyName::EntityModelCache_Checksum).get<std::string>())
+		{
+			return std::nullopt;
+		}
+
+		// Create the cached copy of the static part of EntityModel
+		auto visitor = CreateCachedModelVisitor{};
+		controlledEntity.accept(&visitor, true);
+
+		return std::make_tuple(visitor.getModel(), isFullModel);
+	}
+	catch (json::exception const&)
+	{
+		return std::nullopt;
+	}
+	catch (avdecc::jsonSerializer::DeserializationException const&)
+	{
+		return std::nullopt;
+	}
+	catch (la::avdecc::Exception const&)
+	{
+		return std::nullopt;
+	}
+}
+
 void ControllerImpl::setupDetachedVirtualControlledEntity(ControlledEntityImpl& entity) noexcept
 {
 	// Notify the ControlledEntity it has been fully loaded
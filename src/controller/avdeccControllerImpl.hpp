@@ -32,9 +32,13 @@
 
 #include "avdeccControlledEntityImpl.hpp"
 #include "avdeccControllerProxy.hpp"
+#include "avdeccEnumerationScheduler.hpp"
 
+#include <atomic>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <functional>
 #include <mutex>
@@ -89,10 +93,18 @@ private:
 	virtual void setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) noexcept override;
 	virtual void enableEntityModelCache() noexcept override;
 	virtual void disableEntityModelCache() noexcept override;
+	virtual bool enableEntityModelCachePersistence(std::string const& directoryPath) noexcept override;
+	virtual void disableEntityModelCachePersistence() noexcept override;
 	virtual void enableFullStaticEntityModelEnumeration() noexcept override;
 	virtual void disableFullStaticEntityModelEnumeration() noexcept override;
 	virtual void enableFastEnumeration() noexcept override;
 	virtual void disableFastEnumeration() noexcept override;
+	virtual void enableLazyControlValuesDecoding() noexcept override;
+	virtual void disableLazyControlValuesDecoding() noexcept override;
+	virtual void subscribeToControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex) noexcept override;
+	virtual void unsubscribeFromControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex) noexcept override;
+	virtual void setMaximumConcurrentEnumerations(std::size_t const maximumConcurrentEnumerations) noexcept override;
+	virtual void setPriorityEnumerations(std::vector<UniqueIdentifier> const& entityIDs) noexcept override;
 
 	/* Enumeration and Control Protocol (AECP) AEM */
 	virtual void acquireEntity(UniqueIdentifier const targetEntityID, bool const isPersistent, AcquireEntityHandler const& handler) const noexcept override;
@@ -390,7 +402,8 @@ private:
 	void updateAssociationID(ControlledEntityImpl& controlledEntity, std::optional<UniqueIdentifier> const associationID, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept;
 	void updateAudioUnitSamplingRate(ControlledEntityImpl& controlledEntity, entity::model::AudioUnitIndex const audioUnitIndex, entity::model::SamplingRate const samplingRate, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept;
 	void updateClockSource(ControlledEntityImpl& controlledEntity, entity::model::ClockDomainIndex const clockDomainIndex, entity::model::ClockSourceIndex const clockSourceIndex, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept;
-	bool updateControlValues(ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, MemoryBuffer const& packedControlValues, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept;
+	bool updateControlValues(ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, MemoryBuffer const& packedControlValues, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior, bool const allowLazyDecoding = false) const noexcept;
+	bool isSubscribedToControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex) const noexcept;
 	void updateStreamInputRunningStatus(ControlledEntityImpl& controlledEntity, entity::model::StreamIndex const streamIndex, bool const isRunning, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept;
 	void updateStreamOutputRunningStatus(ControlledEntityImpl& controlledEntity, entity::model::StreamIndex const streamIndex, bool const isRunning, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept;
 	void updateGptpInformation(ControlledEntityImpl& controlledEntity, entity::model::AvbInterfaceIndex const avbInterfaceIndex, networkInterface::MacAddress const& macAddress, UniqueIdentifier const& gptpGrandmasterID, std::uint8_t const gptpDomainNumber, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept;
@@ -413,6 +426,8 @@ private:
 	void updateMaxTransitTime(ControlledEntityImpl& controlledEntity, entity::model::StreamIndex const streamIndex, std::chrono::nanoseconds const& maxTransitTime, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept;
 	static void updateRedundancyWarning(ControllerImpl const* const controller, ControlledEntityImpl& controlledEntity, bool const isWarning) noexcept;
 	static void updateControlCurrentValueOutOfBounds(ControllerImpl const* const controller, ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, bool const isOutOfBounds) noexcept;
+	static void checkControlValues(ControllerImpl const* const controller, ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, entity::model::ControlNodeStaticModel const& controlStaticModel, entity::model::ControlValues const& controlValues) noexcept;
+	static void onPackedControlValuesDecoded(ControlledEntityImpl& controlledEntity, entity::model::ControlIndex const controlIndex, entity::model::ControlValues const& controlValues) noexcept;
 	void updateStreamInputLatency(ControlledEntityImpl& controlledEntity, entity::model::StreamIndex const streamIndex, bool const isOverLatency) const noexcept;
 	void updateSystemUniqueID(ControlledEntityImpl& controlledEntity, UniqueIdentifier const uniqueID, entity::model::AvdeccFixedString const& systemName) const noexcept;
 	void updateMediaClockReferenceInfo(ControlledEntityImpl& controlledEntity, entity::model::ClockDomainIndex const clockDomainIndex, entity::model::DefaultMediaClockReferencePriority const defaultPriority, entity::model::MediaClockReferenceInfo const& info, TreeModelAccessStrategy::NotFoundBehavior const notFoundBehavior) const noexcept;
@@ -694,10 +709,21 @@ private:
 	void registerUnsol(ControlledEntityImpl* const entity) noexcept;
 	void unregisterUnsol(ControlledEntityImpl* const entity) noexcept;
 	void getStaticModel(ControlledEntityImpl* const entity) noexcept;
+	entity::controller::DynamicInfoParameters queryDynamicInfo(ControlledEntityImpl* const entity) noexcept; // Sends the individual queries, returns the ones to be packed in GET_DYNAMIC_INFO
+	entity::controller::DynamicInfoParameters queryDescriptorDynamicInfo(ControlledEntityImpl* const entity) noexcept; // Sends the individual queries, returns the ones to be packed in GET_DYNAMIC_INFO
 	void getDynamicInfo(ControlledEntityImpl* const entity) noexcept;
 	void getDescriptorDynamicInfo(ControlledEntityImpl* const entity) noexcept;
+	void resyncDynamicInfo(ControlledEntityImpl* const entity) noexcept;
+	void scheduleDynamicInfoResync(ControlledEntityImpl* const entity) noexcept; // To be called when an unsolicited notification has been lost
 	void flushPackedDynamicInfoQueries(ControlledEntityImpl* const entity, entity::controller::DynamicInfoParameters const& dynamicInfoParameters, ControlledEntityImpl::EnumerationStep const step) noexcept;
 	void checkEnumerationSteps(ControlledEntityImpl* const entity) noexcept;
+	bool requestEnumeration(ControlledEntityImpl const& entity) noexcept;
+	void releaseEnumeration(UniqueIdentifier const entityID) noexcept;
+	void startEnumerations(std::vector<UniqueIdentifier> const& entityIDs) noexcept;
+	void setFatalEnumerationError(ControlledEntityImpl* const entity) noexcept;
+	void persistEntityModel(ControlledEntityImpl const& controlledEntity, bool const isFullModel) const noexcept;
+	void loadPersistedEntityModels(std::string const& directoryPath, std::vector<UniqueIdentifier> const& entityModelIDs) noexcept; // Loads persisted models in the EntityModelCache, from _persistedModelsLoaderThread
+	void stopLoadingPersistedEntityModels() noexcept;
 	template<entity::model::DescriptorType StreamPortType>
 	entity::model::AudioMappings validateMappings(ControlledEntityImpl& controlledEntity, entity::model::StreamPortIndex const streamPortIndex, entity::model::AudioMappings const& mappings) const noexcept
 	{
@@ -771,6 +797,7 @@ private:
 	static std::tuple<avdecc::jsonSerializer::DeserializationError, std::string, std::vector<SharedControlledEntityImpl>> deserializeJsonNetworkState(std::string const& filePath, entity::model::jsonSerializer::Flags const flags, bool const continueOnError, ControlledEntityImpl::LockInformation::SharedPointer const& lockInfo) noexcept;
 	static std::tuple<avdecc::jsonSerializer::DeserializationError, std::string, SharedControlledEntityImpl> deserializeJson(std::string const& filePath, entity::model::jsonSerializer::Flags const flags, ControlledEntityImpl::LockInformation::SharedPointer const& lockInfo) noexcept;
 	static std::tuple<avdecc::jsonSerializer::DeserializationError, std::string, entity::model::EntityTree, UniqueIdentifier> deserializeJsonEntityModel(std::string const& filePath, bool const isBinaryFormat) noexcept;
+	static std::optional<std::tuple<model::EntityNode, bool>> loadPersistedEntityModel(std::string const& directoryPath, UniqueIdentifier const entityModelID) noexcept;
 	static void setupDetachedVirtualControlledEntity(ControlledEntityImpl& entity) noexcept;
 #endif // ENABLE_AVDECC_FEATURE_JSON
 	entity::addressAccess::Tlv makeNextReadDeviceMemoryTlv(std::uint64_t const baseAddress, std::uint64_t const length, std::uint64_t const currentSize) const noexcept;
@@ -839,12 +866,18 @@ private:
 	std::string _preferedLocale{ "en-US" };
 	bool _fullStaticModelEnumeration{ false };
 	bool _enablePackedGetDynamicInfo{ false };
+	bool _lazyControlValuesDecoding{ false };
 	bool _shouldTerminate{ false };
 	DelayedQueries _delayedQueries{};
 	std::unordered_map<UniqueIdentifier, std::chrono::time_point<std::chrono::system_clock>, UniqueIdentifier::hash> _entityIdentifications{}; // Holds Entity to Controller Identification Information
 	mutable std::unordered_map<UniqueIdentifier, ControllerIdentificationState, UniqueIdentifier::hash> _controllerIdentifications{}; // Holds Controller to Entity Identification Information
 	mutable std::unordered_map<UniqueIdentifier, std::set<ExclusiveAccessTokenImpl*>, UniqueIdentifier::hash> _exclusiveAccessTokens{};
+	std::unordered_map<UniqueIdentifier, std::unordered_set<entity::model::ControlIndex>, UniqueIdentifier::hash> _controlValuesSubscriptions{}; // Controls decoded and notified right away when lazy control values decoding is enabled
+	EnumerationScheduler _enumerationScheduler{}; // Entities allowed to enumerate, and those waiting for a free slot
+	std::vector<UniqueIdentifier> _priorityEnumerations{}; // Entities to enumerate first (in that order) when waiting for a free slot
 	std::thread _stateMachinesThread{};
+	std::thread _persistedModelsLoaderThread{}; // Loads the persisted EntityModels, so the disk is never accessed from the ProtocolInterface executor
+	std::atomic_bool _shouldStopLoadingPersistedModels{ false };
 };
 
 /* ************************************************************************** */
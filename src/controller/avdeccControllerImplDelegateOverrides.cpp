@@ -105,6 +105,13 @@ void ControllerImpl::onEntityOnline(entity::controller::Interface const* const c
 		// Set Steps
 		guardedEntity->setEnumerationSteps(steps);
 
+		// Wait for a free slot if the maximum count of concurrent enumerations is reached (nothing to wait for if there is nothing to enumerate)
+		if (!steps.empty() && !requestEnumeration(*guardedEntity))
+		{
+			LOG_CONTROLLER_TRACE(entityID, "Maximum concurrent enumerations reached, delaying enumeration");
+			return;
+		}
+
 		// Save the time we start enumeration
 		guardedEntity->setStartEnumerationTime(std::chrono::steady_clock::now());
 
@@ -157,6 +164,9 @@ void ControllerImpl::onEntityOffline(entity::controller::Interface const* const
 		}
 	}
 
+	// Free its enumeration slot (or remove it from the waiting entities)
+	releaseEnumeration(entityID);
+
 	if (controlledEntity)
 	{
 		// Entity was advertised to the user, notify observers
@@ -664,7 +674,7 @@ void ControllerImpl::onControlValuesChanged(entity::controller::Interface const*
 	if (controlledEntity)
 	{
 		auto& entity = *controlledEntity;
-		updateControlValues(entity, controlIndex, packedControlValues, entity.wasAdvertised() ? TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull : TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull);
+		updateControlValues(entity, controlIndex, packedControlValues, entity.wasAdvertised() ? TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull : TreeModelAccessStrategy::NotFoundBehavior::IgnoreAndReturnNull, true);
 	}
 }
 
@@ -1078,7 +1088,13 @@ void ControllerImpl::handleAecpUnsolicitedReceived(UniqueIdentifier const& entit
 				notifyObserversMethod<Controller::Observer>(notifyUnsolicitedLossCounterChanged, this, static_cast<ControlledEntity const*>(&entity), value);
 			}
 
-			// As part of #50 (for now), just unsubscribe from unsolicited notifications
+			// If the entity supports GET_DYNAMIC_INFO, stay subscribed but get again all its dynamic information (the lost notification could be about any of it)
+			if (entity.isPackedDynamicInfoSupported())
+			{
+				scheduleDynamicInfoResync(&entity);
+			}
+			// Otherwise, as part of #50 (for now), just unsubscribe from unsolicited notifications
+			else
 			{
 				// Immediately set as unsubscribed, we are already loosing packets we don't want to miss the response to our unsubscribe
 				updateUnsolicitedNotificationsSubscription(entity, false, false);
@@ -116,7 +116,7 @@ void ControllerImpl::onGetMilanInfoResult(entity::controller::Interface const* c
 			{
 				if (!processGetMilanInfoFailureStatus(status, controlledEntity.get(), ControlledEntityImpl::MilanInfoType::MilanInfo, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::GetMilanInfo);
 					return;
 				}
@@ -154,7 +154,7 @@ void ControllerImpl::onEmptyGetDynamicInfoResult(entity::controller::Interface c
 			{
 				if (!processEmptyGetDynamicInfoFailureStatus(status, &entity, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 2 }, std::nullopt, entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, &entity, QueryCommandError::CheckDynamicInfoSupported);
 					return;
 				}
@@ -616,7 +616,7 @@ void ControllerImpl::onGetDynamicInfoResult(entity::controller::Interface const*
 				action = processGetDynamicInfoFailureStatus(updatedStatus, &entity, sentParameters, packetID, step, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 2 }, std::nullopt, entity::model::MilanVersion{ 1, 0 } } });
 				if (action == ControllerImpl::PackedDynamicInfoFailureAction::Fatal)
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, &entity, QueryCommandError::GetDynamicInfo);
 					return;
 				}
@@ -625,7 +625,7 @@ void ControllerImpl::onGetDynamicInfoResult(entity::controller::Interface const*
 			// Got all expected dynamic information (either descriptor dynamic information or dynamic information, because GET_DYNAMIC_INFO is used for both)
 			if (entity.gotAllExpectedPackedDynamicInfo())
 			{
-				if ((step == ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo && entity.gotAllExpectedDescriptorDynamicInfo()) || (step == ControlledEntityImpl::EnumerationStep::GetDynamicInfo && entity.gotAllExpectedDynamicInfo()))
+				if ((step == ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo && entity.gotAllExpectedDescriptorDynamicInfo()) || (step == ControlledEntityImpl::EnumerationStep::GetDynamicInfo && entity.gotAllExpectedDynamicInfo()) || (step == ControlledEntityImpl::EnumerationStep::ResyncDynamicInfo && entity.gotAllExpectedDynamicInfo() && entity.gotAllExpectedDescriptorDynamicInfo()))
 				{
 					if (action == ControllerImpl::PackedDynamicInfoFailureAction::Continue)
 					{
@@ -661,7 +661,7 @@ void ControllerImpl::onRegisterUnsolicitedNotificationsResult(entity::controller
 			{
 				if (!processRegisterUnsolFailureStatus(status, &entity, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, &entity, QueryCommandError::RegisterUnsol);
 					return;
 				}
@@ -729,14 +729,14 @@ void ControllerImpl::onEntityDescriptorResult(entity::controller::Interface cons
 
 				// Search in the AEM cache for the AEM of the active configuration (if not ignored)
 				auto const entityModelID = descriptor.entityModelID;
-				auto cachedModel = std::optional<model::EntityNode>{ std::nullopt };
+				auto cachedModel = EntityModelCache::SharedEntityNode{};
 				auto const& entityModelCache = EntityModelCache::getInstance();
 				// If AEM Cache is Enabled and the entity has an EntityModelID defined
 				if (!entity.shouldIgnoreCachedEntityModel() && entityModelCache.isCacheEnabled() && entityModelID)
 				{
 					if (EntityModelCache::isValidEntityModelID(entityModelID))
 					{
-						cachedModel = entityModelCache.getCachedEntityModel(entityModelID);
+						cachedModel = entityModelCache.getCachedEntityModel(entityModelID); // Persisted models are loaded in the background, never from here
 					}
 					else
 					{
@@ -745,7 +745,7 @@ void ControllerImpl::onEntityDescriptorResult(entity::controller::Interface cons
 				}
 
 				// Already cached, no need to get the remaining of EnumerationSteps::GetStaticModel, proceed with EnumerationSteps::GetDescriptorDynamicInfo
-				if (cachedModel && entity.setCachedEntityNode(std::move(*cachedModel), descriptor, _fullStaticModelEnumeration))
+				if (cachedModel && entity.setCachedEntityNode(*cachedModel, descriptor, _fullStaticModelEnumeration))
 				{
 					LOG_CONTROLLER_INFO(entityID, "AEM-CACHE: Loaded model for EntityModelID {}", utils::toHexString(entityModelID, true, false));
 					entity.addEnumerationStep(ControlledEntityImpl::EnumerationStep::GetDescriptorDynamicInfo);
@@ -763,7 +763,7 @@ void ControllerImpl::onEntityDescriptorResult(entity::controller::Interface cons
 			{
 				if (!processGetStaticModelFailureStatus(status, &entity, 0, entity::model::DescriptorType::Entity, 0))
 				{
-					entity.setGetFatalEnumerationError();
+					setFatalEnumerationError(&entity);
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, &entity, QueryCommandError::EntityDescriptor);
 					return;
 				}
@@ -981,7 +981,7 @@ void ControllerImpl::onConfigurationDescriptorResult(entity::controller::Interfa
 				}
 				catch (ControlledEntity::Exception const&)
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					return;
 				}
 			}
@@ -989,7 +989,7 @@ void ControllerImpl::onConfigurationDescriptorResult(entity::controller::Interfa
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), 0, entity::model::DescriptorType::Configuration, configurationIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ConfigurationDescriptor);
 					return;
 				}
@@ -1062,7 +1062,7 @@ void ControllerImpl::onAudioUnitDescriptorResult(entity::controller::Interface c
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::AudioUnit, audioUnitIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AudioUnitDescriptor);
 					return;
 				}
@@ -1098,7 +1098,7 @@ void ControllerImpl::onStreamInputDescriptorResult(entity::controller::Interface
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::StreamInput, streamIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamInputDescriptor);
 					return;
 				}
@@ -1134,7 +1134,7 @@ void ControllerImpl::onStreamOutputDescriptorResult(entity::controller::Interfac
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::StreamOutput, streamIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamOutputDescriptor);
 					return;
 				}
@@ -1181,7 +1181,7 @@ void ControllerImpl::onJackInputDescriptorResult(entity::controller::Interface c
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::JackInput, jackIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::JackInputDescriptor);
 					return;
 				}
@@ -1228,7 +1228,7 @@ void ControllerImpl::onJackOutputDescriptorResult(entity::controller::Interface
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::JackOutput, jackIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::JackOutputDescriptor);
 					return;
 				}
@@ -1272,7 +1272,7 @@ void ControllerImpl::onAvbInterfaceDescriptorResult(entity::controller::Interfac
 					{
 						if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::AvbInterface, interfaceIndex))
 						{
-							controlledEntity->setGetFatalEnumerationError();
+							setFatalEnumerationError(controlledEntity.get());
 							notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AvbInterfaceDescriptor);
 							return;
 						}
@@ -1299,7 +1299,7 @@ void ControllerImpl::onAvbInterfaceDescriptorResult(entity::controller::Interfac
 					{
 						if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::AvbInterfaceDescriptor, interfaceIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 						{
-							controlledEntity->setGetFatalEnumerationError();
+							setFatalEnumerationError(controlledEntity.get());
 							notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AvbInterfaceDescriptor);
 							return;
 						}
@@ -1348,7 +1348,7 @@ void ControllerImpl::onClockSourceDescriptorResult(entity::controller::Interface
 					{
 						if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::ClockSource, clockIndex))
 						{
-							controlledEntity->setGetFatalEnumerationError();
+							setFatalEnumerationError(controlledEntity.get());
 							notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ClockSourceDescriptor);
 							return;
 						}
@@ -1375,7 +1375,7 @@ void ControllerImpl::onClockSourceDescriptorResult(entity::controller::Interface
 					{
 						if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::ClockSourceDescriptor, clockIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 						{
-							controlledEntity->setGetFatalEnumerationError();
+							setFatalEnumerationError(controlledEntity.get());
 							notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ClockSourceDescriptor);
 							return;
 						}
@@ -1423,7 +1423,7 @@ void ControllerImpl::onMemoryObjectDescriptorResult(entity::controller::Interfac
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::MemoryObject, memoryObjectIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::MemoryObjectDescriptor);
 					return;
 				}
@@ -1484,7 +1484,7 @@ void ControllerImpl::onLocaleDescriptorResult(entity::controller::Interface cons
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::Locale, localeIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::LocaleDescriptor);
 					return;
 				}
@@ -1520,7 +1520,7 @@ void ControllerImpl::onStringsDescriptorResult(entity::controller::Interface con
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::Strings, stringsIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StringsDescriptor);
 					return;
 				}
@@ -1586,7 +1586,7 @@ void ControllerImpl::onStreamPortInputDescriptorResult(entity::controller::Inter
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::StreamPortInput, streamPortIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamPortInputDescriptor);
 					return;
 				}
@@ -1652,7 +1652,7 @@ void ControllerImpl::onStreamPortOutputDescriptorResult(entity::controller::Inte
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::StreamPortOutput, streamPortIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamPortOutputDescriptor);
 					return;
 				}
@@ -1688,7 +1688,7 @@ void ControllerImpl::onAudioClusterDescriptorResult(entity::controller::Interfac
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::AudioCluster, clusterIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AudioClusterDescriptor);
 					return;
 				}
@@ -1724,7 +1724,7 @@ void ControllerImpl::onAudioMapDescriptorResult(entity::controller::Interface co
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::AudioMap, mapIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AudioMapDescriptor);
 					return;
 				}
@@ -1760,7 +1760,7 @@ void ControllerImpl::onControlDescriptorResult(entity::controller::Interface con
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::Control, controlIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ControlDescriptor);
 					return;
 				}
@@ -1796,7 +1796,7 @@ void ControllerImpl::onClockDomainDescriptorResult(entity::controller::Interface
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::ClockDomain, clockDomainIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ClockDomainDescriptor);
 					return;
 				}
@@ -1832,7 +1832,7 @@ void ControllerImpl::onTimingDescriptorResult(entity::controller::Interface cons
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::Timing, timingIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::TimingDescriptor);
 					return;
 				}
@@ -1889,7 +1889,7 @@ void ControllerImpl::onPtpInstanceDescriptorResult(entity::controller::Interface
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::PtpInstance, ptpInstanceIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::PtpInstanceDescriptor);
 					return;
 				}
@@ -1925,7 +1925,7 @@ void ControllerImpl::onPtpPortDescriptorResult(entity::controller::Interface con
 			{
 				if (!processGetStaticModelFailureStatus(status, controlledEntity.get(), configurationIndex, entity::model::DescriptorType::PtpPort, ptpPortIndex))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::PtpPortDescriptor);
 					return;
 				}
@@ -1962,7 +1962,7 @@ void ControllerImpl::onGetStreamInputInfoResult(entity::controller::Interface co
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::InputStreamInfo, streamIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ListenerStreamInfo);
 					return;
 				}
@@ -1999,7 +1999,7 @@ void ControllerImpl::onGetStreamOutputInfoResult(entity::controller::Interface c
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::OutputStreamInfo, streamIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::TalkerStreamInfo);
 					return;
 				}
@@ -2035,7 +2035,7 @@ void ControllerImpl::onGetAcquiredStateResult(entity::controller::Interface cons
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), 0u, ControlledEntityImpl::DynamicInfoType::AcquiredState, 0u, 0u, MilanRequirements{}))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AcquiredState);
 					return;
 				}
@@ -2074,7 +2074,7 @@ void ControllerImpl::onGetLockedStateResult(entity::controller::Interface const*
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), 0u, ControlledEntityImpl::DynamicInfoType::LockedState, 0u, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::LockedState);
 					return;
 				}
@@ -2131,7 +2131,7 @@ void ControllerImpl::onGetStreamPortInputAudioMapResult(entity::controller::Inte
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::InputStreamPortAudioMappings, streamPortIndex, mapIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamInputAudioMap);
 					return;
 				}
@@ -2139,7 +2139,7 @@ void ControllerImpl::onGetStreamPortInputAudioMapResult(entity::controller::Inte
 				// If we are requesting the dynamic mappings it's because no audio map was defined. This command should never return NotImplement nor NotSupported
 				if (status == entity::ControllerEntity::AemCommandStatus::NotImplemented || status == entity::ControllerEntity::AemCommandStatus::NotSupported)
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamInputAudioMap);
 					return;
 				}
@@ -2194,7 +2194,7 @@ void ControllerImpl::onGetStreamPortOutputAudioMapResult(entity::controller::Int
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::OutputStreamPortAudioMappings, streamPortIndex, mapIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamOutputAudioMap);
 					return;
 				}
@@ -2202,7 +2202,7 @@ void ControllerImpl::onGetStreamPortOutputAudioMapResult(entity::controller::Int
 				// If we are requesting the dynamic mappings it's because no audio map was defined. This command should never return NotImplement nor NotSupported
 				if (status == entity::ControllerEntity::AemCommandStatus::NotImplemented || status == entity::ControllerEntity::AemCommandStatus::NotSupported)
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamOutputAudioMap);
 					return;
 				}
@@ -2241,7 +2241,7 @@ void ControllerImpl::onGetAvbInfoResult(entity::controller::Interface const* con
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::GetAvbInfo, avbInterfaceIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AvbInfo);
 					return;
 				}
@@ -2304,7 +2304,7 @@ void ControllerImpl::onGetAsPathResult(entity::controller::Interface const* cons
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::GetAsPath, avbInterfaceIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AsPath);
 					return;
 				}
@@ -2343,7 +2343,7 @@ void ControllerImpl::onGetEntityCountersResult(entity::controller::Interface con
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), 0u, ControlledEntityImpl::DynamicInfoType::GetEntityCounters, 0u, 0u, MilanRequirements{}))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::EntityCounters);
 					return;
 				}
@@ -2391,7 +2391,7 @@ void ControllerImpl::onGetAvbInterfaceCountersResult(entity::controller::Interfa
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::GetAvbInterfaceCounters, avbInterfaceIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AvbInterfaceCounters);
 					return;
 				}
@@ -2439,7 +2439,7 @@ void ControllerImpl::onGetClockDomainCountersResult(entity::controller::Interfac
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::GetClockDomainCounters, clockDomainIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ClockDomainCounters);
 					return;
 				}
@@ -2487,7 +2487,7 @@ void ControllerImpl::onGetStreamInputCountersResult(entity::controller::Interfac
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::GetStreamInputCounters, streamIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamInputCounters);
 					return;
 				}
@@ -2534,7 +2534,7 @@ void ControllerImpl::onGetStreamOutputCountersResult(entity::controller::Interfa
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::GetStreamOutputCounters, streamIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::StreamOutputCounters);
 					return;
 				}
@@ -2570,7 +2570,7 @@ void ControllerImpl::onConfigurationNameResult(entity::controller::Interface con
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::ConfigurationName, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ConfigurationName);
 					return;
 				}
@@ -2606,7 +2606,7 @@ void ControllerImpl::onAudioUnitNameResult(entity::controller::Interface const*
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::AudioUnitName, audioUnitIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AudioUnitName);
 					return;
 				}
@@ -2642,7 +2642,7 @@ void ControllerImpl::onAudioUnitSamplingRateResult(entity::controller::Interface
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::AudioUnitSamplingRate, audioUnitIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AudioUnitSamplingRate);
 					return;
 				}
@@ -2678,7 +2678,7 @@ void ControllerImpl::onInputStreamNameResult(entity::controller::Interface const
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::InputStreamName, streamIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::InputStreamName);
 					return;
 				}
@@ -2715,7 +2715,7 @@ void ControllerImpl::onInputStreamFormatResult(entity::controller::Interface con
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::InputStreamFormat, streamIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::InputStreamFormat);
 					return;
 				}
@@ -2751,7 +2751,7 @@ void ControllerImpl::onOutputStreamNameResult(entity::controller::Interface cons
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::OutputStreamName, streamIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::OutputStreamName);
 					return;
 				}
@@ -2788,7 +2788,7 @@ void ControllerImpl::onOutputStreamFormatResult(entity::controller::Interface co
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::OutputStreamFormat, streamIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::OutputStreamFormat);
 					return;
 				}
@@ -2824,7 +2824,7 @@ void ControllerImpl::onInputJackNameResult(entity::controller::Interface const*
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::InputJackName, jackIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::InputJackName);
 					return;
 				}
@@ -2860,7 +2860,7 @@ void ControllerImpl::onOutputJackNameResult(entity::controller::Interface const*
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::OutputJackName, jackIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::OutputJackName);
 					return;
 				}
@@ -2896,7 +2896,7 @@ void ControllerImpl::onMemoryObjectNameResult(entity::controller::Interface cons
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::MemoryObjectName, memoryObjectIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::MemoryObjectName);
 					return;
 				}
@@ -2932,7 +2932,7 @@ void ControllerImpl::onMemoryObjectLengthResult(entity::controller::Interface co
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::MemoryObjectLength, memoryObjectIndex, MilanRequirements{}))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::MemoryObjectLength);
 					return;
 				}
@@ -2968,7 +2968,7 @@ void ControllerImpl::onAudioClusterNameResult(entity::controller::Interface cons
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::AudioClusterName, audioClusterIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::AudioClusterName);
 					return;
 				}
@@ -3004,7 +3004,7 @@ void ControllerImpl::onControlNameResult(entity::controller::Interface const* co
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::ControlName, controlIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ControlName);
 					return;
 				}
@@ -3045,7 +3045,7 @@ void ControllerImpl::onControlValuesResult(entity::controller::Interface const*
 
 			if (!st && !processGetDescriptorDynamicInfoFailureStatus(st, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::ControlValues, controlIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 			{
-				controlledEntity->setGetFatalEnumerationError();
+				setFatalEnumerationError(controlledEntity.get());
 				notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ControlValues);
 				return;
 			}
@@ -3080,7 +3080,7 @@ void ControllerImpl::onClockDomainNameResult(entity::controller::Interface const
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::ClockDomainName, clockDomainIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ClockDomainName);
 					return;
 				}
@@ -3116,7 +3116,7 @@ void ControllerImpl::onClockDomainSourceIndexResult(entity::controller::Interfac
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::ClockDomainSourceIndex, clockDomainIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::ClockDomainSourceIndex);
 					return;
 				}
@@ -3152,7 +3152,7 @@ void ControllerImpl::onTimingNameResult(entity::controller::Interface const* con
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::TimingName, timingIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 2 }, std::nullopt, entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::TimingName);
 					return;
 				}
@@ -3188,7 +3188,7 @@ void ControllerImpl::onPtpInstanceNameResult(entity::controller::Interface const
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::PtpInstanceName, ptpInstanceIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 2 }, std::nullopt, entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::PtpInstanceName);
 					return;
 				}
@@ -3224,7 +3224,7 @@ void ControllerImpl::onPtpPortNameResult(entity::controller::Interface const* co
 			{
 				if (!processGetDescriptorDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::PtpPortName, ptpPortIndex, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 2 }, std::nullopt, entity::model::MilanVersion{ 1, 0 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::PtpPortName);
 					return;
 				}
@@ -3260,7 +3260,7 @@ void ControllerImpl::onGetMaxTransitTimeResult(entity::controller::Interface con
 			{
 				if (!processGetAecpDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::GetMaxTransitTime, streamIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 3 }, std::nullopt, entity::model::MilanVersion{ 1, 2 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::GetMaxTransitTime);
 					return;
 				}
@@ -3296,7 +3296,7 @@ void ControllerImpl::onGetSystemUniqueIDResult(entity::controller::Interface con
 			{
 				if (!processGetMvuDynamicInfoFailureStatus(status, controlledEntity.get(), entity::model::getInvalidDescriptorIndex(), ControlledEntityImpl::DynamicInfoType::GetSystemUniqueID, entity::model::getInvalidDescriptorIndex(), std::uint16_t{ 0u }, MilanRequirements{}))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::GetSystemUniqueID);
 					return;
 				}
@@ -3332,7 +3332,7 @@ void ControllerImpl::onGetMediaClockReferenceInfoResult(entity::controller::Inte
 			{
 				if (!processGetMvuDynamicInfoFailureStatus(status, controlledEntity.get(), entity::model::getInvalidDescriptorIndex(), ControlledEntityImpl::DynamicInfoType::GetMediaClockReferenceInfo, clockDomainIndex, std::uint16_t{ 0u }, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 3 }, std::nullopt, entity::model::MilanVersion{ 1, 2 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::GetMediaClockReferenceInfo);
 					return;
 				}
@@ -3368,7 +3368,7 @@ void ControllerImpl::onGetStreamInputInfoExResult(entity::controller::Interface
 			{
 				if (!processGetMvuDynamicInfoFailureStatus(status, controlledEntity.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::InputStreamInfoEx, streamIndex, 0u, MilanRequirements{ MilanRequiredVersions{ entity::model::MilanVersion{ 1, 3 }, std::nullopt, entity::model::MilanVersion{ 1, 2 } } }))
 				{
-					controlledEntity->setGetFatalEnumerationError();
+					setFatalEnumerationError(controlledEntity.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, controlledEntity.get(), QueryCommandError::GetStreamInputInfoEx);
 					return;
 				}
@@ -3439,7 +3439,7 @@ void ControllerImpl::onGetTalkerStreamStateResult(entity::controller::Interface
 				}
 				if (!processGetAcmpDynamicInfoFailureStatus(status, &talker, configurationIndex, ControlledEntityImpl::DynamicInfoType::OutputStreamState, talkerStream.streamIndex, MilanRequirements{ requiredVersions }))
 				{
-					talker.setGetFatalEnumerationError();
+					setFatalEnumerationError(&talker);
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, &talker, QueryCommandError::TalkerStreamState);
 					return;
 				}
@@ -3489,7 +3489,7 @@ void ControllerImpl::onGetListenerStreamStateResult(entity::controller::Interfac
 				}
 				if (!processGetAcmpDynamicInfoFailureStatus(status, listener.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::InputStreamState, listenerStream.streamIndex, MilanRequirements{ requiredVersions }))
 				{
-					listener->setGetFatalEnumerationError();
+					setFatalEnumerationError(listener.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, listener.get(), QueryCommandError::ListenerStreamState);
 					return;
 				}
@@ -3525,7 +3525,7 @@ void ControllerImpl::onGetTalkerStreamConnectionResult(entity::controller::Inter
 			{
 				if (!processGetAcmpDynamicInfoFailureStatus(status, talker.get(), configurationIndex, ControlledEntityImpl::DynamicInfoType::OutputStreamConnection, talkerStream, connectionIndex, MilanRequirements{}))
 				{
-					talker->setGetFatalEnumerationError();
+					setFatalEnumerationError(talker.get());
 					notifyObserversMethod<Controller::Observer>(&Controller::Observer::onEntityQueryError, this, talker.get(), QueryCommandError::TalkerStreamConnection);
 					return;
 				}
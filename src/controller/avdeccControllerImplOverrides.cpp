@@ -44,9 +44,11 @@
 #include <cerrno> // errno
 #include <unordered_set>
 #include <set>
+#include <filesystem>
 #include <fstream>
 #include <mutex>
 #include <memory>
+#include <vector>
 
 namespace la
 {
@@ -312,6 +314,9 @@ ControllerImpl::~ControllerImpl()
 {
 	AVDECC_ASSERT(!areControlledEntitiesSelfLocked(), "No ControlledEntity should be locked during this call. relinquish the ownership (with .reset()) before calling this method");
 
+	// Stop loading persisted models
+	stopLoadingPersistedEntityModels();
+
 	// Notify the thread we are shutting down
 	_shouldTerminate = true;
 
@@ -449,6 +454,73 @@ void ControllerImpl::disableEntityModelCache() noexcept
 	LOG_CONTROLLER_INFO(_controller->getEntityID(), "AEM-CACHE Disabled");
 }
 
+bool ControllerImpl::enableEntityModelCachePersistence([[maybe_unused]] std::string const& directoryPath) noexcept
+{
+#ifndef ENABLE_AVDECC_FEATURE_JSON
+	LOG_CONTROLLER_WARN(_controller->getEntityID(), "AEM-CACHE Persistence not supported by the library (was not compiled)");
+	return false;
+
+#else // ENABLE_AVDECC_FEATURE_JSON
+
+	// Stop loading models from a previously enabled persistence
+	stopLoadingPersistedEntityModels();
+
+	auto const directory = utils::filePathFromUTF8String(directoryPath);
+	auto ec = std::error_code{};
+
+	// Create the directory if needed
+	std::filesystem::create_directories(directory, ec);
+	if (ec || !std::filesystem::is_directory(directory, ec))
+	{
+		LOG_CONTROLLER_WARN(_controller->getEntityID(), "AEM-CACHE Persistence cannot use directory {}: {}", directoryPath, ec.message());
+		return false;
+	}
+
+	// Index the already persisted models (they are loaded in the background)
+	auto persistedModels = std::unordered_set<UniqueIdentifier, UniqueIdentifier::hash>{};
+	for (auto it = std::filesystem::directory_iterator{ directory, ec }; !ec && it != std::filesystem::directory_iterator{}; it.increment(ec))
+	{
+		auto const& path = it->path();
+		if (path.extension() != EntityModelCache::PersistedEntityModelFileExtension)
+		{
+			continue;
+		}
+		try
+		{
+			auto const entityModelID = UniqueIdentifier{ std::stoull(path.stem().string(), nullptr, 16) };
+			if (path.filename() == EntityModelCache::getPersistedEntityModelFileName(entityModelID))
+			{
+				persistedModels.insert(entityModelID);
+			}
+		}
+		catch (std::exception const&)
+		{
+			// Not a persisted model, ignore it
+		}
+	}
+
+	LOG_CONTROLLER_INFO(_controller->getEntityID(), "AEM-CACHE Persistence enabled in {} ({} persisted models)", directoryPath, persistedModels.size());
+	auto entityModelIDs = std::vector<UniqueIdentifier>{ persistedModels.begin(), persistedModels.end() };
+	EntityModelCache::getInstance().enablePersistence(directoryPath, std::move(persistedModels));
+
+	// Load the persisted models from a dedicated thread, the ProtocolInterface executor must never access the disk
+	_persistedModelsLoaderThread = std::thread(
+		[this, directoryPath, entityModelIDs = std::move(entityModelIDs)]()
+		{
+			utils::setCurrentThreadName("avdecc::controller::AemCacheLoader");
+			loadPersistedEntityModels(directoryPath, entityModelIDs);
+		});
+	return true;
+#endif // ENABLE_AVDECC_FEATURE_JSON
+}
+
+void ControllerImpl::disableEntityModelCachePersistence() noexcept
+{
+	stopLoadingPersistedEntityModels();
+	EntityModelCache::getInstance().disablePersistence();
+	LOG_CONTROLLER_INFO(_controller->getEntityID(), "AEM-CACHE Persistence disabled");
+}
+
 void ControllerImpl::enableFullStaticEntityModelEnumeration() noexcept
 {
 	_fullStaticModelEnumeration = true;
@@ -469,6 +541,72 @@ void ControllerImpl::disableFastEnumeration() noexcept
 	_enablePackedGetDynamicInfo = false;
 }
 
+void ControllerImpl::enableLazyControlValuesDecoding() noexcept
+{
+	_lazyControlValuesDecoding = true;
+}
+
+void ControllerImpl::disableLazyControlValuesDecoding() noexcept
+{
+	_lazyControlValuesDecoding = false;
+}
+
+void ControllerImpl::subscribeToControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex) noexcept
+{
+	{
+		// Lock to protect _controlValuesSubscriptions
+		auto const lg = std::lock_guard{ _lock };
+		_controlValuesSubscriptions[entityID].insert(controlIndex);
+	}
+
+	// Take a "scoped locked" shared copy of the ControlledEntity
+	auto controlledEntity = getControlledEntityImplGuard(entityID);
+
+	if (controlledEntity && controlledEntity->wasAdvertised())
+	{
+		// Decode the values received since last access and notify the subscriber
+		if (auto const controlValuesOpt = controlledEntity->decodePackedControlValues(controlIndex))
+		{
+			notifyObserversMethod<Controller::Observer>(&Controller::Observer::onControlValuesChanged, this, controlledEntity.get(), controlIndex, *controlValuesOpt);
+		}
+	}
+}
+
+void ControllerImpl::unsubscribeFromControlValues(UniqueIdentifier const entityID, entity::model::ControlIndex const controlIndex) noexcept
+{
+	// Lock to protect _controlValuesSubscriptions
+	auto const lg = std::lock_guard{ _lock };
+
+	if (auto const it = _controlValuesSubscriptions.find(entityID); it != _controlValuesSubscriptions.end())
+	{
+		it->second.erase(controlIndex);
+		if (it->second.empty())
+		{
+			_controlValuesSubscriptions.erase(it);
+		}
+	}
+}
+
+void ControllerImpl::setMaximumConcurrentEnumerations(std::size_t const maximumConcurrentEnumerations) noexcept
+{
+	auto entitiesToStart = std::vector<UniqueIdentifier>{};
+	{
+		// Lock to protect _enumerationScheduler
+		auto const lg = std::lock_guard{ _lock };
+		entitiesToStart = _enumerationScheduler.setMaximumConcurrentEnumerations(maximumConcurrentEnumerations);
+	}
+
+	// Raising the limit may let waiting entities start their enumeration
+	startEnumerations(entitiesToStart);
+}
+
+void ControllerImpl::setPriorityEnumerations(std::vector<UniqueIdentifier> const& entityIDs) noexcept
+{
+	// Lock to protect _priorityEnumerations
+	auto const lg = std::lock_guard{ _lock };
+	_priorityEnumerations = entityIDs;
+}
+
 
 /* Enumeration and Control Protocol (AECP) */
 void ControllerImpl::acquireEntity(UniqueIdentifier const targetEntityID, bool const isPersistent, AcquireEntityHandler const& handler) const noexcept
@@ -170,6 +170,11 @@ constexpr auto ControlledEntity_EntityState = "state";
 constexpr auto ControlledEntity_Statistics = "statistics";
 constexpr auto ControlledEntity_Diagnostics = "diagnostics";
 
+/* Persisted EntityModelCache nodes */
+constexpr auto EntityModelCache_DumpVersion = "dump_version";
+constexpr auto EntityModelCache_FullModel = "full_model";
+constexpr auto EntityModelCache_Checksum = "checksum";
+
 } // namespace keyName
 
 namespace keyValue
@@ -181,6 +186,10 @@ constexpr auto Controller_DumpVersion = std::uint32_t{ 1 };
 constexpr auto ControlledEntity_DumpVersion = std::uint32_t{ 2 };
 constexpr auto ControlledEntity_SchemaBaseURL = "https://raw.githubusercontent.com/L-Acoustics/avdecc/refs/heads/main/resources/schemas/AVE/";
 
+/* Persisted EntityModelCache nodes */
+constexpr auto EntityModelCache_DumpVersion = std::uint32_t{ 1 };
+constexpr auto EntityModelCache_ChecksumVersion = std::uint32_t{ 3 }; // Last checksum version not including MilanInfo, which is not part of the persisted model
+
 } // namespace keyValue
 } // namespace jsonSerializer
 } // namespace controller
@@ -30,9 +30,12 @@
 #include "avdeccControllerLogHelper.hpp"
 
 #include <unordered_map>
+#include <memory>
+#include <unordered_set>
 #include <mutex>
 #include <tuple>
 #include <optional>
+#include <string>
 
 namespace la
 {
@@ -70,7 +73,11 @@ public:
 		_isEnabled = false;
 	}
 
-	std::optional<model::EntityNode> getCachedEntityModel(UniqueIdentifier const entityModelID) const noexcept
+	/** Shared immutable EntityModel, entities adopting it make their own copy */
+	using SharedEntityNode = std::shared_ptr<model::EntityNode const>;
+
+	/** Returns the cached EntityModel (shared, not copied), or nullptr if not in the cache */
+	SharedEntityNode getCachedEntityModel(UniqueIdentifier const entityModelID) const noexcept
 	{
 		AVDECC_ASSERT(_isEnabled, "Should not call AEM cache if cache is not enabled");
 		AVDECC_ASSERT(entityModelID, "Should not call AEM cache if EntityModelID is invalid");
@@ -84,10 +91,35 @@ public:
 			}
 		}
 
-		return std::nullopt;
+		return nullptr;
 	}
 
-	void cacheEntityModel(UniqueIdentifier const entityModelID, model::EntityNode&& model, bool const isFullModel) noexcept
+	/** Returns true if cacheEntityModel would store the model (not in the cache yet, or only an incomplete one is cached and the passed one is complete) */
+	bool shouldCacheEntityModel(UniqueIdentifier const entityModelID, bool const isFullModel) const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (!_isEnabled || !entityModelID)
+		{
+			return false;
+		}
+		if (auto const entityModelIt = _modelCache.find(entityModelID); entityModelIt != _modelCache.end())
+		{
+			return !std::get<0>(entityModelIt->second) && isFullModel;
+		}
+		return true;
+	}
+
+	/** Returns true if the EntityModel is in the cache, or persisted and not loaded yet */
+	bool hasCachedEntityModel(UniqueIdentifier const entityModelID) const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		return _isEnabled && entityModelID && (_modelCache.count(entityModelID) != 0 || _persistedModels.count(entityModelID) != 0);
+	}
+
+	/** Caches the EntityModel, returns true if it was added to the cache (or replaced an incomplete one) */
+	bool cacheEntityModel(UniqueIdentifier const entityModelID, model::EntityNode&& model, bool const isFullModel) noexcept
 	{
 		AVDECC_ASSERT(_isEnabled, "Should not call AEM cache if cache is not enabled");
 		AVDECC_ASSERT(entityModelID, "Should not call AEM cache if EntityModelID is invalid");
@@ -103,18 +135,75 @@ public:
 				if (!isCachedModelComplete && isFullModel)
 				{
 					// Move the new model to the cache
-					entityModelIt->second = { isFullModel, std::move(model) };
+					entityModelIt->second = { isFullModel, std::make_shared<model::EntityNode const>(std::move(model)) };
 					LOG_CONTROLLER_DEBUG(UniqueIdentifier::getNullUniqueIdentifier(), "EntityModelCache: Replacing incomplete model with complete one for EntityModelID: {}\n", utils::toHexString(entityModelID, true));
+					return true;
 				}
 				// Do not replace the cached model as the new one is either incomplete or we already have a complete one
-				return;
+				return false;
 			}
 
 			// Move the new model to the cache
-			_modelCache.emplace(entityModelID, std::make_tuple(isFullModel, std::move(model)));
+			_modelCache.emplace(entityModelID, std::make_tuple(isFullModel, std::make_shared<model::EntityNode const>(std::move(model))));
+			return true;
+		}
+		return false;
+	}
+
+	/** Enables the persistence of the cache in directoryPath, persistedModels being the EntityModels already stored there (not loaded yet) */
+	void enablePersistence(std::string const& directoryPath, std::unordered_set<UniqueIdentifier, UniqueIdentifier::hash>&& persistedModels) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		_persistenceDirectory = directoryPath;
+		_persistedModels = std::move(persistedModels);
+	}
+
+	void disablePersistence() noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		_persistenceDirectory = std::nullopt;
+		_persistedModels.clear();
+	}
+
+	std::optional<std::string> getPersistenceDirectory() const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		return _persistenceDirectory;
+	}
+
+	/** Returns true if the EntityModel is persisted but not loaded in the cache yet */
+	bool isPersistedEntityModel(UniqueIdentifier const entityModelID) const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		return _persistenceDirectory && _persistedModels.count(entityModelID) != 0 && _modelCache.count(entityModelID) == 0;
+	}
+
+	void setPersistedEntityModel(UniqueIdentifier const entityModelID, bool const isPersisted) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+
+		if (isPersisted)
+		{
+			_persistedModels.insert(entityModelID);
 		}
+		else
+		{
+			_persistedModels.erase(entityModelID);
+		}
+	}
+
+	/** Returns the name of the file storing the EntityModel in the persistence directory */
+	static inline std::string getPersistedEntityModelFileName(UniqueIdentifier const entityModelID) noexcept
+	{
+		return utils::toHexString(entityModelID, true, true) + PersistedEntityModelFileExtension;
 	}
 
+	static constexpr auto PersistedEntityModelFileExtension = ".aem";
+
 	static inline bool isValidEntityModelID(UniqueIdentifier const entityModelID) noexcept
 	{
 		auto const [vendorID, deviceID, modelID] = entity::model::splitEntityModelID(entityModelID);
@@ -192,7 +281,9 @@ private:
 	}
 
 	mutable std::mutex _lock{};
-	std::unordered_map<UniqueIdentifier, std::tuple<bool, model::EntityNode>, la::avdecc::UniqueIdentifier::hash> _modelCache{};
+	std::unordered_map<UniqueIdentifier, std::tuple<bool, SharedEntityNode>, la::avdecc::UniqueIdentifier::hash> _modelCache{};
+	std::optional<std::string> _persistenceDirectory{ std::nullopt };
+	std::unordered_set<UniqueIdentifier, la::avdecc::UniqueIdentifier::hash> _persistedModels{};
 	bool _isEnabled{ false };
 };
 
@@ -0,0 +1,160 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file avdeccEnumerationScheduler.hpp
+* @author Christophe Calmejane
+* @brief Admission of discovered entities into enumeration, limiting the count of concurrent enumerations.
+*/
+
+#pragma once
+
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace controller
+{
+/**
+* @brief Decides which discovered entities are allowed to enumerate, so that at most a maximum count of entities are enumerated at the same time.
+* @details Entities that cannot start right away are queued, ordered by Priority then by rank (for UserDeclared priority) then by discovery order.
+*          This class is not thread-safe, the owner must protect all calls.
+*/
+class EnumerationScheduler final
+{
+public:
+	enum class Priority : std::uint8_t
+	{
+		CachedModel = 0, /**< The EntityModel of the entity is in the cache, its enumeration will be short */
+		UserDeclared = 1, /**< The entity has been declared as a priority one by the user */
+		Default = 2, /**< Any other entity */
+	};
+
+	/** Sets the maximum count of entities being enumerated at the same time (0 for no limit). Returns the queued entities that can now start their enumeration. */
+	std::vector<UniqueIdentifier> setMaximumConcurrentEnumerations(std::size_t const maximumConcurrentEnumerations) noexcept
+	{
+		_maximumConcurrentEnumerations = maximumConcurrentEnumerations;
+		return admitQueuedEntities();
+	}
+
+	std::size_t getMaximumConcurrentEnumerations() const noexcept
+	{
+		return _maximumConcurrentEnumerations;
+	}
+
+	/** Requests the enumeration of an entity. Returns true if it can start right away, false if it has been queued. The rank orders entities sharing the same priority (lower first). */
+	bool requestEnumeration(UniqueIdentifier const entityID, Priority const priority, std::size_t const rank = 0u) noexcept
+	{
+		// Already active or queued
+		if (_activeEntities.count(entityID) != 0 || _queuedEntities.count(entityID) != 0)
+		{
+			return false;
+		}
+
+		if (hasAvailableSlot())
+		{
+			_activeEntities.insert(entityID);
+			return true;
+		}
+
+		auto const key = QueueKey{ priority, rank, _nextSequence++ };
+		_queue.emplace(key, entityID);
+		_queuedEntities.emplace(entityID, key);
+		return false;
+	}
+
+	/** Releases an entity, either because its enumeration is complete (or failed) or because it went offline. Returns the queued entities that can now start their enumeration. */
+	std::vector<UniqueIdentifier> releaseEnumeration(UniqueIdentifier const entityID) noexcept
+	{
+		if (auto const queuedIt = _queuedEntities.find(entityID); queuedIt != _queuedEntities.end())
+		{
+			_queue.erase(queuedIt->second);
+			_queuedEntities.erase(queuedIt);
+			return {};
+		}
+
+		if (_activeEntities.erase(entityID) == 0)
+		{
+			return {};
+		}
+
+		return admitQueuedEntities();
+	}
+
+	/** Returns true if the entity is waiting for its enumeration to start */
+	bool isQueued(UniqueIdentifier const entityID) const noexcept
+	{
+		return _queuedEntities.count(entityID) != 0;
+	}
+
+	std::size_t getActiveCount() const noexcept
+	{
+		return _activeEntities.size();
+	}
+
+	std::size_t getQueuedCount() const noexcept
+	{
+		return _queue.size();
+	}
+
+private:
+	using QueueKey = std::tuple<Priority, std::size_t, std::uint64_t>; // Priority, Rank, Discovery order
+
+	bool hasAvailableSlot() const noexcept
+	{
+		return _maximumConcurrentEnumerations == 0u || _activeEntities.size() < _maximumConcurrentEnumerations;
+	}
+
+	std::vector<UniqueIdentifier> admitQueuedEntities() noexcept
+	{
+		auto admitted = std::vector<UniqueIdentifier>{};
+
+		while (!_queue.empty() && hasAvailableSlot())
+		{
+			auto const queueIt = _queue.begin();
+			auto const entityID = queueIt->second;
+			_queue.erase(queueIt);
+			_queuedEntities.erase(entityID);
+			_activeEntities.insert(entityID);
+			admitted.push_back(entityID);
+		}
+
+		return admitted;
+	}
+
+	std::size_t _maximumConcurrentEnumerations{ 0u };
+	std::uint64_t _nextSequence{ 0u };
+	std::unordered_set<UniqueIdentifier, UniqueIdentifier::hash> _activeEntities{};
+	std::map<QueueKey, UniqueIdentifier> _queue{};
+	std::unordered_map<UniqueIdentifier, QueueKey, UniqueIdentifier::hash> _queuedEntities{};
+};
+
+} // namespace controller
+} // namespace avdecc
+} // namespace la
@@ -26,6 +26,10 @@
 #include "entityImpl.hpp"
 #include "protocol/protocolAemPayloads.hpp"
 
+#include "la/avdecc/executor.hpp"
+
+#include <algorithm>
+#include <utility> // exchange
 
 namespace la
 {
@@ -35,6 +39,8 @@ namespace entity
 {
 namespace model
 {
+static constexpr auto AemDispatchTableSize = std::size_t{ 0x80 }; // All AEM command_type values defined by IEEE 1722.1 are below 0x80 (Expansion excepted, which is not handled)
+
 class NoSuchDescriptorException final : public Exception
 {
 public:
@@ -44,6 +50,15 @@ public:
 	}
 };
 
+class BadArgumentsException final : public Exception
+{
+public:
+	BadArgumentsException()
+		: Exception("Bad arguments")
+	{
+	}
+};
+
 AemHandler::AemHandler(entity::Entity const& entity, entity::model::EntityTree const* const entityModelTree)
 	: _entity{ entity }
 	, _entityModelTree{ entityModelTree }
@@ -52,6 +67,32 @@ AemHandler::AemHandler(entity::Entity const& entity, entity::model::EntityTree c
 	validateEntityModel(_entityModelTree);
 }
 
+AemHandler::~AemHandler() noexcept
+{
+	// Stop the thread scheduling the pending unsolicited notifications (it never waits for the ProtocolInterface lock, so joining cannot deadlock even if the caller holds it)
+	{
+		auto const lg = std::lock_guard{ _notificationsLock };
+		_shouldTerminate = true;
+	}
+	_notificationsCondition.notify_all();
+	if (_notificationsThread.joinable())
+	{
+		_notificationsThread.join();
+	}
+
+	// Detach from the ProtocolInterface, so the sending jobs still queued on its executor do nothing
+	auto* pi = static_cast<protocol::ProtocolInterface*>(nullptr);
+	{
+		auto const lg = std::lock_guard{ _notificationsLock };
+		pi = std::exchange(_notificationsProtocolInterface, nullptr);
+	}
+	if (pi != nullptr)
+	{
+		auto const piLock = std::lock_guard<decltype(*pi)>{ *pi };
+		_notificationsSender->handler = nullptr;
+	}
+}
+
 void AemHandler::validateEntityModel(entity::model::EntityTree const* const entityModelTree)
 {
 	// Briefly validate entity model
@@ -74,7 +115,22 @@ void AemHandler::validateEntityModel(entity::model::EntityTree const* const enti
 
 bool AemHandler::onUnhandledAecpAemCommand(protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem) const noexcept
 {
-	static std::unordered_map<protocol::AemCommandType::value_type, std::function<bool(protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem)>> s_Dispatch{
+	// GET commands answered from the current values of the entity model
+	auto const getCommandHandler = [](protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem)
+	{
+		if (aemHandler._entityModelTree != nullptr)
+		{
+			auto ser = ResponseSerializer{};
+			if (aemHandler.serializeGetCommandResponse(aem.getCommandType(), aem.getPayload(), ser))
+			{
+				LocalEntityImpl<>::sendAemAecpResponse(pi, aem, protocol::AemAecpStatus::Success, ser.data(), ser.size());
+				return true;
+			}
+		}
+		return false;
+	};
+
+	static auto const s_Dispatch = utils::DispatchTable<bool(protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem), AemDispatchTableSize>{
 		// Read Descriptor
 		{ protocol::AemCommandType::ReadDescriptor.getValue(),
 			[](protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem)
@@ -91,6 +147,7 @@ bool AemHandler::onUnhandledAecpAemCommand(protocol::ProtocolInterface* const pi
 								LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::BadArguments);
 								return true;
 							}
+							// Never cached, some fields come from the Entity itself (capabilities, association) and may change at any time
 							auto ser = protocol::aemPayload::serializeReadDescriptorCommonResponse(configIndex, descriptorType, descriptorIndex);
 							protocol::aemPayload::serializeReadEntityDescriptorResponse(ser, aemHandler.buildEntityDescriptor());
 							LocalEntityImpl<>::sendAemAecpResponse(pi, aem, protocol::AemAecpStatus::Success, ser.data(), ser.size());
@@ -103,31 +160,105 @@ bool AemHandler::onUnhandledAecpAemCommand(protocol::ProtocolInterface* const pi
 								LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::BadArguments);
 								return true;
 							}
-							auto ser = protocol::aemPayload::serializeReadDescriptorCommonResponse(configIndex, descriptorType, descriptorIndex);
-							protocol::aemPayload::serializeReadConfigurationDescriptorResponse(ser, aemHandler.buildConfigurationDescriptor(descriptorIndex));
-							LocalEntityImpl<>::sendAemAecpResponse(pi, aem, protocol::AemAecpStatus::Success, ser.data(), ser.size());
+							// ConfigurationDescriptor is stored along with the descriptors of the configuration it describes
+							if (!aemHandler.sendSerializedDescriptor(pi, aem, descriptorIndex, descriptorType, descriptorIndex))
+							{
+								throw NoSuchDescriptorException{};
+							}
 							return true;
 						}
 						default:
-							break;
+							// Descriptors not found in the model are left to the delegate
+							return aemHandler.sendSerializedDescriptor(pi, aem, configIndex, descriptorType, descriptorIndex);
 					}
 				}
 				return false;
 			} },
+		// Register Unsolicited Notification
+		{ protocol::AemCommandType::RegisterUnsolicitedNotification.getValue(),
+			[](protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem)
+			{
+				// Only an entity exposing a model has something to notify
+				if (aemHandler._entityModelTree != nullptr)
+				{
+					aemHandler.registerUnsolicitedNotifications(aem);
+					LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::Success);
+					return true;
+				}
+				return false;
+			} },
+		// Deregister Unsolicited Notification
+		{ protocol::AemCommandType::DeregisterUnsolicitedNotification.getValue(),
+			[](protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem)
+			{
+				if (aemHandler._entityModelTree != nullptr)
+				{
+					aemHandler.unregisterUnsolicitedNotifications(aem.getControllerEntityID());
+					LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::Success);
+					return true;
+				}
+				return false;
+			} },
+		// Get Configuration
+		{ protocol::AemCommandType::GetConfiguration.getValue(), getCommandHandler },
+		// Get Stream Format
+		{ protocol::AemCommandType::GetStreamFormat.getValue(), getCommandHandler },
+		// Get Stream Info
+		{ protocol::AemCommandType::GetStreamInfo.getValue(), getCommandHandler },
+		// Get Name
+		{ protocol::AemCommandType::GetName.getValue(), getCommandHandler },
+		// Get Association ID
+		{ protocol::AemCommandType::GetAssociationID.getValue(), getCommandHandler },
+		// Get Sampling Rate
+		{ protocol::AemCommandType::GetSamplingRate.getValue(), getCommandHandler },
+		// Get Clock Source
+		{ protocol::AemCommandType::GetClockSource.getValue(), getCommandHandler },
+		// Get Counters
+		{ protocol::AemCommandType::GetCounters.getValue(), getCommandHandler },
+		// Get Memory Object Length
+		{ protocol::AemCommandType::GetMemoryObjectLength.getValue(), getCommandHandler },
+		// Get Max Transit Time
+		{ protocol::AemCommandType::GetMaxTransitTime.getValue(), getCommandHandler },
+		// Get Dynamic Info
+		{ protocol::AemCommandType::GetDynamicInfo.getValue(),
+			[](protocol::ProtocolInterface* const pi, AemHandler const& aemHandler, protocol::AemAecpdu const& aem)
+			{
+				if (aemHandler._entityModelTree != nullptr)
+				{
+					aemHandler.sendDynamicInfo(pi, aem);
+					return true;
+				}
+				return false;
+			} },
 	};
 
-	auto const& it = s_Dispatch.find(aem.getCommandType().getValue());
-	if (it != s_Dispatch.end())
+	auto const dispatchHandler = s_Dispatch.find(aem.getCommandType().getValue());
+	if (dispatchHandler != nullptr)
 	{
 		try
 		{
-			return it->second(pi, *this, aem);
+			return dispatchHandler(pi, *this, aem);
 		}
 		catch (NoSuchDescriptorException const&)
 		{
 			LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::NoSuchDescriptor);
 			return true;
 		}
+		catch (BadArgumentsException const&)
+		{
+			LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::BadArguments);
+			return true;
+		}
+		catch (protocol::aemPayload::IncorrectPayloadSizeException const&)
+		{
+			LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::BadArguments);
+			return true;
+		}
+		catch (protocol::aemPayload::NotImplementedException const&)
+		{
+			LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::NotImplemented);
+			return true;
+		}
 		catch (la::avdecc::Exception const&)
 		{
 			LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::EntityMisbehaving);
@@ -183,18 +314,10 @@ void setDescriptorsCount(ConfigurationDescriptor& configDescriptor, Tree const&
 	}
 }
 
-ConfigurationDescriptor AemHandler::buildConfigurationDescriptor(entity::model::ConfigurationIndex const configIndex) const
+static ConfigurationDescriptor buildConfigurationDescriptor(ConfigurationTree const& configTree) noexcept
 {
 	auto configDescriptor = ConfigurationDescriptor{};
 
-	auto const configIt = _entityModelTree->configurationTrees.find(configIndex);
-	if (configIt == _entityModelTree->configurationTrees.end())
-	{
-		throw NoSuchDescriptorException{};
-	}
-
-	auto const& configTree = configIt->second;
-
 	configDescriptor.objectName = configTree.dynamicModel.objectName;
 	configDescriptor.localizedDescription = configTree.staticModel.localizedDescription;
 
@@ -212,11 +335,1286 @@ ConfigurationDescriptor AemHandler::buildConfigurationDescriptor(entity::model::
 	setDescriptorsCount<DescriptorType::Timing>(configDescriptor, configTree.timingModels);
 	setDescriptorsCount<DescriptorType::PtpInstance>(configDescriptor, configTree.ptpInstanceTrees);
 
-	std::unordered_map<DescriptorType, std::uint16_t, la::avdecc::utils::EnumClassHash> descriptorCounts{};
-
 	return configDescriptor;
 }
 
+void AemHandler::notifyEntityModelChanged() noexcept
+{
+	auto const lg = std::lock_guard{ _lock };
+	_serializedDescriptors.clear();
+}
+
+static inline std::uint32_t makeDescriptorKey(DescriptorType const descriptorType, DescriptorIndex const descriptorIndex) noexcept
+{
+	return (static_cast<std::uint32_t>(utils::to_integral(descriptorType)) << 16) | descriptorIndex;
+}
+
+template<auto BuildDescriptor, auto SerializeDescriptor, auto SerializeDynamicFields, typename Models>
+void AemHandler::storeSerializedDescriptor(SerializedDescriptors& descriptors, ConfigurationIndex const configIndex, DescriptorType const descriptorType, DescriptorIndex const descriptorIndex, Models const& models)
+{
+	static constexpr auto s_Serializer = DescriptorSerializer{
+		[](ResponseSerializer& ser, void const* const models)
+		{
+			SerializeDescriptor(ser, BuildDescriptor(*static_cast<Models const*>(models)));
+		},
+		[](ResponseSerializer& ser, void const* const models)
+		{
+			SerializeDynamicFields(ser, *static_cast<Models const*>(models));
+		},
+	};
+
+	auto& descriptor = descriptors[makeDescriptorKey(descriptorType, descriptorIndex)];
+	descriptor.configIndex = configIndex;
+	descriptor.models = &models;
+	descriptor.serializer = &s_Serializer;
+	updateSerializedDescriptor(descriptor, descriptorType, descriptorIndex);
+}
+
+void AemHandler::updateSerializedDescriptor(SerializedDescriptor& descriptor, DescriptorType const descriptorType, DescriptorIndex const descriptorIndex) noexcept
+{
+	descriptor.payload.clear();
+	descriptor.dynamicFields.clear();
+	try
+	{
+		auto ser = protocol::aemPayload::serializeReadDescriptorCommonResponse(descriptor.configIndex, descriptorType, descriptorIndex);
+		descriptor.serializer->serializeDescriptor(ser, descriptor.models);
+		auto dynamicSer = ResponseSerializer{};
+		descriptor.serializer->serializeDynamicFields(dynamicSer, descriptor.models);
+		descriptor.payload.assign(ser.data(), ser.data() + ser.size());
+		descriptor.dynamicFields.assign(dynamicSer.data(), dynamicSer.data() + dynamicSer.size());
+	}
+	catch (...)
+	{
+		// Descriptor cannot be serialized (invalid values in the model), keep an empty payload so the other descriptors can still be read
+		descriptor.payload.clear();
+	}
+}
+
+bool AemHandler::hasDynamicFieldsChanged(SerializedDescriptor const& descriptor) noexcept
+{
+	try
+	{
+		auto ser = ResponseSerializer{};
+		descriptor.serializer->serializeDynamicFields(ser, descriptor.models);
+		return !std::equal(descriptor.dynamicFields.begin(), descriptor.dynamicFields.end(), ser.data(), ser.data() + ser.size());
+	}
+	catch (...)
+	{
+		return true;
+	}
+}
+
+static AudioUnitDescriptor buildAudioUnitDescriptor(AudioUnitTree const& tree) noexcept
+{
+	auto descriptor = AudioUnitDescriptor{};
+
+	descriptor.objectName = tree.dynamicModel.objectName;
+	descriptor.localizedDescription = tree.staticModel.localizedDescription;
+	descriptor.clockDomainIndex = tree.staticModel.clockDomainIndex;
+	descriptor.numberOfStreamInputPorts = tree.staticModel.numberOfStreamInputPorts;
+	descriptor.baseStreamInputPort = tree.staticModel.baseStreamInputPort;
+	descriptor.numberOfStreamOutputPorts = tree.staticModel.numberOfStreamOutputPorts;
+	descriptor.baseStreamOutputPort = tree.staticModel.baseStreamOutputPort;
+	descriptor.numberOfExternalInputPorts = tree.staticModel.numberOfExternalInputPorts;
+	descriptor.baseExternalInputPort = tree.staticModel.baseExternalInputPort;
+	descriptor.numberOfExternalOutputPorts = tree.staticModel.numberOfExternalOutputPorts;
+	descriptor.baseExternalOutputPort = tree.staticModel.baseExternalOutputPort;
+	descriptor.numberOfInternalInputPorts = tree.staticModel.numberOfInternalInputPorts;
+	descriptor.baseInternalInputPort = tree.staticModel.baseInternalInputPort;
+	descriptor.numberOfInternalOutputPorts = tree.staticModel.numberOfInternalOutputPorts;
+	descriptor.baseInternalOutputPort = tree.staticModel.baseInternalOutputPort;
+	descriptor.numberOfControls = tree.staticModel.numberOfControls;
+	descriptor.baseControl = tree.staticModel.baseControl;
+	descriptor.numberOfSignalSelectors = tree.staticModel.numberOfSignalSelectors;
+	descriptor.baseSignalSelector = tree.staticModel.baseSignalSelector;
+	descriptor.numberOfMixers = tree.staticModel.numberOfMixers;
+	descriptor.baseMixer = tree.staticModel.baseMixer;
+	descriptor.numberOfMatrices = tree.staticModel.numberOfMatrices;
+	descriptor.baseMatrix = tree.staticModel.baseMatrix;
+	descriptor.numberOfSplitters = tree.staticModel.numberOfSplitters;
+	descriptor.baseSplitter = tree.staticModel.baseSplitter;
+	descriptor.numberOfCombiners = tree.staticModel.numberOfCombiners;
+	descriptor.baseCombiner = tree.staticModel.baseCombiner;
+	descriptor.numberOfDemultiplexers = tree.staticModel.numberOfDemultiplexers;
+	descriptor.baseDemultiplexer = tree.staticModel.baseDemultiplexer;
+	descriptor.numberOfMultiplexers = tree.staticModel.numberOfMultiplexers;
+	descriptor.baseMultiplexer = tree.staticModel.baseMultiplexer;
+	descriptor.numberOfTranscoders = tree.staticModel.numberOfTranscoders;
+	descriptor.baseTranscoder = tree.staticModel.baseTranscoder;
+	descriptor.numberOfControlBlocks = tree.staticModel.numberOfControlBlocks;
+	descriptor.baseControlBlock = tree.staticModel.baseControlBlock;
+	descriptor.currentSamplingRate = tree.dynamicModel.currentSamplingRate;
+	descriptor.samplingRates = tree.staticModel.samplingRates;
+
+	return descriptor;
+}
+
+template<typename StreamNodeModels>
+static StreamDescriptor buildStreamDescriptor(StreamNodeModels const& models) noexcept
+{
+	auto descriptor = StreamDescriptor{};
+	auto const& staticModel = models.staticModel;
+	auto const& dynamicModel = models.dynamicModel;
+
+	descriptor.objectName = dynamicModel.objectName;
+	descriptor.localizedDescription = staticModel.localizedDescription;
+	descriptor.clockDomainIndex = staticModel.clockDomainIndex;
+	descriptor.streamFlags = staticModel.streamFlags;
+	descriptor.currentFormat = dynamicModel.streamFormat;
+	descriptor.backupTalkerEntityID_0 = staticModel.backupTalkerEntityID_0;
+	descriptor.backupTalkerUniqueID_0 = staticModel.backupTalkerUniqueID_0;
+	descriptor.backupTalkerEntityID_1 = staticModel.backupTalkerEntityID_1;
+	descriptor.backupTalkerUniqueID_1 = staticModel.backupTalkerUniqueID_1;
+	descriptor.backupTalkerEntityID_2 = staticModel.backupTalkerEntityID_2;
+	descriptor.backupTalkerUniqueID_2 = staticModel.backupTalkerUniqueID_2;
+	descriptor.backedupTalkerEntityID = staticModel.backedupTalkerEntityID;
+	descriptor.backedupTalkerUnique = staticModel.backedupTalkerUnique;
+	descriptor.avbInterfaceIndex = staticModel.avbInterfaceIndex;
+	descriptor.bufferLength = staticModel.bufferLength;
+	descriptor.formats = staticModel.formats;
+#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
+	descriptor.redundantStreams = staticModel.redundantStreams;
+#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
+
+	return descriptor;
+}
+
+static JackDescriptor buildJackDescriptor(JackTree const& tree) noexcept
+{
+	auto descriptor = JackDescriptor{};
+
+	descriptor.objectName = tree.dynamicModel.objectName;
+	descriptor.localizedDescription = tree.staticModel.localizedDescription;
+	descriptor.jackFlags = tree.staticModel.jackFlags;
+	descriptor.jackType = tree.staticModel.jackType;
+	descriptor.numberOfControls = tree.staticModel.numberOfControls;
+	descriptor.baseControl = tree.staticModel.baseControl;
+
+	return descriptor;
+}
+
+static AvbInterfaceDescriptor buildAvbInterfaceDescriptor(AvbInterfaceNodeModels const& models) noexcept
+{
+	auto descriptor = AvbInterfaceDescriptor{};
+
+	descriptor.objectName = models.dynamicModel.objectName;
+	descriptor.localizedDescription = models.staticModel.localizedDescription;
+	descriptor.macAddress = models.dynamicModel.macAddress;
+	descriptor.interfaceFlags = models.staticModel.interfaceFlags;
+	descriptor.clockIdentity = models.dynamicModel.clockIdentity;
+	descriptor.priority1 = models.dynamicModel.priority1;
+	descriptor.clockClass = models.dynamicModel.clockClass;
+	descriptor.offsetScaledLogVariance = models.dynamicModel.offsetScaledLogVariance;
+	descriptor.clockAccuracy = models.dynamicModel.clockAccuracy;
+	descriptor.priority2 = models.dynamicModel.priority2;
+	descriptor.domainNumber = models.dynamicModel.domainNumber;
+	descriptor.logSyncInterval = models.dynamicModel.logSyncInterval;
+	descriptor.logAnnounceInterval = models.dynamicModel.logAnnounceInterval;
+	descriptor.logPDelayInterval = models.dynamicModel.logPDelayInterval;
+	descriptor.portNumber = models.staticModel.portNumber;
+
+	return descriptor;
+}
+
+static ClockSourceDescriptor buildClockSourceDescriptor(ClockSourceNodeModels const& models) noexcept
+{
+	auto descriptor = ClockSourceDescriptor{};
+
+	descriptor.objectName = models.dynamicModel.objectName;
+	descriptor.localizedDescription = models.staticModel.localizedDescription;
+	descriptor.clockSourceFlags = models.dynamicModel.clockSourceFlags;
+	descriptor.clockSourceType = models.staticModel.clockSourceType;
+	descriptor.clockSourceIdentifier = models.dynamicModel.clockSourceIdentifier;
+	descriptor.clockSourceLocationType = models.staticModel.clockSourceLocationType;
+	descriptor.clockSourceLocationIndex = models.staticModel.clockSourceLocationIndex;
+
+	return descriptor;
+}
+
+static MemoryObjectDescriptor buildMemoryObjectDescriptor(MemoryObjectNodeModels const& models) noexcept
+{
+	auto descriptor = MemoryObjectDescriptor{};
+
+	descriptor.objectName = models.dynamicModel.objectName;
+	descriptor.localizedDescription = models.staticModel.localizedDescription;
+	descriptor.memoryObjectType = models.staticModel.memoryObjectType;
+	descriptor.targetDescriptorType = models.staticModel.targetDescriptorType;
+	descriptor.targetDescriptorIndex = models.staticModel.targetDescriptorIndex;
+	descriptor.startAddress = models.staticModel.startAddress;
+	descriptor.maximumLength = models.staticModel.maximumLength;
+	descriptor.length = models.dynamicModel.length;
+
+	return descriptor;
+}
+
+static LocaleDescriptor buildLocaleDescriptor(LocaleTree const& tree) noexcept
+{
+	auto descriptor = LocaleDescriptor{};
+
+	descriptor.localeID = tree.staticModel.localeID;
+	descriptor.numberOfStringDescriptors = tree.staticModel.numberOfStringDescriptors;
+	descriptor.baseStringDescriptorIndex = tree.staticModel.baseStringDescriptorIndex;
+
+	return descriptor;
+}
+
+static StringsDescriptor buildStringsDescriptor(StringsNodeModels const& models) noexcept
+{
+	auto descriptor = StringsDescriptor{};
+
+	descriptor.strings = models.staticModel.strings;
+
+	return descriptor;
+}
+
+static StreamPortDescriptor buildStreamPortDescriptor(StreamPortTree const& tree) noexcept
+{
+	auto descriptor = StreamPortDescriptor{};
+
+	descriptor.clockDomainIndex = tree.staticModel.clockDomainIndex;
+	descriptor.portFlags = tree.staticModel.portFlags;
+	descriptor.numberOfControls = tree.staticModel.numberOfControls;
+	descriptor.baseControl = tree.staticModel.baseControl;
+	descriptor.numberOfClusters = tree.staticModel.numberOfClusters;
+	descriptor.baseCluster = tree.staticModel.baseCluster;
+	descriptor.numberOfMaps = tree.staticModel.numberOfMaps;
+	descriptor.baseMap = tree.staticModel.baseMap;
+
+	return descriptor;
+}
+
+static AudioClusterDescriptor buildAudioClusterDescriptor(AudioClusterNodeModels const& models) noexcept
+{
+	auto descriptor = AudioClusterDescriptor{};
+
+	descriptor.objectName = models.dynamicModel.objectName;
+	descriptor.localizedDescription = models.staticModel.localizedDescription;
+	descriptor.signalType = models.staticModel.signalType;
+	descriptor.signalIndex = models.staticModel.signalIndex;
+	descriptor.signalOutput = models.staticModel.signalOutput;
+	descriptor.pathLatency = models.staticModel.pathLatency;
+	descriptor.blockLatency = models.staticModel.blockLatency;
+	descriptor.channelCount = models.staticModel.channelCount;
+	descriptor.format = models.staticModel.format;
+
+	return descriptor;
+}
+
+static AudioMapDescriptor buildAudioMapDescriptor(AudioMapNodeModels const& models) noexcept
+{
+	auto descriptor = AudioMapDescriptor{};
+
+	descriptor.mappings = models.staticModel.mappings;
+
+	return descriptor;
+}
+
+static ControlDescriptor buildControlDescriptor(ControlNodeModels const& models) noexcept
+{
+	auto descriptor = ControlDescriptor{};
+
+	descriptor.objectName = models.dynamicModel.objectName;
+	descriptor.localizedDescription = models.staticModel.localizedDescription;
+	descriptor.blockLatency = models.staticModel.blockLatency;
+	descriptor.controlLatency = models.staticModel.controlLatency;
+	descriptor.controlDomain = models.staticModel.controlDomain;
+	descriptor.controlValueType = models.staticModel.controlValueType;
+	descriptor.controlType = models.staticModel.controlType;
+	descriptor.resetTime = models.staticModel.resetTime;
+	descriptor.signalType = models.staticModel.signalType;
+	descriptor.signalIndex = models.staticModel.signalIndex;
+	descriptor.signalOutput = models.staticModel.signalOutput;
+	descriptor.numberOfValues = models.staticModel.numberOfValues;
+	descriptor.valuesStatic = models.staticModel.values;
+	descriptor.valuesDynamic = models.dynamicModel.values;
+
+	return descriptor;
+}
+
+static ClockDomainDescriptor buildClockDomainDescriptor(ClockDomainNodeModels const& models) noexcept
+{
+	auto descriptor = ClockDomainDescriptor{};
+
+	descriptor.objectName = models.dynamicModel.objectName;
+	descriptor.localizedDescription = models.staticModel.localizedDescription;
+	descriptor.clockSourceIndex = models.dynamicModel.clockSourceIndex;
+	descriptor.clockSources = models.staticModel.clockSources;
+
+	return descriptor;
+}
+
+static TimingDescriptor buildTimingDescriptor(TimingNodeModels const& models) noexcept
+{
+	auto descriptor = TimingDescriptor{};
+
+	descriptor.objectName = models.dynamicModel.objectName;
+	descriptor.localizedDescription = models.staticModel.localizedDescription;
+	descriptor.algorithm = models.staticModel.algorithm;
+	descriptor.ptpInstances = models.staticModel.ptpInstances;
+
+	return descriptor;
+}
+
+static PtpInstanceDescriptor buildPtpInstanceDescriptor(PtpInstanceTree const& tree) noexcept
+{
+	auto descriptor = PtpInstanceDescriptor{};
+
+	descriptor.objectName = tree.dynamicModel.objectName;
+	descriptor.localizedDescription = tree.staticModel.localizedDescription;
+	descriptor.clockIdentity = tree.staticModel.clockIdentity;
+	descriptor.flags = tree.staticModel.flags;
+	descriptor.numberOfControls = tree.staticModel.numberOfControls;
+	descriptor.baseControl = tree.staticModel.baseControl;
+	descriptor.numberOfPtpPorts = tree.staticModel.numberOfPtpPorts;
+	descriptor.basePtpPort = tree.staticModel.basePtpPort;
+
+	return descriptor;
+}
+
+static PtpPortDescriptor buildPtpPortDescriptor(PtpPortNodeModels const& models) noexcept
+{
+	auto descriptor = PtpPortDescriptor{};
+
+	descriptor.objectName = models.dynamicModel.objectName;
+	descriptor.localizedDescription = models.staticModel.localizedDescription;
+	descriptor.portNumber = models.staticModel.portNumber;
+	descriptor.portType = models.staticModel.portType;
+	descriptor.flags = models.staticModel.flags;
+	descriptor.avbInterfaceIndex = models.staticModel.avbInterfaceIndex;
+	descriptor.profileIdentifier = models.staticModel.profileIdentifier;
+
+	return descriptor;
+}
+
+using AemSerializer = Serializer<protocol::AemAecpdu::MaximumSendPayloadBufferLength>;
+
+// Dynamic fields of each descriptor (fields built from the dynamic model), compared to the serialized ones each time a descriptor is read so the cache never serves stale values
+template<typename Models>
+static void serializeNoDynamicFields(AemSerializer& /*ser*/, Models const& /*models*/) noexcept {}
+
+template<typename Models>
+static void serializeObjectNameDynamicField(AemSerializer& ser, Models const& models)
+{
+	ser << models.dynamicModel.objectName;
+}
+
+static void serializeAudioUnitDynamicFields(AemSerializer& ser, AudioUnitTree const& tree)
+{
+	ser << tree.dynamicModel.objectName << tree.dynamicModel.currentSamplingRate;
+}
+
+template<typename StreamNodeModels>
+static void serializeStreamDynamicFields(AemSerializer& ser, StreamNodeModels const& models)
+{
+	ser << models.dynamicModel.objectName << models.dynamicModel.streamFormat;
+}
+
+static void serializeAvbInterfaceDynamicFields(AemSerializer& ser, AvbInterfaceNodeModels const& models)
+{
+	auto const& dynamicModel = models.dynamicModel;
+	ser << dynamicModel.objectName << dynamicModel.macAddress << dynamicModel.clockIdentity << dynamicModel.priority1 << dynamicModel.clockClass << dynamicModel.offsetScaledLogVariance << dynamicModel.clockAccuracy << dynamicModel.priority2 << dynamicModel.domainNumber << dynamicModel.logSyncInterval << dynamicModel.logAnnounceInterval << dynamicModel.logPDelayInterval;
+}
+
+static void serializeClockSourceDynamicFields(AemSerializer& ser, ClockSourceNodeModels const& models)
+{
+	ser << models.dynamicModel.objectName << models.dynamicModel.clockSourceFlags << models.dynamicModel.clockSourceIdentifier;
+}
+
+static void serializeMemoryObjectDynamicFields(AemSerializer& ser, MemoryObjectNodeModels const& models)
+{
+	ser << models.dynamicModel.objectName << models.dynamicModel.length;
+}
+
+static void serializeControlDynamicFields(AemSerializer& ser, ControlNodeModels const& models)
+{
+	ser << models.dynamicModel.objectName;
+	ser += protocol::aemPayload::serializeSetControlResponse(DescriptorType::Control, ControlIndex{ 0u }, models.dynamicModel.values);
+}
+
+static void serializeClockDomainDynamicFields(AemSerializer& ser, ClockDomainNodeModels const& models)
+{
+	ser << models.dynamicModel.objectName << models.dynamicModel.clockSourceIndex;
+}
+
+AemHandler::SerializedDescriptors& AemHandler::getSerializedDescriptors(entity::model::ConfigurationIndex const configIndex) const
+{
+	// Already serialized
+	if (auto const it = _serializedDescriptors.find(configIndex); it != _serializedDescriptors.end())
+	{
+		return it->second;
+	}
+
+	auto const configIt = _entityModelTree->configurationTrees.find(configIndex);
+	if (configIt == _entityModelTree->configurationTrees.end())
+	{
+		throw NoSuchDescriptorException{};
+	}
+	auto const& configTree = configIt->second;
+
+	// Serialize all the descriptors of the configuration at once, a controller enumerating the entity will read them all anyway
+	auto descriptors = SerializedDescriptors{};
+	auto const storeControls = [&descriptors, configIndex](std::map<ControlIndex, ControlNodeModels> const& controlModels)
+	{
+		for (auto const& [controlIndex, controlModels] : controlModels)
+		{
+			storeSerializedDescriptor<buildControlDescriptor, protocol::aemPayload::serializeReadControlDescriptorResponse, serializeControlDynamicFields>(descriptors, configIndex, DescriptorType::Control, controlIndex, controlModels);
+		}
+	};
+	auto const storeStreamPorts = [&descriptors, configIndex, &storeControls](DescriptorType const descriptorType, AudioUnitTree::StreamPortTrees const& streamPortTrees)
+	{
+		for (auto const& [streamPortIndex, streamPortTree] : streamPortTrees)
+		{
+			storeSerializedDescriptor<buildStreamPortDescriptor, protocol::aemPayload::serializeReadStreamPortDescriptorResponse, serializeNoDynamicFields<StreamPortTree>>(descriptors, configIndex, descriptorType, streamPortIndex, streamPortTree);
+			for (auto const& [clusterIndex, clusterModels] : streamPortTree.audioClusterModels)
+			{
+				storeSerializedDescriptor<buildAudioClusterDescriptor, protocol::aemPayload::serializeReadAudioClusterDescriptorResponse, serializeObjectNameDynamicField<AudioClusterNodeModels>>(descriptors, configIndex, DescriptorType::AudioCluster, clusterIndex, clusterModels);
+			}
+			for (auto const& [mapIndex, mapModels] : streamPortTree.audioMapModels)
+			{
+				storeSerializedDescriptor<buildAudioMapDescriptor, protocol::aemPayload::serializeReadAudioMapDescriptorResponse, serializeNoDynamicFields<AudioMapNodeModels>>(descriptors, configIndex, DescriptorType::AudioMap, mapIndex, mapModels);
+			}
+			storeControls(streamPortTree.controlModels);
+		}
+	};
+	auto const storeJacks = [&descriptors, configIndex, &storeControls](DescriptorType const descriptorType, ConfigurationTree::JackTrees const& jackTrees)
+	{
+		for (auto const& [jackIndex, jackTree] : jackTrees)
+		{
+			storeSerializedDescriptor<buildJackDescriptor, protocol::aemPayload::serializeReadJackDescriptorResponse, serializeObjectNameDynamicField<JackTree>>(descriptors, configIndex, descriptorType, jackIndex, jackTree);
+			storeControls(jackTree.controlModels);
+		}
+	};
+
+	// ConfigurationDescriptor is always read with ConfigurationIndex 0
+	storeSerializedDescriptor<buildConfigurationDescriptor, protocol::aemPayload::serializeReadConfigurationDescriptorResponse, serializeObjectNameDynamicField<ConfigurationTree>>(descriptors, ConfigurationIndex{ 0u }, DescriptorType::Configuration, configIndex, configTree);
+	for (auto const& [audioUnitIndex, audioUnitTree] : configTree.audioUnitTrees)
+	{
+		storeSerializedDescriptor<buildAudioUnitDescriptor, protocol::aemPayload::serializeReadAudioUnitDescriptorResponse, serializeAudioUnitDynamicFields>(descriptors, configIndex, DescriptorType::AudioUnit, audioUnitIndex, audioUnitTree);
+		storeStreamPorts(DescriptorType::StreamPortInput, audioUnitTree.streamPortInputTrees);
+		storeStreamPorts(DescriptorType::StreamPortOutput, audioUnitTree.streamPortOutputTrees);
+		storeControls(audioUnitTree.controlModels);
+	}
+	for (auto const& [streamIndex, streamModels] : configTree.streamInputModels)
+	{
+		storeSerializedDescriptor<buildStreamDescriptor<StreamInputNodeModels>, protocol::aemPayload::serializeReadStreamDescriptorResponse, serializeStreamDynamicFields<StreamInputNodeModels>>(descriptors, configIndex, DescriptorType::StreamInput, streamIndex, streamModels);
+	}
+	for (auto const& [streamIndex, streamModels] : configTree.streamOutputModels)
+	{
+		storeSerializedDescriptor<buildStreamDescriptor<StreamOutputNodeModels>, protocol::aemPayload::serializeReadStreamDescriptorResponse, serializeStreamDynamicFields<StreamOutputNodeModels>>(descriptors, configIndex, DescriptorType::StreamOutput, streamIndex, streamModels);
+	}
+	storeJacks(DescriptorType::JackInput, configTree.jackInputTrees);
+	storeJacks(DescriptorType::JackOutput, configTree.jackOutputTrees);
+	for (auto const& [avbInterfaceIndex, avbInterfaceModels] : configTree.avbInterfaceModels)
+	{
+		storeSerializedDescriptor<buildAvbInterfaceDescriptor, protocol::aemPayload::serializeReadAvbInterfaceDescriptorResponse, serializeAvbInterfaceDynamicFields>(descriptors, configIndex, DescriptorType::AvbInterface, avbInterfaceIndex, avbInterfaceModels);
+	}
+	for (auto const& [clockSourceIndex, clockSourceModels] : configTree.clockSourceModels)
+	{
+		storeSerializedDescriptor<buildClockSourceDescriptor, protocol::aemPayload::serializeReadClockSourceDescriptorResponse, serializeClockSourceDynamicFields>(descriptors, configIndex, DescriptorType::ClockSource, clockSourceIndex, clockSourceModels);
+	}
+	for (auto const& [memoryObjectIndex, memoryObjectModels] : configTree.memoryObjectModels)
+	{
+		storeSerializedDescriptor<buildMemoryObjectDescriptor, protocol::aemPayload::serializeReadMemoryObjectDescriptorResponse, serializeMemoryObjectDynamicFields>(descriptors, configIndex, DescriptorType::MemoryObject, memoryObjectIndex, memoryObjectModels);
+	}
+	for (auto const& [localeIndex, localeTree] : configTree.localeTrees)
+	{
+		storeSerializedDescriptor<buildLocaleDescriptor, protocol::aemPayload::serializeReadLocaleDescriptorResponse, serializeNoDynamicFields<LocaleTree>>(descriptors, configIndex, DescriptorType::Locale, localeIndex, localeTree);
+		for (auto const& [stringsIndex, stringsModels] : localeTree.stringsModels)
+		{
+			storeSerializedDescriptor<buildStringsDescriptor, protocol::aemPayload::serializeReadStringsDescriptorResponse, serializeNoDynamicFields<StringsNodeModels>>(descriptors, configIndex, DescriptorType::Strings, stringsIndex, stringsModels);
+		}
+	}
+	storeControls(configTree.controlModels);
+	for (auto const& [clockDomainIndex, clockDomainModels] : configTree.clockDomainModels)
+	{
+		storeSerializedDescriptor<buildClockDomainDescriptor, protocol::aemPayload::serializeReadClockDomainDescriptorResponse, serializeClockDomainDynamicFields>(descriptors, configIndex, DescriptorType::ClockDomain, clockDomainIndex, clockDomainModels);
+	}
+	for (auto const& [timingIndex, timingModels] : configTree.timingModels)
+	{
+		storeSerializedDescriptor<buildTimingDescriptor, protocol::aemPayload::serializeReadTimingDescriptorResponse, serializeObjectNameDynamicField<TimingNodeModels>>(descriptors, configIndex, DescriptorType::Timing, timingIndex, timingModels);
+	}
+	for (auto const& [ptpInstanceIndex, ptpInstanceTree] : configTree.ptpInstanceTrees)
+	{
+		storeSerializedDescriptor<buildPtpInstanceDescriptor, protocol::aemPayload::serializeReadPtpInstanceDescriptorResponse, serializeObjectNameDynamicField<PtpInstanceTree>>(descriptors, configIndex, DescriptorType::PtpInstance, ptpInstanceIndex, ptpInstanceTree);
+		for (auto const& [ptpPortIndex, ptpPortModels] : ptpInstanceTree.ptpPortModels)
+		{
+			storeSerializedDescriptor<buildPtpPortDescriptor, protocol::aemPayload::serializeReadPtpPortDescriptorResponse, serializeObjectNameDynamicField<PtpPortNodeModels>>(descriptors, configIndex, DescriptorType::PtpPort, ptpPortIndex, ptpPortModels);
+		}
+		storeControls(ptpInstanceTree.controlModels);
+	}
+
+	return _serializedDescriptors.emplace(configIndex, std::move(descriptors)).first->second;
+}
+
+bool AemHandler::sendSerializedDescriptor(protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem, entity::model::ConfigurationIndex const configIndex, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex) const
+{
+	auto const lg = std::lock_guard{ _lock };
+
+	if (_entityModelTree->configurationTrees.count(configIndex) == 0)
+	{
+		return false;
+	}
+	auto& descriptors = getSerializedDescriptors(configIndex);
+	auto const it = descriptors.find(makeDescriptorKey(descriptorType, descriptorIndex));
+	if (it == descriptors.end())
+	{
+		return false;
+	}
+
+	// Dynamic fields may have been modified in the model since the descriptor was serialized
+	auto& descriptor = it->second;
+	if (hasDynamicFieldsChanged(descriptor))
+	{
+		updateSerializedDescriptor(descriptor, descriptorType, descriptorIndex);
+	}
+
+	if (descriptor.payload.empty())
+	{
+		throw Exception("Descriptor cannot be serialized");
+	}
+
+	LocalEntityImpl<>::sendAemAecpResponse(pi, aem, protocol::AemAecpStatus::Success, descriptor.payload.data(), descriptor.payload.size());
+	return true;
+}
+
+static ControlNodeModels const* findControlModels(ConfigurationTree const& configTree, ControlIndex const controlIndex) noexcept
+{
+	auto const findIn = [controlIndex](std::map<ControlIndex, ControlNodeModels> const& controlModels) -> ControlNodeModels const*
+	{
+		if (auto const it = controlModels.find(controlIndex); it != controlModels.end())
+		{
+			return &it->second;
+		}
+		return nullptr;
+	};
+
+	if (auto const* const models = findIn(configTree.controlModels))
+	{
+		return models;
+	}
+	for (auto const& [audioUnitIndex, audioUnitTree] : configTree.audioUnitTrees)
+	{
+		if (auto const* const models = findIn(audioUnitTree.controlModels))
+		{
+			return models;
+		}
+		for (auto const* const streamPortTrees : { &audioUnitTree.streamPortInputTrees, &audioUnitTree.streamPortOutputTrees })
+		{
+			for (auto const& [streamPortIndex, streamPortTree] : *streamPortTrees)
+			{
+				if (auto const* const models = findIn(streamPortTree.controlModels))
+				{
+					return models;
+				}
+			}
+		}
+	}
+	for (auto const* const jackTrees : { &configTree.jackInputTrees, &configTree.jackOutputTrees })
+	{
+		for (auto const& [jackIndex, jackTree] : *jackTrees)
+		{
+			if (auto const* const models = findIn(jackTree.controlModels))
+			{
+				return models;
+			}
+		}
+	}
+	for (auto const& [ptpInstanceIndex, ptpInstanceTree] : configTree.ptpInstanceTrees)
+	{
+		if (auto const* const models = findIn(ptpInstanceTree.controlModels))
+		{
+			return models;
+		}
+	}
+	return nullptr;
+}
+
+template<typename Models>
+static Models const& findModels(std::map<DescriptorIndex, Models> const& models, DescriptorIndex const descriptorIndex)
+{
+	auto const it = models.find(descriptorIndex);
+	if (it == models.end())
+	{
+		throw NoSuchDescriptorException{};
+	}
+	return it->second;
+}
+
+static AvdeccFixedString const& findObjectName(ConfigurationTree const& configTree, DescriptorType const descriptorType, DescriptorIndex const descriptorIndex)
+{
+	switch (descriptorType)
+	{
+		case DescriptorType::AudioUnit:
+			return findModels(configTree.audioUnitTrees, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::StreamInput:
+			return findModels(configTree.streamInputModels, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::StreamOutput:
+			return findModels(configTree.streamOutputModels, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::JackInput:
+			return findModels(configTree.jackInputTrees, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::JackOutput:
+			return findModels(configTree.jackOutputTrees, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::AvbInterface:
+			return findModels(configTree.avbInterfaceModels, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::ClockSource:
+			return findModels(configTree.clockSourceModels, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::MemoryObject:
+			return findModels(configTree.memoryObjectModels, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::AudioCluster:
+			for (auto const& [audioUnitIndex, audioUnitTree] : configTree.audioUnitTrees)
+			{
+				for (auto const* const streamPortTrees : { &audioUnitTree.streamPortInputTrees, &audioUnitTree.streamPortOutputTrees })
+				{
+					for (auto const& [streamPortIndex, streamPortTree] : *streamPortTrees)
+					{
+						if (auto const it = streamPortTree.audioClusterModels.find(descriptorIndex); it != streamPortTree.audioClusterModels.end())
+						{
+							return it->second.dynamicModel.objectName;
+						}
+					}
+				}
+			}
+			throw NoSuchDescriptorException{};
+		case DescriptorType::Control:
+			if (auto const* const models = findControlModels(configTree, descriptorIndex))
+			{
+				return models->dynamicModel.objectName;
+			}
+			throw NoSuchDescriptorException{};
+		case DescriptorType::ClockDomain:
+			return findModels(configTree.clockDomainModels, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::Timing:
+			return findModels(configTree.timingModels, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::PtpInstance:
+			return findModels(configTree.ptpInstanceTrees, descriptorIndex).dynamicModel.objectName;
+		case DescriptorType::PtpPort:
+			for (auto const& [ptpInstanceIndex, ptpInstanceTree] : configTree.ptpInstanceTrees)
+			{
+				if (auto const it = ptpInstanceTree.ptpPortModels.find(descriptorIndex); it != ptpInstanceTree.ptpPortModels.end())
+				{
+					return it->second.dynamicModel.objectName;
+				}
+			}
+			throw NoSuchDescriptorException{};
+		default:
+			// Descriptor without an object_name field
+			throw BadArgumentsException{};
+	}
+}
+
+/** Packs counters stored in the entity model (indexed by their valid flag) into the GET_COUNTERS representation. Keys that are not a single bit are ignored */
+template<typename CountersType>
+static std::pair<DescriptorCounterValidFlag, DescriptorCounters> packCounters(std::optional<CountersType> const& counters) noexcept
+{
+	auto validCounters = DescriptorCounterValidFlag{ 0u };
+	auto descriptorCounters = DescriptorCounters{};
+
+	if (counters)
+	{
+		for (auto const& [validFlag, counter] : *counters)
+		{
+			auto const bit = static_cast<DescriptorCounterValidFlag>(utils::to_integral(validFlag));
+			if (bit != 0u && (bit & (bit - 1u)) == 0u)
+			{
+				validCounters |= bit;
+				descriptorCounters[utils::EnumBitfield<typename CountersType::key_type>::getPosition(validFlag)] = counter;
+			}
+		}
+	}
+
+	return { validCounters, descriptorCounters };
+}
+
+/** Builds the GET_STREAM_INFO representation of a stream from the values stored in the entity model. Fields without a value in the model are reported as not valid */
+static StreamInfo buildStreamInfo(StreamNodeDynamicModel const& dynamicModel, StreamInputConnectionInfo::State const connectionState) noexcept
+{
+	auto streamInfo = StreamInfo{};
+	auto& flags = streamInfo.streamInfoFlags;
+
+	streamInfo.streamFormat = dynamicModel.streamFormat;
+	if (streamInfo.streamFormat)
+	{
+		flags.set(StreamInfoFlag::StreamFormatValid);
+	}
+	if (dynamicModel.isStreamRunning && !*dynamicModel.isStreamRunning)
+	{
+		flags.set(StreamInfoFlag::StreamingWait);
+	}
+	if (connectionState == StreamInputConnectionInfo::State::Connected)
+	{
+		flags.set(StreamInfoFlag::Connected);
+	}
+	else if (connectionState == StreamInputConnectionInfo::State::FastConnecting)
+	{
+		flags.set(StreamInfoFlag::FastConnect);
+	}
+
+	if (auto const& info = dynamicModel.streamDynamicInfo)
+	{
+		if (info->isClassB)
+		{
+			flags.set(StreamInfoFlag::ClassB);
+		}
+		if (info->hasSavedState)
+		{
+			flags.set(StreamInfoFlag::SavedState);
+		}
+		if (info->doesSupportEncrypted)
+		{
+			flags.set(StreamInfoFlag::SupportsEncrypted);
+		}
+		if (info->arePdusEncrypted)
+		{
+			flags.set(StreamInfoFlag::EncryptedPdu);
+		}
+		if (info->hasSrpRegistrationFailed)
+		{
+			flags.set(StreamInfoFlag::SrpRegistrationFailed);
+		}
+		if (info->streamID)
+		{
+			flags.set(StreamInfoFlag::StreamIDValid);
+			streamInfo.streamID = *info->streamID;
+		}
+		if (info->msrpAccumulatedLatency)
+		{
+			flags.set(StreamInfoFlag::MsrpAccLatValid);
+			streamInfo.msrpAccumulatedLatency = *info->msrpAccumulatedLatency;
+		}
+		if (info->streamDestMac)
+		{
+			flags.set(StreamInfoFlag::StreamDestMacValid);
+			streamInfo.streamDestMac = *info->streamDestMac;
+		}
+		if (info->msrpFailureCode && info->msrpFailureBridgeID)
+		{
+			flags.set(StreamInfoFlag::MsrpFailureValid);
+			streamInfo.msrpFailureCode = *info->msrpFailureCode;
+			streamInfo.msrpFailureBridgeID = *info->msrpFailureBridgeID;
+		}
+		if (info->streamVlanID)
+		{
+			flags.set(StreamInfoFlag::StreamVlanIDValid);
+			streamInfo.streamVlanID = *info->streamVlanID;
+		}
+		// Milan extended information is only sent when complete
+		if (info->streamInfoFlagsEx && info->probingStatus && info->acmpStatus)
+		{
+			streamInfo.streamInfoFlagsEx = info->streamInfoFlagsEx;
+			streamInfo.probingStatus = info->probingStatus;
+			streamInfo.acmpStatus = info->acmpStatus;
+		}
+	}
+
+	return streamInfo;
+}
+
+ConfigurationTree const& AemHandler::getConfigurationTree(entity::model::ConfigurationIndex const configIndex) const
+{
+	auto const it = _entityModelTree->configurationTrees.find(configIndex);
+	if (it == _entityModelTree->configurationTrees.end())
+	{
+		throw NoSuchDescriptorException{};
+	}
+	return it->second;
+}
+
+bool AemHandler::serializeGetCommandResponse(protocol::AemCommandType const commandType, protocol::AemAecpdu::Payload const& commandPayload, ResponseSerializer& ser) const
+{
+	static auto const s_GetCommands = utils::DispatchTable<void(AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& payload, ResponseSerializer& ser), AemDispatchTableSize>{
+		// Get Configuration
+		{ protocol::AemCommandType::GetConfiguration.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& /*payload*/, ResponseSerializer& ser)
+			{
+				ser += protocol::aemPayload::serializeGetConfigurationResponse(ConfigurationIndex{ aemHandler._entityModelTree->dynamicModel.currentConfiguration });
+			} },
+		// Get Stream Format
+		{ protocol::AemCommandType::GetStreamFormat.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& payload, ResponseSerializer& ser)
+			{
+				auto const [descriptorType, descriptorIndex] = protocol::aemPayload::deserializeGetStreamFormatCommand(payload);
+				auto const& configTree = aemHandler.getConfigurationTree(aemHandler._entityModelTree->dynamicModel.currentConfiguration);
+				switch (descriptorType)
+				{
+					case DescriptorType::StreamInput:
+						ser += protocol::aemPayload::serializeGetStreamFormatResponse(descriptorType, descriptorIndex, findModels(configTree.streamInputModels, descriptorIndex).dynamicModel.streamFormat);
+						break;
+					case DescriptorType::StreamOutput:
+						ser += protocol::aemPayload::serializeGetStreamFormatResponse(descriptorType, descriptorIndex, findModels(configTree.streamOutputModels, descriptorIndex).dynamicModel.streamFormat);
+						break;
+					default:
+						throw BadArgumentsException{};
+				}
+			} },
+		// Get Stream Info
+		{ protocol::AemCommandType::GetStreamInfo.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& payload, ResponseSerializer& ser)
+			{
+				auto const [descriptorType, descriptorIndex] = protocol::aemPayload::deserializeGetStreamInfoCommand(payload);
+				auto const& configTree = aemHandler.getConfigurationTree(aemHandler._entityModelTree->dynamicModel.currentConfiguration);
+				switch (descriptorType)
+				{
+					case DescriptorType::StreamInput:
+					{
+						auto const& dynamicModel = findModels(configTree.streamInputModels, descriptorIndex).dynamicModel;
+						ser += protocol::aemPayload::serializeGetStreamInfoResponse(descriptorType, descriptorIndex, buildStreamInfo(dynamicModel, dynamicModel.connectionInfo.state));
+						break;
+					}
+					case DescriptorType::StreamOutput:
+						ser += protocol::aemPayload::serializeGetStreamInfoResponse(descriptorType, descriptorIndex, buildStreamInfo(findModels(configTree.streamOutputModels, descriptorIndex).dynamicModel, StreamInputConnectionInfo::State::NotConnected));
+						break;
+					default:
+						throw BadArgumentsException{};
+				}
+			} },
+		// Get Name
+		{ protocol::AemCommandType::GetName.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& payload, ResponseSerializer& ser)
+			{
+				auto const [descriptorType, descriptorIndex, nameIndex, configIndex] = protocol::aemPayload::deserializeGetNameCommand(payload);
+				auto const& entityTree = *aemHandler._entityModelTree;
+				switch (descriptorType)
+				{
+					case DescriptorType::Entity:
+					{
+						if (descriptorIndex != DescriptorIndex{ 0u } || nameIndex > 1u)
+						{
+							throw BadArgumentsException{};
+						}
+						auto const& name = nameIndex == 0u ? entityTree.dynamicModel.entityName : entityTree.dynamicModel.groupName;
+						ser += protocol::aemPayload::serializeGetNameResponse(descriptorType, descriptorIndex, nameIndex, configIndex, name);
+						break;
+					}
+					case DescriptorType::Configuration:
+					{
+						if (nameIndex != 0u)
+						{
+							throw BadArgumentsException{};
+						}
+						ser += protocol::aemPayload::serializeGetNameResponse(descriptorType, descriptorIndex, nameIndex, configIndex, aemHandler.getConfigurationTree(descriptorIndex).dynamicModel.objectName);
+						break;
+					}
+					default:
+					{
+						if (nameIndex != 0u)
+						{
+							throw BadArgumentsException{};
+						}
+						ser += protocol::aemPayload::serializeGetNameResponse(descriptorType, descriptorIndex, nameIndex, configIndex, findObjectName(aemHandler.getConfigurationTree(configIndex), descriptorType, descriptorIndex));
+						break;
+					}
+				}
+			} },
+		// Get Association ID
+		{ protocol::AemCommandType::GetAssociationID.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& /*payload*/, ResponseSerializer& ser)
+			{
+				auto const associationID = aemHandler._entity.getAssociationID();
+				if (!associationID)
+				{
+					throw protocol::aemPayload::NotImplementedException{};
+				}
+				ser += protocol::aemPayload::serializeGetAssociationIDResponse(*associationID);
+			} },
+		// Get Sampling Rate
+		{ protocol::AemCommandType::GetSamplingRate.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& payload, ResponseSerializer& ser)
+			{
+				auto const [descriptorType, descriptorIndex] = protocol::aemPayload::deserializeGetSamplingRateCommand(payload);
+				if (descriptorType != DescriptorType::AudioUnit)
+				{
+					throw BadArgumentsException{};
+				}
+				auto const& configTree = aemHandler.getConfigurationTree(aemHandler._entityModelTree->dynamicModel.currentConfiguration);
+				ser += protocol::aemPayload::serializeGetSamplingRateResponse(descriptorType, descriptorIndex, findModels(configTree.audioUnitTrees, descriptorIndex).dynamicModel.currentSamplingRate);
+			} },
+		// Get Clock Source
+		{ protocol::AemCommandType::GetClockSource.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& payload, ResponseSerializer& ser)
+			{
+				auto const [descriptorType, descriptorIndex] = protocol::aemPayload::deserializeGetClockSourceCommand(payload);
+				if (descriptorType != DescriptorType::ClockDomain)
+				{
+					throw BadArgumentsException{};
+				}
+				auto const& configTree = aemHandler.getConfigurationTree(aemHandler._entityModelTree->dynamicModel.currentConfiguration);
+				ser += protocol::aemPayload::serializeGetClockSourceResponse(descriptorType, descriptorIndex, findModels(configTree.clockDomainModels, descriptorIndex).dynamicModel.clockSourceIndex);
+			} },
+		// Get Counters
+		{ protocol::AemCommandType::GetCounters.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& payload, ResponseSerializer& ser)
+			{
+				auto const [descriptorType, descriptorIndex] = protocol::aemPayload::deserializeGetCountersCommand(payload);
+				auto const& configTree = aemHandler.getConfigurationTree(aemHandler._entityModelTree->dynamicModel.currentConfiguration);
+				auto validCounters = DescriptorCounterValidFlag{ 0u };
+				auto counters = DescriptorCounters{};
+				switch (descriptorType)
+				{
+					case DescriptorType::Entity:
+						if (descriptorIndex != DescriptorIndex{ 0u })
+						{
+							throw NoSuchDescriptorException{};
+						}
+						std::tie(validCounters, counters) = packCounters(aemHandler._entityModelTree->dynamicModel.counters);
+						break;
+					case DescriptorType::AvbInterface:
+						std::tie(validCounters, counters) = packCounters(findModels(configTree.avbInterfaceModels, descriptorIndex).dynamicModel.counters);
+						break;
+					case DescriptorType::ClockDomain:
+						std::tie(validCounters, counters) = packCounters(findModels(configTree.clockDomainModels, descriptorIndex).dynamicModel.counters);
+						break;
+					case DescriptorType::StreamInput:
+						std::tie(validCounters, counters) = packCounters(findModels(configTree.streamInputModels, descriptorIndex).dynamicModel.counters);
+						break;
+					case DescriptorType::StreamOutput:
+					{
+						// StreamOutputCounters already store the counters in the GET_COUNTERS representation
+						if (auto const& streamOutputCounters = findModels(configTree.streamOutputModels, descriptorIndex).dynamicModel.counters)
+						{
+							validCounters = streamOutputCounters->getBaseValidFlags();
+							counters = streamOutputCounters->getBaseCounters();
+						}
+						break;
+					}
+					default:
+						throw BadArgumentsException{};
+				}
+				ser += protocol::aemPayload::serializeGetCountersResponse(descriptorType, descriptorIndex, validCounters, counters);
+			} },
+		// Get Memory Object Length
+		{ protocol::AemCommandType::GetMemoryObjectLength.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& payload, ResponseSerializer& ser)
+			{
+				auto const [configIndex, memoryObjectIndex] = protocol::aemPayload::deserializeGetMemoryObjectLengthCommand(payload);
+				auto const& configTree = aemHandler.getConfigurationTree(configIndex);
+				ser += protocol::aemPayload::serializeGetMemoryObjectLengthResponse(configIndex, memoryObjectIndex, findModels(configTree.memoryObjectModels, memoryObjectIndex).dynamicModel.length);
+			} },
+		// Get Max Transit Time
+		{ protocol::AemCommandType::GetMaxTransitTime.getValue(),
+			[](AemHandler const& aemHandler, protocol::AemAecpdu::Payload const& payload, ResponseSerializer& ser)
+			{
+				auto const [descriptorType, streamIndex] = protocol::aemPayload::deserializeGetMaxTransitTimeCommand(payload);
+				if (descriptorType != DescriptorType::StreamOutput)
+				{
+					throw BadArgumentsException{};
+				}
+				auto const& configTree = aemHandler.getConfigurationTree(aemHandler._entityModelTree->dynamicModel.currentConfiguration);
+				auto const& presentationTimeOffset = findModels(configTree.streamOutputModels, streamIndex).dynamicModel.presentationTimeOffset;
+				ser += protocol::aemPayload::serializeGetMaxTransitTimeResponse(descriptorType, streamIndex, static_cast<std::uint64_t>(presentationTimeOffset.count()));
+			} },
+	};
+
+	auto const dispatchHandler = s_GetCommands.find(commandType.getValue());
+	if (dispatchHandler == nullptr)
+	{
+		return false;
+	}
+	dispatchHandler(*this, commandPayload, ser);
+	return true;
+}
+
+void AemHandler::sendDynamicInfo(protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem) const
+{
+	// Size of the header preceding each command in a GET_DYNAMIC_INFO payload (command_length, reserved, status, reserved, command_type)
+	constexpr auto DynamicInfoHeaderLength = size_t{ 8u };
+
+	auto const commands = protocol::aemPayload::deserializeGetDynamicInfoCommand(aem.getPayload());
+	auto responses = protocol::aemPayload::DynamicInfos{};
+	responses.reserve(commands.size());
+	auto responseLength = size_t{ 0u };
+
+	// Answer each command independently, a failed command is returned with its status and its command payload
+	for (auto const& [commandStatus, commandType, commandPayload] : commands)
+	{
+		auto status = protocol::AecpStatus{ protocol::AecpStatus::Success };
+		auto ser = ResponseSerializer{};
+		try
+		{
+			if (!serializeGetCommandResponse(commandType, protocol::AemAecpdu::Payload{ commandPayload.data(), commandPayload.size() }, ser))
+			{
+				status = protocol::AemAecpStatus::NotImplemented;
+			}
+		}
+		catch (NoSuchDescriptorException const&)
+		{
+			status = protocol::AemAecpStatus::NoSuchDescriptor;
+		}
+		catch (BadArgumentsException const&)
+		{
+			status = protocol::AemAecpStatus::BadArguments;
+		}
+		catch (protocol::aemPayload::IncorrectPayloadSizeException const&)
+		{
+			status = protocol::AemAecpStatus::BadArguments;
+		}
+		catch (protocol::aemPayload::NotImplementedException const&)
+		{
+			status = protocol::AemAecpStatus::NotImplemented;
+		}
+		catch (la::avdecc::Exception const&)
+		{
+			status = protocol::AemAecpStatus::EntityMisbehaving;
+		}
+
+		if (status == protocol::AemAecpStatus::Success)
+		{
+			responseLength += DynamicInfoHeaderLength + ser.size();
+			responses.emplace_back(status, commandType, MemoryBuffer{ ser.data(), ser.size() });
+		}
+		else
+		{
+			responseLength += DynamicInfoHeaderLength + commandPayload.size();
+			responses.emplace_back(status, commandType, commandPayload);
+		}
+	}
+
+	// The controller packs its commands so the responses fit in a single AECPDU, refuse the whole command if they don't
+	if (responseLength > protocol::AemAecpdu::MaximumPayloadLength_17221)
+	{
+		LocalEntityImpl<>::reflectAecpCommand(pi, aem, protocol::AemAecpStatus::NoResources);
+		return;
+	}
+
+	auto const ser = protocol::aemPayload::serializeGetDynamicInfoResponse(responses);
+	LocalEntityImpl<>::sendAemAecpResponse(pi, aem, protocol::AemAecpStatus::Success, ser.data(), ser.size());
+}
+
+void AemHandler::notifyControlValuesChanged(protocol::ProtocolInterface* const pi, entity::model::ControlIndex const controlIndex) noexcept
+{
+	if (_entityModelTree == nullptr)
+	{
+		return;
+	}
+
+	auto const configIndex = _entityModelTree->dynamicModel.currentConfiguration;
+	auto const configIt = _entityModelTree->configurationTrees.find(configIndex);
+	if (configIt == _entityModelTree->configurationTrees.end())
+	{
+		return;
+	}
+	auto const* const controlModels = findControlModels(configIt->second, controlIndex);
+	if (!AVDECC_ASSERT_WITH_RET(controlModels != nullptr, "ControlIndex not found in the current configuration"))
+	{
+		return;
+	}
+
+	try
+	{
+		// The CONTROL descriptor contains the current values, update the one served to READ_DESCRIPTOR
+		{
+			auto const lg = std::lock_guard{ _lock };
+			if (auto const configDescriptorsIt = _serializedDescriptors.find(configIndex); configDescriptorsIt != _serializedDescriptors.end())
+			{
+				auto& descriptors = configDescriptorsIt->second;
+				if (auto const it = descriptors.find(makeDescriptorKey(DescriptorType::Control, controlIndex)); it != descriptors.end())
+				{
+					updateSerializedDescriptor(it->second, DescriptorType::Control, controlIndex);
+				}
+			}
+		}
+
+		auto const ser = protocol::aemPayload::serializeSetControlResponse(DescriptorType::Control, controlIndex, controlModels->dynamicModel.values);
+		queueUnsolicitedNotification(pi, protocol::AemCommandType::SetControl, DescriptorType::Control, controlIndex, ser.data(), ser.size());
+	}
+	catch (...)
+	{
+		// Values cannot be serialized (or not enough memory), nothing to notify
+	}
+}
+
+void AemHandler::onRemoteEntityOffline(UniqueIdentifier const entityID) noexcept
+{
+	// A departing controller is no longer registered for unsolicited notifications
+	unregisterUnsolicitedNotifications(entityID);
+}
+
+void AemHandler::registerUnsolicitedNotifications(protocol::AemAecpdu const& aem) const noexcept
+{
+	auto const lg = std::lock_guard{ _notificationsLock };
+
+	auto const controllerEntityID = aem.getControllerEntityID();
+	auto const it = std::find_if(_unsolicitedNotificationsSubscribers.begin(), _unsolicitedNotificationsSubscribers.end(),
+		[controllerEntityID](auto const& subscriber)
+		{
+			return subscriber.controllerEntityID == controllerEntityID;
+		});
+
+	// Already registered, only refresh its address
+	if (it != _unsolicitedNotificationsSubscribers.end())
+	{
+		it->macAddress = aem.getSrcAddress();
+		return;
+	}
+
+	try
+	{
+		_unsolicitedNotificationsSubscribers.push_back(UnsolicitedNotificationsSubscriber{ controllerEntityID, aem.getSrcAddress(), 0u });
+	}
+	catch (...)
+	{
+	}
+}
+
+void AemHandler::unregisterUnsolicitedNotifications(UniqueIdentifier const controllerEntityID) const noexcept
+{
+	auto const lg = std::lock_guard{ _notificationsLock };
+
+	_unsolicitedNotificationsSubscribers.erase(std::remove_if(_unsolicitedNotificationsSubscribers.begin(), _unsolicitedNotificationsSubscribers.end(),
+																								 [controllerEntityID](auto const& subscriber)
+																								 {
+																									 return subscriber.controllerEntityID == controllerEntityID;
+																								 }),
+		_unsolicitedNotificationsSubscribers.end());
+}
+
+void AemHandler::queueUnsolicitedNotification(protocol::ProtocolInterface* const pi, protocol::AemCommandType const commandType, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, std::uint8_t const* const payload, size_t const payloadLength) noexcept
+{
+	try
+	{
+		// Lock the ProtocolInterface first, the same order as when a command is dispatched to this handler
+		auto const piLock = std::lock_guard<decltype(*pi)>{ *pi };
+		auto const lg = std::lock_guard{ _notificationsLock };
+
+		// Nobody to notify
+		if (_unsolicitedNotificationsSubscribers.empty())
+		{
+			return;
+		}
+
+		auto const key = (static_cast<std::uint64_t>(commandType.getValue()) << 32) | makeDescriptorKey(descriptorType, descriptorIndex);
+		auto& notification = _unsolicitedNotifications[key];
+		notification.commandType = commandType;
+
+		// Enough time elapsed since the last notification for this descriptor, send it right away
+		auto const now = std::chrono::steady_clock::now();
+		if (now - notification.lastSentTime >= UnsolicitedNotificationMinimumInterval)
+		{
+			notification.lastSentTime = now;
+			notification.isPending = false;
+			sendUnsolicitedNotification(pi, commandType, payload, payloadLength);
+			return;
+		}
+
+		// Otherwise coalesce with any pending notification, only the latest state is sent once the interval elapsed
+		notification.pendingPayload.assign(payload, payload + payloadLength);
+		notification.isPending = true;
+		_notificationsProtocolInterface = pi;
+
+		if (!_notificationsThread.joinable())
+		{
+			_notificationsThread = std::thread(
+				[this]
+				{
+					utils::setCurrentThreadName("avdecc::AemHandler::Notifications");
+					schedulePendingUnsolicitedNotifications();
+				});
+		}
+		_notificationsCondition.notify_one();
+	}
+	catch (...)
+	{
+	}
+}
+
+void AemHandler::sendUnsolicitedNotification(protocol::ProtocolInterface* const pi, protocol::AemCommandType const commandType, std::uint8_t const* const payload, size_t const payloadLength) noexcept
+{
+	// The payload is serialized once, only the destination and the sequence change for each controller
+	for (auto& subscriber : _unsolicitedNotificationsSubscribers)
+	{
+		try
+		{
+			auto frame = protocol::AemAecpdu::create(true);
+			auto* aem = static_cast<protocol::AemAecpdu*>(frame.get());
+
+			// Set Ether2 fields
+			aem->setSrcAddress(pi->getMacAddress());
+			aem->setDestAddress(subscriber.macAddress);
+			// Set AECP fields
+			aem->setStatus(protocol::AemAecpStatus::Success);
+			aem->setTargetEntityID(_entity.getEntityID());
+			aem->setControllerEntityID(subscriber.controllerEntityID);
+			aem->setSequenceID(subscriber.nextSequenceID++);
+			// Set AEM fields
+			aem->setUnsolicited(true);
+			aem->setCommandType(commandType);
+			aem->setCommandSpecificData(payload, payloadLength);
+
+			// We don't care about the send errors
+			pi->sendAecpResponse(std::move(frame));
+		}
+		catch (...)
+		{
+		}
+	}
+}
+
+void AemHandler::schedulePendingUnsolicitedNotifications() noexcept
+{
+	auto lg = std::unique_lock{ _notificationsLock };
+
+	while (!_shouldTerminate)
+	{
+		// Find when the next pending notification is due (unless a job sending them is already queued)
+		auto nextDueTime = std::chrono::steady_clock::time_point::max();
+		if (!_isSendJobPending)
+		{
+			for (auto const& [key, notification] : _unsolicitedNotifications)
+			{
+				if (notification.isPending)
+				{
+					nextDueTime = std::min(nextDueTime, notification.lastSentTime + UnsolicitedNotificationMinimumInterval);
+				}
+			}
+		}
+
+		if (nextDueTime == std::chrono::steady_clock::time_point::max())
+		{
+			_notificationsCondition.wait(lg);
+			continue;
+		}
+		if (std::chrono::steady_clock::now() < nextDueTime)
+		{
+			_notificationsCondition.wait_until(lg, nextDueTime);
+			continue;
+		}
+
+		// Some notifications are due, send them from the ProtocolInterface executor (which can lock the ProtocolInterface first, the same order as when a command is dispatched)
+		auto* const pi = _notificationsProtocolInterface;
+		_isSendJobPending = true;
+		ExecutorManager::getInstance().pushJob(pi->getExecutorName(),
+			[pi, sender = _notificationsSender]()
+			{
+				auto const piLock = std::lock_guard<decltype(*pi)>{ *pi };
+				if (sender->handler != nullptr)
+				{
+					sender->handler->sendDueUnsolicitedNotifications(pi);
+				}
+			});
+	}
+}
+
+void AemHandler::sendDueUnsolicitedNotifications(protocol::ProtocolInterface* const pi) noexcept
+{
+	{
+		auto const lg = std::lock_guard{ _notificationsLock };
+
+		_isSendJobPending = false;
+		auto const now = std::chrono::steady_clock::now();
+		for (auto& [key, notification] : _unsolicitedNotifications)
+		{
+			if (notification.isPending && now - notification.lastSentTime >= UnsolicitedNotificationMinimumInterval)
+			{
+				notification.lastSentTime = now;
+				notification.isPending = false;
+				sendUnsolicitedNotification(pi, notification.commandType, notification.pendingPayload.data(), notification.pendingPayload.size());
+			}
+		}
+	}
+
+	// Reschedule the notifications that are still pending
+	_notificationsCondition.notify_one();
+}
+
 } // namespace model
 } // namespace entity
 } // namespace avdecc
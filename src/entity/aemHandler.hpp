@@ -28,6 +28,16 @@
 #include "la/avdecc/internals/entityModelTree.hpp"
 #include "la/avdecc/internals/protocolInterface.hpp"
 #include "la/avdecc/internals/protocolAemAecpdu.hpp"
+#include "la/avdecc/internals/serialization.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace la
 {
@@ -40,12 +50,25 @@ namespace model
 class AemHandler final
 {
 public:
+	/** Minimum delay between two unsolicited notifications for the same descriptor, intermediate changes are coalesced */
+	static constexpr auto UnsolicitedNotificationMinimumInterval = std::chrono::milliseconds{ 100 };
+
 	AemHandler(entity::Entity const& entity, entity::model::EntityTree const* const entityModelTree);
+	~AemHandler() noexcept;
 
 	static void validateEntityModel(entity::model::EntityTree const* const entityModelTree);
 
 	bool onUnhandledAecpAemCommand(protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem) const noexcept;
 
+	/** Discards the serialized descriptors, to be called whenever descriptors have been added to or removed from the entity model tree (modified dynamic fields are detected when a descriptor is read) */
+	void notifyEntityModelChanged() noexcept;
+
+	/** Sends a SET_CONTROL unsolicited notification to the registered controllers, to be called whenever the current values of a CONTROL of the current configuration have been modified in the entity model tree */
+	void notifyControlValuesChanged(protocol::ProtocolInterface* const pi, entity::model::ControlIndex const controlIndex) noexcept;
+
+	/** Unregisters a controller from unsolicited notifications, to be called when a remote entity goes offline */
+	void onRemoteEntityOffline(UniqueIdentifier const entityID) noexcept;
+
 	// Deleted compiler auto-generated methods
 	AemHandler(AemHandler const&) = delete;
 	AemHandler(AemHandler&&) = delete;
@@ -53,11 +76,87 @@ public:
 	AemHandler& operator=(AemHandler&&) = delete;
 
 private:
+	using ResponseSerializer = Serializer<protocol::AemAecpdu::MaximumSendPayloadBufferLength>;
+
+	/** Serializes a descriptor (or its dynamic fields) from the models it is built from */
+	struct DescriptorSerializer
+	{
+		void (*serializeDescriptor)(ResponseSerializer& ser, void const* const models){ nullptr };
+		void (*serializeDynamicFields)(ResponseSerializer& ser, void const* const models){ nullptr };
+	};
+	/** READ_DESCRIPTOR response payload (including the common descriptor fields) of a descriptor, along with the dynamic fields it was serialized with */
+	struct SerializedDescriptor
+	{
+		entity::model::ConfigurationIndex configIndex{ 0u }; /** ConfigurationIndex of the response */
+		void const* models{ nullptr }; /** Models of the entity model tree the descriptor is built from */
+		DescriptorSerializer const* serializer{ nullptr };
+		std::vector<std::uint8_t> payload{}; /** Empty if the descriptor failed to serialize */
+		std::vector<std::uint8_t> dynamicFields{};
+	};
+	/** Serialized descriptors of a configuration, indexed by DescriptorType and DescriptorIndex */
+	using SerializedDescriptors = std::unordered_map<std::uint32_t, SerializedDescriptor>;
+
+	template<auto BuildDescriptor, auto SerializeDescriptor, auto SerializeDynamicFields, typename Models>
+	static void storeSerializedDescriptor(SerializedDescriptors& descriptors, entity::model::ConfigurationIndex const configIndex, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, Models const& models);
+	static void updateSerializedDescriptor(SerializedDescriptor& descriptor, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex) noexcept;
+	static bool hasDynamicFieldsChanged(SerializedDescriptor const& descriptor) noexcept;
+
 	EntityDescriptor buildEntityDescriptor() const noexcept;
-	ConfigurationDescriptor buildConfigurationDescriptor(entity::model::ConfigurationIndex const configIndex) const;
+	SerializedDescriptors& getSerializedDescriptors(entity::model::ConfigurationIndex const configIndex) const;
+	/** Sends the READ_DESCRIPTOR response of a descriptor of the entity model. Returns false if the descriptor is not part of the model */
+	bool sendSerializedDescriptor(protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem, entity::model::ConfigurationIndex const configIndex, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex) const;
+
+	entity::model::ConfigurationTree const& getConfigurationTree(entity::model::ConfigurationIndex const configIndex) const;
+	/** Serializes the response to a GET command answered from the entity model (directly or as a GET_DYNAMIC_INFO sub-command). Returns false if the command is not one of them */
+	bool serializeGetCommandResponse(protocol::AemCommandType const commandType, protocol::AemAecpdu::Payload const& commandPayload, ResponseSerializer& ser) const;
+	void sendDynamicInfo(protocol::ProtocolInterface* const pi, protocol::AemAecpdu const& aem) const;
+
+	/** A controller registered with REGISTER_UNSOLICITED_NOTIFICATION */
+	struct UnsolicitedNotificationsSubscriber
+	{
+		UniqueIdentifier controllerEntityID{};
+		networkInterface::MacAddress macAddress{};
+		protocol::AecpSequenceID nextSequenceID{ 0u }; /** Unsolicited notifications have their own sequence per controller */
+	};
+	/** Last unsolicited notification for a descriptor (and command), and the one waiting for the minimum interval to elapse */
+	struct UnsolicitedNotification
+	{
+		protocol::AemCommandType commandType{ protocol::AemCommandType::InvalidCommandType };
+		std::chrono::steady_clock::time_point lastSentTime{};
+		bool isPending{ false };
+		std::vector<std::uint8_t> pendingPayload{};
+	};
+
+	void registerUnsolicitedNotifications(protocol::AemAecpdu const& aem) const noexcept;
+	void unregisterUnsolicitedNotifications(UniqueIdentifier const controllerEntityID) const noexcept;
+	void queueUnsolicitedNotification(protocol::ProtocolInterface* const pi, protocol::AemCommandType const commandType, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, std::uint8_t const* const payload, size_t const payloadLength) noexcept;
+	void sendUnsolicitedNotification(protocol::ProtocolInterface* const pi, protocol::AemCommandType const commandType, std::uint8_t const* const payload, size_t const payloadLength) noexcept;
+	/** Notifications thread: waits for the pending notifications to be due and pushes a job sending them to the ProtocolInterface executor */
+	void schedulePendingUnsolicitedNotifications() noexcept;
+	/** Sends the pending notifications that are due (ProtocolInterface must be locked) */
+	void sendDueUnsolicitedNotifications(protocol::ProtocolInterface* const pi) noexcept;
+
+	/** Shared with the jobs pushed to the ProtocolInterface executor, so they do not use a destroyed handler (protected by the ProtocolInterface lock) */
+	struct NotificationsSender
+	{
+		AemHandler* handler{ nullptr };
+	};
 
 	entity::Entity const& _entity;
 	entity::model::EntityTree const* _entityModelTree{ nullptr };
+	mutable std::mutex _lock{};
+	mutable std::unordered_map<ConfigurationIndex, SerializedDescriptors> _serializedDescriptors{}; /** Serialized on first request, as all controllers read the same descriptors */
+
+	// Unsolicited notifications (always lock the ProtocolInterface before _notificationsLock, the same order as when a command is dispatched)
+	mutable std::mutex _notificationsLock{};
+	mutable std::vector<UnsolicitedNotificationsSubscriber> _unsolicitedNotificationsSubscribers{};
+	std::unordered_map<std::uint64_t, UnsolicitedNotification> _unsolicitedNotifications{}; /** Indexed by AemCommandType, DescriptorType and DescriptorIndex */
+	protocol::ProtocolInterface* _notificationsProtocolInterface{ nullptr }; /** ProtocolInterface used to send the pending notifications, cleared when the handler is destroyed */
+	std::shared_ptr<NotificationsSender> _notificationsSender{ std::make_shared<NotificationsSender>(NotificationsSender{ this }) };
+	std::condition_variable _notificationsCondition{};
+	std::thread _notificationsThread{}; /** Started on first coalesced notification, never locks the ProtocolInterface (sending is done on its executor) so it can always be joined */
+	bool _isSendJobPending{ false }; /** A job sending the due notifications has been pushed to the ProtocolInterface executor */
+	bool _shouldTerminate{ false };
 };
 
 } // namespace model
@@ -1146,6 +1146,24 @@ void AggregateEntityImpl::setControllerDelegate(controller::Delegate* const dele
 	}
 }
 
+void AggregateEntityImpl::notifyEntityModelChanged() noexcept
+{
+	// The entity model is only exposed through the ControllerCapabilityDelegate
+	if (_controllerCapabilityDelegate != nullptr)
+	{
+		static_cast<controller::CapabilityDelegate&>(*_controllerCapabilityDelegate).notifyEntityModelChanged();
+	}
+}
+
+void AggregateEntityImpl::notifyControlValuesChanged(model::ControlIndex const controlIndex) noexcept
+{
+	// The entity model is only exposed through the ControllerCapabilityDelegate
+	if (_controllerCapabilityDelegate != nullptr)
+	{
+		static_cast<controller::CapabilityDelegate&>(*_controllerCapabilityDelegate).notifyControlValuesChanged(controlIndex);
+	}
+}
+
 /*void AggregateEntityImpl::setListenerDelegate(listener::Delegate* const delegate) noexcept
 {
 	if (AVDECC_ASSERT_WITH_RET(_listenerCapabilityDelegate != nullptr, "Listener method should have a valid ListenerCapabilityDelegate"))
@@ -203,6 +203,8 @@ private:
 	virtual void setControllerDelegate(controller::Delegate* const delegate) noexcept override;
 	//virtual void setListenerDelegate(listener::Delegate* const delegate) noexcept override;
 	//virtual void setTalkerDelegate(talker::Delegate* const delegate) noexcept override;
+	virtual void notifyEntityModelChanged() noexcept override;
+	virtual void notifyControlValuesChanged(model::ControlIndex const controlIndex) noexcept override;
 
 	/* ************************************************************************** */
 	/* protocol::ProtocolInterface::Observer overrides                            */
@@ -59,6 +59,13 @@ static model::StreamInputInfoEx const s_emptyStreamInputInfoEx{}; // Empty Strea
 static DynamicInfoParameters const s_emptyDynamicInfoParameters{}; // Empty DynamicInfoParameters used by timeout callback (need a ref to a DynamicInfoParameters)
 static model::StreamIdentification const s_emptyStreamIdentification{}; // Empty StreamIdentification used by timeout callback
 
+/* ************************************************************************** */
+/* Dispatch tables sizes                                                      */
+/* ************************************************************************** */
+static constexpr auto AemDispatchTableSize = std::size_t{ 0x80 }; // All AEM command_type values defined by IEEE 1722.1 are below 0x80 (Expansion excepted, which is not handled)
+static constexpr auto MvuDispatchTableSize = std::size_t{ 0x10 }; // All MVU command_type values defined by Milan are below 0x10
+static constexpr auto AcmpDispatchTableSize = std::size_t{ 0x10 }; // ACMP message_type is a 4 bits field
+
 /* ************************************************************************** */
 /* Exceptions                                                                 */
 /* ************************************************************************** */
@@ -111,15 +118,25 @@ void CapabilityDelegate::setControllerDelegate(controller::Delegate* const deleg
 	_controllerDelegate = delegate;
 }
 
+void CapabilityDelegate::notifyEntityModelChanged() noexcept
+{
+	_aemHandler.notifyEntityModelChanged();
+}
+
+void CapabilityDelegate::notifyControlValuesChanged(model::ControlIndex const controlIndex) noexcept
+{
+	_aemHandler.notifyControlValuesChanged(_protocolInterface, controlIndex);
+}
+
 /* Discovery Protocol (ADP) */
 /* Enumeration and Control Protocol (AECP) AEM */
 void CapabilityDelegate::acquireEntity(UniqueIdentifier const targetEntityID, bool const isPersistent, model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex, Interface::AcquireEntityHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeAcquireEntityCommand(isPersistent ? protocol::AemAcquireEntityFlags::Persistent : protocol::AemAcquireEntityFlags::None, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AcquireEntity, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AcquireEntity, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -130,11 +147,11 @@ void CapabilityDelegate::acquireEntity(UniqueIdentifier const targetEntityID, bo
 
 void CapabilityDelegate::releaseEntity(UniqueIdentifier const targetEntityID, model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex, Interface::ReleaseEntityHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeAcquireEntityCommand(protocol::AemAcquireEntityFlags::Release, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AcquireEntity, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AcquireEntity, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -145,11 +162,11 @@ void CapabilityDelegate::releaseEntity(UniqueIdentifier const targetEntityID, mo
 
 void CapabilityDelegate::lockEntity(UniqueIdentifier const targetEntityID, model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex, Interface::LockEntityHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeLockEntityCommand(protocol::AemLockEntityFlags::None, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::LockEntity, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::LockEntity, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -160,11 +177,11 @@ void CapabilityDelegate::lockEntity(UniqueIdentifier const targetEntityID, model
 
 void CapabilityDelegate::unlockEntity(UniqueIdentifier const targetEntityID, model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex, Interface::UnlockEntityHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeLockEntityCommand(protocol::AemLockEntityFlags::Unlock, UniqueIdentifier::getNullUniqueIdentifier(), descriptorType, descriptorIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::LockEntity, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::LockEntity, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -175,35 +192,35 @@ void CapabilityDelegate::unlockEntity(UniqueIdentifier const targetEntityID, mod
 
 void CapabilityDelegate::queryEntityAvailable(UniqueIdentifier const targetEntityID, Interface::QueryEntityAvailableHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
-	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::EntityAvailable, nullptr, 0, errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
+	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::EntityAvailable, nullptr, 0, std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::queryControllerAvailable(UniqueIdentifier const targetEntityID, Interface::QueryControllerAvailableHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
-	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ControllerAvailable, nullptr, 0, errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
+	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ControllerAvailable, nullptr, 0, std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::registerUnsolicitedNotifications(UniqueIdentifier const targetEntityID, Interface::RegisterUnsolicitedNotificationsHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
-	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::RegisterUnsolicitedNotification, nullptr, 0, errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
+	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::RegisterUnsolicitedNotification, nullptr, 0, std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::unregisterUnsolicitedNotifications(UniqueIdentifier const targetEntityID, Interface::UnregisterUnsolicitedNotificationsHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
-	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::DeregisterUnsolicitedNotification, nullptr, 0, errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
+	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::DeregisterUnsolicitedNotification, nullptr, 0, std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::readEntityDescriptor(UniqueIdentifier const targetEntityID, Interface::EntityDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, model::EntityDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, model::EntityDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(model::ConfigurationIndex(0u), model::DescriptorType::Entity, model::DescriptorIndex(0u));
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -214,11 +231,11 @@ void CapabilityDelegate::readEntityDescriptor(UniqueIdentifier const targetEntit
 
 void CapabilityDelegate::readConfigurationDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, Interface::ConfigurationDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, model::ConfigurationDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, model::ConfigurationDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(model::ConfigurationIndex(0u), model::DescriptorType::Configuration, static_cast<model::DescriptorIndex>(configurationIndex)); // Passing configurationIndex as a DescriptorIndex is NOT an error. See 7.4.5.1
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -229,11 +246,11 @@ void CapabilityDelegate::readConfigurationDescriptor(UniqueIdentifier const targ
 
 void CapabilityDelegate::readAudioUnitDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::AudioUnitIndex const audioUnitIndex, Interface::AudioUnitDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioUnitIndex, model::AudioUnitDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioUnitIndex, model::AudioUnitDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::AudioUnit, audioUnitIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -244,11 +261,11 @@ void CapabilityDelegate::readAudioUnitDescriptor(UniqueIdentifier const targetEn
 
 void CapabilityDelegate::readStreamInputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::StreamIndex const streamIndex, Interface::StreamInputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, model::StreamDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, model::StreamDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::StreamInput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -259,11 +276,11 @@ void CapabilityDelegate::readStreamInputDescriptor(UniqueIdentifier const target
 
 void CapabilityDelegate::readStreamOutputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::StreamIndex const streamIndex, Interface::StreamOutputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, model::StreamDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, model::StreamDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::StreamOutput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -274,11 +291,11 @@ void CapabilityDelegate::readStreamOutputDescriptor(UniqueIdentifier const targe
 
 void CapabilityDelegate::readJackInputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::JackIndex const jackIndex, Interface::JackInputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, model::JackDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, model::JackDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::JackInput, jackIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -289,11 +306,11 @@ void CapabilityDelegate::readJackInputDescriptor(UniqueIdentifier const targetEn
 
 void CapabilityDelegate::readJackOutputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::JackIndex const jackIndex, Interface::JackOutputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, model::JackDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, model::JackDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::JackOutput, jackIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -304,11 +321,11 @@ void CapabilityDelegate::readJackOutputDescriptor(UniqueIdentifier const targetE
 
 void CapabilityDelegate::readAvbInterfaceDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::AvbInterfaceIndex const avbInterfaceIndex, Interface::AvbInterfaceDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, avbInterfaceIndex, model::AvbInterfaceDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, avbInterfaceIndex, model::AvbInterfaceDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::AvbInterface, avbInterfaceIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -319,11 +336,11 @@ void CapabilityDelegate::readAvbInterfaceDescriptor(UniqueIdentifier const targe
 
 void CapabilityDelegate::readClockSourceDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ClockSourceIndex const clockSourceIndex, Interface::ClockSourceDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockSourceIndex, model::ClockSourceDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockSourceIndex, model::ClockSourceDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::ClockSource, clockSourceIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -334,11 +351,11 @@ void CapabilityDelegate::readClockSourceDescriptor(UniqueIdentifier const target
 
 void CapabilityDelegate::readMemoryObjectDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::MemoryObjectIndex const memoryObjectIndex, Interface::MemoryObjectDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, model::MemoryObjectDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, model::MemoryObjectDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::MemoryObject, memoryObjectIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -349,11 +366,11 @@ void CapabilityDelegate::readMemoryObjectDescriptor(UniqueIdentifier const targe
 
 void CapabilityDelegate::readLocaleDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::LocaleIndex const localeIndex, Interface::LocaleDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, localeIndex, model::LocaleDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, localeIndex, model::LocaleDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::Locale, localeIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -364,11 +381,11 @@ void CapabilityDelegate::readLocaleDescriptor(UniqueIdentifier const targetEntit
 
 void CapabilityDelegate::readStringsDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::StringsIndex const stringsIndex, Interface::StringsDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, stringsIndex, model::StringsDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, stringsIndex, model::StringsDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::Strings, stringsIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -379,11 +396,11 @@ void CapabilityDelegate::readStringsDescriptor(UniqueIdentifier const targetEnti
 
 void CapabilityDelegate::readStreamPortInputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::StreamPortIndex const streamPortIndex, Interface::StreamPortInputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamPortIndex, model::StreamPortDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamPortIndex, model::StreamPortDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::StreamPortInput, streamPortIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -394,11 +411,11 @@ void CapabilityDelegate::readStreamPortInputDescriptor(UniqueIdentifier const ta
 
 void CapabilityDelegate::readStreamPortOutputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::StreamPortIndex const streamPortIndex, Interface::StreamPortOutputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamPortIndex, model::StreamPortDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamPortIndex, model::StreamPortDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::StreamPortOutput, streamPortIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -409,11 +426,11 @@ void CapabilityDelegate::readStreamPortOutputDescriptor(UniqueIdentifier const t
 
 void CapabilityDelegate::readExternalPortInputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ExternalPortIndex const externalPortIndex, Interface::ExternalPortInputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, externalPortIndex, model::ExternalPortDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, externalPortIndex, model::ExternalPortDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::ExternalPortInput, externalPortIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -424,11 +441,11 @@ void CapabilityDelegate::readExternalPortInputDescriptor(UniqueIdentifier const
 
 void CapabilityDelegate::readExternalPortOutputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ExternalPortIndex const externalPortIndex, Interface::ExternalPortOutputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, externalPortIndex, model::ExternalPortDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, externalPortIndex, model::ExternalPortDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::ExternalPortOutput, externalPortIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -439,11 +456,11 @@ void CapabilityDelegate::readExternalPortOutputDescriptor(UniqueIdentifier const
 
 void CapabilityDelegate::readInternalPortInputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::InternalPortIndex const internalPortIndex, Interface::InternalPortInputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, internalPortIndex, model::InternalPortDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, internalPortIndex, model::InternalPortDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::InternalPortInput, internalPortIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -454,11 +471,11 @@ void CapabilityDelegate::readInternalPortInputDescriptor(UniqueIdentifier const
 
 void CapabilityDelegate::readInternalPortOutputDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::InternalPortIndex const internalPortIndex, Interface::InternalPortOutputDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, internalPortIndex, model::InternalPortDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, internalPortIndex, model::InternalPortDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::InternalPortOutput, internalPortIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -469,11 +486,11 @@ void CapabilityDelegate::readInternalPortOutputDescriptor(UniqueIdentifier const
 
 void CapabilityDelegate::readAudioClusterDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ClusterIndex const clusterIndex, Interface::AudioClusterDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clusterIndex, model::AudioClusterDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clusterIndex, model::AudioClusterDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::AudioCluster, clusterIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -484,11 +501,11 @@ void CapabilityDelegate::readAudioClusterDescriptor(UniqueIdentifier const targe
 
 void CapabilityDelegate::readAudioMapDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::MapIndex const mapIndex, Interface::AudioMapDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, mapIndex, model::AudioMapDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, mapIndex, model::AudioMapDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::AudioMap, mapIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -499,11 +516,11 @@ void CapabilityDelegate::readAudioMapDescriptor(UniqueIdentifier const targetEnt
 
 void CapabilityDelegate::readControlDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ControlIndex const controlIndex, Interface::ControlDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, controlIndex, model::ControlDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, controlIndex, model::ControlDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::Control, controlIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -514,11 +531,11 @@ void CapabilityDelegate::readControlDescriptor(UniqueIdentifier const targetEnti
 
 void CapabilityDelegate::readClockDomainDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ClockDomainIndex const clockDomainIndex, Interface::ClockDomainDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockDomainIndex, model::ClockDomainDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockDomainIndex, model::ClockDomainDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::ClockDomain, clockDomainIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -529,11 +546,11 @@ void CapabilityDelegate::readClockDomainDescriptor(UniqueIdentifier const target
 
 void CapabilityDelegate::readTimingDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::TimingIndex const timingIndex, Interface::TimingDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, timingIndex, model::TimingDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, timingIndex, model::TimingDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::Timing, timingIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -544,11 +561,11 @@ void CapabilityDelegate::readTimingDescriptor(UniqueIdentifier const targetEntit
 
 void CapabilityDelegate::readPtpInstanceDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::PtpInstanceIndex const ptpInstanceIndex, Interface::PtpInstanceDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpInstanceIndex, model::PtpInstanceDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpInstanceIndex, model::PtpInstanceDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::PtpInstance, ptpInstanceIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -559,11 +576,11 @@ void CapabilityDelegate::readPtpInstanceDescriptor(UniqueIdentifier const target
 
 void CapabilityDelegate::readPtpPortDescriptor(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::PtpPortIndex const ptpPortIndex, Interface::PtpPortDescriptorHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpPortIndex, model::PtpPortDescriptor{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpPortIndex, model::PtpPortDescriptor{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeReadDescriptorCommand(configurationIndex, model::DescriptorType::PtpPort, ptpPortIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::ReadDescriptor, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -574,11 +591,11 @@ void CapabilityDelegate::readPtpPortDescriptor(UniqueIdentifier const targetEnti
 
 void CapabilityDelegate::setConfiguration(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, Interface::SetConfigurationHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetConfigurationCommand(configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetConfiguration, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetConfiguration, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -589,17 +606,17 @@ void CapabilityDelegate::setConfiguration(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::getConfiguration(UniqueIdentifier const targetEntityID, Interface::GetConfigurationHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, model::ConfigurationIndex{ 0u });
-	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetConfiguration, nullptr, 0, errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, model::ConfigurationIndex{ 0u });
+	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetConfiguration, nullptr, 0, std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::setStreamInputFormat(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, model::StreamFormat const streamFormat, Interface::SetStreamInputFormatHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, model::StreamFormat());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, model::StreamFormat());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetStreamFormatCommand(model::DescriptorType::StreamInput, streamIndex, streamFormat);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetStreamFormat, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetStreamFormat, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -610,11 +627,11 @@ void CapabilityDelegate::setStreamInputFormat(UniqueIdentifier const targetEntit
 
 void CapabilityDelegate::getStreamInputFormat(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::GetStreamInputFormatHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, model::StreamFormat());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, model::StreamFormat());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetStreamFormatCommand(model::DescriptorType::StreamInput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetStreamFormat, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetStreamFormat, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -625,11 +642,11 @@ void CapabilityDelegate::getStreamInputFormat(UniqueIdentifier const targetEntit
 
 void CapabilityDelegate::setStreamOutputFormat(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, model::StreamFormat const streamFormat, Interface::SetStreamOutputFormatHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, model::StreamFormat());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, model::StreamFormat());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetStreamFormatCommand(model::DescriptorType::StreamOutput, streamIndex, streamFormat);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetStreamFormat, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetStreamFormat, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -640,11 +657,11 @@ void CapabilityDelegate::setStreamOutputFormat(UniqueIdentifier const targetEnti
 
 void CapabilityDelegate::getStreamOutputFormat(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::GetStreamOutputFormatHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, model::StreamFormat());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, model::StreamFormat());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetStreamFormatCommand(model::DescriptorType::StreamOutput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetStreamFormat, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetStreamFormat, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -655,11 +672,11 @@ void CapabilityDelegate::getStreamOutputFormat(UniqueIdentifier const targetEnti
 
 void CapabilityDelegate::getStreamPortInputAudioMap(UniqueIdentifier const targetEntityID, model::StreamPortIndex const streamPortIndex, model::MapIndex const mapIndex, Interface::GetStreamPortInputAudioMapHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, model::MapIndex(0), mapIndex, s_emptyMappings);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, model::MapIndex(0), mapIndex, s_emptyMappings);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetAudioMapCommand(model::DescriptorType::StreamPortInput, streamPortIndex, mapIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAudioMap, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAudioMap, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -670,11 +687,11 @@ void CapabilityDelegate::getStreamPortInputAudioMap(UniqueIdentifier const targe
 
 void CapabilityDelegate::getStreamPortOutputAudioMap(UniqueIdentifier const targetEntityID, model::StreamPortIndex const streamPortIndex, model::MapIndex const mapIndex, Interface::GetStreamPortOutputAudioMapHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, model::MapIndex(0), mapIndex, s_emptyMappings);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, model::MapIndex(0), mapIndex, s_emptyMappings);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetAudioMapCommand(model::DescriptorType::StreamPortOutput, streamPortIndex, mapIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAudioMap, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAudioMap, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -685,11 +702,11 @@ void CapabilityDelegate::getStreamPortOutputAudioMap(UniqueIdentifier const targ
 
 void CapabilityDelegate::addStreamPortInputAudioMappings(UniqueIdentifier const targetEntityID, model::StreamPortIndex const streamPortIndex, model::AudioMappings const& mappings, Interface::AddStreamPortInputAudioMappingsHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, s_emptyMappings);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, s_emptyMappings);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeAddAudioMappingsCommand(model::DescriptorType::StreamPortInput, streamPortIndex, mappings);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AddAudioMappings, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AddAudioMappings, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -700,11 +717,11 @@ void CapabilityDelegate::addStreamPortInputAudioMappings(UniqueIdentifier const
 
 void CapabilityDelegate::addStreamPortOutputAudioMappings(UniqueIdentifier const targetEntityID, model::StreamPortIndex const streamPortIndex, model::AudioMappings const& mappings, Interface::AddStreamPortOutputAudioMappingsHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, s_emptyMappings);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, s_emptyMappings);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeAddAudioMappingsCommand(model::DescriptorType::StreamPortOutput, streamPortIndex, mappings);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AddAudioMappings, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AddAudioMappings, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -715,11 +732,11 @@ void CapabilityDelegate::addStreamPortOutputAudioMappings(UniqueIdentifier const
 
 void CapabilityDelegate::removeStreamPortInputAudioMappings(UniqueIdentifier const targetEntityID, model::StreamPortIndex const streamPortIndex, model::AudioMappings const& mappings, Interface::RemoveStreamPortInputAudioMappingsHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, s_emptyMappings);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, s_emptyMappings);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeRemoveAudioMappingsCommand(model::DescriptorType::StreamPortInput, streamPortIndex, mappings);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::RemoveAudioMappings, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::RemoveAudioMappings, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -730,11 +747,11 @@ void CapabilityDelegate::removeStreamPortInputAudioMappings(UniqueIdentifier con
 
 void CapabilityDelegate::removeStreamPortOutputAudioMappings(UniqueIdentifier const targetEntityID, model::StreamPortIndex const streamPortIndex, model::AudioMappings const& mappings, Interface::RemoveStreamPortOutputAudioMappingsHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, s_emptyMappings);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamPortIndex, s_emptyMappings);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeRemoveAudioMappingsCommand(model::DescriptorType::StreamPortOutput, streamPortIndex, mappings);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::RemoveAudioMappings, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::RemoveAudioMappings, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -745,11 +762,11 @@ void CapabilityDelegate::removeStreamPortOutputAudioMappings(UniqueIdentifier co
 
 void CapabilityDelegate::setStreamInputInfo(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, model::StreamInfo const& info, Interface::SetStreamInputInfoHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInfo);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInfo);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetStreamInfoCommand(model::DescriptorType::StreamInput, streamIndex, info);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetStreamInfo, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetStreamInfo, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -760,11 +777,11 @@ void CapabilityDelegate::setStreamInputInfo(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::setStreamOutputInfo(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, model::StreamInfo const& info, Interface::SetStreamOutputInfoHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInfo);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInfo);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetStreamInfoCommand(model::DescriptorType::StreamOutput, streamIndex, info);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetStreamInfo, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetStreamInfo, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -775,11 +792,11 @@ void CapabilityDelegate::setStreamOutputInfo(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::getStreamInputInfo(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::GetStreamInputInfoHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInfo);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInfo);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetStreamInfoCommand(model::DescriptorType::StreamInput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetStreamInfo, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetStreamInfo, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -790,11 +807,11 @@ void CapabilityDelegate::getStreamInputInfo(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::getStreamOutputInfo(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::GetStreamOutputInfoHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInfo);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInfo);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetStreamInfoCommand(model::DescriptorType::StreamOutput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetStreamInfo, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetStreamInfo, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -805,11 +822,11 @@ void CapabilityDelegate::getStreamOutputInfo(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::setEntityName(UniqueIdentifier const targetEntityID, model::AvdeccFixedString const& entityName, Interface::SetEntityNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::Entity, 0, 0, 0, entityName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -820,11 +837,11 @@ void CapabilityDelegate::setEntityName(UniqueIdentifier const targetEntityID, mo
 
 void CapabilityDelegate::getEntityName(UniqueIdentifier const targetEntityID, Interface::GetEntityNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::Entity, 0, 0, 0);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -835,11 +852,11 @@ void CapabilityDelegate::getEntityName(UniqueIdentifier const targetEntityID, In
 
 void CapabilityDelegate::setEntityGroupName(UniqueIdentifier const targetEntityID, model::AvdeccFixedString const& entityGroupName, Interface::SetEntityGroupNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::Entity, 0, 1, 0, entityGroupName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -850,11 +867,11 @@ void CapabilityDelegate::setEntityGroupName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::getEntityGroupName(UniqueIdentifier const targetEntityID, Interface::GetEntityGroupNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::Entity, 0, 1, 0);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -865,11 +882,11 @@ void CapabilityDelegate::getEntityGroupName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::setConfigurationName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::AvdeccFixedString const& configurationName, Interface::SetConfigurationNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::Configuration, configurationIndex, 0, 0, configurationName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -880,11 +897,11 @@ void CapabilityDelegate::setConfigurationName(UniqueIdentifier const targetEntit
 
 void CapabilityDelegate::getConfigurationName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, Interface::GetConfigurationNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::Configuration, configurationIndex, 0, 0);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -895,11 +912,11 @@ void CapabilityDelegate::getConfigurationName(UniqueIdentifier const targetEntit
 
 void CapabilityDelegate::setAudioUnitName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::AudioUnitIndex const audioUnitIndex, model::AvdeccFixedString const& audioUnitName, Interface::SetAudioUnitNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioUnitIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioUnitIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::AudioUnit, audioUnitIndex, 0, configurationIndex, audioUnitName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -910,11 +927,11 @@ void CapabilityDelegate::setAudioUnitName(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::getAudioUnitName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::AudioUnitIndex const audioUnitIndex, Interface::GetAudioUnitNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioUnitIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioUnitIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::AudioUnit, audioUnitIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -925,11 +942,11 @@ void CapabilityDelegate::getAudioUnitName(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::setStreamInputName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::StreamIndex const streamIndex, model::AvdeccFixedString const& streamInputName, Interface::SetStreamInputNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::StreamInput, streamIndex, 0, configurationIndex, streamInputName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -940,11 +957,11 @@ void CapabilityDelegate::setStreamInputName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::getStreamInputName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::StreamIndex const streamIndex, Interface::GetStreamInputNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::StreamInput, streamIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -955,11 +972,11 @@ void CapabilityDelegate::getStreamInputName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::setStreamOutputName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::StreamIndex const streamIndex, model::AvdeccFixedString const& streamOutputName, Interface::SetStreamOutputNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::StreamOutput, streamIndex, 0, configurationIndex, streamOutputName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -970,11 +987,11 @@ void CapabilityDelegate::setStreamOutputName(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::getStreamOutputName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::StreamIndex const streamIndex, Interface::GetStreamOutputNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, streamIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::StreamOutput, streamIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -985,11 +1002,11 @@ void CapabilityDelegate::getStreamOutputName(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::setJackInputName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::JackIndex const jackIndex, model::AvdeccFixedString const& jackInputName, Interface::SetJackInputNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::JackInput, jackIndex, 0, configurationIndex, jackInputName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1000,11 +1017,11 @@ void CapabilityDelegate::setJackInputName(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::getJackInputName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::JackIndex const jackIndex, Interface::GetJackInputNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::JackInput, jackIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1015,11 +1032,11 @@ void CapabilityDelegate::getJackInputName(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::setJackOutputName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::JackIndex const jackIndex, model::AvdeccFixedString const& jackOutputName, Interface::SetJackOutputNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::JackOutput, jackIndex, 0, configurationIndex, jackOutputName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1030,11 +1047,11 @@ void CapabilityDelegate::setJackOutputName(UniqueIdentifier const targetEntityID
 
 void CapabilityDelegate::getJackOutputName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::JackIndex const jackIndex, Interface::GetJackOutputNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, jackIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::JackOutput, jackIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1045,11 +1062,11 @@ void CapabilityDelegate::getJackOutputName(UniqueIdentifier const targetEntityID
 
 void CapabilityDelegate::setAvbInterfaceName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::AvbInterfaceIndex const avbInterfaceIndex, model::AvdeccFixedString const& avbInterfaceName, Interface::SetAvbInterfaceNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, avbInterfaceIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, avbInterfaceIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::AvbInterface, avbInterfaceIndex, 0, configurationIndex, avbInterfaceName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1060,11 +1077,11 @@ void CapabilityDelegate::setAvbInterfaceName(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::getAvbInterfaceName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::AvbInterfaceIndex const avbInterfaceIndex, Interface::GetAvbInterfaceNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, avbInterfaceIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, avbInterfaceIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::AvbInterface, avbInterfaceIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1075,11 +1092,11 @@ void CapabilityDelegate::getAvbInterfaceName(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::setClockSourceName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ClockSourceIndex const clockSourceIndex, model::AvdeccFixedString const& clockSourceName, Interface::SetClockSourceNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockSourceIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockSourceIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::ClockSource, clockSourceIndex, 0, configurationIndex, clockSourceName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1090,11 +1107,11 @@ void CapabilityDelegate::setClockSourceName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::getClockSourceName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ClockSourceIndex const clockSourceIndex, Interface::GetClockSourceNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockSourceIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockSourceIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::ClockSource, clockSourceIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1105,11 +1122,11 @@ void CapabilityDelegate::getClockSourceName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::setMemoryObjectName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::MemoryObjectIndex const memoryObjectIndex, model::AvdeccFixedString const& memoryObjectName, Interface::SetMemoryObjectNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::MemoryObject, memoryObjectIndex, 0, configurationIndex, memoryObjectName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1120,11 +1137,11 @@ void CapabilityDelegate::setMemoryObjectName(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::getMemoryObjectName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::MemoryObjectIndex const memoryObjectIndex, Interface::GetMemoryObjectNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::MemoryObject, memoryObjectIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1135,11 +1152,11 @@ void CapabilityDelegate::getMemoryObjectName(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::setAudioClusterName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ClusterIndex const audioClusterIndex, model::AvdeccFixedString const& audioClusterName, Interface::SetAudioClusterNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioClusterIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioClusterIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::AudioCluster, audioClusterIndex, 0, configurationIndex, audioClusterName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1150,11 +1167,11 @@ void CapabilityDelegate::setAudioClusterName(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::getAudioClusterName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ClusterIndex const audioClusterIndex, Interface::GetAudioClusterNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioClusterIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, audioClusterIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::AudioCluster, audioClusterIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1165,11 +1182,11 @@ void CapabilityDelegate::getAudioClusterName(UniqueIdentifier const targetEntity
 
 void CapabilityDelegate::setControlName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ControlIndex const controlIndex, model::AvdeccFixedString const& controlName, Interface::SetControlNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, controlIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, controlIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::Control, controlIndex, 0, configurationIndex, controlName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1180,11 +1197,11 @@ void CapabilityDelegate::setControlName(UniqueIdentifier const targetEntityID, m
 
 void CapabilityDelegate::getControlName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ControlIndex const controlIndex, Interface::GetControlNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, controlIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, controlIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::Control, controlIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1195,11 +1212,11 @@ void CapabilityDelegate::getControlName(UniqueIdentifier const targetEntityID, m
 
 void CapabilityDelegate::setClockDomainName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ClockDomainIndex const clockDomainIndex, model::AvdeccFixedString const& clockDomainName, Interface::SetClockDomainNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockDomainIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockDomainIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::ClockDomain, clockDomainIndex, 0, configurationIndex, clockDomainName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1210,11 +1227,11 @@ void CapabilityDelegate::setClockDomainName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::getClockDomainName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::ClockDomainIndex const clockDomainIndex, Interface::GetClockDomainNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockDomainIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, clockDomainIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::ClockDomain, clockDomainIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1225,11 +1242,11 @@ void CapabilityDelegate::getClockDomainName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::setTimingName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::TimingIndex const timingIndex, model::AvdeccFixedString const& timingName, Interface::SetTimingNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, timingIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, timingIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::Timing, timingIndex, 0, configurationIndex, timingName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1240,11 +1257,11 @@ void CapabilityDelegate::setTimingName(UniqueIdentifier const targetEntityID, mo
 
 void CapabilityDelegate::getTimingName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::TimingIndex const timingIndex, Interface::GetTimingNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, timingIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, timingIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::Timing, timingIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1255,11 +1272,11 @@ void CapabilityDelegate::getTimingName(UniqueIdentifier const targetEntityID, mo
 
 void CapabilityDelegate::setPtpInstanceName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::PtpInstanceIndex const ptpInstanceIndex, model::AvdeccFixedString const& ptpInstanceName, Interface::SetPtpInstanceNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpInstanceIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpInstanceIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::PtpInstance, ptpInstanceIndex, 0, configurationIndex, ptpInstanceName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1270,11 +1287,11 @@ void CapabilityDelegate::setPtpInstanceName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::getPtpInstanceName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::PtpInstanceIndex const ptpInstanceIndex, Interface::GetPtpInstanceNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpInstanceIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpInstanceIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::PtpInstance, ptpInstanceIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1285,11 +1302,11 @@ void CapabilityDelegate::getPtpInstanceName(UniqueIdentifier const targetEntityI
 
 void CapabilityDelegate::setPtpPortName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::PtpPortIndex const ptpPortIndex, model::AvdeccFixedString const& ptpPortName, Interface::SetPtpPortNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpPortIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpPortIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetNameCommand(model::DescriptorType::PtpPort, ptpPortIndex, 0, configurationIndex, ptpPortName);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1300,11 +1317,11 @@ void CapabilityDelegate::setPtpPortName(UniqueIdentifier const targetEntityID, m
 
 void CapabilityDelegate::getPtpPortName(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::PtpPortIndex const ptpPortIndex, Interface::GetPtpPortNameHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpPortIndex, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, ptpPortIndex, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetNameCommand(model::DescriptorType::PtpPort, ptpPortIndex, 0, configurationIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetName, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1315,11 +1332,11 @@ void CapabilityDelegate::getPtpPortName(UniqueIdentifier const targetEntityID, m
 
 void CapabilityDelegate::setAssociationID(UniqueIdentifier const targetEntityID, UniqueIdentifier const associationID, Interface::SetAssociationHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetAssociationIDCommand(associationID);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetAssociationID, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetAssociationID, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1330,17 +1347,17 @@ void CapabilityDelegate::setAssociationID(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::getAssociationID(UniqueIdentifier const targetEntityID, Interface::GetAssociationHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier());
-	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAssociationID, nullptr, 0, errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier::getNullUniqueIdentifier());
+	sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAssociationID, nullptr, 0, std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::setAudioUnitSamplingRate(UniqueIdentifier const targetEntityID, model::AudioUnitIndex const audioUnitIndex, model::SamplingRate const samplingRate, Interface::SetAudioUnitSamplingRateHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, audioUnitIndex, model::SamplingRate::getNullSamplingRate());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, audioUnitIndex, model::SamplingRate::getNullSamplingRate());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetSamplingRateCommand(model::DescriptorType::AudioUnit, audioUnitIndex, samplingRate);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetSamplingRate, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetSamplingRate, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1351,11 +1368,11 @@ void CapabilityDelegate::setAudioUnitSamplingRate(UniqueIdentifier const targetE
 
 void CapabilityDelegate::getAudioUnitSamplingRate(UniqueIdentifier const targetEntityID, model::AudioUnitIndex const audioUnitIndex, Interface::GetAudioUnitSamplingRateHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, audioUnitIndex, model::SamplingRate::getNullSamplingRate());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, audioUnitIndex, model::SamplingRate::getNullSamplingRate());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetSamplingRateCommand(model::DescriptorType::AudioUnit, audioUnitIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetSamplingRate, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetSamplingRate, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1366,11 +1383,11 @@ void CapabilityDelegate::getAudioUnitSamplingRate(UniqueIdentifier const targetE
 
 void CapabilityDelegate::setVideoClusterSamplingRate(UniqueIdentifier const targetEntityID, model::ClusterIndex const videoClusterIndex, model::SamplingRate const samplingRate, Interface::SetVideoClusterSamplingRateHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, videoClusterIndex, model::SamplingRate::getNullSamplingRate());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, videoClusterIndex, model::SamplingRate::getNullSamplingRate());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetSamplingRateCommand(model::DescriptorType::VideoCluster, videoClusterIndex, samplingRate);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetSamplingRate, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetSamplingRate, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1381,11 +1398,11 @@ void CapabilityDelegate::setVideoClusterSamplingRate(UniqueIdentifier const targ
 
 void CapabilityDelegate::getVideoClusterSamplingRate(UniqueIdentifier const targetEntityID, model::ClusterIndex const videoClusterIndex, Interface::GetVideoClusterSamplingRateHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, videoClusterIndex, model::SamplingRate::getNullSamplingRate());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, videoClusterIndex, model::SamplingRate::getNullSamplingRate());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetSamplingRateCommand(model::DescriptorType::VideoCluster, videoClusterIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetSamplingRate, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetSamplingRate, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1396,11 +1413,11 @@ void CapabilityDelegate::getVideoClusterSamplingRate(UniqueIdentifier const targ
 
 void CapabilityDelegate::setSensorClusterSamplingRate(UniqueIdentifier const targetEntityID, model::ClusterIndex const sensorClusterIndex, model::SamplingRate const samplingRate, Interface::SetSensorClusterSamplingRateHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, sensorClusterIndex, model::SamplingRate::getNullSamplingRate());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, sensorClusterIndex, model::SamplingRate::getNullSamplingRate());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetSamplingRateCommand(model::DescriptorType::SensorCluster, sensorClusterIndex, samplingRate);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetSamplingRate, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetSamplingRate, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1411,11 +1428,11 @@ void CapabilityDelegate::setSensorClusterSamplingRate(UniqueIdentifier const tar
 
 void CapabilityDelegate::getSensorClusterSamplingRate(UniqueIdentifier const targetEntityID, model::ClusterIndex const sensorClusterIndex, Interface::GetSensorClusterSamplingRateHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, sensorClusterIndex, model::SamplingRate::getNullSamplingRate());
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, sensorClusterIndex, model::SamplingRate::getNullSamplingRate());
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetSamplingRateCommand(model::DescriptorType::SensorCluster, sensorClusterIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetSamplingRate, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetSamplingRate, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1426,11 +1443,11 @@ void CapabilityDelegate::getSensorClusterSamplingRate(UniqueIdentifier const tar
 
 void CapabilityDelegate::setClockSource(UniqueIdentifier const targetEntityID, model::ClockDomainIndex const clockDomainIndex, model::ClockSourceIndex const clockSourceIndex, Interface::SetClockSourceHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, model::ClockSourceIndex{ 0u });
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, model::ClockSourceIndex{ 0u });
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetClockSourceCommand(model::DescriptorType::ClockDomain, clockDomainIndex, clockSourceIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetClockSource, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetClockSource, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1441,11 +1458,11 @@ void CapabilityDelegate::setClockSource(UniqueIdentifier const targetEntityID, m
 
 void CapabilityDelegate::getClockSource(UniqueIdentifier const targetEntityID, model::ClockDomainIndex const clockDomainIndex, Interface::GetClockSourceHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, model::ClockSourceIndex{ 0u });
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, model::ClockSourceIndex{ 0u });
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetClockSourceCommand(model::DescriptorType::ClockDomain, clockDomainIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetClockSource, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetClockSource, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1456,11 +1473,11 @@ void CapabilityDelegate::getClockSource(UniqueIdentifier const targetEntityID, m
 
 void CapabilityDelegate::setControlValues(UniqueIdentifier const targetEntityID, model::ControlIndex const controlIndex, model::ControlValues const& controlValues, Interface::SetControlValuesHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, controlIndex, s_emptyPackedControlValues);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, controlIndex, s_emptyPackedControlValues);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetControlCommand(model::DescriptorType::Control, controlIndex, controlValues);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetControl, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetControl, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] protocol::aemPayload::UnsupportedValueException const& e)
 	{
@@ -1476,11 +1493,11 @@ void CapabilityDelegate::setControlValues(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::getControlValues(UniqueIdentifier const targetEntityID, model::ControlIndex const controlIndex, Interface::GetControlValuesHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, controlIndex, s_emptyPackedControlValues);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, controlIndex, s_emptyPackedControlValues);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetControlCommand(model::DescriptorType::Control, controlIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetControl, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetControl, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1491,11 +1508,11 @@ void CapabilityDelegate::getControlValues(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::startStreamInput(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::StartStreamInputHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeStartStreamingCommand(model::DescriptorType::StreamInput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StartStreaming, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StartStreaming, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1506,11 +1523,11 @@ void CapabilityDelegate::startStreamInput(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::startStreamOutput(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::StartStreamOutputHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeStartStreamingCommand(model::DescriptorType::StreamOutput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StartStreaming, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StartStreaming, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1521,11 +1538,11 @@ void CapabilityDelegate::startStreamOutput(UniqueIdentifier const targetEntityID
 
 void CapabilityDelegate::stopStreamInput(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::StopStreamInputHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeStopStreamingCommand(model::DescriptorType::StreamInput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StopStreaming, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StopStreaming, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1536,11 +1553,11 @@ void CapabilityDelegate::stopStreamInput(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::stopStreamOutput(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::StopStreamOutputHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeStopStreamingCommand(model::DescriptorType::StreamOutput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StopStreaming, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StopStreaming, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1551,11 +1568,11 @@ void CapabilityDelegate::stopStreamOutput(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::getAvbInfo(UniqueIdentifier const targetEntityID, model::AvbInterfaceIndex const avbInterfaceIndex, Interface::GetAvbInfoHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, avbInterfaceIndex, s_emptyAvbInfo);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, avbInterfaceIndex, s_emptyAvbInfo);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetAvbInfoCommand(model::DescriptorType::AvbInterface, avbInterfaceIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAvbInfo, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAvbInfo, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1566,11 +1583,11 @@ void CapabilityDelegate::getAvbInfo(UniqueIdentifier const targetEntityID, model
 
 void CapabilityDelegate::getAsPath(UniqueIdentifier const targetEntityID, model::AvbInterfaceIndex const avbInterfaceIndex, Interface::GetAsPathHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, avbInterfaceIndex, s_emptyAsPath);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, avbInterfaceIndex, s_emptyAsPath);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetAsPathCommand(avbInterfaceIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAsPath, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetAsPath, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1581,11 +1598,11 @@ void CapabilityDelegate::getAsPath(UniqueIdentifier const targetEntityID, model:
 
 void CapabilityDelegate::getEntityCounters(UniqueIdentifier const targetEntityID, Interface::GetEntityCountersHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, EntityCounterValidFlags{}, model::DescriptorCounters{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, EntityCounterValidFlags{}, model::DescriptorCounters{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetCountersCommand(model::DescriptorType::Entity, 0);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1596,11 +1613,11 @@ void CapabilityDelegate::getEntityCounters(UniqueIdentifier const targetEntityID
 
 void CapabilityDelegate::getAvbInterfaceCounters(UniqueIdentifier const targetEntityID, model::AvbInterfaceIndex const avbInterfaceIndex, Interface::GetAvbInterfaceCountersHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, avbInterfaceIndex, AvbInterfaceCounterValidFlags{}, model::DescriptorCounters{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, avbInterfaceIndex, AvbInterfaceCounterValidFlags{}, model::DescriptorCounters{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetCountersCommand(model::DescriptorType::AvbInterface, avbInterfaceIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1611,11 +1628,11 @@ void CapabilityDelegate::getAvbInterfaceCounters(UniqueIdentifier const targetEn
 
 void CapabilityDelegate::getClockDomainCounters(UniqueIdentifier const targetEntityID, model::ClockDomainIndex const clockDomainIndex, Interface::GetClockDomainCountersHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, ClockDomainCounterValidFlags{}, model::DescriptorCounters{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, ClockDomainCounterValidFlags{}, model::DescriptorCounters{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetCountersCommand(model::DescriptorType::ClockDomain, clockDomainIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1626,11 +1643,11 @@ void CapabilityDelegate::getClockDomainCounters(UniqueIdentifier const targetEnt
 
 void CapabilityDelegate::getStreamInputCounters(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::GetStreamInputCountersHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, StreamInputCounterValidFlags{}, model::DescriptorCounters{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, StreamInputCounterValidFlags{}, model::DescriptorCounters{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetCountersCommand(model::DescriptorType::StreamInput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1641,11 +1658,11 @@ void CapabilityDelegate::getStreamInputCounters(UniqueIdentifier const targetEnt
 
 void CapabilityDelegate::getStreamOutputCounters(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::GetStreamOutputCountersHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, StreamOutputCounterValidFlags{}, model::DescriptorCounters{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, StreamOutputCounterValidFlags{}, model::DescriptorCounters{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetCountersCommand(model::DescriptorType::StreamOutput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetCounters, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1656,11 +1673,11 @@ void CapabilityDelegate::getStreamOutputCounters(UniqueIdentifier const targetEn
 
 void CapabilityDelegate::reboot(UniqueIdentifier const targetEntityID, Interface::RebootHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeRebootCommand(model::DescriptorType::Entity, model::DescriptorIndex{ 0u });
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::Reboot, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::Reboot, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1671,11 +1688,11 @@ void CapabilityDelegate::reboot(UniqueIdentifier const targetEntityID, Interface
 
 void CapabilityDelegate::rebootToFirmware(UniqueIdentifier const targetEntityID, model::MemoryObjectIndex const memoryObjectIndex, Interface::RebootToFirmwareHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, memoryObjectIndex);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, memoryObjectIndex);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeRebootCommand(model::DescriptorType::MemoryObject, memoryObjectIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::Reboot, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::Reboot, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1686,11 +1703,11 @@ void CapabilityDelegate::rebootToFirmware(UniqueIdentifier const targetEntityID,
 
 void CapabilityDelegate::startOperation(UniqueIdentifier const targetEntityID, model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex, model::MemoryObjectOperationType const operationType, MemoryBuffer const& memoryBuffer, Interface::StartOperationHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, descriptorType, descriptorIndex, model::OperationID{ 0u }, operationType, MemoryBuffer{});
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, descriptorType, descriptorIndex, model::OperationID{ 0u }, operationType, MemoryBuffer{});
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeStartOperationCommand(descriptorType, descriptorIndex, model::OperationID{ 0u }, operationType, memoryBuffer);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StartOperation, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::StartOperation, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1701,11 +1718,11 @@ void CapabilityDelegate::startOperation(UniqueIdentifier const targetEntityID, m
 
 void CapabilityDelegate::abortOperation(UniqueIdentifier const targetEntityID, model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex, model::OperationID const operationID, Interface::AbortOperationHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, descriptorType, descriptorIndex, operationID);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, descriptorType, descriptorIndex, operationID);
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeAbortOperationCommand(descriptorType, descriptorIndex, operationID);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AbortOperation, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::AbortOperation, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1716,11 +1733,11 @@ void CapabilityDelegate::abortOperation(UniqueIdentifier const targetEntityID, m
 
 void CapabilityDelegate::setMemoryObjectLength(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::MemoryObjectIndex const memoryObjectIndex, std::uint64_t const length, Interface::SetMemoryObjectLengthHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, std::uint64_t{ 0u });
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, std::uint64_t{ 0u });
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetMemoryObjectLengthCommand(configurationIndex, memoryObjectIndex, length);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetMemoryObjectLength, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetMemoryObjectLength, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1731,11 +1748,11 @@ void CapabilityDelegate::setMemoryObjectLength(UniqueIdentifier const targetEnti
 
 void CapabilityDelegate::getMemoryObjectLength(UniqueIdentifier const targetEntityID, model::ConfigurationIndex const configurationIndex, model::MemoryObjectIndex const memoryObjectIndex, Interface::GetMemoryObjectLengthHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, std::uint64_t{ 0u });
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, configurationIndex, memoryObjectIndex, std::uint64_t{ 0u });
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetMemoryObjectLengthCommand(configurationIndex, memoryObjectIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetMemoryObjectLength, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetMemoryObjectLength, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -1746,7 +1763,7 @@ void CapabilityDelegate::getMemoryObjectLength(UniqueIdentifier const targetEnti
 
 void CapabilityDelegate::getDynamicInfo(UniqueIdentifier const targetEntityID, DynamicInfoParameters const& parameters, Interface::GetDynamicInfoHandler const& handler) const noexcept
 {
-	static auto s_DynamicInfoDispatch = std::unordered_map<protocol::AemCommandType::value_type, std::function<void(UniqueIdentifier const targetEntityID, DynamicInfoParameter const& parameters, protocol::aemPayload::DynamicInfos& dynamicInfos)>>{
+	static auto const s_DynamicInfoDispatch = utils::DispatchTable<void(UniqueIdentifier const targetEntityID, DynamicInfoParameter const& parameters, protocol::aemPayload::DynamicInfos& dynamicInfos), AemDispatchTableSize>{
 		// Get Configuration
 		{ protocol::AemCommandType::GetConfiguration.getValue(),
 			[]([[maybe_unused]] UniqueIdentifier const targetEntityID, DynamicInfoParameter const& parameters, protocol::aemPayload::DynamicInfos& dynamicInfos)
@@ -1983,24 +2000,24 @@ void CapabilityDelegate::getDynamicInfo(UniqueIdentifier const targetEntityID, D
 			} },
 	};
 
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyDynamicInfoParameters);
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyDynamicInfoParameters);
 	try
 	{
 		auto dynamicInfos = la::avdecc::protocol::aemPayload::DynamicInfos{};
 		for (auto const& dynInfo : parameters)
 		{
-			auto const& it = s_DynamicInfoDispatch.find(dynInfo.commandType.getValue());
-			if (it == s_DynamicInfoDispatch.end())
+			auto const dispatchHandler = s_DynamicInfoDispatch.find(dynInfo.commandType.getValue());
+			if (dispatchHandler == nullptr)
 			{
 				LOG_CONTROLLER_ENTITY_DEBUG(targetEntityID, "Failed to serialize getDynamicInfo: Unhandled command type {} ({})", std::string(dynInfo.commandType), utils::toHexString(dynInfo.commandType.getValue()));
 				utils::invokeProtectedHandler(errorCallback, LocalEntity::AemCommandStatus::ProtocolError);
 				return;
 			}
-			it->second(targetEntityID, dynInfo, dynamicInfos);
+			dispatchHandler(targetEntityID, dynInfo, dynamicInfos);
 #pragma message("TODO: Somehow, check for maximum payload size (both send AND recv")
 		}
 		auto const ser = protocol::aemPayload::serializeGetDynamicInfoCommand(dynamicInfos);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetDynamicInfo, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetDynamicInfo, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2011,11 +2028,11 @@ void CapabilityDelegate::getDynamicInfo(UniqueIdentifier const targetEntityID, D
 
 void CapabilityDelegate::setMaxTransitTime(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, std::chrono::nanoseconds const& maxTransitTime, Interface::SetMaxTransitTimeHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, std::chrono::nanoseconds{ 0u });
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, std::chrono::nanoseconds{ 0u });
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeSetMaxTransitTimeCommand(model::DescriptorType::StreamOutput, streamIndex, static_cast<std::uint64_t>(maxTransitTime.count()));
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetMaxTransitTime, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::SetMaxTransitTime, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2026,11 +2043,11 @@ void CapabilityDelegate::setMaxTransitTime(UniqueIdentifier const targetEntityID
 
 void CapabilityDelegate::getMaxTransitTime(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::GetMaxTransitTimeHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, std::chrono::nanoseconds{ 0u });
+	auto errorCallback = LocalEntityImpl<>::makeAemAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, std::chrono::nanoseconds{ 0u });
 	try
 	{
 		auto const ser = protocol::aemPayload::serializeGetMaxTransitTimeCommand(model::DescriptorType::StreamOutput, streamIndex);
-		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetMaxTransitTime, ser.data(), ser.size(), errorCallback, handler);
+		sendAemAecpCommand(targetEntityID, protocol::AemCommandType::GetMaxTransitTime, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2042,18 +2059,18 @@ void CapabilityDelegate::getMaxTransitTime(UniqueIdentifier const targetEntityID
 /* Enumeration and Control Protocol (AECP) AA */
 void CapabilityDelegate::addressAccess(UniqueIdentifier const targetEntityID, addressAccess::Tlvs const& tlvs, Interface::AddressAccessHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeAaAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, addressAccess::Tlvs{});
-	sendAaAecpCommand(targetEntityID, tlvs, errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeAaAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, addressAccess::Tlvs{});
+	sendAaAecpCommand(targetEntityID, tlvs, std::move(errorCallback), handler);
 }
 
 /* Enumeration and Control Protocol (AECP) MVU (Milan Vendor Unique) */
 void CapabilityDelegate::getMilanInfo(UniqueIdentifier const targetEntityID, Interface::GetMilanInfoHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyMilanInfo);
+	auto errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, s_emptyMilanInfo);
 	try
 	{
 		auto const ser = protocol::mvuPayload::serializeGetMilanInfoCommand();
-		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::GetMilanInfo, ser.data(), ser.size(), errorCallback, handler);
+		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::GetMilanInfo, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2064,11 +2081,11 @@ void CapabilityDelegate::getMilanInfo(UniqueIdentifier const targetEntityID, Int
 
 void CapabilityDelegate::setSystemUniqueID(UniqueIdentifier const targetEntityID, UniqueIdentifier const systemUniqueID, model::AvdeccFixedString const& systemName, Interface::SetSystemUniqueIDHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier{}, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier{}, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::mvuPayload::serializeSetSystemUniqueIDCommand(systemUniqueID, systemName);
-		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::SetSystemUniqueID, ser.data(), ser.size(), errorCallback, handler);
+		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::SetSystemUniqueID, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2079,11 +2096,11 @@ void CapabilityDelegate::setSystemUniqueID(UniqueIdentifier const targetEntityID
 
 void CapabilityDelegate::getSystemUniqueID(UniqueIdentifier const targetEntityID, Interface::GetSystemUniqueIDHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier{}, s_emptyAvdeccFixedString);
+	auto errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, UniqueIdentifier{}, s_emptyAvdeccFixedString);
 	try
 	{
 		auto const ser = protocol::mvuPayload::serializeGetSystemUniqueIDCommand();
-		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::GetSystemUniqueID, ser.data(), ser.size(), errorCallback, handler);
+		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::GetSystemUniqueID, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2094,7 +2111,7 @@ void CapabilityDelegate::getSystemUniqueID(UniqueIdentifier const targetEntityID
 
 void CapabilityDelegate::setMediaClockReferenceInfo(UniqueIdentifier const targetEntityID, model::ClockDomainIndex const clockDomainIndex, std::optional<model::MediaClockReferencePriority> const userPriority, std::optional<model::AvdeccFixedString> const& domainName, Interface::SetMediaClockReferenceInfoHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, entity::model::DefaultMediaClockReferencePriority::Default, s_emptyMediaClockReferenceInfo);
+	auto errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, entity::model::DefaultMediaClockReferencePriority::Default, s_emptyMediaClockReferenceInfo);
 	try
 	{
 		auto const buildMediaClockReferenceInfoFlags = [](std::optional<model::MediaClockReferencePriority> const userPriority, std::optional<model::AvdeccFixedString> const& domainName)
@@ -2111,7 +2128,7 @@ void CapabilityDelegate::setMediaClockReferenceInfo(UniqueIdentifier const targe
 			return flags;
 		};
 		auto const ser = protocol::mvuPayload::serializeSetMediaClockReferenceInfoCommand(clockDomainIndex, buildMediaClockReferenceInfoFlags(userPriority, domainName), entity::model::DefaultMediaClockReferencePriority::Default /* Ignored */, userPriority ? *userPriority : utils::to_integral(entity::model::DefaultMediaClockReferencePriority::Default), domainName ? *domainName : model::AvdeccFixedString{});
-		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::SetMediaClockReferenceInfo, ser.data(), ser.size(), errorCallback, handler);
+		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::SetMediaClockReferenceInfo, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2122,11 +2139,11 @@ void CapabilityDelegate::setMediaClockReferenceInfo(UniqueIdentifier const targe
 
 void CapabilityDelegate::getMediaClockReferenceInfo(UniqueIdentifier const targetEntityID, model::ClockDomainIndex const clockDomainIndex, Interface::GetMediaClockReferenceInfoHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, entity::model::DefaultMediaClockReferencePriority::Default, s_emptyMediaClockReferenceInfo);
+	auto errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, clockDomainIndex, entity::model::DefaultMediaClockReferencePriority::Default, s_emptyMediaClockReferenceInfo);
 	try
 	{
 		auto const ser = protocol::mvuPayload::serializeGetMediaClockReferenceInfoCommand(clockDomainIndex);
-		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::GetMediaClockReferenceInfo, ser.data(), ser.size(), errorCallback, handler);
+		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::GetMediaClockReferenceInfo, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2137,11 +2154,11 @@ void CapabilityDelegate::getMediaClockReferenceInfo(UniqueIdentifier const targe
 
 void CapabilityDelegate::bindStream(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, model::StreamIdentification const& talkerStream, BindStreamFlags const flags, Interface::BindStreamHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamIdentification, BindStreamFlags{});
+	auto errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamIdentification, BindStreamFlags{});
 	try
 	{
 		auto const ser = protocol::mvuPayload::serializeBindStreamCommand(flags, entity::model::DescriptorType::StreamInput, streamIndex, talkerStream.entityID, talkerStream.streamIndex);
-		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::BindStream, ser.data(), ser.size(), errorCallback, handler);
+		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::BindStream, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2152,11 +2169,11 @@ void CapabilityDelegate::bindStream(UniqueIdentifier const targetEntityID, model
 
 void CapabilityDelegate::unbindStream(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::UnbindStreamHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
+	auto errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex);
 	try
 	{
 		auto const ser = protocol::mvuPayload::serializeUnbindStreamCommand(entity::model::DescriptorType::StreamInput, streamIndex);
-		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::UnbindStream, ser.data(), ser.size(), errorCallback, handler);
+		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::UnbindStream, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2167,11 +2184,11 @@ void CapabilityDelegate::unbindStream(UniqueIdentifier const targetEntityID, mod
 
 void CapabilityDelegate::getStreamInputInfoEx(UniqueIdentifier const targetEntityID, model::StreamIndex const streamIndex, Interface::GetStreamInputInfoExHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInputInfoEx);
+	auto errorCallback = LocalEntityImpl<>::makeMvuAECPErrorHandler(handler, &_controllerInterface, targetEntityID, std::placeholders::_1, streamIndex, s_emptyStreamInputInfoEx);
 	try
 	{
 		auto const ser = protocol::mvuPayload::serializeGetStreamInputInfoExCommand(entity::model::DescriptorType::StreamInput, streamIndex);
-		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::GetStreamInputInfoEx, ser.data(), ser.size(), errorCallback, handler);
+		sendMvuAecpCommand(targetEntityID, protocol::MvuCommandType::GetStreamInputInfoEx, ser.data(), ser.size(), std::move(errorCallback), handler);
 	}
 	catch ([[maybe_unused]] std::exception const& e)
 	{
@@ -2183,38 +2200,38 @@ void CapabilityDelegate::getStreamInputInfoEx(UniqueIdentifier const targetEntit
 /* Connection Management Protocol (ACMP) */
 void CapabilityDelegate::connectStream(model::StreamIdentification const& talkerStream, model::StreamIdentification const& listenerStream, Interface::ConnectStreamHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, listenerStream, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
-	sendAcmpCommand(protocol::AcmpMessageType::ConnectRxCommand, talkerStream.entityID, talkerStream.streamIndex, listenerStream.entityID, listenerStream.streamIndex, std::uint16_t(0), errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, listenerStream, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
+	sendAcmpCommand(protocol::AcmpMessageType::ConnectRxCommand, talkerStream.entityID, talkerStream.streamIndex, listenerStream.entityID, listenerStream.streamIndex, std::uint16_t(0), std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::disconnectStream(model::StreamIdentification const& talkerStream, model::StreamIdentification const& listenerStream, Interface::DisconnectStreamHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, listenerStream, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
-	sendAcmpCommand(protocol::AcmpMessageType::DisconnectRxCommand, talkerStream.entityID, talkerStream.streamIndex, listenerStream.entityID, listenerStream.streamIndex, std::uint16_t(0), errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, listenerStream, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
+	sendAcmpCommand(protocol::AcmpMessageType::DisconnectRxCommand, talkerStream.entityID, talkerStream.streamIndex, listenerStream.entityID, listenerStream.streamIndex, std::uint16_t(0), std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::disconnectTalkerStream(model::StreamIdentification const& talkerStream, model::StreamIdentification const& listenerStream, Interface::DisconnectTalkerStreamHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, listenerStream, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
-	sendAcmpCommand(protocol::AcmpMessageType::DisconnectTxCommand, talkerStream.entityID, talkerStream.streamIndex, listenerStream.entityID, listenerStream.streamIndex, std::uint16_t(0), errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, listenerStream, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
+	sendAcmpCommand(protocol::AcmpMessageType::DisconnectTxCommand, talkerStream.entityID, talkerStream.streamIndex, listenerStream.entityID, listenerStream.streamIndex, std::uint16_t(0), std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::getTalkerStreamState(model::StreamIdentification const& talkerStream, Interface::GetTalkerStreamStateHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, model::StreamIdentification{}, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
-	sendAcmpCommand(protocol::AcmpMessageType::GetTxStateCommand, talkerStream.entityID, talkerStream.streamIndex, UniqueIdentifier::getNullUniqueIdentifier(), model::StreamIndex(0), std::uint16_t(0), errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, model::StreamIdentification{}, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
+	sendAcmpCommand(protocol::AcmpMessageType::GetTxStateCommand, talkerStream.entityID, talkerStream.streamIndex, UniqueIdentifier::getNullUniqueIdentifier(), model::StreamIndex(0), std::uint16_t(0), std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::getListenerStreamState(model::StreamIdentification const& listenerStream, Interface::GetListenerStreamStateHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, model::StreamIdentification{}, listenerStream, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
-	sendAcmpCommand(protocol::AcmpMessageType::GetRxStateCommand, UniqueIdentifier::getNullUniqueIdentifier(), model::StreamIndex(0), listenerStream.entityID, listenerStream.streamIndex, std::uint16_t(0), errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, model::StreamIdentification{}, listenerStream, std::uint16_t(0), entity::ConnectionFlags{}, std::placeholders::_1);
+	sendAcmpCommand(protocol::AcmpMessageType::GetRxStateCommand, UniqueIdentifier::getNullUniqueIdentifier(), model::StreamIndex(0), listenerStream.entityID, listenerStream.streamIndex, std::uint16_t(0), std::move(errorCallback), handler);
 }
 
 void CapabilityDelegate::getTalkerStreamConnection(model::StreamIdentification const& talkerStream, std::uint16_t const connectionIndex, Interface::GetTalkerStreamConnectionHandler const& handler) const noexcept
 {
-	auto const errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, model::StreamIdentification{}, connectionIndex, entity::ConnectionFlags{}, std::placeholders::_1);
-	sendAcmpCommand(protocol::AcmpMessageType::GetTxConnectionCommand, talkerStream.entityID, talkerStream.streamIndex, UniqueIdentifier::getNullUniqueIdentifier(), model::StreamIndex(0), connectionIndex, errorCallback, handler);
+	auto errorCallback = LocalEntityImpl<>::makeACMPErrorHandler(handler, &_controllerInterface, talkerStream, model::StreamIdentification{}, connectionIndex, entity::ConnectionFlags{}, std::placeholders::_1);
+	sendAcmpCommand(protocol::AcmpMessageType::GetTxConnectionCommand, talkerStream.entityID, talkerStream.streamIndex, UniqueIdentifier::getNullUniqueIdentifier(), model::StreamIndex(0), connectionIndex, std::move(errorCallback), handler);
 }
 
 /* ************************************************************************** */
@@ -2242,8 +2259,8 @@ void CapabilityDelegate::onLocalEntityOffline(protocol::ProtocolInterface* const
 	if (entityID == _controllerID)
 		return;
 
-	// Forward to RemoteEntityOffline, we handle all discovered entities the same way
-	onRemoteEntityOffline(pi, entityID);
+	// Forward to RemoteEntityOffline, we handle all discovered entities the same way (but inflight commands to a local entity are not discarded by the ProtocolInterface)
+	notifyRemoteEntityOffline(pi, entityID);
 }
 
 void CapabilityDelegate::onLocalEntityUpdated(protocol::ProtocolInterface* const pi, Entity const& entity) noexcept
@@ -2282,6 +2299,19 @@ void CapabilityDelegate::onRemoteEntityOnline(protocol::ProtocolInterface* const
 }
 
 void CapabilityDelegate::onRemoteEntityOffline(protocol::ProtocolInterface* const pi, UniqueIdentifier const entityID) noexcept
+{
+	// The ProtocolInterface discarded all the AECP commands sent to this entity, release their continuations
+	_aemContinuations.discard(entityID);
+	_aaContinuations.discard(entityID);
+	_mvuContinuations.discard(entityID);
+
+	// A departing controller is no longer registered for the unsolicited notifications of our entity model
+	_aemHandler.onRemoteEntityOffline(entityID);
+
+	notifyRemoteEntityOffline(pi, entityID);
+}
+
+void CapabilityDelegate::notifyRemoteEntityOffline(protocol::ProtocolInterface* const pi, UniqueIdentifier const entityID) noexcept
 {
 	{
 		// Lock ProtocolInterface
@@ -2353,10 +2383,10 @@ void CapabilityDelegate::onRemoteEntityUpdated(protocol::ProtocolInterface* cons
 			onRemoteEntityOnline(pi, entity);
 			break;
 		case Action::ForwardOffline:
-			onRemoteEntityOffline(pi, entityID);
+			notifyRemoteEntityOffline(pi, entityID); // Not coming from the ProtocolInterface, inflight commands are still alive
 			break;
 		case Action::ForwardOfflineOnline:
-			onRemoteEntityOffline(pi, entityID);
+			notifyRemoteEntityOffline(pi, entityID); // Not coming from the ProtocolInterface, inflight commands are still alive
 			onRemoteEntityOnline(pi, entity);
 			break;
 		default:
@@ -2503,7 +2533,7 @@ bool CapabilityDelegate::isResponseForController(protocol::AcmpMessageType const
 	return false;
 }
 
-void CapabilityDelegate::sendAemAecpCommand(UniqueIdentifier const targetEntityID, protocol::AemCommandType const commandType, void const* const payload, size_t const payloadLength, LocalEntityImpl<>::OnAemAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept
+void CapabilityDelegate::sendAemAecpCommand(UniqueIdentifier const targetEntityID, protocol::AemCommandType const commandType, void const* const payload, size_t const payloadLength, LocalEntityImpl<>::OnAemAECPErrorCallback&& onErrorCallback, LocalEntityImpl<>::AnswerCallback&& answerCallback) const noexcept
 {
 	auto targetMacAddress = networkInterface::MacAddress{};
 
@@ -2529,8 +2559,9 @@ void CapabilityDelegate::sendAemAecpCommand(UniqueIdentifier const targetEntityI
 		return;
 	}
 
-	LocalEntityImpl<>::sendAemAecpCommand(_protocolInterface, _controllerID, targetEntityID, targetMacAddress, commandType, payload, payloadLength,
-		[this, commandType, onErrorCallback, answerCallback](protocol::Aecpdu const* const response, LocalEntity::AemCommandStatus const status)
+	// Store the continuation (taking ownership of the handlers), the ProtocolInterface only gets a Ticket to it
+	auto const ticket = _aemContinuations.store(targetEntityID,
+		[this, commandType, onErrorCallback = std::move(onErrorCallback), answerCallback = std::move(answerCallback)](protocol::Aecpdu const* const response, LocalEntity::AemCommandStatus const status)
 		{
 			if (!!status)
 			{
@@ -2541,9 +2572,10 @@ void CapabilityDelegate::sendAemAecpCommand(UniqueIdentifier const targetEntityI
 				utils::invokeProtectedHandler(onErrorCallback, status);
 			}
 		});
+	LocalEntityImpl<>::sendAemAecpCommand(_protocolInterface, _controllerID, targetEntityID, targetMacAddress, commandType, payload, payloadLength, ticket);
 }
 
-void CapabilityDelegate::sendAaAecpCommand(UniqueIdentifier const targetEntityID, addressAccess::Tlvs const& tlvs, LocalEntityImpl<>::OnAaAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept
+void CapabilityDelegate::sendAaAecpCommand(UniqueIdentifier const targetEntityID, addressAccess::Tlvs const& tlvs, LocalEntityImpl<>::OnAaAECPErrorCallback&& onErrorCallback, LocalEntityImpl<>::AnswerCallback&& answerCallback) const noexcept
 {
 	auto targetMacAddress = networkInterface::MacAddress{};
 
@@ -2569,8 +2601,9 @@ void CapabilityDelegate::sendAaAecpCommand(UniqueIdentifier const targetEntityID
 		return;
 	}
 
-	LocalEntityImpl<>::sendAaAecpCommand(_protocolInterface, _controllerID, targetEntityID, targetMacAddress, tlvs,
-		[this, onErrorCallback, answerCallback](protocol::Aecpdu const* const response, LocalEntity::AaCommandStatus const status)
+	// Store the continuation (taking ownership of the handlers), the ProtocolInterface only gets a Ticket to it
+	auto const ticket = _aaContinuations.store(targetEntityID,
+		[this, onErrorCallback = std::move(onErrorCallback), answerCallback = std::move(answerCallback)](protocol::Aecpdu const* const response, LocalEntity::AaCommandStatus const status)
 		{
 			if (!!status)
 			{
@@ -2581,9 +2614,10 @@ void CapabilityDelegate::sendAaAecpCommand(UniqueIdentifier const targetEntityID
 				utils::invokeProtectedHandler(onErrorCallback, status);
 			}
 		});
+	LocalEntityImpl<>::sendAaAecpCommand(_protocolInterface, _controllerID, targetEntityID, targetMacAddress, tlvs, ticket);
 }
 
-void CapabilityDelegate::sendMvuAecpCommand(UniqueIdentifier const targetEntityID, protocol::MvuCommandType const commandType, void const* const payload, size_t const payloadLength, LocalEntityImpl<>::OnMvuAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept
+void CapabilityDelegate::sendMvuAecpCommand(UniqueIdentifier const targetEntityID, protocol::MvuCommandType const commandType, void const* const payload, size_t const payloadLength, LocalEntityImpl<>::OnMvuAECPErrorCallback&& onErrorCallback, LocalEntityImpl<>::AnswerCallback&& answerCallback) const noexcept
 {
 	auto targetMacAddress = networkInterface::MacAddress{};
 
@@ -2609,8 +2643,9 @@ void CapabilityDelegate::sendMvuAecpCommand(UniqueIdentifier const targetEntityI
 		return;
 	}
 
-	LocalEntityImpl<>::sendMvuAecpCommand(_protocolInterface, _controllerID, targetEntityID, targetMacAddress, commandType, payload, payloadLength,
-		[this, commandType, onErrorCallback, answerCallback](protocol::Aecpdu const* const response, LocalEntity::MvuCommandStatus const status)
+	// Store the continuation (taking ownership of the handlers), the ProtocolInterface only gets a Ticket to it
+	auto const ticket = _mvuContinuations.store(targetEntityID,
+		[this, commandType, onErrorCallback = std::move(onErrorCallback), answerCallback = std::move(answerCallback)](protocol::Aecpdu const* const response, LocalEntity::MvuCommandStatus const status)
 		{
 			if (!!status)
 			{
@@ -2621,12 +2656,14 @@ void CapabilityDelegate::sendMvuAecpCommand(UniqueIdentifier const targetEntityI
 				utils::invokeProtectedHandler(onErrorCallback, status);
 			}
 		});
+	LocalEntityImpl<>::sendMvuAecpCommand(_protocolInterface, _controllerID, targetEntityID, targetMacAddress, commandType, payload, payloadLength, ticket);
 }
 
-void CapabilityDelegate::sendAcmpCommand(protocol::AcmpMessageType const messageType, UniqueIdentifier const talkerEntityID, model::StreamIndex const talkerStreamIndex, UniqueIdentifier const listenerEntityID, model::StreamIndex const listenerStreamIndex, std::uint16_t const connectionIndex, LocalEntityImpl<>::OnACMPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept
+void CapabilityDelegate::sendAcmpCommand(protocol::AcmpMessageType const messageType, UniqueIdentifier const talkerEntityID, model::StreamIndex const talkerStreamIndex, UniqueIdentifier const listenerEntityID, model::StreamIndex const listenerStreamIndex, std::uint16_t const connectionIndex, LocalEntityImpl<>::OnACMPErrorCallback&& onErrorCallback, LocalEntityImpl<>::AnswerCallback&& answerCallback) const noexcept
 {
-	LocalEntityImpl<>::sendAcmpCommand(_protocolInterface, messageType, _controllerID, talkerEntityID, talkerStreamIndex, listenerEntityID, listenerStreamIndex, connectionIndex,
-		[this, onErrorCallback, answerCallback](protocol::Acmpdu const* const response, LocalEntity::ControlStatus const status)
+	// Store the continuation (taking ownership of the handlers), the ProtocolInterface only gets a Ticket to it (ACMP commands are never discarded, no need to track the target entity)
+	auto const ticket = _acmpContinuations.store(UniqueIdentifier::getNullUniqueIdentifier(),
+		[this, onErrorCallback = std::move(onErrorCallback), answerCallback = std::move(answerCallback)](protocol::Acmpdu const* const response, LocalEntity::ControlStatus const status)
 		{
 			if (!!status)
 			{
@@ -2637,6 +2674,7 @@ void CapabilityDelegate::sendAcmpCommand(protocol::AcmpMessageType const message
 				utils::invokeProtectedHandler(onErrorCallback, status);
 			}
 		});
+	LocalEntityImpl<>::sendAcmpCommand(_protocolInterface, messageType, _controllerID, talkerEntityID, talkerStreamIndex, listenerEntityID, listenerStreamIndex, connectionIndex, ticket);
 }
 
 void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const commandType, protocol::Aecpdu const* const response, LocalEntityImpl<>::OnAemAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept
@@ -2644,7 +2682,10 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 	auto const& aem = static_cast<protocol::AemAecpdu const&>(*response);
 	auto const status = static_cast<LocalEntity::AemCommandStatus>(aem.getStatus().getValue()); // We have to convert protocol status to our extended status
 	auto const responseCommandType = aem.getCommandType();
-	auto const protocolViolationCallback = static_cast<LocalEntityImpl<>::AnswerCallback::Callback>(std::bind(onErrorCallback, LocalEntity::AemCommandStatus::BaseProtocolViolation));
+	auto const protocolViolationCallback = LocalEntityImpl<>::AnswerCallback::Callback{ [&onErrorCallback]()
+		{
+			onErrorCallback(LocalEntity::AemCommandStatus::BaseProtocolViolation);
+		} };
 
 	// First, do an early check on commandType (should match the commandType that was sent)
 	// Other dispatch errors will be trapped by the AnswerCallback class during invoke call
@@ -2655,8 +2696,7 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 		return;
 	}
 
-	static std::unordered_map<protocol::AemCommandType::value_type, std::function<void(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::AemCommandStatus const status, protocol::AemAecpdu const& aem, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback)>> s_Dispatch
-	{
+	static auto const s_Dispatch = utils::DispatchTable<void(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::AemCommandStatus const status, protocol::AemAecpdu const& aem, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback), AemDispatchTableSize>{
 		// Acquire Entity
 		{ protocol::AemCommandType::AcquireEntity.getValue(), [](controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::AemCommandStatus const status, protocol::AemAecpdu const& aem, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback)
 			{
@@ -4160,7 +4200,7 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 				// Unpack responses if SUCCESS
 				if (status == LocalEntity::AemCommandStatus::Success)
 				{
-					static auto s_DynamicInfoDispatch = std::unordered_map<protocol::AemCommandType::value_type, std::function<DynamicInfoParameter::Parameters(UniqueIdentifier const targetID, entity::LocalEntity::AemCommandStatus const status, protocol::AemAecpdu::Payload const payload)>>{
+					static auto const s_DynamicInfoDispatch = utils::DispatchTable<DynamicInfoParameter::Parameters(UniqueIdentifier const targetID, entity::LocalEntity::AemCommandStatus const status, protocol::AemAecpdu::Payload const payload), AemDispatchTableSize>{
 						// Get Configuration
 						{ protocol::AemCommandType::GetConfiguration.getValue(),
 							[](UniqueIdentifier const /*targetID*/, entity::LocalEntity::AemCommandStatus const status, protocol::AemAecpdu::Payload const payload)
@@ -4579,14 +4619,14 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 
 					for (auto const& [dynamicInfoStatus, commandType, buffer] : dynamicInfos)
 					{
-						auto const& it = s_DynamicInfoDispatch.find(commandType.getValue());
-						if (it == s_DynamicInfoDispatch.end())
+						auto const dispatchHandler = s_DynamicInfoDispatch.find(commandType.getValue());
+						if (dispatchHandler == nullptr)
 						{
 							LOG_CONTROLLER_ENTITY_DEBUG(targetID, "Failed to deserialize getDynamicInfo: Unhandled command type {} ({})", std::string(commandType), utils::toHexString(commandType.getValue()));
 							throw std::invalid_argument("Failed to deserialize getDynamicInfo: Unhandled command type");
 						}
 						auto const st = entity::LocalEntity::AemCommandStatus{ dynamicInfoStatus.getValue() };
-						auto arguments = it->second(targetID, st, protocol::AemAecpdu::Payload{ buffer.data(), buffer.size() });
+						auto arguments = dispatchHandler(targetID, st, protocol::AemAecpdu::Payload{ buffer.data(), buffer.size() });
 						parameters.emplace_back(DynamicInfoParameter{ st, commandType, std::move(arguments) });
 					}
 				}
@@ -4625,8 +4665,8 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 		},
 	};
 
-	auto const& it = s_Dispatch.find(responseCommandType.getValue());
-	if (it == s_Dispatch.end())
+	auto const dispatchHandler = s_Dispatch.find(responseCommandType.getValue());
+	if (dispatchHandler == nullptr)
 	{
 		// If this is an unsolicited notification, simply log we do not handle the message
 		if (aem.getUnsolicited())
@@ -4662,7 +4702,7 @@ void CapabilityDelegate::processAemAecpResponse(protocol::AemCommandType const c
 
 		try
 		{
-			it->second(_controllerDelegate, &_controllerInterface, status, aem, answerCallback, protocolViolationCallback);
+			dispatchHandler(_controllerDelegate, &_controllerInterface, status, aem, answerCallback, protocolViolationCallback);
 		}
 		catch ([[maybe_unused]] protocol::aemPayload::NotImplementedException const& e)
 		{
@@ -4700,7 +4740,10 @@ void CapabilityDelegate::processAaAecpResponse(protocol::Aecpdu const* const res
 	auto const& aa = static_cast<protocol::AaAecpdu const&>(*response);
 	auto const status = static_cast<LocalEntity::AaCommandStatus>(aa.getStatus().getValue()); // We have to convert protocol status to our extended status
 	auto const targetID = aa.getTargetEntityID();
-	auto const protocolViolationCallback = std::bind(onErrorCallback, LocalEntity::AaCommandStatus::BaseProtocolViolation);
+	auto const protocolViolationCallback = LocalEntityImpl<>::AnswerCallback::Callback{ [&onErrorCallback]()
+		{
+			onErrorCallback(LocalEntity::AaCommandStatus::BaseProtocolViolation);
+		} };
 
 	answerCallback.invoke<controller::Interface::AddressAccessHandler>(protocolViolationCallback, &_controllerInterface, targetID, status, aa.getTlvData());
 }
@@ -4725,7 +4768,10 @@ void CapabilityDelegate::processMvuAecpResponse(protocol::MvuCommandType const c
 	auto const& mvu = static_cast<protocol::MvuAecpdu const&>(*response);
 	auto const status = static_cast<LocalEntity::MvuCommandStatus>(mvu.getStatus().getValue()); // We have to convert protocol status to our extended status
 	auto const responseCommandType = mvu.getCommandType();
-	auto const protocolViolationCallback = static_cast<LocalEntityImpl<>::AnswerCallback::Callback>(std::bind(onErrorCallback, LocalEntity::MvuCommandStatus::BaseProtocolViolation));
+	auto const protocolViolationCallback = LocalEntityImpl<>::AnswerCallback::Callback{ [&onErrorCallback]()
+		{
+			onErrorCallback(LocalEntity::MvuCommandStatus::BaseProtocolViolation);
+		} };
 
 	// First, do an early check on commandType (should match the commandType that was sent)
 	// Other dispatch errors will be trapped by the AnswerCallback class during invoke call
@@ -4736,7 +4782,7 @@ void CapabilityDelegate::processMvuAecpResponse(protocol::MvuCommandType const c
 		return;
 	}
 
-	static std::unordered_map<protocol::MvuCommandType::value_type, std::function<void(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::MvuCommandStatus const status, protocol::MvuAecpdu const& mvu, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback)>> s_Dispatch{
+	static auto const s_Dispatch = utils::DispatchTable<void(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::MvuCommandStatus const status, protocol::MvuAecpdu const& mvu, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback), MvuDispatchTableSize>{
 		// Get Milan Info
 		{ protocol::MvuCommandType::GetMilanInfo.getValue(),
 			[](controller::Delegate* const /*delegate*/, Interface const* const controllerInterface, LocalEntity::MvuCommandStatus const status, protocol::MvuAecpdu const& mvu, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback)
@@ -4864,8 +4910,8 @@ void CapabilityDelegate::processMvuAecpResponse(protocol::MvuCommandType const c
 			},
 	};
 
-	auto const& it = s_Dispatch.find(responseCommandType.getValue());
-	if (it == s_Dispatch.end())
+	auto const dispatchHandler = s_Dispatch.find(responseCommandType.getValue());
+	if (dispatchHandler == nullptr)
 	{
 		// If this is an unsolicited notification, simply log we do not handle the message
 		if (mvu.getUnsolicited())
@@ -4883,7 +4929,7 @@ void CapabilityDelegate::processMvuAecpResponse(protocol::MvuCommandType const c
 	{
 		try
 		{
-			it->second(_controllerDelegate, &_controllerInterface, status, mvu, answerCallback, protocolViolationCallback);
+			dispatchHandler(_controllerDelegate, &_controllerInterface, status, mvu, answerCallback, protocolViolationCallback);
 		}
 		catch ([[maybe_unused]] protocol::mvuPayload::NotImplementedException const& e)
 		{
@@ -4916,9 +4962,12 @@ void CapabilityDelegate::processAcmpResponse(protocol::Acmpdu const* const respo
 {
 	auto const& acmp = static_cast<protocol::Acmpdu const&>(*response);
 	auto const status = static_cast<LocalEntity::ControlStatus>(acmp.getStatus().getValue()); // We have to convert protocol status to our extended status
-	auto const protocolViolationCallback = std::bind(onErrorCallback, LocalEntity::ControlStatus::BaseProtocolViolation);
+	auto const protocolViolationCallback = LocalEntityImpl<>::AnswerCallback::Callback{ [&onErrorCallback]()
+		{
+			onErrorCallback(LocalEntity::ControlStatus::BaseProtocolViolation);
+		} };
 
-	static std::unordered_map<protocol::AcmpMessageType::value_type, std::function<void(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::ControlStatus const status, protocol::Acmpdu const& acmp, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback, bool const sniffed)>> s_Dispatch{
+	static auto const s_Dispatch = utils::DispatchTable<void(controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::ControlStatus const status, protocol::Acmpdu const& acmp, LocalEntityImpl<>::AnswerCallback const& answerCallback, LocalEntityImpl<>::AnswerCallback::Callback const& protocolViolationCallback, bool const sniffed), AcmpDispatchTableSize>{
 		// Connect TX response
 		{ protocol::AcmpMessageType::ConnectTxResponse.getValue(),
 			[](controller::Delegate* const delegate, Interface const* const controllerInterface, LocalEntity::ControlStatus const status, protocol::Acmpdu const& acmp, LocalEntityImpl<>::AnswerCallback const& /*answerCallback*/, LocalEntityImpl<>::AnswerCallback::Callback const& /*protocolViolationCallback*/, bool const sniffed)
@@ -5028,8 +5077,8 @@ void CapabilityDelegate::processAcmpResponse(protocol::Acmpdu const* const respo
 			} },
 	};
 
-	auto const& it = s_Dispatch.find(acmp.getMessageType().getValue());
-	if (it == s_Dispatch.end())
+	auto const dispatchHandler = s_Dispatch.find(acmp.getMessageType().getValue());
+	if (dispatchHandler == nullptr)
 	{
 		// If this is a sniffed message, simply log we do not handle the message
 		if (sniffed)
@@ -5047,7 +5096,7 @@ void CapabilityDelegate::processAcmpResponse(protocol::Acmpdu const* const respo
 	{
 		try
 		{
-			it->second(_controllerDelegate, &_controllerInterface, status, acmp, answerCallback, protocolViolationCallback, sniffed);
+			dispatchHandler(_controllerDelegate, &_controllerInterface, status, acmp, answerCallback, protocolViolationCallback, sniffed);
 		}
 		catch ([[maybe_unused]] std::exception const& e) // Mainly unpacking errors
 		{
@@ -52,6 +52,8 @@ public:
 	/* Controller methods                                                         */
 	/* ************************************************************************** */
 	void setControllerDelegate(controller::Delegate* const delegate) noexcept;
+	void notifyEntityModelChanged() noexcept;
+	void notifyControlValuesChanged(model::ControlIndex const controlIndex) noexcept;
 	/* Discovery Protocol (ADP) */
 	/* Enumeration and Control Protocol (AECP) AEM */
 	void acquireEntity(UniqueIdentifier const targetEntityID, bool const isPersistent, model::DescriptorType const descriptorType, model::DescriptorIndex const descriptorIndex, Interface::AcquireEntityHandler const& handler) const noexcept;
@@ -243,10 +245,11 @@ private:
 	/* ************************************************************************** */
 	model::AvbInterfaceIndex getMainInterfaceIndex(Entity const& entity) const noexcept;
 	bool isResponseForController(protocol::AcmpMessageType const messageType) const noexcept;
-	void sendAemAecpCommand(UniqueIdentifier const targetEntityID, protocol::AemCommandType const commandType, void const* const payload, size_t const payloadLength, LocalEntityImpl<>::OnAemAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept;
-	void sendAaAecpCommand(UniqueIdentifier const targetEntityID, addressAccess::Tlvs const& tlvs, LocalEntityImpl<>::OnAaAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept;
-	void sendMvuAecpCommand(UniqueIdentifier const targetEntityID, protocol::MvuCommandType const commandType, void const* const payload, size_t const payloadLength, LocalEntityImpl<>::OnMvuAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept;
-	void sendAcmpCommand(protocol::AcmpMessageType const messageType, UniqueIdentifier const talkerEntityID, model::StreamIndex const talkerStreamIndex, UniqueIdentifier const listenerEntityID, model::StreamIndex const listenerStreamIndex, std::uint16_t const connectionIndex, LocalEntityImpl<>::OnACMPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept;
+	void notifyRemoteEntityOffline(protocol::ProtocolInterface* const pi, UniqueIdentifier const entityID) noexcept;
+	void sendAemAecpCommand(UniqueIdentifier const targetEntityID, protocol::AemCommandType const commandType, void const* const payload, size_t const payloadLength, LocalEntityImpl<>::OnAemAECPErrorCallback&& onErrorCallback, LocalEntityImpl<>::AnswerCallback&& answerCallback) const noexcept;
+	void sendAaAecpCommand(UniqueIdentifier const targetEntityID, addressAccess::Tlvs const& tlvs, LocalEntityImpl<>::OnAaAECPErrorCallback&& onErrorCallback, LocalEntityImpl<>::AnswerCallback&& answerCallback) const noexcept;
+	void sendMvuAecpCommand(UniqueIdentifier const targetEntityID, protocol::MvuCommandType const commandType, void const* const payload, size_t const payloadLength, LocalEntityImpl<>::OnMvuAECPErrorCallback&& onErrorCallback, LocalEntityImpl<>::AnswerCallback&& answerCallback) const noexcept;
+	void sendAcmpCommand(protocol::AcmpMessageType const messageType, UniqueIdentifier const talkerEntityID, model::StreamIndex const talkerStreamIndex, UniqueIdentifier const listenerEntityID, model::StreamIndex const listenerStreamIndex, std::uint16_t const connectionIndex, LocalEntityImpl<>::OnACMPErrorCallback&& onErrorCallback, LocalEntityImpl<>::AnswerCallback&& answerCallback) const noexcept;
 	void processAemAecpResponse(protocol::AemCommandType const commandType, protocol::Aecpdu const* const response, LocalEntityImpl<>::OnAemAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept;
 	void processAaAecpResponse(protocol::Aecpdu const* const response, LocalEntityImpl<>::OnAaAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept;
 	void processMvuAecpResponse(protocol::MvuCommandType const commandType, protocol::Aecpdu const* const response, LocalEntityImpl<>::OnMvuAECPErrorCallback const& onErrorCallback, LocalEntityImpl<>::AnswerCallback const& answerCallback) const noexcept;
@@ -259,8 +262,12 @@ private:
 	controller::Delegate* _controllerDelegate{ nullptr };
 	Interface& _controllerInterface;
 	UniqueIdentifier const _controllerID{ UniqueIdentifier::getNullUniqueIdentifier() };
-	model::AemHandler const _aemHandler;
+	model::AemHandler _aemHandler;
 	DiscoveredEntities _discoveredEntities{};
+	mutable LocalEntityImpl<>::CommandContinuations<protocol::Aecpdu, LocalEntity::AemCommandStatus> _aemContinuations{};
+	mutable LocalEntityImpl<>::CommandContinuations<protocol::Aecpdu, LocalEntity::AaCommandStatus> _aaContinuations{};
+	mutable LocalEntityImpl<>::CommandContinuations<protocol::Aecpdu, LocalEntity::MvuCommandStatus> _mvuContinuations{};
+	mutable LocalEntityImpl<>::CommandContinuations<protocol::Acmpdu, LocalEntity::ControlStatus> _acmpContinuations{};
 };
 
 } // namespace controller
@@ -738,6 +738,16 @@ void ControllerEntityImpl::setControllerDelegate(controller::Delegate* const del
 	static_cast<controller::CapabilityDelegate&>(*_controllerCapabilityDelegate).setControllerDelegate(delegate);
 }
 
+void ControllerEntityImpl::notifyEntityModelChanged() noexcept
+{
+	static_cast<controller::CapabilityDelegate&>(*_controllerCapabilityDelegate).notifyEntityModelChanged();
+}
+
+void ControllerEntityImpl::notifyControlValuesChanged(model::ControlIndex const controlIndex) noexcept
+{
+	static_cast<controller::CapabilityDelegate&>(*_controllerCapabilityDelegate).notifyControlValuesChanged(controlIndex);
+}
+
 /* ************************************************************************** */
 /* protocol::ProtocolInterface::Observer overrides                            */
 /* ************************************************************************** */
@@ -200,6 +200,8 @@ private:
 	virtual void getTalkerStreamConnection(model::StreamIdentification const& talkerStream, std::uint16_t const connectionIndex, GetTalkerStreamConnectionHandler const& handler) const noexcept override;
 	/* Other methods */
 	virtual void setControllerDelegate(controller::Delegate* const delegate) noexcept override;
+	virtual void notifyEntityModelChanged() noexcept override;
+	virtual void notifyControlValuesChanged(model::ControlIndex const controlIndex) noexcept override;
 	controller::Delegate* getControllerDelegate() const noexcept;
 
 	/* ************************************************************************** */
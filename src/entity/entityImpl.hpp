@@ -36,6 +36,10 @@
 #include <cstdint>
 #include <algorithm>
 #include <mutex>
+#include <new>
+#include <functional>
+#include <type_traits>
+#include <vector>
 
 namespace la
 {
@@ -177,29 +181,62 @@ public:
 		return _protocolInterface->isSelfLocked();
 	}
 
-	struct AnswerCallback
+	/**
+	* @brief Handler of a command answer, stored inline (handlers are std::function, which all have the same size).
+	* @details The type of the handler is recorded when it is stored and checked when it is invoked, the error callback being called instead in case of mismatch.
+	*          Move-only, so the handler is never copied once stored.
+	*/
+	class AnswerCallback final
 	{
 	public:
 		using Callback = std::function<void()>;
+
 		// Constructors
-		AnswerCallback() = default;
-		template<typename T>
-		AnswerCallback(T f)
-			: _onAnswer{ std::move(reinterpret_cast<Callback&>(f)) }
-			, _hash{ typeid(T).hash_code() }
+		AnswerCallback() noexcept = default;
+		template<typename T, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, AnswerCallback>>>
+		AnswerCallback(T&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<T>, T&&>)
+		{
+			using Handler = std::decay_t<T>;
+			static_assert(sizeof(Handler) <= sizeof(Storage) && alignof(Handler) <= alignof(Storage), "Handler does not fit in AnswerCallback storage");
+			static_assert(std::is_nothrow_move_constructible_v<Handler>, "Handler must be nothrow move constructible");
+			if (!!f)
+			{
+				new (&_storage) Handler(std::forward<T>(f));
+				_operations = &s_Operations<Handler>;
+			}
+		}
+
+		AnswerCallback(AnswerCallback&& other) noexcept
+		{
+			moveFrom(other);
+		}
+
+		AnswerCallback& operator=(AnswerCallback&& other) noexcept
+		{
+			if (this != &other)
+			{
+				reset();
+				moveFrom(other);
+			}
+			return *this;
+		}
+
+		~AnswerCallback() noexcept
 		{
+			reset();
 		}
+
 		// Call operator
 		template<typename T, typename... Ts>
 		void invoke(Callback const& errorCallback, Ts&&... params) const noexcept
 		{
-			if (_onAnswer)
+			if (_operations)
 			{
-				if (AVDECC_ASSERT_WITH_RET(typeid(T).hash_code() == _hash, "Trying to call an AnswerCallback that is not of the expected typeid"))
+				if (AVDECC_ASSERT_WITH_RET(_operations == &s_Operations<T>, "Trying to call an AnswerCallback that is not of the expected type"))
 				{
 					try
 					{
-						reinterpret_cast<T const&>(_onAnswer)(std::forward<Ts>(params)...);
+						(*std::launder(reinterpret_cast<T const*>(&_storage)))(std::forward<Ts>(params)...);
 					}
 					catch (...)
 					{
@@ -213,15 +250,216 @@ public:
 			}
 		}
 
+		// Deleted compiler auto-generated methods
+		AnswerCallback(AnswerCallback const&) = delete;
+		AnswerCallback& operator=(AnswerCallback const&) = delete;
+
 	private:
-		Callback _onAnswer{ nullptr };
-		std::size_t _hash{ 0u };
+		using Storage = std::aligned_storage_t<sizeof(std::function<void()>), alignof(std::function<void()>)>;
+
+		// One instance per handler type, its address being used to check the type of the stored handler
+		struct Operations
+		{
+			void (*move)(Storage* const dst, Storage* const src) noexcept; // Move-constructs dst from src, then destroys src
+			void (*destroy)(Storage* const storage) noexcept;
+		};
+
+		template<typename Handler>
+		static inline Operations const s_Operations{
+			[](Storage* const dst, Storage* const src) noexcept
+			{
+				auto* const handler = std::launder(reinterpret_cast<Handler*>(src));
+				new (dst) Handler(std::move(*handler));
+				handler->~Handler();
+			},
+			[](Storage* const storage) noexcept
+			{
+				std::launder(reinterpret_cast<Handler*>(storage))->~Handler();
+			},
+		};
+
+		void reset() noexcept
+		{
+			if (_operations)
+			{
+				_operations->destroy(&_storage);
+				_operations = nullptr;
+			}
+		}
+
+		void moveFrom(AnswerCallback& other) noexcept
+		{
+			if (other._operations)
+			{
+				other._operations->move(&_storage, &other._storage);
+				_operations = other._operations;
+				other._operations = nullptr;
+			}
+		}
+
+		Storage _storage;
+		Operations const* _operations{ nullptr };
 	};
 
-	using OnAemAECPErrorCallback = std::function<void(LocalEntity::AemCommandStatus)>;
-	using OnAaAECPErrorCallback = std::function<void(LocalEntity::AaCommandStatus)>;
-	using OnMvuAECPErrorCallback = std::function<void(LocalEntity::MvuCommandStatus)>;
-	using OnACMPErrorCallback = std::function<void(LocalEntity::ControlStatus)>;
+	/** Inline size of the error callbacks, enough for a handler bound with its object and a few parameters (bigger ones use pooled storage) */
+	static constexpr auto ErrorCallbackInlineSize = std::size_t{ 128u };
+	/** Inline size of the command continuations, enough for an error callback and an AnswerCallback */
+	static constexpr auto ContinuationInlineSize = std::size_t{ 320u };
+
+	using OnAemAECPErrorCallback = utils::InlineFunction<void(LocalEntity::AemCommandStatus), ErrorCallbackInlineSize>;
+	using OnAaAECPErrorCallback = utils::InlineFunction<void(LocalEntity::AaCommandStatus), ErrorCallbackInlineSize>;
+	using OnMvuAECPErrorCallback = utils::InlineFunction<void(LocalEntity::MvuCommandStatus), ErrorCallbackInlineSize>;
+	using OnACMPErrorCallback = utils::InlineFunction<void(LocalEntity::ControlStatus), ErrorCallbackInlineSize>;
+
+	/**
+	* @brief Continuations of the commands sent to the ProtocolInterface, waiting for their result.
+	* @details The result handler given to the ProtocolInterface is a Ticket referencing a continuation stored here. Tickets are small and trivially copyable, so they fit in the small buffer of std::function,
+	*          and continuation slots are reused, so sending a command does not allocate once warmed up.
+	*          Continuations of the commands discarded by the ProtocolInterface (eg. the target entity went offline) must be released with discard, a late completion through their Ticket being ignored.
+	* @note Thread-safe.
+	*/
+	template<typename PduType, typename StatusType>
+	class CommandContinuations final
+	{
+	public:
+		using Continuation = utils::InlineFunction<void(PduType const*, StatusType), ContinuationInlineSize>;
+
+		/** Result handler referencing a stored continuation */
+		class Ticket final
+		{
+		public:
+			void operator()(PduType const* const response, StatusType const status) const noexcept
+			{
+				_continuations->complete(_index, _generation, response, status);
+			}
+
+			explicit operator bool() const noexcept
+			{
+				return _continuations != nullptr;
+			}
+
+			friend bool operator==(Ticket const& lhs, std::nullptr_t) noexcept
+			{
+				return !lhs;
+			}
+
+		private:
+			friend class CommandContinuations;
+
+			CommandContinuations* _continuations{ nullptr };
+			std::uint32_t _index{ 0u };
+			std::uint32_t _generation{ 0u };
+		};
+
+		/** Stores a continuation for a command sent to targetEntityID, returning the Ticket to complete it */
+		Ticket store(UniqueIdentifier const targetEntityID, Continuation&& continuation)
+		{
+			// Lock to protect _slots
+			auto const lg = std::lock_guard{ _lock };
+
+			auto index = std::uint32_t{ 0u };
+			if (!_freeSlots.empty())
+			{
+				index = _freeSlots.back();
+				_freeSlots.pop_back();
+			}
+			else
+			{
+				index = static_cast<std::uint32_t>(_slots.size());
+				_slots.emplace_back();
+			}
+
+			auto& slot = _slots[index];
+			slot.continuation = std::move(continuation);
+			slot.targetEntityID = targetEntityID;
+
+			auto ticket = Ticket{};
+			ticket._continuations = this;
+			ticket._index = index;
+			ticket._generation = slot.generation;
+			return ticket;
+		}
+
+		/** Releases all the continuations of the commands sent to targetEntityID, without calling them */
+		void discard(UniqueIdentifier const targetEntityID) noexcept
+		{
+			auto discarded = std::vector<Continuation>{};
+			{
+				// Lock to protect _slots
+				auto const lg = std::lock_guard{ _lock };
+
+				for (auto index = std::uint32_t{ 0u }; index < _slots.size(); ++index)
+				{
+					auto& slot = _slots[index];
+					if (slot.continuation && slot.targetEntityID == targetEntityID)
+					{
+						try
+						{
+							discarded.push_back(std::move(slot.continuation));
+						}
+						catch (...)
+						{
+						}
+						release(index);
+					}
+				}
+			}
+			// Continuations are destroyed outside the lock
+		}
+
+		/** Returns the count of continuations waiting for their result */
+		std::size_t getPendingCount() const noexcept
+		{
+			// Lock to protect _slots
+			auto const lg = std::lock_guard{ _lock };
+			return _slots.size() - _freeSlots.size();
+		}
+
+	private:
+		struct Slot
+		{
+			Continuation continuation{};
+			UniqueIdentifier targetEntityID{};
+			std::uint32_t generation{ 0u };
+		};
+
+		void complete(std::uint32_t const index, std::uint32_t const generation, PduType const* const response, StatusType const status) noexcept
+		{
+			auto continuation = Continuation{};
+			{
+				// Lock to protect _slots
+				auto const lg = std::lock_guard{ _lock };
+
+				if (index >= _slots.size() || _slots[index].generation != generation || !_slots[index].continuation)
+				{
+					// Already completed or discarded
+					return;
+				}
+				continuation = std::move(_slots[index].continuation);
+				release(index);
+			}
+			utils::invokeProtectedHandler(continuation, response, status);
+		}
+
+		void release(std::uint32_t const index) noexcept
+		{
+			auto& slot = _slots[index];
+			slot.continuation.reset();
+			++slot.generation;
+			try
+			{
+				_freeSlots.push_back(index);
+			}
+			catch (...)
+			{
+				// Slot is lost, but its generation prevents any further use
+			}
+		}
+
+		mutable std::mutex _lock{};
+		std::vector<Slot> _slots{};
+		std::vector<std::uint32_t> _freeSlots{};
+	};
 
 	template<typename T, typename Object, typename... Ts>
 	static inline OnAemAECPErrorCallback makeAemAECPErrorHandler(T const& handler, Object const* const object, Ts&&... params) noexcept
@@ -269,7 +507,8 @@ public:
 	static LocalEntity::MvuCommandStatus convertErrorToMvuCommandStatus(protocol::ProtocolInterface::Error const error) noexcept;
 	static LocalEntity::ControlStatus convertErrorToControlStatus(protocol::ProtocolInterface::Error const error) noexcept;
 
-	static void sendAemAecpCommand(protocol::ProtocolInterface const* const pi, UniqueIdentifier const controllerEntityID, UniqueIdentifier const targetEntityID, networkInterface::MacAddress targetMacAddress, protocol::AemCommandType const commandType, void const* const payload, size_t const payloadLength, std::function<void(protocol::Aecpdu const*, LocalEntity::AemCommandStatus)> const& onResult) noexcept
+	template<typename ResultHandler>
+	static void sendAemAecpCommand(protocol::ProtocolInterface const* const pi, UniqueIdentifier const controllerEntityID, UniqueIdentifier const targetEntityID, networkInterface::MacAddress targetMacAddress, protocol::AemCommandType const commandType, void const* const payload, size_t const payloadLength, ResultHandler const& onResult) noexcept
 	{
 		try
 		{
@@ -310,7 +549,8 @@ public:
 		}
 	}
 
-	static void sendAaAecpCommand(protocol::ProtocolInterface const* const pi, UniqueIdentifier const controllerEntityID, UniqueIdentifier const targetEntityID, networkInterface::MacAddress targetMacAddress, addressAccess::Tlvs const& tlvs, std::function<void(protocol::Aecpdu const*, LocalEntity::AaCommandStatus)> const& onResult) noexcept
+	template<typename ResultHandler>
+	static void sendAaAecpCommand(protocol::ProtocolInterface const* const pi, UniqueIdentifier const controllerEntityID, UniqueIdentifier const targetEntityID, networkInterface::MacAddress targetMacAddress, addressAccess::Tlvs const& tlvs, ResultHandler const& onResult) noexcept
 	{
 		try
 		{
@@ -352,7 +592,8 @@ public:
 		}
 	}
 
-	static void sendMvuAecpCommand(protocol::ProtocolInterface const* const pi, UniqueIdentifier const controllerEntityID, UniqueIdentifier const targetEntityID, networkInterface::MacAddress targetMacAddress, protocol::MvuCommandType const commandType, void const* const payload, size_t const payloadLength, std::function<void(protocol::Aecpdu const*, LocalEntity::MvuCommandStatus)> const& onResult) noexcept
+	template<typename ResultHandler>
+	static void sendMvuAecpCommand(protocol::ProtocolInterface const* const pi, UniqueIdentifier const controllerEntityID, UniqueIdentifier const targetEntityID, networkInterface::MacAddress targetMacAddress, protocol::MvuCommandType const commandType, void const* const payload, size_t const payloadLength, ResultHandler const& onResult) noexcept
 	{
 		try
 		{
@@ -392,7 +633,8 @@ public:
 		}
 	}
 
-	static void sendAcmpCommand(protocol::ProtocolInterface const* const pi, protocol::AcmpMessageType const messageType, UniqueIdentifier const controllerEntityID, UniqueIdentifier const talkerEntityID, model::StreamIndex const talkerStreamIndex, UniqueIdentifier const listenerEntityID, model::StreamIndex const listenerStreamIndex, std::uint16_t const connectionIndex, std::function<void(protocol::Acmpdu const*, LocalEntity::ControlStatus)> const& onResult) noexcept
+	template<typename ResultHandler>
+	static void sendAcmpCommand(protocol::ProtocolInterface const* const pi, protocol::AcmpMessageType const messageType, UniqueIdentifier const controllerEntityID, UniqueIdentifier const talkerEntityID, model::StreamIndex const talkerStreamIndex, UniqueIdentifier const listenerEntityID, model::StreamIndex const listenerStreamIndex, std::uint16_t const connectionIndex, ResultHandler const& onResult) noexcept
 	{
 		try
 		{
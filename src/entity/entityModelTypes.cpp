@@ -25,6 +25,12 @@
 #include "la/avdecc/internals/entityModelTypes.hpp"
 #include "la/avdecc/utils.hpp"
 
+#include <cstddef> // std::byte
+#include <memory>
+#include <mutex>
+#include <utility> // exchange, swap
+#include <unordered_set>
+
 namespace la
 {
 namespace avdecc
@@ -822,6 +828,169 @@ std::string LA_AVDECC_CALL_CONVENTION defaultMediaClockReferencePriorityToString
 	}
 }
 
+class FixedStringsPool final
+{
+public:
+	using PooledString = InternedAvdeccFixedString::PooledString;
+
+	static FixedStringsPool& getInstance() noexcept
+	{
+		// Never destroyed, handles may be released by other static objects during exit
+		alignas(FixedStringsPool) static std::byte s_storage[sizeof(FixedStringsPool)];
+		static auto* const s_instance = new (s_storage) FixedStringsPool{};
+		return *s_instance;
+	}
+
+	PooledString* intern(AvdeccFixedString const& str)
+	{
+		if (str.empty())
+		{
+			return getEmptyString();
+		}
+
+		auto key = PooledString{};
+		key.str = str;
+
+		// Lock to protect _strings
+		auto const lg = std::lock_guard{ _lock };
+
+		if (auto const it = _strings.find(&key); it != _strings.end())
+		{
+			++(*it)->refCount;
+			return *it;
+		}
+
+		auto pooledString = std::make_unique<PooledString>();
+		pooledString->str = str;
+		pooledString->refCount = 1u;
+		_strings.insert(pooledString.get());
+		return pooledString.release();
+	}
+
+	PooledString* getEmptyString() noexcept
+	{
+		return acquire(&_emptyString);
+	}
+
+	static PooledString* acquire(PooledString* const pooledString) noexcept
+	{
+		++pooledString->refCount;
+		return pooledString;
+	}
+
+	void release(PooledString* const pooledString) noexcept
+	{
+		// Not the last handle: no need to lock the pool, the count cannot reach 0 here
+		auto count = pooledString->refCount.load();
+		while (count > 1u)
+		{
+			if (pooledString->refCount.compare_exchange_weak(count, count - 1u))
+			{
+				return;
+			}
+		}
+
+		// Possibly the last handle: decrement under the lock, so intern cannot return the string while it is being removed
+		auto const lg = std::lock_guard{ _lock };
+
+		if (--pooledString->refCount == 0u)
+		{
+			_strings.erase(pooledString);
+			delete pooledString;
+		}
+	}
+
+	std::size_t size() const noexcept
+	{
+		// Lock to protect _strings
+		auto const lg = std::lock_guard{ _lock };
+
+		return _strings.size();
+	}
+
+private:
+	struct Hash
+	{
+		std::size_t operator()(PooledString const* const pooledString) const noexcept
+		{
+			// FNV-1a over the whole fixed buffer
+			auto const [ptr, size] = pooledString->str.data();
+			auto hash = std::uint64_t{ 14695981039346656037ull };
+			for (auto i = size_t{ 0u }; i < size; ++i)
+			{
+				hash ^= static_cast<std::uint8_t>(ptr[i]);
+				hash *= std::uint64_t{ 1099511628211ull };
+			}
+			return static_cast<std::size_t>(hash);
+		}
+	};
+	struct Equal
+	{
+		bool operator()(PooledString const* const lhs, PooledString const* const rhs) const noexcept
+		{
+			return lhs->str == rhs->str;
+		}
+	};
+
+	FixedStringsPool() noexcept
+	{
+		// The pool keeps a reference on the empty string (not stored in _strings), so it is never removed
+		_emptyString.refCount = 1u;
+	}
+
+	mutable std::mutex _lock{};
+	std::unordered_set<PooledString*, Hash, Equal> _strings{};
+	PooledString _emptyString{};
+};
+
+InternedAvdeccFixedString::InternedAvdeccFixedString() noexcept
+	: _pooledString{ FixedStringsPool::getInstance().getEmptyString() }
+{
+}
+
+InternedAvdeccFixedString::InternedAvdeccFixedString(AvdeccFixedString const& str)
+	: _pooledString{ FixedStringsPool::getInstance().intern(str) }
+{
+}
+
+InternedAvdeccFixedString::~InternedAvdeccFixedString() noexcept
+{
+	FixedStringsPool::getInstance().release(_pooledString);
+}
+
+InternedAvdeccFixedString::InternedAvdeccFixedString(InternedAvdeccFixedString&& other) noexcept
+	: _pooledString{ std::exchange(other._pooledString, FixedStringsPool::getInstance().getEmptyString()) }
+{
+}
+
+InternedAvdeccFixedString::InternedAvdeccFixedString(InternedAvdeccFixedString const& other) noexcept
+	: _pooledString{ FixedStringsPool::acquire(other._pooledString) }
+{
+}
+
+InternedAvdeccFixedString& InternedAvdeccFixedString::operator=(InternedAvdeccFixedString const& other) noexcept
+{
+	if (_pooledString != other._pooledString)
+	{
+		auto* const previous = _pooledString;
+		_pooledString = FixedStringsPool::acquire(other._pooledString);
+		FixedStringsPool::getInstance().release(previous);
+	}
+	return *this;
+}
+
+InternedAvdeccFixedString& InternedAvdeccFixedString::operator=(InternedAvdeccFixedString&& other) noexcept
+{
+	// The moved-from handle releases our previous string when destroyed
+	std::swap(_pooledString, other._pooledString);
+	return *this;
+}
+
+std::size_t InternedAvdeccFixedString::getPoolSize() noexcept
+{
+	return FixedStringsPool::getInstance().size();
+}
+
 } // namespace model
 } // namespace entity
 } // namespace avdecc
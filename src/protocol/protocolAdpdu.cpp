@@ -24,6 +24,7 @@
 
 #include "la/avdecc/internals/protocolAdpdu.hpp"
 
+#include "protocolPduPool.hpp"
 #include "logHelper.hpp"
 
 #include <cassert>
@@ -133,7 +134,7 @@ Adpdu::UniquePointer LA_AVDECC_CALL_CONVENTION Adpdu::copy() const
 	{
 		self->destroy();
 	};
-	return UniquePointer(new Adpdu(*this), deleter);
+	return UniquePointer(PduPool<Adpdu>::getInstance().create(*this), deleter);
 }
 
 // Defaulted compiler auto-generated methods
@@ -145,13 +146,13 @@ Adpdu& LA_AVDECC_CALL_CONVENTION Adpdu::operator=(Adpdu&&) = default;
 /** Entry point */
 Adpdu* LA_AVDECC_CALL_CONVENTION Adpdu::createRawAdpdu() noexcept
 {
-	return new Adpdu();
+	return PduPool<Adpdu>::getInstance().create();
 }
 
 /** Destroy method for COM-like interface */
 void LA_AVDECC_CALL_CONVENTION Adpdu::destroy() noexcept
 {
-	delete this;
+	PduPool<Adpdu>::getInstance().destroy(this);
 }
 
 } // namespace protocol
@@ -58,6 +58,10 @@ struct control_values_payload_traits
 	{
 		throw std::invalid_argument("No template specialization found for this ControlValueType");
 	}
+	static void packFullControlValues(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& /*ser*/, entity::model::ControlValues const& /*staticValues*/, entity::model::ControlValues const& /*dynamicValues*/)
+	{
+		throw std::invalid_argument("No template specialization found for this ControlValueType");
+	}
 	static std::tuple<entity::model::ControlValuesValidationResult, std::string> validateControlValues(entity::model::ControlValues const& /*staticValues*/, entity::model::ControlValues const& /*dynamicValues*/) noexcept
 	{
 		return std::make_tuple(entity::model::ControlValuesValidationResult::NotSupported, "No template specialization found for this ControlValueType");
@@ -101,6 +105,7 @@ struct LinearValuesPayloadTraits : BaseValuesPayloadTraits<StaticValueType, Dyna
 	static entity::model::ControlValues unpackDynamicControlValues(Deserializer& des, std::uint16_t const numberOfValues)
 	{
 		auto valuesDynamic = DynamicValueType{};
+		valuesDynamic.getValues().reserve(numberOfValues);
 
 		for (auto i = 0u; i < numberOfValues; ++i)
 		{
@@ -129,6 +134,24 @@ struct LinearValuesPayloadTraits : BaseValuesPayloadTraits<StaticValueType, Dyna
 		}
 	}
 
+	static void packFullControlValues(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ControlValues const& staticValues, entity::model::ControlValues const& dynamicValues)
+	{
+		auto const linearStaticValues = staticValues.getValues<StaticValueType>();
+		auto const linearDynamicValues = dynamicValues.getValues<DynamicValueType>();
+		auto const& valuesStatic = linearStaticValues.getValues();
+		auto const& valuesDynamic = linearDynamicValues.getValues();
+		if (valuesStatic.size() != valuesDynamic.size())
+		{
+			throw std::invalid_argument("Static and Dynamic LINEAR values count do not match");
+		}
+
+		for (auto i = 0u; i < valuesStatic.size(); ++i)
+		{
+			auto const& valueStatic = valuesStatic[i];
+			ser << valueStatic.minimum << valueStatic.maximum << valueStatic.step << valueStatic.defaultValue << valuesDynamic[i].currentValue << valueStatic.unit << valueStatic.localizedName;
+		}
+	}
+
 	static std::tuple<entity::model::ControlValuesValidationResult, std::string> validateControlValues(entity::model::ControlValues const& staticValues, entity::model::ControlValues const& dynamicValues) noexcept
 	{
 		try
@@ -270,6 +293,20 @@ struct SelectorValuePayloadTraits : BaseValuesPayloadTraits<StaticValueType, Dyn
 		ser << selectorValue.currentValue;
 	}
 
+	static void packFullControlValues(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ControlValues const& staticValues, entity::model::ControlValues const& dynamicValues)
+	{
+		auto const selectorStaticValue = staticValues.getValues<StaticValueType>();
+		auto const selectorDynamicValue = dynamicValues.getValues<DynamicValueType>();
+
+		ser << selectorDynamicValue.currentValue;
+		ser << selectorStaticValue.defaultValue;
+		for (auto const& option : selectorStaticValue.options)
+		{
+			ser << option;
+		}
+		ser << selectorStaticValue.unit;
+	}
+
 	static std::tuple<entity::model::ControlValuesValidationResult, std::string> validateControlValues(entity::model::ControlValues const& staticValues, entity::model::ControlValues const& dynamicValues) noexcept
 	{
 		try
@@ -371,6 +408,7 @@ struct ArrayValuesPayloadTraits : BaseValuesPayloadTraits<StaticValueType, Dynam
 	static entity::model::ControlValues unpackDynamicControlValues(Deserializer& des, std::uint16_t const numberOfValues)
 	{
 		auto valuesDynamic = DynamicValueType{};
+		valuesDynamic.currentValues.reserve(numberOfValues);
 
 		for (auto i = 0u; i < numberOfValues; ++i)
 		{
@@ -399,6 +437,14 @@ struct ArrayValuesPayloadTraits : BaseValuesPayloadTraits<StaticValueType, Dynam
 		}
 	}
 
+	static void packFullControlValues(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ControlValues const& staticValues, entity::model::ControlValues const& dynamicValues)
+	{
+		auto const arrayStaticValue = staticValues.getValues<StaticValueType>();
+
+		ser << arrayStaticValue.minimum << arrayStaticValue.maximum << arrayStaticValue.step << arrayStaticValue.defaultValue << arrayStaticValue.unit << arrayStaticValue.localizedName;
+		packDynamicControlValues(ser, dynamicValues);
+	}
+
 	static std::tuple<entity::model::ControlValuesValidationResult, std::string> validateControlValues(entity::model::ControlValues const& staticValues, entity::model::ControlValues const& dynamicValues) noexcept
 	{
 		try
@@ -557,6 +603,12 @@ struct control_values_payload_traits<entity::model::ControlValueType::Type::Cont
 		ser.packBuffer(utf8Values.currentValue.data(), length);
 	}
 
+	static void packFullControlValues(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ControlValues const& /*staticValues*/, entity::model::ControlValues const& dynamicValues)
+	{
+		// No static values for CONTROL_UTF8
+		packDynamicControlValues(ser, dynamicValues);
+	}
+
 	static std::tuple<entity::model::ControlValuesValidationResult, std::string> validateControlValues(entity::model::ControlValues const& /*staticValues*/, entity::model::ControlValues const& dynamicValues) noexcept
 	{
 		try
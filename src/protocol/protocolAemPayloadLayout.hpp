@@ -0,0 +1,362 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolAemPayloadLayout.hpp
+* @author Christophe Calmejane
+* @brief Compile-time description of fixed-size AEM payloads, from which both serialization and deserialization code is generated.
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/endian.hpp"
+#include "la/avdecc/internals/serialization.hpp"
+#include "la/avdecc/internals/protocolAemAecpdu.hpp"
+#include "protocolAemPayloads.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+namespace aemPayload
+{
+namespace layout
+{
+/** Wire representation of a field type: size on the wire, and conversion from/to a (network endian) buffer. Loads and stores do not check the buffer size. */
+template<typename T, typename = void>
+struct WireTraits;
+
+/** Arithmetic types and enums */
+template<typename T>
+struct WireTraits<T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+{
+	static constexpr auto Size = sizeof(T);
+
+	static T load(std::uint8_t const* const ptr) noexcept
+	{
+		auto value = T{};
+		std::memcpy(&value, ptr, Size);
+		return AVDECC_UNPACK_TYPE(value, T);
+	}
+
+	static void store(std::uint8_t* const ptr, T const value) noexcept
+	{
+		auto const packed = AVDECC_PACK_TYPE(value, T);
+		std::memcpy(ptr, &packed, Size);
+	}
+};
+
+/** Types wrapping an arithmetic value_type (TypedDefine, UniqueIdentifier, SamplingRate, StreamFormat, ...) */
+template<typename T>
+struct WireTraits<T, std::enable_if_t<std::is_arithmetic_v<typename T::value_type> && std::is_same_v<decltype(std::declval<T const&>().getValue()), typename T::value_type> && std::is_constructible_v<T, typename T::value_type>>>
+{
+	using value_type = typename T::value_type;
+	static constexpr auto Size = sizeof(value_type);
+
+	static T load(std::uint8_t const* const ptr) noexcept
+	{
+		return T{ WireTraits<value_type>::load(ptr) };
+	}
+
+	static void store(std::uint8_t* const ptr, T const& value) noexcept
+	{
+		WireTraits<value_type>::store(ptr, value.getValue());
+	}
+};
+
+/** EnumBitfield */
+template<typename EnumType, typename Enable>
+struct WireTraits<utils::EnumBitfield<EnumType, Enable>, void>
+{
+	using underlying_value_type = typename utils::EnumBitfield<EnumType, Enable>::underlying_value_type;
+	static constexpr auto Size = sizeof(underlying_value_type);
+
+	static utils::EnumBitfield<EnumType, Enable> load(std::uint8_t const* const ptr) noexcept
+	{
+		auto value = utils::EnumBitfield<EnumType, Enable>{};
+		value.assign(WireTraits<underlying_value_type>::load(ptr));
+		return value;
+	}
+
+	static void store(std::uint8_t* const ptr, utils::EnumBitfield<EnumType, Enable> const& value) noexcept
+	{
+		WireTraits<underlying_value_type>::store(ptr, value.value());
+	}
+};
+
+/** AvdeccFixedString (without changing endianess) */
+template<>
+struct WireTraits<entity::model::AvdeccFixedString, void>
+{
+	static constexpr auto Size = entity::model::AvdeccFixedString::MaxLength;
+
+	static entity::model::AvdeccFixedString load(std::uint8_t const* const ptr) noexcept
+	{
+		return entity::model::AvdeccFixedString{ ptr, Size };
+	}
+
+	/** Loads directly into an existing string, avoiding the copy of a temporary */
+	static void load(std::uint8_t const* const ptr, entity::model::AvdeccFixedString& value) noexcept
+	{
+		auto const [data, size] = value.data();
+		std::memcpy(data, ptr, size);
+	}
+
+	static void store(std::uint8_t* const ptr, entity::model::AvdeccFixedString const& value) noexcept
+	{
+		auto const [data, size] = value.data();
+		std::memcpy(ptr, data, size);
+	}
+};
+
+/** Raw byte arrays, like MacAddress (without changing endianess) */
+template<std::size_t Length>
+struct WireTraits<std::array<std::uint8_t, Length>, void>
+{
+	static constexpr auto Size = Length;
+
+	static std::array<std::uint8_t, Length> load(std::uint8_t const* const ptr) noexcept
+	{
+		auto value = std::array<std::uint8_t, Length>{};
+		std::memcpy(value.data(), ptr, Size);
+		return value;
+	}
+
+	static void store(std::uint8_t* const ptr, std::array<std::uint8_t, Length> const& value) noexcept
+	{
+		std::memcpy(ptr, value.data(), Size);
+	}
+};
+
+/** A field of type T */
+template<typename T>
+struct Field
+{
+	using value_type = T;
+	using values_tuple = std::tuple<T>;
+	static constexpr auto IsReserved = false;
+	static constexpr auto Size = WireTraits<T>::Size;
+};
+
+/** Reserved bytes, written as 0 and ignored when read */
+template<std::size_t Length>
+struct Reserved
+{
+	using values_tuple = std::tuple<>;
+	static constexpr auto IsReserved = true;
+	static constexpr auto Size = Length;
+};
+
+namespace detail
+{
+template<typename MemberPointer>
+struct MemberPointerTraits;
+
+template<class Class, typename T>
+struct MemberPointerTraits<T Class::*>
+{
+	using class_type = Class;
+	using value_type = T;
+};
+
+template<typename... Fields>
+constexpr auto computeOffsets() noexcept
+{
+	auto const sizes = std::array<std::size_t, sizeof...(Fields)>{ Fields::Size... };
+	auto offsets = std::array<std::size_t, sizeof...(Fields)>{};
+	auto offset = std::size_t{ 0u };
+	for (auto i = std::size_t{ 0u }; i < sizes.size(); ++i)
+	{
+		offsets[i] = offset;
+		offset += sizes[i];
+	}
+	return offsets;
+}
+
+/** Indexes (in Fields) of all the non-reserved fields */
+template<typename... Fields>
+constexpr auto computeValueFields() noexcept
+{
+	auto const reserved = std::array<bool, sizeof...(Fields)>{ Fields::IsReserved... };
+	auto indexes = std::array<std::size_t, (std::size_t{ 0u } + ... + (Fields::IsReserved ? 0u : 1u))>{};
+	auto index = std::size_t{ 0u };
+	for (auto i = std::size_t{ 0u }; i < reserved.size(); ++i)
+	{
+		if (!reserved[i])
+		{
+			indexes[index] = i;
+			++index;
+		}
+	}
+	return indexes;
+}
+} // namespace detail
+
+/** A field of a structure, mapped to a data member */
+template<auto MemberPointer>
+struct Member : Field<typename detail::MemberPointerTraits<decltype(MemberPointer)>::value_type>
+{
+	static constexpr auto Pointer = MemberPointer;
+};
+
+/**
+* @brief Fixed-size payload returned as a std::tuple of all non-reserved fields.
+* @details Offsets of all fields are computed at compile time. Deserialization checks the payload length once, then loads each field from its offset.
+*/
+template<typename... Fields>
+class Layout final
+{
+	template<std::size_t Index>
+	using FieldAt = std::tuple_element_t<Index, std::tuple<Fields...>>;
+	static constexpr auto Offsets = detail::computeOffsets<Fields...>();
+	static constexpr auto ValueFields = detail::computeValueFields<Fields...>();
+
+public:
+	static constexpr auto Size = (std::size_t{ 0u } + ... + Fields::Size);
+	using Values = decltype(std::tuple_cat(std::declval<typename Fields::values_tuple>()...));
+
+	/** Unpacks all fields. ptr must point to at least Size bytes. */
+	static Values unpack(std::uint8_t const* const ptr) noexcept
+	{
+		return unpack(ptr, std::make_index_sequence<ValueFields.size()>{});
+	}
+
+	/** Unpacks all fields from the payload, throwing IncorrectPayloadSizeException if it is too small */
+	static Values deserialize(AemAecpdu::Payload const& payload)
+	{
+		auto* const commandPayload = payload.first;
+		auto const commandPayloadLength = payload.second;
+
+		if (commandPayload == nullptr || commandPayloadLength < Size) // Malformed packet
+		{
+			throw IncorrectPayloadSizeException();
+		}
+
+		return unpack(static_cast<std::uint8_t const*>(commandPayload));
+	}
+
+	/** Serializes the specified values (one per non-reserved field, in order) */
+	template<typename... Args>
+	static Serializer<Size> serialize(Args const&... values)
+	{
+		static_assert(sizeof...(Args) == ValueFields.size(), "Values count does not match the layout");
+
+		// Serializer buffer is zero-initialized, so reserved fields are already set
+		auto ser = Serializer<Size>{};
+		pack(ser.reserveBuffer(Size), std::forward_as_tuple(values...), std::make_index_sequence<sizeof...(Args)>{});
+		return ser;
+	}
+
+private:
+	template<std::size_t... Indexes>
+	static Values unpack(std::uint8_t const* const ptr, std::index_sequence<Indexes...>) noexcept
+	{
+		return Values{ WireTraits<typename FieldAt<ValueFields[Indexes]>::value_type>::load(ptr + Offsets[ValueFields[Indexes]])... };
+	}
+
+	template<typename Tuple, std::size_t... Indexes>
+	static void pack(std::uint8_t* const ptr, Tuple const& values, std::index_sequence<Indexes...>) noexcept
+	{
+		(WireTraits<typename FieldAt<ValueFields[Indexes]>::value_type>::store(ptr + Offsets[ValueFields[Indexes]], std::get<Indexes>(values)), ...);
+	}
+};
+
+/**
+* @brief Fixed-size payload mapped to the data members of a structure (using Member and Reserved fields).
+*/
+template<class Struct, typename... Fields>
+class StructLayout final
+{
+	template<std::size_t Index>
+	using FieldAt = std::tuple_element_t<Index, std::tuple<Fields...>>;
+	static constexpr auto Offsets = detail::computeOffsets<Fields...>();
+
+public:
+	static constexpr auto Size = (std::size_t{ 0u } + ... + Fields::Size);
+
+	/** Unpacks all fields into s. ptr must point to at least Size bytes. */
+	static void unpack(std::uint8_t const* const ptr, Struct& s) noexcept
+	{
+		unpack(ptr, s, std::make_index_sequence<sizeof...(Fields)>{});
+	}
+
+	/** Appends all fields of s to the serializer */
+	template<std::size_t MaximumSize>
+	static void serialize(Serializer<MaximumSize>& ser, Struct const& s)
+	{
+		// Serializer buffer is zero-initialized, so reserved fields are already set
+		pack(ser.reserveBuffer(Size), s, std::make_index_sequence<sizeof...(Fields)>{});
+	}
+
+private:
+	template<std::size_t Index>
+	static void unpackField(std::uint8_t const* const ptr, Struct& s) noexcept
+	{
+		using F = FieldAt<Index>;
+		if constexpr (!F::IsReserved)
+		{
+			using Traits = WireTraits<typename F::value_type>;
+			if constexpr (std::is_same_v<typename F::value_type, entity::model::AvdeccFixedString>)
+			{
+				Traits::load(ptr + Offsets[Index], s.*F::Pointer);
+			}
+			else
+			{
+				s.*F::Pointer = Traits::load(ptr + Offsets[Index]);
+			}
+		}
+	}
+
+	template<std::size_t Index>
+	static void packField(std::uint8_t* const ptr, Struct const& s) noexcept
+	{
+		using F = FieldAt<Index>;
+		if constexpr (!F::IsReserved)
+		{
+			WireTraits<typename F::value_type>::store(ptr + Offsets[Index], s.*F::Pointer);
+		}
+	}
+
+	template<std::size_t... Indexes>
+	static void unpack(std::uint8_t const* const ptr, Struct& s, std::index_sequence<Indexes...>) noexcept
+	{
+		(unpackField<Indexes>(ptr, s), ...);
+	}
+
+	template<std::size_t... Indexes>
+	static void pack(std::uint8_t* const ptr, Struct const& s, std::index_sequence<Indexes...>) noexcept
+	{
+		(packField<Indexes>(ptr, s), ...);
+	}
+};
+
+} // namespace layout
+} // namespace aemPayload
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
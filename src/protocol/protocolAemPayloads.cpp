@@ -26,6 +26,8 @@
 
 #include "protocolAemControlValuesPayloads.hpp"
 #include "protocolAemPayloads.hpp"
+#include "protocolAemPayloadLayout.hpp"
+#include "protocolBulkEndian.hpp"
 #include "logHelper.hpp"
 
 namespace la
@@ -63,42 +65,36 @@ static inline void checkResponsePayload(AemAecpdu::Payload const& payload, entit
 	}
 }
 
-/** ACQUIRE_ENTITY Command - IEEE1722.1-2013 Clause 7.4.1.1 */
-Serializer<AecpAemAcquireEntityCommandPayloadSize> serializeAcquireEntityCommand(AemAcquireEntityFlags const flags, UniqueIdentifier const ownerID, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
+/** AudioMapping is stored as 4 contiguous 16 bits values, in the same order than on the wire, so that whole arrays of mappings can be converted at once */
+static_assert(std::is_trivially_copyable_v<entity::model::AudioMapping> && sizeof(entity::model::AudioMapping) == entity::model::AudioMapping::size() && entity::model::AudioMapping::size() == 4 * sizeof(std::uint16_t), "AudioMapping layout does not allow bulk conversion");
+static_assert(offsetof(entity::model::AudioMapping, streamIndex) == 0 && offsetof(entity::model::AudioMapping, streamChannel) == 2 && offsetof(entity::model::AudioMapping, clusterOffset) == 4 && offsetof(entity::model::AudioMapping, clusterChannel) == 6, "AudioMapping fields are not in wire order");
+
+template<size_t MaximumSize>
+static inline void serializeAudioMappings(Serializer<MaximumSize>& ser, entity::model::AudioMappings const& mappings)
 {
-	Serializer<AecpAemAcquireEntityCommandPayloadSize> ser;
+	auto* const ptr = ser.reserveBuffer(entity::model::AudioMapping::size() * mappings.size());
+	storeBigEndianArray<sizeof(std::uint16_t)>(ptr, mappings.data(), mappings.size() * 4);
+}
 
-	ser << flags;
-	ser << ownerID;
-	ser << descriptorType << descriptorIndex;
+static inline void deserializeAudioMappings(Deserializer& des, size_t const numberOfMappings, entity::model::AudioMappings& mappings)
+{
+	auto const* const ptr = des.borrowBuffer(entity::model::AudioMapping::size() * numberOfMappings);
+	mappings.resize(numberOfMappings);
+	loadBigEndianArray<sizeof(std::uint16_t)>(mappings.data(), ptr, numberOfMappings * 4);
+}
 
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
+/** ACQUIRE_ENTITY Command - IEEE1722.1-2013 Clause 7.4.1.1 */
+using AcquireEntityCommandLayout = layout::Layout<layout::Field<AemAcquireEntityFlags>, layout::Field<UniqueIdentifier>, layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(AcquireEntityCommandLayout::Size == AecpAemAcquireEntityCommandPayloadSize, "ACQUIRE_ENTITY Command layout does not match the protocol constant");
 
-	return ser;
+Serializer<AecpAemAcquireEntityCommandPayloadSize> serializeAcquireEntityCommand(AemAcquireEntityFlags const flags, UniqueIdentifier const ownerID, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
+{
+	return AcquireEntityCommandLayout::serialize(flags, ownerID, descriptorType, descriptorIndex);
 }
 
 std::tuple<AemAcquireEntityFlags, UniqueIdentifier, entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeAcquireEntityCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemAcquireEntityCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	AemAcquireEntityFlags flags{ AemAcquireEntityFlags::None };
-	UniqueIdentifier ownerID{};
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> flags;
-	des >> ownerID;
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemAcquireEntityCommandPayloadSize, "Used bytes doesn't match protocol constant");
-
-	return std::make_tuple(flags, ownerID, descriptorType, descriptorIndex);
+	return AcquireEntityCommandLayout::deserialize(payload);
 }
 
 /** ACQUIRE_ENTITY Response - IEEE1722.1-2013 Clause 7.4.1.1 */
@@ -118,41 +114,17 @@ std::tuple<AemAcquireEntityFlags, UniqueIdentifier, entity::model::DescriptorTyp
 }
 
 /** LOCK_ENTITY Command - IEEE1722.1-2013 Clause 7.4.2.1 */
+using LockEntityCommandLayout = layout::Layout<layout::Field<AemLockEntityFlags>, layout::Field<UniqueIdentifier>, layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(LockEntityCommandLayout::Size == AecpAemLockEntityCommandPayloadSize, "LOCK_ENTITY Command layout does not match the protocol constant");
+
 Serializer<AecpAemLockEntityCommandPayloadSize> serializeLockEntityCommand(AemLockEntityFlags flags, UniqueIdentifier lockedID, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemLockEntityCommandPayloadSize> ser;
-
-	ser << flags;
-	ser << lockedID;
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return LockEntityCommandLayout::serialize(flags, lockedID, descriptorType, descriptorIndex);
 }
 
 std::tuple<AemLockEntityFlags, UniqueIdentifier, entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeLockEntityCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemLockEntityCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	AemLockEntityFlags flags{ AemLockEntityFlags::None };
-	UniqueIdentifier lockedID{};
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> flags;
-	des >> lockedID;
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemLockEntityCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(flags, lockedID, descriptorType, descriptorIndex);
+	return LockEntityCommandLayout::deserialize(payload);
 }
 
 /** LOCK_ENTITY Response - IEEE1722.1-2013 Clause 7.4.2.1 */
@@ -172,40 +144,17 @@ std::tuple<AemLockEntityFlags, UniqueIdentifier, entity::model::DescriptorType,
 }
 
 /** READ_DESCRIPTOR Command - IEEE1722.1-2013 Clause 7.4.5.1 */
+using ReadDescriptorCommandLayout = layout::Layout<layout::Field<entity::model::ConfigurationIndex>, layout::Reserved<2>, layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(ReadDescriptorCommandLayout::Size == AecpAemReadDescriptorCommandPayloadSize, "READ_DESCRIPTOR Command layout does not match the protocol constant");
+
 Serializer<AecpAemReadDescriptorCommandPayloadSize> serializeReadDescriptorCommand(entity::model::ConfigurationIndex const configurationIndex, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemReadDescriptorCommandPayloadSize> ser;
-	std::uint16_t const reserved{ 0u };
-
-	ser << configurationIndex << reserved;
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return ReadDescriptorCommandLayout::serialize(configurationIndex, descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::ConfigurationIndex, entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeReadDescriptorCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemReadDescriptorCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::ConfigurationIndex configurationIndex{ 0u };
-	std::uint16_t reserved{ 0u };
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> configurationIndex >> reserved;
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemReadDescriptorCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(configurationIndex, descriptorType, descriptorIndex);
+	return ReadDescriptorCommandLayout::deserialize(payload);
 }
 
 /** READ_DESCRIPTOR Response - IEEE1722.1-2013 Clause 7.4.5.2 */
@@ -220,20 +169,12 @@ Serializer<AemAecpdu::MaximumSendPayloadBufferLength> serializeReadDescriptorCom
 	return ser;
 }
 
+using EntityDescriptorLayout = layout::StructLayout<entity::model::EntityDescriptor, layout::Member<&entity::model::EntityDescriptor::entityID>, layout::Member<&entity::model::EntityDescriptor::entityModelID>, layout::Member<&entity::model::EntityDescriptor::entityCapabilities>, layout::Member<&entity::model::EntityDescriptor::talkerStreamSources>, layout::Member<&entity::model::EntityDescriptor::talkerCapabilities>, layout::Member<&entity::model::EntityDescriptor::listenerStreamSinks>, layout::Member<&entity::model::EntityDescriptor::listenerCapabilities>, layout::Member<&entity::model::EntityDescriptor::controllerCapabilities>, layout::Member<&entity::model::EntityDescriptor::availableIndex>, layout::Member<&entity::model::EntityDescriptor::associationID>, layout::Member<&entity::model::EntityDescriptor::entityName>, layout::Member<&entity::model::EntityDescriptor::vendorNameString>, layout::Member<&entity::model::EntityDescriptor::modelNameString>, layout::Member<&entity::model::EntityDescriptor::firmwareVersion>, layout::Member<&entity::model::EntityDescriptor::groupName>, layout::Member<&entity::model::EntityDescriptor::serialNumber>, layout::Member<&entity::model::EntityDescriptor::configurationsCount>, layout::Member<&entity::model::EntityDescriptor::currentConfiguration>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + EntityDescriptorLayout::Size == AecpAemReadEntityDescriptorResponsePayloadSize, "ENTITY Descriptor layout does not match the protocol constant");
+
 void serializeReadEntityDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::EntityDescriptor const& entityDescriptor)
 {
-	ser << entityDescriptor.entityID << entityDescriptor.entityModelID << entityDescriptor.entityCapabilities;
-	ser << entityDescriptor.talkerStreamSources << entityDescriptor.talkerCapabilities;
-	ser << entityDescriptor.listenerStreamSinks << entityDescriptor.listenerCapabilities;
-	ser << entityDescriptor.controllerCapabilities;
-	ser << entityDescriptor.availableIndex;
-	ser << entityDescriptor.associationID;
-	ser << entityDescriptor.entityName;
-	ser << entityDescriptor.vendorNameString << entityDescriptor.modelNameString;
-	ser << entityDescriptor.firmwareVersion;
-	ser << entityDescriptor.groupName;
-	ser << entityDescriptor.serialNumber;
-	ser << entityDescriptor.configurationsCount << entityDescriptor.currentConfiguration;
+	EntityDescriptorLayout::serialize(ser, entityDescriptor);
 }
 
 void serializeReadConfigurationDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ConfigurationDescriptor const& configurationDescriptor)
@@ -255,25 +196,13 @@ void serializeReadConfigurationDescriptorResponse(Serializer<AemAecpdu::MaximumS
 
 std::tuple<size_t, entity::model::ConfigurationIndex, entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeReadDescriptorCommonResponse(entity::LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
 	checkResponsePayload(payload, status, AecpAemReadDescriptorCommandPayloadSize, AecpAemReadCommonDescriptorResponsePayloadSize);
 
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::ConfigurationIndex configurationIndex{ 0u };
-	std::uint16_t reserved{ 0u };
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	// Read common READ_DESCRIPTOR Response fields
-	des >> configurationIndex >> reserved;
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemReadCommonDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
+	// Common READ_DESCRIPTOR Response fields are the same as READ_DESCRIPTOR Command
+	static_assert(AecpAemReadCommonDescriptorResponsePayloadSize == ReadDescriptorCommandLayout::Size, "Common READ_DESCRIPTOR Response no longer the same as READ_DESCRIPTOR Command");
+	auto const [configurationIndex, descriptorType, descriptorIndex] = ReadDescriptorCommandLayout::unpack(static_cast<std::uint8_t const*>(payload.first));
 
-	return std::make_tuple(des.usedBytes(), configurationIndex, descriptorType, descriptorIndex);
+	return std::make_tuple(ReadDescriptorCommandLayout::Size, configurationIndex, descriptorType, descriptorIndex);
 }
 
 entity::model::EntityDescriptor deserializeReadEntityDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
@@ -290,26 +219,13 @@ entity::model::EntityDescriptor deserializeReadEntityDescriptorResponse(AemAecpd
 			throw IncorrectPayloadSizeException();
 
 		// Check entity descriptor payload - IEEE1722.1-2013 Clause 7.2.1
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> entityDescriptor.entityID >> entityDescriptor.entityModelID >> entityDescriptor.entityCapabilities;
-		des >> entityDescriptor.talkerStreamSources >> entityDescriptor.talkerCapabilities;
-		des >> entityDescriptor.listenerStreamSinks >> entityDescriptor.listenerCapabilities;
-		des >> entityDescriptor.controllerCapabilities;
-		des >> entityDescriptor.availableIndex;
-		des >> entityDescriptor.associationID;
-		des >> entityDescriptor.entityName;
-		des >> entityDescriptor.vendorNameString >> entityDescriptor.modelNameString;
-		des >> entityDescriptor.firmwareVersion;
-		des >> entityDescriptor.groupName;
-		des >> entityDescriptor.serialNumber;
-		des >> entityDescriptor.configurationsCount >> entityDescriptor.currentConfiguration;
-
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadEntityDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		EntityDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, entityDescriptor);
 
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - EntityDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_ENTITY_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_ENTITY_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
@@ -373,6 +289,39 @@ entity::model::ConfigurationDescriptor deserializeReadConfigurationDescriptorRes
 	return configurationDescriptor;
 }
 
+void serializeReadAudioUnitDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::AudioUnitDescriptor const& audioUnitDescriptor)
+{
+	auto const numberOfSamplingRates = static_cast<std::uint16_t>(audioUnitDescriptor.samplingRates.size());
+	// Sampling rates are right after the fixed part of the descriptor (offset is from the base of the descriptor, not from the base of our serializer buffer)
+	auto const samplingRatesOffset = static_cast<std::uint16_t>(AecpAemReadAudioUnitDescriptorResponsePayloadMinSize - PayloadBufferOffset);
+
+	ser << audioUnitDescriptor.objectName;
+	ser << audioUnitDescriptor.localizedDescription << audioUnitDescriptor.clockDomainIndex;
+	ser << audioUnitDescriptor.numberOfStreamInputPorts << audioUnitDescriptor.baseStreamInputPort;
+	ser << audioUnitDescriptor.numberOfStreamOutputPorts << audioUnitDescriptor.baseStreamOutputPort;
+	ser << audioUnitDescriptor.numberOfExternalInputPorts << audioUnitDescriptor.baseExternalInputPort;
+	ser << audioUnitDescriptor.numberOfExternalOutputPorts << audioUnitDescriptor.baseExternalOutputPort;
+	ser << audioUnitDescriptor.numberOfInternalInputPorts << audioUnitDescriptor.baseInternalInputPort;
+	ser << audioUnitDescriptor.numberOfInternalOutputPorts << audioUnitDescriptor.baseInternalOutputPort;
+	ser << audioUnitDescriptor.numberOfControls << audioUnitDescriptor.baseControl;
+	ser << audioUnitDescriptor.numberOfSignalSelectors << audioUnitDescriptor.baseSignalSelector;
+	ser << audioUnitDescriptor.numberOfMixers << audioUnitDescriptor.baseMixer;
+	ser << audioUnitDescriptor.numberOfMatrices << audioUnitDescriptor.baseMatrix;
+	ser << audioUnitDescriptor.numberOfSplitters << audioUnitDescriptor.baseSplitter;
+	ser << audioUnitDescriptor.numberOfCombiners << audioUnitDescriptor.baseCombiner;
+	ser << audioUnitDescriptor.numberOfDemultiplexers << audioUnitDescriptor.baseDemultiplexer;
+	ser << audioUnitDescriptor.numberOfMultiplexers << audioUnitDescriptor.baseMultiplexer;
+	ser << audioUnitDescriptor.numberOfTranscoders << audioUnitDescriptor.baseTranscoder;
+	ser << audioUnitDescriptor.numberOfControlBlocks << audioUnitDescriptor.baseControlBlock;
+	ser << audioUnitDescriptor.currentSamplingRate << samplingRatesOffset << numberOfSamplingRates;
+	AVDECC_ASSERT(ser.usedBytes() == AecpAemReadAudioUnitDescriptorResponsePayloadMinSize, "Packed bytes doesn't match protocol constant");
+
+	for (auto const& samplingRate : audioUnitDescriptor.samplingRates)
+	{
+		ser << samplingRate;
+	}
+}
+
 entity::model::AudioUnitDescriptor deserializeReadAudioUnitDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::AudioUnitDescriptor audioUnitDescriptor{};
@@ -425,12 +374,11 @@ entity::model::AudioUnitDescriptor deserializeReadAudioUnitDescriptorResponse(Ae
 		des.setPosition(samplingRatesOffset);
 
 		// Let's loop over the sampling rates
-		for (auto index = 0u; index < numberOfSamplingRates; ++index)
-		{
-			entity::model::SamplingRate rate;
-			des >> rate;
-			audioUnitDescriptor.samplingRates.insert(rate);
-		}
+		forEachBigEndianValue<sizeof(entity::model::SamplingRate::value_type)>(des.borrowBuffer(sizeof(entity::model::SamplingRate::value_type) * numberOfSamplingRates), numberOfSamplingRates,
+			[&audioUnitDescriptor](auto const rate)
+			{
+				audioUnitDescriptor.samplingRates.insert(entity::model::SamplingRate{ rate });
+			});
 
 		if (des.remaining() != 0)
 		{
@@ -441,6 +389,52 @@ entity::model::AudioUnitDescriptor deserializeReadAudioUnitDescriptorResponse(Ae
 	return audioUnitDescriptor;
 }
 
+void serializeReadStreamDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::StreamDescriptor const& streamDescriptor)
+{
+	auto const numberOfFormats = static_cast<std::uint16_t>(streamDescriptor.formats.size());
+	// Formats are right after the fixed part of the descriptor (offset is from the base of the descriptor, not from the base of our serializer buffer)
+	auto formatsOffset = static_cast<std::uint16_t>(AecpAemReadStreamDescriptorResponsePayloadMinSize - PayloadBufferOffset);
+#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
+	// Redundant fields (AVnu Alliance 'Network Redundancy' extension) are only added if the stream is redundant, between the fixed part and the formats
+	auto const numberOfRedundantStreams = static_cast<std::uint16_t>(streamDescriptor.redundantStreams.size());
+	auto redundantOffset = std::uint16_t{ 0u };
+	if (numberOfRedundantStreams != 0u)
+	{
+		formatsOffset += static_cast<std::uint16_t>(sizeof(redundantOffset) + sizeof(numberOfRedundantStreams));
+		redundantOffset = static_cast<std::uint16_t>(formatsOffset + sizeof(entity::model::StreamFormat::value_type) * numberOfFormats);
+	}
+#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
+
+	ser << streamDescriptor.objectName;
+	ser << streamDescriptor.localizedDescription << streamDescriptor.clockDomainIndex << streamDescriptor.streamFlags;
+	ser << streamDescriptor.currentFormat << formatsOffset << numberOfFormats;
+	ser << streamDescriptor.backupTalkerEntityID_0 << streamDescriptor.backupTalkerUniqueID_0;
+	ser << streamDescriptor.backupTalkerEntityID_1 << streamDescriptor.backupTalkerUniqueID_1;
+	ser << streamDescriptor.backupTalkerEntityID_2 << streamDescriptor.backupTalkerUniqueID_2;
+	ser << streamDescriptor.backedupTalkerEntityID << streamDescriptor.backedupTalkerUnique;
+	ser << streamDescriptor.avbInterfaceIndex << streamDescriptor.bufferLength;
+	AVDECC_ASSERT(ser.usedBytes() == AecpAemReadStreamDescriptorResponsePayloadMinSize, "Packed bytes doesn't match protocol constant");
+
+#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
+	if (numberOfRedundantStreams != 0u)
+	{
+		ser << redundantOffset << numberOfRedundantStreams;
+	}
+#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
+
+	for (auto const& format : streamDescriptor.formats)
+	{
+		ser << format;
+	}
+
+#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
+	for (auto const redundantStreamIndex : streamDescriptor.redundantStreams)
+	{
+		ser << redundantStreamIndex;
+	}
+#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
+}
+
 entity::model::StreamDescriptor deserializeReadStreamDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::StreamDescriptor streamDescriptor{};
@@ -500,12 +494,11 @@ entity::model::StreamDescriptor deserializeReadStreamDescriptorResponse(AemAecpd
 		des.setPosition(formatsOffset);
 
 		// Let's loop over the formats
-		for (auto index = 0u; index < numberOfFormats; ++index)
-		{
-			entity::model::StreamFormat format{};
-			des >> format;
-			streamDescriptor.formats.insert(format);
-		}
+		forEachBigEndianValue<sizeof(entity::model::StreamFormat::value_type)>(des.borrowBuffer(sizeof(entity::model::StreamFormat::value_type) * numberOfFormats), numberOfFormats,
+			[&streamDescriptor](auto const format)
+			{
+				streamDescriptor.formats.insert(entity::model::StreamFormat{ format });
+			});
 
 #ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
 		// Read redundant streams association
@@ -517,12 +510,11 @@ entity::model::StreamDescriptor deserializeReadStreamDescriptorResponse(AemAecpd
 			des.setPosition(redundantOffset);
 
 			// Let's loop over the redundant streams association
-			for (auto index = 0u; index < numberOfRedundantStreams; ++index)
-			{
-				entity::model::StreamIndex redundantStreamIndex;
-				des >> redundantStreamIndex;
-				streamDescriptor.redundantStreams.insert(redundantStreamIndex);
-			}
+			forEachBigEndianValue<sizeof(entity::model::StreamIndex)>(des.borrowBuffer(sizeof(entity::model::StreamIndex) * numberOfRedundantStreams), numberOfRedundantStreams,
+				[&streamDescriptor](auto const redundantStreamIndex)
+				{
+					streamDescriptor.redundantStreams.insert(entity::model::StreamIndex{ redundantStreamIndex });
+				});
 		}
 #endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
 
@@ -535,6 +527,14 @@ entity::model::StreamDescriptor deserializeReadStreamDescriptorResponse(AemAecpd
 	return streamDescriptor;
 }
 
+using JackDescriptorLayout = layout::StructLayout<entity::model::JackDescriptor, layout::Member<&entity::model::JackDescriptor::objectName>, layout::Member<&entity::model::JackDescriptor::localizedDescription>, layout::Member<&entity::model::JackDescriptor::jackFlags>, layout::Member<&entity::model::JackDescriptor::jackType>, layout::Member<&entity::model::JackDescriptor::numberOfControls>, layout::Member<&entity::model::JackDescriptor::baseControl>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + JackDescriptorLayout::Size == AecpAemReadJackDescriptorResponsePayloadSize, "JACK Descriptor layout does not match the protocol constant");
+
+void serializeReadJackDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::JackDescriptor const& jackDescriptor)
+{
+	JackDescriptorLayout::serialize(ser, jackDescriptor);
+}
+
 entity::model::JackDescriptor deserializeReadJackDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::JackDescriptor jackDescriptor{};
@@ -549,24 +549,27 @@ entity::model::JackDescriptor deserializeReadJackDescriptorResponse(AemAecpdu::P
 			throw IncorrectPayloadSizeException();
 
 		// Check jack descriptor payload - IEEE1722.1-2013 Clause 7.2.7
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> jackDescriptor.objectName;
-		des >> jackDescriptor.localizedDescription;
-		des >> jackDescriptor.jackFlags >> jackDescriptor.jackType;
-		des >> jackDescriptor.numberOfControls >> jackDescriptor.baseControl;
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		JackDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, jackDescriptor);
 
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadJackDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - JackDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_JACK_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_JACK_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
 	return jackDescriptor;
 }
 
+using AvbInterfaceDescriptorLayout = layout::StructLayout<entity::model::AvbInterfaceDescriptor, layout::Member<&entity::model::AvbInterfaceDescriptor::objectName>, layout::Member<&entity::model::AvbInterfaceDescriptor::localizedDescription>, layout::Member<&entity::model::AvbInterfaceDescriptor::macAddress>, layout::Member<&entity::model::AvbInterfaceDescriptor::interfaceFlags>, layout::Member<&entity::model::AvbInterfaceDescriptor::clockIdentity>, layout::Member<&entity::model::AvbInterfaceDescriptor::priority1>, layout::Member<&entity::model::AvbInterfaceDescriptor::clockClass>, layout::Member<&entity::model::AvbInterfaceDescriptor::offsetScaledLogVariance>, layout::Member<&entity::model::AvbInterfaceDescriptor::clockAccuracy>, layout::Member<&entity::model::AvbInterfaceDescriptor::priority2>, layout::Member<&entity::model::AvbInterfaceDescriptor::domainNumber>, layout::Member<&entity::model::AvbInterfaceDescriptor::logSyncInterval>, layout::Member<&entity::model::AvbInterfaceDescriptor::logAnnounceInterval>, layout::Member<&entity::model::AvbInterfaceDescriptor::logPDelayInterval>, layout::Member<&entity::model::AvbInterfaceDescriptor::portNumber>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + AvbInterfaceDescriptorLayout::Size == AecpAemReadAvbInterfaceDescriptorResponsePayloadSize, "AVB_INTERFACE Descriptor layout does not match the protocol constant");
+
+void serializeReadAvbInterfaceDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::AvbInterfaceDescriptor const& avbInterfaceDescriptor)
+{
+	AvbInterfaceDescriptorLayout::serialize(ser, avbInterfaceDescriptor);
+}
+
 entity::model::AvbInterfaceDescriptor deserializeReadAvbInterfaceDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::AvbInterfaceDescriptor avbInterfaceDescriptor{};
@@ -581,30 +584,27 @@ entity::model::AvbInterfaceDescriptor deserializeReadAvbInterfaceDescriptorRespo
 			throw IncorrectPayloadSizeException();
 
 		// Check avb interface descriptor payload - IEEE1722.1-2013 Clause 7.2.8
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> avbInterfaceDescriptor.objectName;
-		des >> avbInterfaceDescriptor.localizedDescription;
-		des >> avbInterfaceDescriptor.macAddress;
-		des >> avbInterfaceDescriptor.interfaceFlags;
-		des >> avbInterfaceDescriptor.clockIdentity;
-		des >> avbInterfaceDescriptor.priority1 >> avbInterfaceDescriptor.clockClass;
-		des >> avbInterfaceDescriptor.offsetScaledLogVariance >> avbInterfaceDescriptor.clockAccuracy;
-		des >> avbInterfaceDescriptor.priority2 >> avbInterfaceDescriptor.domainNumber;
-		des >> avbInterfaceDescriptor.logSyncInterval >> avbInterfaceDescriptor.logAnnounceInterval >> avbInterfaceDescriptor.logPDelayInterval;
-		des >> avbInterfaceDescriptor.portNumber;
-
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadAvbInterfaceDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		AvbInterfaceDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, avbInterfaceDescriptor);
 
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - AvbInterfaceDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_AVB_INTERFACE_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_AVB_INTERFACE_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
 	return avbInterfaceDescriptor;
 }
 
+using ClockSourceDescriptorLayout = layout::StructLayout<entity::model::ClockSourceDescriptor, layout::Member<&entity::model::ClockSourceDescriptor::objectName>, layout::Member<&entity::model::ClockSourceDescriptor::localizedDescription>, layout::Member<&entity::model::ClockSourceDescriptor::clockSourceFlags>, layout::Member<&entity::model::ClockSourceDescriptor::clockSourceType>, layout::Member<&entity::model::ClockSourceDescriptor::clockSourceIdentifier>, layout::Member<&entity::model::ClockSourceDescriptor::clockSourceLocationType>, layout::Member<&entity::model::ClockSourceDescriptor::clockSourceLocationIndex>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + ClockSourceDescriptorLayout::Size == AecpAemReadClockSourceDescriptorResponsePayloadSize, "CLOCK_SOURCE Descriptor layout does not match the protocol constant");
+
+void serializeReadClockSourceDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ClockSourceDescriptor const& clockSourceDescriptor)
+{
+	ClockSourceDescriptorLayout::serialize(ser, clockSourceDescriptor);
+}
+
 entity::model::ClockSourceDescriptor deserializeReadClockSourceDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::ClockSourceDescriptor clockSourceDescriptor{};
@@ -619,25 +619,29 @@ entity::model::ClockSourceDescriptor deserializeReadClockSourceDescriptorRespons
 			throw IncorrectPayloadSizeException();
 
 		// Check clock source descriptor payload - IEEE1722.1-2013 Clause 7.2.9
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> clockSourceDescriptor.objectName;
-		des >> clockSourceDescriptor.localizedDescription;
-		des >> clockSourceDescriptor.clockSourceFlags >> clockSourceDescriptor.clockSourceType;
-		des >> clockSourceDescriptor.clockSourceIdentifier;
-		des >> clockSourceDescriptor.clockSourceLocationType >> clockSourceDescriptor.clockSourceLocationIndex;
-
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadClockSourceDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		ClockSourceDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, clockSourceDescriptor);
 
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - ClockSourceDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_CLOCK_SOURCE_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_CLOCK_SOURCE_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
 	return clockSourceDescriptor;
 }
 
+void serializeReadMemoryObjectDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::MemoryObjectDescriptor const& memoryObjectDescriptor)
+{
+	ser << memoryObjectDescriptor.objectName;
+	ser << memoryObjectDescriptor.localizedDescription;
+	ser << memoryObjectDescriptor.memoryObjectType;
+	ser << memoryObjectDescriptor.targetDescriptorType << memoryObjectDescriptor.targetDescriptorIndex;
+	ser << memoryObjectDescriptor.startAddress << memoryObjectDescriptor.maximumLength << memoryObjectDescriptor.length;
+	AVDECC_ASSERT(ser.usedBytes() == AecpAemReadMemoryObjectDescriptorResponsePayloadSize, "Packed bytes doesn't match protocol constant");
+}
+
 entity::model::MemoryObjectDescriptor deserializeReadMemoryObjectDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::MemoryObjectDescriptor memoryObjectDescriptor{};
@@ -672,6 +676,14 @@ entity::model::MemoryObjectDescriptor deserializeReadMemoryObjectDescriptorRespo
 	return memoryObjectDescriptor;
 }
 
+using LocaleDescriptorLayout = layout::StructLayout<entity::model::LocaleDescriptor, layout::Member<&entity::model::LocaleDescriptor::localeID>, layout::Member<&entity::model::LocaleDescriptor::numberOfStringDescriptors>, layout::Member<&entity::model::LocaleDescriptor::baseStringDescriptorIndex>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + LocaleDescriptorLayout::Size == AecpAemReadLocaleDescriptorResponsePayloadSize, "LOCALE Descriptor layout does not match the protocol constant");
+
+void serializeReadLocaleDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::LocaleDescriptor const& localeDescriptor)
+{
+	LocaleDescriptorLayout::serialize(ser, localeDescriptor);
+}
+
 entity::model::LocaleDescriptor deserializeReadLocaleDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::LocaleDescriptor localeDescriptor{};
@@ -686,22 +698,28 @@ entity::model::LocaleDescriptor deserializeReadLocaleDescriptorResponse(AemAecpd
 			throw IncorrectPayloadSizeException();
 
 		// Check locale descriptor payload - IEEE1722.1-2013 Clause 7.2.11
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> localeDescriptor.localeID;
-		des >> localeDescriptor.numberOfStringDescriptors >> localeDescriptor.baseStringDescriptorIndex;
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		LocaleDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, localeDescriptor);
 
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadLocaleDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - LocaleDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_LOCALE_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_LOCALE_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
 	return localeDescriptor;
 }
 
+void serializeReadStringsDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::StringsDescriptor const& stringsDescriptor)
+{
+	for (auto const& str : stringsDescriptor.strings)
+	{
+		ser << str;
+	}
+	AVDECC_ASSERT(ser.usedBytes() == AecpAemReadStringsDescriptorResponsePayloadSize, "Packed bytes doesn't match protocol constant");
+}
+
 entity::model::StringsDescriptor deserializeReadStringsDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::StringsDescriptor stringsDescriptor{};
@@ -734,6 +752,14 @@ entity::model::StringsDescriptor deserializeReadStringsDescriptorResponse(AemAec
 	return stringsDescriptor;
 }
 
+using StreamPortDescriptorLayout = layout::StructLayout<entity::model::StreamPortDescriptor, layout::Member<&entity::model::StreamPortDescriptor::clockDomainIndex>, layout::Member<&entity::model::StreamPortDescriptor::portFlags>, layout::Member<&entity::model::StreamPortDescriptor::numberOfControls>, layout::Member<&entity::model::StreamPortDescriptor::baseControl>, layout::Member<&entity::model::StreamPortDescriptor::numberOfClusters>, layout::Member<&entity::model::StreamPortDescriptor::baseCluster>, layout::Member<&entity::model::StreamPortDescriptor::numberOfMaps>, layout::Member<&entity::model::StreamPortDescriptor::baseMap>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + StreamPortDescriptorLayout::Size == AecpAemReadStreamPortDescriptorResponsePayloadSize, "STREAM_PORT Descriptor layout does not match the protocol constant");
+
+void serializeReadStreamPortDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::StreamPortDescriptor const& streamPortDescriptor)
+{
+	StreamPortDescriptorLayout::serialize(ser, streamPortDescriptor);
+}
+
 entity::model::StreamPortDescriptor deserializeReadStreamPortDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::StreamPortDescriptor streamPortDescriptor{};
@@ -748,24 +774,27 @@ entity::model::StreamPortDescriptor deserializeReadStreamPortDescriptorResponse(
 			throw IncorrectPayloadSizeException();
 
 		// Check stream port descriptor payload - IEEE1722.1-2013 Clause 7.2.13
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> streamPortDescriptor.clockDomainIndex >> streamPortDescriptor.portFlags;
-		des >> streamPortDescriptor.numberOfControls >> streamPortDescriptor.baseControl;
-		des >> streamPortDescriptor.numberOfClusters >> streamPortDescriptor.baseCluster;
-		des >> streamPortDescriptor.numberOfMaps >> streamPortDescriptor.baseMap;
-
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadStreamPortDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		StreamPortDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, streamPortDescriptor);
 
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - StreamPortDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_STREAM_PORT_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_STREAM_PORT_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
 	return streamPortDescriptor;
 }
 
+using ExternalPortDescriptorLayout = layout::StructLayout<entity::model::ExternalPortDescriptor, layout::Member<&entity::model::ExternalPortDescriptor::clockDomainIndex>, layout::Member<&entity::model::ExternalPortDescriptor::portFlags>, layout::Member<&entity::model::ExternalPortDescriptor::numberOfControls>, layout::Member<&entity::model::ExternalPortDescriptor::baseControl>, layout::Member<&entity::model::ExternalPortDescriptor::signalType>, layout::Member<&entity::model::ExternalPortDescriptor::signalIndex>, layout::Member<&entity::model::ExternalPortDescriptor::signalOutput>, layout::Member<&entity::model::ExternalPortDescriptor::blockLatency>, layout::Member<&entity::model::ExternalPortDescriptor::jackIndex>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + ExternalPortDescriptorLayout::Size == AecpAemReadExternalPortDescriptorResponsePayloadSize, "EXTERNAL_PORT Descriptor layout does not match the protocol constant");
+
+void serializeReadExternalPortDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ExternalPortDescriptor const& externalPortDescriptor)
+{
+	ExternalPortDescriptorLayout::serialize(ser, externalPortDescriptor);
+}
+
 entity::model::ExternalPortDescriptor deserializeReadExternalPortDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::ExternalPortDescriptor externalPortDescriptor{};
@@ -780,24 +809,27 @@ entity::model::ExternalPortDescriptor deserializeReadExternalPortDescriptorRespo
 			throw IncorrectPayloadSizeException();
 
 		// Check external port descriptor payload - IEEE1722.1-2013 Clause 7.2.14
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> externalPortDescriptor.clockDomainIndex >> externalPortDescriptor.portFlags;
-		des >> externalPortDescriptor.numberOfControls >> externalPortDescriptor.baseControl;
-		des >> externalPortDescriptor.signalType >> externalPortDescriptor.signalIndex >> externalPortDescriptor.signalOutput;
-		des >> externalPortDescriptor.blockLatency >> externalPortDescriptor.jackIndex;
-
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadExternalPortDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		ExternalPortDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, externalPortDescriptor);
 
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - ExternalPortDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_EXTERNAL_PORT_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_EXTERNAL_PORT_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
 	return externalPortDescriptor;
 }
 
+using InternalPortDescriptorLayout = layout::StructLayout<entity::model::InternalPortDescriptor, layout::Member<&entity::model::InternalPortDescriptor::clockDomainIndex>, layout::Member<&entity::model::InternalPortDescriptor::portFlags>, layout::Member<&entity::model::InternalPortDescriptor::numberOfControls>, layout::Member<&entity::model::InternalPortDescriptor::baseControl>, layout::Member<&entity::model::InternalPortDescriptor::signalType>, layout::Member<&entity::model::InternalPortDescriptor::signalIndex>, layout::Member<&entity::model::InternalPortDescriptor::signalOutput>, layout::Member<&entity::model::InternalPortDescriptor::blockLatency>, layout::Member<&entity::model::InternalPortDescriptor::internalIndex>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + InternalPortDescriptorLayout::Size == AecpAemReadInternalPortDescriptorResponsePayloadSize, "INTERNAL_PORT Descriptor layout does not match the protocol constant");
+
+void serializeReadInternalPortDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::InternalPortDescriptor const& internalPortDescriptor)
+{
+	InternalPortDescriptorLayout::serialize(ser, internalPortDescriptor);
+}
+
 entity::model::InternalPortDescriptor deserializeReadInternalPortDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::InternalPortDescriptor internalPortDescriptor{};
@@ -812,24 +844,27 @@ entity::model::InternalPortDescriptor deserializeReadInternalPortDescriptorRespo
 			throw IncorrectPayloadSizeException();
 
 		// Check internal port descriptor payload - IEEE1722.1-2013 Clause 7.2.15
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> internalPortDescriptor.clockDomainIndex >> internalPortDescriptor.portFlags;
-		des >> internalPortDescriptor.numberOfControls >> internalPortDescriptor.baseControl;
-		des >> internalPortDescriptor.signalType >> internalPortDescriptor.signalIndex >> internalPortDescriptor.signalOutput;
-		des >> internalPortDescriptor.blockLatency >> internalPortDescriptor.internalIndex;
-
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadInternalPortDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		InternalPortDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, internalPortDescriptor);
 
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - InternalPortDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_INTERNAL_PORT_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_INTERNAL_PORT_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
 	return internalPortDescriptor;
 }
 
+using AudioClusterDescriptorLayout = layout::StructLayout<entity::model::AudioClusterDescriptor, layout::Member<&entity::model::AudioClusterDescriptor::objectName>, layout::Member<&entity::model::AudioClusterDescriptor::localizedDescription>, layout::Member<&entity::model::AudioClusterDescriptor::signalType>, layout::Member<&entity::model::AudioClusterDescriptor::signalIndex>, layout::Member<&entity::model::AudioClusterDescriptor::signalOutput>, layout::Member<&entity::model::AudioClusterDescriptor::pathLatency>, layout::Member<&entity::model::AudioClusterDescriptor::blockLatency>, layout::Member<&entity::model::AudioClusterDescriptor::channelCount>, layout::Member<&entity::model::AudioClusterDescriptor::format>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + AudioClusterDescriptorLayout::Size == AecpAemReadAudioClusterDescriptorResponsePayloadSize, "AUDIO_CLUSTER Descriptor layout does not match the protocol constant");
+
+void serializeReadAudioClusterDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::AudioClusterDescriptor const& audioClusterDescriptor)
+{
+	AudioClusterDescriptorLayout::serialize(ser, audioClusterDescriptor);
+}
+
 entity::model::AudioClusterDescriptor deserializeReadAudioClusterDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::AudioClusterDescriptor audioClusterDescriptor{};
@@ -844,25 +879,31 @@ entity::model::AudioClusterDescriptor deserializeReadAudioClusterDescriptorRespo
 			throw IncorrectPayloadSizeException();
 
 		// Check audio cluster descriptor payload - IEEE1722.1-2013 Clause 7.2.16
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> audioClusterDescriptor.objectName;
-		des >> audioClusterDescriptor.localizedDescription;
-		des >> audioClusterDescriptor.signalType >> audioClusterDescriptor.signalIndex >> audioClusterDescriptor.signalOutput;
-		des >> audioClusterDescriptor.pathLatency >> audioClusterDescriptor.blockLatency;
-		des >> audioClusterDescriptor.channelCount >> audioClusterDescriptor.format;
-
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadAudioClusterDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		AudioClusterDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, audioClusterDescriptor);
 
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - AudioClusterDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_AUDIO_CLUSTER_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_AUDIO_CLUSTER_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
 	return audioClusterDescriptor;
 }
 
+void serializeReadAudioMapDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::AudioMapDescriptor const& audioMapDescriptor)
+{
+	// Mappings are right after the fixed part of the descriptor (offset is from the base of the descriptor, not from the base of our serializer buffer)
+	auto const mappingsOffset = static_cast<std::uint16_t>(AecpAemReadAudioMapDescriptorResponsePayloadMinSize - PayloadBufferOffset);
+	auto const numberOfMappings = static_cast<std::uint16_t>(audioMapDescriptor.mappings.size());
+
+	ser << mappingsOffset << numberOfMappings;
+	AVDECC_ASSERT(ser.usedBytes() == AecpAemReadAudioMapDescriptorResponsePayloadMinSize, "Packed bytes doesn't match protocol constant");
+
+	serializeAudioMappings(ser, audioMapDescriptor.mappings);
+}
+
 entity::model::AudioMapDescriptor deserializeReadAudioMapDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::AudioMapDescriptor audioMapDescriptor{};
@@ -896,13 +937,8 @@ entity::model::AudioMapDescriptor deserializeReadAudioMapDescriptorResponse(AemA
 			throw IncorrectPayloadSizeException();
 		des.setPosition(mappingsOffset);
 
-		// Let's loop over the mappings
-		for (auto index = 0u; index < numberOfMappings; ++index)
-		{
-			entity::model::AudioMapping mapping;
-			des >> mapping.streamIndex >> mapping.streamChannel >> mapping.clusterOffset >> mapping.clusterChannel;
-			audioMapDescriptor.mappings.push_back(mapping);
-		}
+		// Unpack all the mappings at once
+		deserializeAudioMappings(des, numberOfMappings, audioMapDescriptor.mappings);
 
 		if (des.remaining() != 0)
 		{
@@ -956,6 +992,90 @@ static inline void createUnpackFullControlValuesDispatchTable(std::unordered_map
 	dispatchTable[entity::model::ControlValueType::Type::ControlUtf8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlUtf8>::unpackFullControlValues;
 }
 
+static inline void createPackFullControlValuesDispatchTable(std::unordered_map<entity::model::ControlValueType::Type, std::function<void(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>&, entity::model::ControlValues const&, entity::model::ControlValues const&)>>& dispatchTable)
+{
+	/** Linear Values - IEEE1722.1-2013 Clause 7.3.5.2.1 */
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt8>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt8>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt16>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt16>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt32>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt32>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearInt64>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearUInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearUInt64>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearFloat] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearFloat>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlLinearDouble] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlLinearDouble>::packFullControlValues;
+
+	/** Selector Value - IEEE1722.1-2013 Clause 7.3.5.2.2 */
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt8>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt8>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt16>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt16>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt32>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt32>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorInt64>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorUInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorUInt64>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorFloat] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorFloat>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorDouble] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorDouble>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlSelectorString] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlSelectorString>::packFullControlValues;
+
+	/** Array Values - IEEE1722.1-2013 Clause 7.3.5.2.3 */
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt8>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt8>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt16>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt16] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt16>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt32>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt32] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt32>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayInt64>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayUInt64] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayUInt64>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayFloat] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayFloat>::packFullControlValues;
+	dispatchTable[entity::model::ControlValueType::Type::ControlArrayDouble] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlArrayDouble>::packFullControlValues;
+
+	/** UTF-8 String Value - IEEE1722.1-2013 Clause 7.3.5.2.4 */
+	dispatchTable[entity::model::ControlValueType::Type::ControlUtf8] = control_values_payload_traits<entity::model::ControlValueType::Type::ControlUtf8>::packFullControlValues;
+}
+
+void serializeReadControlDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ControlDescriptor const& controlDescriptor)
+{
+	static auto s_Dispatch = std::unordered_map<entity::model::ControlValueType::Type, std::function<void(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>&, entity::model::ControlValues const&, entity::model::ControlValues const&)>>{};
+
+	if (s_Dispatch.empty())
+	{
+		// Create the dispatch table
+		createPackFullControlValuesDispatchTable(s_Dispatch);
+	}
+
+	// Values are right after the fixed part of the descriptor (offset is from the base of the descriptor, not from the base of our serializer buffer)
+	auto const valuesOffset = static_cast<std::uint16_t>(AecpAemReadControlDescriptorResponsePayloadMinSize - PayloadBufferOffset);
+
+	ser << controlDescriptor.objectName << controlDescriptor.localizedDescription;
+	ser << controlDescriptor.blockLatency << controlDescriptor.controlLatency << controlDescriptor.controlDomain;
+	ser << controlDescriptor.controlValueType << controlDescriptor.controlType << controlDescriptor.resetTime;
+	ser << valuesOffset << controlDescriptor.numberOfValues;
+	ser << controlDescriptor.signalType << controlDescriptor.signalIndex << controlDescriptor.signalOutput;
+	AVDECC_ASSERT(ser.usedBytes() == AecpAemReadControlDescriptorResponsePayloadMinSize, "Packed bytes doesn't match protocol constant");
+
+	// Pack Control Values based on ControlValueType
+	auto const valueType = controlDescriptor.controlValueType.getType();
+	if (auto const& it = s_Dispatch.find(valueType); it != s_Dispatch.end())
+	{
+		try
+		{
+			it->second(ser, controlDescriptor.valuesStatic, controlDescriptor.valuesDynamic);
+		}
+		catch ([[maybe_unused]] std::invalid_argument const& e)
+		{
+			LOG_AEM_PAYLOAD_TRACE("serializeReadControlDescriptorResponse error: Invalid control values: {}", e.what());
+			throw UnsupportedValueException();
+		}
+	}
+	else
+	{
+		LOG_AEM_PAYLOAD_TRACE("serializeReadControlDescriptorResponse warning: Unsupported ControlValueType: {}", controlValueTypeToString(valueType));
+		throw UnsupportedValueException();
+	}
+}
+
 entity::model::ControlDescriptor deserializeReadControlDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	static auto s_Dispatch = std::unordered_map<entity::model::ControlValueType::Type, std::function<std::tuple<entity::model::ControlValues, entity::model::ControlValues>(Deserializer&, std::uint16_t)>>{};
@@ -1027,6 +1147,24 @@ entity::model::ControlDescriptor deserializeReadControlDescriptorResponse(AemAec
 	return controlDescriptor;
 }
 
+void serializeReadClockDomainDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ClockDomainDescriptor const& clockDomainDescriptor)
+{
+	// Clock sources are right after the fixed part of the descriptor (offset is from the base of the descriptor, not from the base of our serializer buffer)
+	auto const clockSourcesOffset = static_cast<std::uint16_t>(AecpAemReadClockDomainDescriptorResponsePayloadMinSize - PayloadBufferOffset);
+	auto const numberOfClockSources = static_cast<std::uint16_t>(clockDomainDescriptor.clockSources.size());
+
+	ser << clockDomainDescriptor.objectName;
+	ser << clockDomainDescriptor.localizedDescription;
+	ser << clockDomainDescriptor.clockSourceIndex;
+	ser << clockSourcesOffset << numberOfClockSources;
+	AVDECC_ASSERT(ser.usedBytes() == AecpAemReadClockDomainDescriptorResponsePayloadMinSize, "Packed bytes doesn't match protocol constant");
+
+	for (auto const clockSourceIndex : clockDomainDescriptor.clockSources)
+	{
+		ser << clockSourceIndex;
+	}
+}
+
 entity::model::ClockDomainDescriptor deserializeReadClockDomainDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::ClockDomainDescriptor clockDomainDescriptor{};
@@ -1080,6 +1218,23 @@ entity::model::ClockDomainDescriptor deserializeReadClockDomainDescriptorRespons
 	return clockDomainDescriptor;
 }
 
+void serializeReadTimingDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::TimingDescriptor const& timingDescriptor)
+{
+	// PTP instances are right after the fixed part of the descriptor (offset is from the base of the descriptor, not from the base of our serializer buffer)
+	auto const ptpInstancesOffset = static_cast<std::uint16_t>(AecpAemReadTimingDescriptorResponsePayloadMinSize - PayloadBufferOffset);
+	auto const numberOfPtpInstances = static_cast<std::uint16_t>(timingDescriptor.ptpInstances.size());
+
+	ser << timingDescriptor.objectName;
+	ser << timingDescriptor.localizedDescription << timingDescriptor.algorithm;
+	ser << ptpInstancesOffset << numberOfPtpInstances;
+	AVDECC_ASSERT(ser.usedBytes() == AecpAemReadTimingDescriptorResponsePayloadMinSize, "Packed bytes doesn't match protocol constant");
+
+	for (auto const ptpInstanceIndex : timingDescriptor.ptpInstances)
+	{
+		ser << ptpInstanceIndex;
+	}
+}
+
 entity::model::TimingDescriptor deserializeReadTimingDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::TimingDescriptor timingDescriptor{};
@@ -1132,6 +1287,14 @@ entity::model::TimingDescriptor deserializeReadTimingDescriptorResponse(AemAecpd
 	return timingDescriptor;
 }
 
+using PtpInstanceDescriptorLayout = layout::StructLayout<entity::model::PtpInstanceDescriptor, layout::Member<&entity::model::PtpInstanceDescriptor::objectName>, layout::Member<&entity::model::PtpInstanceDescriptor::localizedDescription>, layout::Member<&entity::model::PtpInstanceDescriptor::clockIdentity>, layout::Member<&entity::model::PtpInstanceDescriptor::flags>, layout::Member<&entity::model::PtpInstanceDescriptor::numberOfControls>, layout::Member<&entity::model::PtpInstanceDescriptor::baseControl>, layout::Member<&entity::model::PtpInstanceDescriptor::numberOfPtpPorts>, layout::Member<&entity::model::PtpInstanceDescriptor::basePtpPort>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + PtpInstanceDescriptorLayout::Size == AecpAemReadPtpInstanceDescriptorResponsePayloadSize, "PTP_INSTANCE Descriptor layout does not match the protocol constant");
+
+void serializeReadPtpInstanceDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::PtpInstanceDescriptor const& ptpInstanceDescriptor)
+{
+	PtpInstanceDescriptorLayout::serialize(ser, ptpInstanceDescriptor);
+}
+
 entity::model::PtpInstanceDescriptor deserializeReadPtpInstanceDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::PtpInstanceDescriptor ptpInstanceDescriptor{};
@@ -1146,25 +1309,27 @@ entity::model::PtpInstanceDescriptor deserializeReadPtpInstanceDescriptorRespons
 			throw IncorrectPayloadSizeException();
 
 		// Check ptp instance descriptor payload - IEEE1722.1-2021 Clause 7.2.35
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> ptpInstanceDescriptor.objectName;
-		des >> ptpInstanceDescriptor.localizedDescription;
-		des >> ptpInstanceDescriptor.clockIdentity >> ptpInstanceDescriptor.flags;
-		des >> ptpInstanceDescriptor.numberOfControls >> ptpInstanceDescriptor.baseControl;
-		des >> ptpInstanceDescriptor.numberOfPtpPorts >> ptpInstanceDescriptor.basePtpPort;
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		PtpInstanceDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, ptpInstanceDescriptor);
 
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadPtpInstanceDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - PtpInstanceDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_PTP_INSTANCE_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_PTP_INSTANCE_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
 	return ptpInstanceDescriptor;
 }
 
+using PtpPortDescriptorLayout = layout::StructLayout<entity::model::PtpPortDescriptor, layout::Member<&entity::model::PtpPortDescriptor::objectName>, layout::Member<&entity::model::PtpPortDescriptor::localizedDescription>, layout::Member<&entity::model::PtpPortDescriptor::portNumber>, layout::Member<&entity::model::PtpPortDescriptor::portType>, layout::Member<&entity::model::PtpPortDescriptor::flags>, layout::Member<&entity::model::PtpPortDescriptor::avbInterfaceIndex>, layout::Member<&entity::model::PtpPortDescriptor::profileIdentifier>>;
+static_assert(AecpAemReadCommonDescriptorResponsePayloadSize + PtpPortDescriptorLayout::Size == AecpAemReadPtpPortDescriptorResponsePayloadSize, "PTP_PORT Descriptor layout does not match the protocol constant");
+
+void serializeReadPtpPortDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::PtpPortDescriptor const& ptpPortDescriptor)
+{
+	PtpPortDescriptorLayout::serialize(ser, ptpPortDescriptor);
+}
+
 entity::model::PtpPortDescriptor deserializeReadPtpPortDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status)
 {
 	entity::model::PtpPortDescriptor ptpPortDescriptor{};
@@ -1179,18 +1344,13 @@ entity::model::PtpPortDescriptor deserializeReadPtpPortDescriptorResponse(AemAec
 			throw IncorrectPayloadSizeException();
 
 		// Check ptp port descriptor payload - IEEE1722.1-2021 Clause 7.2.36
-		Deserializer des(commandPayload, commandPayloadLength);
-		des.setPosition(commonSize); // Skip already unpacked common header
-		des >> ptpPortDescriptor.objectName;
-		des >> ptpPortDescriptor.localizedDescription;
-		des >> ptpPortDescriptor.portNumber >> ptpPortDescriptor.portType >> ptpPortDescriptor.flags >> ptpPortDescriptor.avbInterfaceIndex;
-		des.unpackBuffer(ptpPortDescriptor.profileIdentifier.data(), ptpPortDescriptor.profileIdentifier.size());
+		AVDECC_ASSERT(commonSize == AecpAemReadCommonDescriptorResponsePayloadSize, "Common header size doesn't match protocol constant");
+		PtpPortDescriptorLayout::unpack(static_cast<std::uint8_t const*>(commandPayload) + commonSize, ptpPortDescriptor);
 
-		AVDECC_ASSERT(des.usedBytes() == AecpAemReadPtpPortDescriptorResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-		if (des.remaining() != 0)
+		auto const remaining = commandPayloadLength - commonSize - PtpPortDescriptorLayout::Size;
+		if (remaining != 0)
 		{
-			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_PTP_PORT_DESCRIPTOR RESPONSE: {}", des.remaining());
+			LOG_AEM_PAYLOAD_TRACE("ReadDescriptorResponse deserialize warning: Remaining bytes in buffer for READ_PTP_PORT_DESCRIPTOR RESPONSE: {}", remaining);
 		}
 	}
 
@@ -1214,36 +1374,17 @@ entity::model::PtpPortDescriptor deserializeReadPtpPortDescriptorResponse(AemAec
 // No payload
 
 /** SET_CONFIGURATION Command - IEEE1722.1-2013 Clause 7.4.7.1 */
+using SetConfigurationCommandLayout = layout::Layout<layout::Reserved<2>, layout::Field<entity::model::ConfigurationIndex>>;
+static_assert(SetConfigurationCommandLayout::Size == AecpAemSetConfigurationCommandPayloadSize, "SET_CONFIGURATION Command layout does not match the protocol constant");
+
 Serializer<AecpAemSetConfigurationCommandPayloadSize> serializeSetConfigurationCommand(entity::model::ConfigurationIndex const configurationIndex)
 {
-	Serializer<AecpAemSetConfigurationCommandPayloadSize> ser;
-	std::uint16_t const reserved{ 0u };
-
-	ser << reserved << configurationIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return SetConfigurationCommandLayout::serialize(configurationIndex);
 }
 
 std::tuple<entity::model::ConfigurationIndex> deserializeSetConfigurationCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemSetConfigurationCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	std::uint16_t reserved{ 0u };
-	entity::model::ConfigurationIndex configurationIndex{ 0u };
-
-	des >> reserved >> configurationIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemSetConfigurationCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(configurationIndex);
+	return SetConfigurationCommandLayout::deserialize(payload);
 }
 
 /** SET_CONFIGURATION Response - IEEE1722.1-2013 Clause 7.4.7.1 */
@@ -1282,38 +1423,17 @@ std::tuple<entity::model::ConfigurationIndex> deserializeGetConfigurationRespons
 }
 
 /** SET_STREAM_FORMAT Command - IEEE1722.1-2013 Clause 7.4.9.1 */
+using SetStreamFormatCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>, layout::Field<entity::model::StreamFormat>>;
+static_assert(SetStreamFormatCommandLayout::Size == AecpAemSetStreamFormatCommandPayloadSize, "SET_STREAM_FORMAT Command layout does not match the protocol constant");
+
 Serializer<AecpAemSetStreamFormatCommandPayloadSize> serializeSetStreamFormatCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::StreamFormat const streamFormat)
 {
-	Serializer<AecpAemSetStreamFormatCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-	ser << streamFormat;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return SetStreamFormatCommandLayout::serialize(descriptorType, descriptorIndex, streamFormat);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity::model::StreamFormat> deserializeSetStreamFormatCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemSetStreamFormatCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-	entity::model::StreamFormat streamFormat{};
-
-	des >> descriptorType >> descriptorIndex;
-	des >> streamFormat;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemSetStreamFormatCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex, streamFormat);
+	return SetStreamFormatCommandLayout::deserialize(payload);
 }
 
 /** SET_STREAM_FORMAT Response - IEEE1722.1-2013 Clause 7.4.9.1 */
@@ -1333,35 +1453,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** GET_STREAM_FORMAT Command - IEEE1722.1-2013 Clause 7.4.10.1 */
+using GetStreamFormatCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(GetStreamFormatCommandLayout::Size == AecpAemGetStreamFormatCommandPayloadSize, "GET_STREAM_FORMAT Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetStreamFormatCommandPayloadSize> serializeGetStreamFormatCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemGetStreamFormatCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetStreamFormatCommandLayout::serialize(descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeGetStreamFormatCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetStreamFormatCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetStreamFormatCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex);
+	return GetStreamFormatCommandLayout::deserialize(payload);
 }
 
 /** GET_STREAM_FORMAT Response - IEEE1722.1-2013 Clause 7.4.10.2 */
@@ -1456,35 +1558,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** GET_STREAM_INFO Command - IEEE1722.1-2013 Clause 7.4.16.1 */
+using GetStreamInfoCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(GetStreamInfoCommandLayout::Size == AecpAemGetStreamInfoCommandPayloadSize, "GET_STREAM_INFO Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetStreamInfoCommandPayloadSize> serializeGetStreamInfoCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemGetStreamInfoCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetStreamInfoCommandLayout::serialize(descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeGetStreamInfoCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetStreamInfoCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetStreamInfoCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex);
+	return GetStreamInfoCommandLayout::deserialize(payload);
 }
 
 
@@ -1619,41 +1703,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 /** GET_STREAM_INFO Response - IEEE1722.1-2013 Clause 7.4.16.2 */
 
 /** SET_NAME Command - IEEE1722.1-2013 Clause 7.4.17.1 */
+using SetNameCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>, layout::Field<std::uint16_t>, layout::Field<entity::model::ConfigurationIndex>, layout::Field<entity::model::AvdeccFixedString>>;
+static_assert(SetNameCommandLayout::Size == AecpAemSetNameCommandPayloadSize, "SET_NAME Command layout does not match the protocol constant");
+
 Serializer<AecpAemSetNameCommandPayloadSize> serializeSetNameCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, std::uint16_t const nameIndex, entity::model::ConfigurationIndex const configurationIndex, entity::model::AvdeccFixedString const& name)
 {
-	Serializer<AecpAemSetNameCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-	ser << nameIndex << configurationIndex;
-	ser << name;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return SetNameCommandLayout::serialize(descriptorType, descriptorIndex, nameIndex, configurationIndex, name);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, std::uint16_t, entity::model::ConfigurationIndex, entity::model::AvdeccFixedString> deserializeSetNameCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemSetNameCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-	std::uint16_t nameIndex{ 0u };
-	entity::model::ConfigurationIndex configurationIndex{ 0u };
-	entity::model::AvdeccFixedString name{};
-
-	des >> descriptorType >> descriptorIndex;
-	des >> nameIndex >> configurationIndex >> name;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemSetNameCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex, nameIndex, configurationIndex, name);
+	return SetNameCommandLayout::deserialize(payload);
 }
 
 /** SET_NAME Response - IEEE1722.1-2013 Clause 7.4.17.1 */
@@ -1673,39 +1733,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, std::u
 }
 
 /** GET_NAME Command - IEEE1722.1-2013 Clause 7.4.18.1 */
+using GetNameCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>, layout::Field<std::uint16_t>, layout::Field<entity::model::ConfigurationIndex>>;
+static_assert(GetNameCommandLayout::Size == AecpAemGetNameCommandPayloadSize, "GET_NAME Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetNameCommandPayloadSize> serializeGetNameCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, std::uint16_t const nameIndex, entity::model::ConfigurationIndex const configurationIndex)
 {
-	Serializer<AecpAemGetNameCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-	ser << nameIndex << configurationIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetNameCommandLayout::serialize(descriptorType, descriptorIndex, nameIndex, configurationIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, std::uint16_t, entity::model::ConfigurationIndex> deserializeGetNameCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetNameCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-	std::uint16_t nameIndex{ 0u };
-	entity::model::ConfigurationIndex configurationIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-	des >> nameIndex >> configurationIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetNameCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex, nameIndex, configurationIndex);
+	return GetNameCommandLayout::deserialize(payload);
 }
 
 /** GET_NAME Response - IEEE1722.1-2013 Clause 7.4.18.2 */
@@ -1725,34 +1763,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, std::u
 }
 
 /** SET_ASSOCIATION_ID Command - IEEE1722.1-2013 Clause 7.4.19.1 */
+using SetAssociationIDCommandLayout = layout::Layout<layout::Field<UniqueIdentifier>>;
+static_assert(SetAssociationIDCommandLayout::Size == AecpAemSetAssociationIDCommandPayloadSize, "SET_ASSOCIATION_ID Command layout does not match the protocol constant");
+
 Serializer<AecpAemSetAssociationIDCommandPayloadSize> serializeSetAssociationIDCommand(UniqueIdentifier const associationID)
 {
-	Serializer<AecpAemSetAssociationIDCommandPayloadSize> ser;
-
-	ser << associationID;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return SetAssociationIDCommandLayout::serialize(associationID);
 }
 
 std::tuple<UniqueIdentifier> deserializeSetAssociationIDCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemSetAssociationIDCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	UniqueIdentifier associationID{};
-
-	des >> associationID;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemSetAssociationIDCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(associationID);
+	return SetAssociationIDCommandLayout::deserialize(payload);
 }
 
 /** SET_ASSOCIATION_ID Response - IEEE1722.1-2013 Clause 7.4.19.1 */
@@ -1791,38 +1812,17 @@ std::tuple<UniqueIdentifier> deserializeGetAssociationIDResponse(entity::LocalEn
 }
 
 /** SET_SAMPLING_RATE Command - IEEE1722.1-2013 Clause 7.4.21.1 */
+using SetSamplingRateCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>, layout::Field<entity::model::SamplingRate>>;
+static_assert(SetSamplingRateCommandLayout::Size == AecpAemSetSamplingRateCommandPayloadSize, "SET_SAMPLING_RATE Command layout does not match the protocol constant");
+
 Serializer<AecpAemSetSamplingRateCommandPayloadSize> serializeSetSamplingRateCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::SamplingRate const samplingRate)
 {
-	Serializer<AecpAemSetSamplingRateCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-	ser << samplingRate;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return SetSamplingRateCommandLayout::serialize(descriptorType, descriptorIndex, samplingRate);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity::model::SamplingRate> deserializeSetSamplingRateCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemSetSamplingRateCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-	entity::model::SamplingRate samplingRate{};
-
-	des >> descriptorType >> descriptorIndex;
-	des >> samplingRate;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemSetSamplingRateCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex, samplingRate);
+	return SetSamplingRateCommandLayout::deserialize(payload);
 }
 
 /** SET_SAMPLING_RATE Response - IEEE1722.1-2013 Clause 7.4.21.1 */
@@ -1842,35 +1842,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** GET_SAMPLING_RATE Command - IEEE1722.1-2013 Clause 7.4.22.1 */
+using GetSamplingRateCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(GetSamplingRateCommandLayout::Size == AecpAemGetSamplingRateCommandPayloadSize, "GET_SAMPLING_RATE Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetSamplingRateCommandPayloadSize> serializeGetSamplingRateCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemGetSamplingRateCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetSamplingRateCommandLayout::serialize(descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeGetSamplingRateCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetSamplingRateCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetSamplingRateCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex);
+	return GetSamplingRateCommandLayout::deserialize(payload);
 }
 
 /** GET_SAMPLING_RATE Response - IEEE1722.1-2013 Clause 7.4.22.2 */
@@ -1890,40 +1872,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** SET_CLOCK_SOURCE Command - IEEE1722.1-2013 Clause 7.4.23.1 */
+using SetClockSourceCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>, layout::Field<entity::model::ClockSourceIndex>, layout::Reserved<2>>;
+static_assert(SetClockSourceCommandLayout::Size == AecpAemSetClockSourceCommandPayloadSize, "SET_CLOCK_SOURCE Command layout does not match the protocol constant");
+
 Serializer<AecpAemSetClockSourceCommandPayloadSize> serializeSetClockSourceCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::ClockSourceIndex const clockSourceIndex)
 {
-	Serializer<AecpAemSetClockSourceCommandPayloadSize> ser;
-	std::uint16_t const reserved{ 0u };
-
-	ser << descriptorType << descriptorIndex;
-	ser << clockSourceIndex << reserved;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return SetClockSourceCommandLayout::serialize(descriptorType, descriptorIndex, clockSourceIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity::model::ClockSourceIndex> deserializeSetClockSourceCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemSetClockSourceCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-	entity::model::ClockSourceIndex clockSourceIndex{ 0u };
-	std::uint16_t reserved{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-	des >> clockSourceIndex >> reserved;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemSetClockSourceCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex, clockSourceIndex);
+	return SetClockSourceCommandLayout::deserialize(payload);
 }
 
 /** SET_CLOCK_SOURCE Response - IEEE1722.1-2013 Clause 7.4.23.1 */
@@ -1943,35 +1902,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** GET_CLOCK_SOURCE Command - IEEE1722.1-2013 Clause 7.4.24.1 */
+using GetClockSourceCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(GetClockSourceCommandLayout::Size == AecpAemGetClockSourceCommandPayloadSize, "GET_CLOCK_SOURCE Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetClockSourceCommandPayloadSize> serializeGetClockSourceCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemGetClockSourceCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetClockSourceCommandLayout::serialize(descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeGetClockSourceCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetClockSourceCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetClockSourceCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex);
+	return GetClockSourceCommandLayout::deserialize(payload);
 }
 
 /** GET_CLOCK_SOURCE Response - IEEE1722.1-2013 Clause 7.4.24.2 */
@@ -2109,35 +2050,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, Memory
 }
 
 /** GET_CONTROL Command - IEEE1722.1-2013 Clause 7.4.26.1 */
+using GetControlCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(GetControlCommandLayout::Size == AecpAemGetControlCommandPayloadSize, "GET_CONTROL Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetControlCommandPayloadSize> serializeGetControlCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemGetControlCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetControlCommandLayout::serialize(descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeGetControlCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetControlCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetControlCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex);
+	return GetControlCommandLayout::deserialize(payload);
 }
 
 /** GET_CONTROL Response - IEEE1722.1-2013 Clause 7.4.26.2 */
@@ -2157,35 +2080,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, Memory
 }
 
 /** START_STREAMING Command - IEEE1722.1-2013 Clause 7.4.35.1 */
+using StartStreamingCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(StartStreamingCommandLayout::Size == AecpAemStartStreamingCommandPayloadSize, "START_STREAMING Command layout does not match the protocol constant");
+
 Serializer<AecpAemStartStreamingCommandPayloadSize> serializeStartStreamingCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemStartStreamingCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return StartStreamingCommandLayout::serialize(descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeStartStreamingCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemStartStreamingCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemStartStreamingCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex);
+	return StartStreamingCommandLayout::deserialize(payload);
 }
 
 /** START_STREAMING Response - IEEE1722.1-2013 Clause 7.4.35.1 */
@@ -2236,35 +2141,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deseri
 }
 
 /** GET_AVB_INFO Command - IEEE1722.1-2013 Clause 7.4.40.1 */
+using GetAvbInfoCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(GetAvbInfoCommandLayout::Size == AecpAemGetAvbInfoCommandPayloadSize, "GET_AVB_INFO Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetAvbInfoCommandPayloadSize> serializeGetAvbInfoCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemGetAvbInfoCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetAvbInfoCommandLayout::serialize(descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeGetAvbInfoCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetAvbInfoCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetAvbInfoCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex);
+	return GetAvbInfoCommandLayout::deserialize(payload);
 }
 
 /** GET_AVB_INFO Response - IEEE1722.1-2013 Clause 7.4.40.2 */
@@ -2337,36 +2224,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** GET_AS_PATH Command - IEEE1722.1-2013 Clause 7.4.41.1 */
+using GetAsPathCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorIndex>, layout::Reserved<2>>;
+static_assert(GetAsPathCommandLayout::Size == AecpAemGetAsPathCommandPayloadSize, "GET_AS_PATH Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetAsPathCommandPayloadSize> serializeGetAsPathCommand(entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemGetAsPathCommandPayloadSize> ser;
-	std::uint16_t const reserved{ 0u };
-
-	ser << descriptorIndex << reserved;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetAsPathCommandLayout::serialize(descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorIndex> deserializeGetAsPathCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetAsPathCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-	std::uint16_t reserved{ 0u };
-
-	des >> descriptorIndex >> reserved;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetAsPathCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorIndex);
+	return GetAsPathCommandLayout::deserialize(payload);
 }
 
 /** GET_AS_PATH Response - IEEE1722.1-2013 Clause 7.4.41.2 */
@@ -2434,35 +2302,17 @@ std::tuple<entity::model::DescriptorIndex, entity::model::AsPath> deserializeGet
 }
 
 /** GET_COUNTERS Command - IEEE1722.1-2013 Clause 7.4.42.1 */
+using GetCountersCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(GetCountersCommandLayout::Size == AecpAemGetCountersCommandPayloadSize, "GET_COUNTERS Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetCountersCommandPayloadSize> serializeGetCountersCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemGetCountersCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetCountersCommandLayout::serialize(descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeGetCountersCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetCountersCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetCountersCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex);
+	return GetCountersCommandLayout::deserialize(payload);
 }
 
 /** GET_COUNTERS Response - IEEE1722.1-2013 Clause 7.4.42.2 */
@@ -2474,10 +2324,7 @@ Serializer<AecpAemGetCountersResponsePayloadSize> serializeGetCountersResponse(e
 	ser << validCounters;
 
 	// Serialize the counters
-	for (auto const counter : counters)
-	{
-		ser << counter;
-	}
+	storeBigEndianArray<sizeof(entity::model::DescriptorCounter)>(ser.reserveBuffer(sizeof(counters)), counters.data(), counters.size());
 
 	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
 
@@ -2503,10 +2350,7 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 		des >> validCounters;
 
 		// Deserialize the counters
-		for (auto& counter : counters)
-		{
-			des >> counter;
-		}
+		loadBigEndianArray<sizeof(entity::model::DescriptorCounter)>(counters.data(), des.borrowBuffer(sizeof(counters)), counters.size());
 
 		AVDECC_ASSERT(des.usedBytes() == AecpAemGetCountersResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
 	}
@@ -2523,35 +2367,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** REBOOT Command - IEEE1722.1-2013 Clause 7.4.43.1 */
+using RebootCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>>;
+static_assert(RebootCommandLayout::Size == AecpAemRebootCommandPayloadSize, "REBOOT Command layout does not match the protocol constant");
+
 Serializer<AecpAemRebootCommandPayloadSize> serializeRebootCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex)
 {
-	Serializer<AecpAemRebootCommandPayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return RebootCommandLayout::serialize(descriptorType, descriptorIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeRebootCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemRebootCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemRebootCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex);
+	return RebootCommandLayout::deserialize(payload);
 }
 
 /** REBOOT Response - IEEE1722.1-2013 Clause 7.4.43.1 */
@@ -2571,40 +2397,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex> deseri
 }
 
 /** GET_AUDIO_MAP Command - IEEE1722.1-2013 Clause 7.4.44.1 */
+using GetAudioMapCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>, layout::Field<entity::model::MapIndex>, layout::Reserved<2>>;
+static_assert(GetAudioMapCommandLayout::Size == AecpAemGetAudioMapCommandPayloadSize, "GET_AUDIO_MAP Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetAudioMapCommandPayloadSize> serializeGetAudioMapCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::MapIndex const mapIndex)
 {
-	Serializer<AecpAemGetAudioMapCommandPayloadSize> ser;
-	std::uint16_t const reserved{ 0u };
-
-	ser << descriptorType << descriptorIndex;
-	ser << mapIndex << reserved;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetAudioMapCommandLayout::serialize(descriptorType, descriptorIndex, mapIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity::model::MapIndex> deserializeGetAudioMapCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetAudioMapCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-	entity::model::MapIndex mapIndex{ 0u };
-	std::uint16_t reserved{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-	des >> mapIndex >> reserved;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetAudioMapCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex, mapIndex);
+	return GetAudioMapCommandLayout::deserialize(payload);
 }
 
 /** GET_AUDIO_MAP Response - IEEE1722.1-2013 Clause 7.4.44.2 */
@@ -2617,10 +2420,7 @@ Serializer<AemAecpdu::MaximumSendPayloadBufferLength> serializeGetAudioMapRespon
 	ser << mapIndex << numberOfMaps << static_cast<std::uint16_t>(mappings.size()) << reserved;
 
 	// Serialize variable data
-	for (auto const& mapping : mappings)
-	{
-		ser << mapping.streamIndex << mapping.streamChannel << mapping.clusterOffset << mapping.clusterChannel;
-	}
+	serializeAudioMappings(ser, mappings);
 
 	return ser;
 }
@@ -2653,12 +2453,7 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 			throw IncorrectPayloadSizeException();
 
 		// Unpack remaining data
-		for (auto index = 0u; index < numberOfMappings; ++index)
-		{
-			entity::model::AudioMapping mapping;
-			des >> mapping.streamIndex >> mapping.streamChannel >> mapping.clusterOffset >> mapping.clusterChannel;
-			mappings.push_back(mapping);
-		}
+		deserializeAudioMappings(des, numberOfMappings, mappings);
 		AVDECC_ASSERT(des.usedBytes() == (protocol::aemPayload::AecpAemGetAudioMapResponsePayloadMinSize + mappingsSize), "Unpacked bytes doesn't match protocol constant");
 
 		if (des.remaining() != 0)
@@ -2688,10 +2483,7 @@ Serializer<AemAecpdu::MaximumSendPayloadBufferLength> serializeAddAudioMappingsC
 	ser << static_cast<std::uint16_t>(mappings.size()) << reserved;
 
 	// Serialize variable data
-	for (auto const& mapping : mappings)
-	{
-		ser << mapping.streamIndex << mapping.streamChannel << mapping.clusterOffset << mapping.clusterChannel;
-	}
+	serializeAudioMappings(ser, mappings);
 
 	return ser;
 }
@@ -2722,12 +2514,7 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 
 	// Unpack remaining data
 	entity::model::AudioMappings mappings;
-	for (auto index = 0u; index < numberOfMappings; ++index)
-	{
-		entity::model::AudioMapping mapping;
-		des >> mapping.streamIndex >> mapping.streamChannel >> mapping.clusterOffset >> mapping.clusterChannel;
-		mappings.push_back(mapping);
-	}
+	deserializeAudioMappings(des, numberOfMappings, mappings);
 	AVDECC_ASSERT(des.usedBytes() == (protocol::aemPayload::AecpAemAddAudioMappingsCommandPayloadMinSize + mappingsSize), "Unpacked bytes doesn't match protocol constant");
 
 	if (des.remaining() != 0)
@@ -2851,40 +2638,17 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** ABORT_OPERATION Command - IEEE1722.1-2013 Clause 7.4.55.1 */
+using AbortOperationCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>, layout::Field<entity::model::OperationID>, layout::Reserved<2>>;
+static_assert(AbortOperationCommandLayout::Size == AecpAemAbortOperationCommandPayloadSize, "ABORT_OPERATION Command layout does not match the protocol constant");
+
 Serializer<AecpAemAbortOperationCommandPayloadSize> serializeAbortOperationCommand(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::OperationID const operationID)
 {
-	Serializer<AecpAemAbortOperationCommandPayloadSize> ser;
-	std::uint16_t const reserved{ 0u };
-
-	ser << descriptorType << descriptorIndex;
-	ser << operationID << reserved;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return AbortOperationCommandLayout::serialize(descriptorType, descriptorIndex, operationID);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity::model::OperationID> deserializeAbortOperationCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemAbortOperationResponsePayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-	entity::model::OperationID operationID{ 0u };
-	std::uint16_t reserved{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-	des >> operationID >> reserved;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemAbortOperationResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex, operationID);
+	return AbortOperationCommandLayout::deserialize(payload);
 }
 
 /** ABORT_OPERATION Response - IEEE1722.1-2013 Clause 7.4.55.1 */
@@ -2904,75 +2668,32 @@ std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity
 }
 
 /** OPERATION_STATUS Unsolicited Response - IEEE1722.1-2013 Clause 7.4.55.1 */
+using OperationStatusResponseLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::DescriptorIndex>, layout::Field<entity::model::OperationID>, layout::Field<std::uint16_t>>;
+static_assert(OperationStatusResponseLayout::Size == AecpAemOperationStatusResponsePayloadSize, "OPERATION_STATUS Unsolicited Response layout does not match the protocol constant");
+
 Serializer<AecpAemOperationStatusResponsePayloadSize> serializeOperationStatusResponse(entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex, entity::model::OperationID const operationID, std::uint16_t const percentComplete)
 {
-	Serializer<AecpAemOperationStatusResponsePayloadSize> ser;
-
-	ser << descriptorType << descriptorIndex;
-	ser << operationID << percentComplete;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return OperationStatusResponseLayout::serialize(descriptorType, descriptorIndex, operationID, percentComplete);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::DescriptorIndex, entity::model::OperationID, std::uint16_t> deserializeOperationStatusResponse(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemOperationStatusResponsePayloadSize) // Malformed packet
-	{
-		throw IncorrectPayloadSizeException();
-	}
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::DescriptorIndex descriptorIndex{ 0u };
-	entity::model::OperationID operationID{ 0u };
-	std::uint16_t percentComplete{ 0u };
-
-	des >> descriptorType >> descriptorIndex;
-	des >> operationID >> percentComplete;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemOperationStatusResponsePayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, descriptorIndex, operationID, percentComplete);
+	return OperationStatusResponseLayout::deserialize(payload);
 }
 
 /** SET_MEMORY_OBJECT_LENGTH Command - IEEE1722.1-2013 Clause 7.4.72.1 */
+using SetMemoryObjectLengthCommandLayout = layout::Layout<layout::Field<entity::model::MemoryObjectIndex>, layout::Field<entity::model::ConfigurationIndex>, layout::Field<std::uint64_t>>;
+static_assert(SetMemoryObjectLengthCommandLayout::Size == AecpAemSetMemoryObjectLengthCommandPayloadSize, "SET_MEMORY_OBJECT_LENGTH Command layout does not match the protocol constant");
+
 Serializer<AecpAemSetMemoryObjectLengthCommandPayloadSize> serializeSetMemoryObjectLengthCommand(entity::model::ConfigurationIndex const configurationIndex, entity::model::MemoryObjectIndex const memoryObjectIndex, std::uint64_t const length)
 {
-	Serializer<AecpAemSetMemoryObjectLengthCommandPayloadSize> ser;
-
-	ser << memoryObjectIndex << configurationIndex;
-	ser << length;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return SetMemoryObjectLengthCommandLayout::serialize(memoryObjectIndex, configurationIndex, length);
 }
 
 std::tuple<entity::model::ConfigurationIndex, entity::model::MemoryObjectIndex, std::uint64_t> deserializeSetMemoryObjectLengthCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemSetMemoryObjectLengthCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::MemoryObjectIndex memoryObjectIndex{ 0u };
-	entity::model::ConfigurationIndex configurationIndex{ 0u };
-	std::uint64_t length{ 0u };
-
-	des >> memoryObjectIndex >> configurationIndex;
-	des >> length;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemSetMemoryObjectLengthCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
+	// Wire order differs from the tuple order
+	auto const [memoryObjectIndex, configurationIndex, length] = SetMemoryObjectLengthCommandLayout::deserialize(payload);
 	return std::make_tuple(configurationIndex, memoryObjectIndex, length);
 }
 
@@ -2993,34 +2714,18 @@ std::tuple<entity::model::ConfigurationIndex, entity::model::MemoryObjectIndex,
 }
 
 /** GET_MEMORY_OBJECT_LENGTH Command - IEEE1722.1-2013 Clause 7.4.73.1 */
+using GetMemoryObjectLengthCommandLayout = layout::Layout<layout::Field<entity::model::MemoryObjectIndex>, layout::Field<entity::model::ConfigurationIndex>>;
+static_assert(GetMemoryObjectLengthCommandLayout::Size == AecpAemGetMemoryObjectLengthCommandPayloadSize, "GET_MEMORY_OBJECT_LENGTH Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetMemoryObjectLengthCommandPayloadSize> serializeGetMemoryObjectLengthCommand(entity::model::ConfigurationIndex const configurationIndex, entity::model::MemoryObjectIndex const memoryObjectIndex)
 {
-	Serializer<AecpAemGetClockSourceCommandPayloadSize> ser;
-
-	ser << memoryObjectIndex << configurationIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetMemoryObjectLengthCommandLayout::serialize(memoryObjectIndex, configurationIndex);
 }
 
 std::tuple<entity::model::ConfigurationIndex, entity::model::MemoryObjectIndex> deserializeGetMemoryObjectLengthCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetMemoryObjectLengthCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::MemoryObjectIndex memoryObjectIndex{ 0u };
-	entity::model::ConfigurationIndex configurationIndex{ 0u };
-
-	des >> memoryObjectIndex >> configurationIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetMemoryObjectLengthCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
+	// Wire order differs from the tuple order
+	auto const [memoryObjectIndex, configurationIndex] = GetMemoryObjectLengthCommandLayout::deserialize(payload);
 	return std::make_tuple(configurationIndex, memoryObjectIndex);
 }
 
@@ -3123,38 +2828,17 @@ DynamicInfos deserializeGetDynamicInfoResponse(entity::LocalEntity::AemCommandSt
 }
 
 /** SET_MAX_TRANSIT_TIME Command - IEEE1722.1-2021 Clause 7.4.77.1 */
+using SetMaxTransitTimeCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::StreamIndex>, layout::Field<std::uint64_t>>;
+static_assert(SetMaxTransitTimeCommandLayout::Size == AecpAemSetMaxTransitTimeCommandPayloadSize, "SET_MAX_TRANSIT_TIME Command layout does not match the protocol constant");
+
 Serializer<AecpAemSetMaxTransitTimeCommandPayloadSize> serializeSetMaxTransitTimeCommand(entity::model::DescriptorType const descriptorType, entity::model::StreamIndex const streamIndex, std::uint64_t const maxTransitTime)
 {
-	Serializer<AecpAemSetMaxTransitTimeCommandPayloadSize> ser;
-
-	ser << descriptorType << streamIndex;
-	ser << maxTransitTime;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return SetMaxTransitTimeCommandLayout::serialize(descriptorType, streamIndex, maxTransitTime);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::StreamIndex, std::uint64_t> deserializeSetMaxTransitTimeCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemSetMaxTransitTimeCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::StreamIndex streamIndex{ 0u };
-	std::uint64_t maxTransitTime{ 0u };
-
-	des >> descriptorType >> streamIndex;
-	des >> maxTransitTime;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemSetMaxTransitTimeCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, streamIndex, maxTransitTime);
+	return SetMaxTransitTimeCommandLayout::deserialize(payload);
 }
 
 /** SET_MAX_TRANSIT_TIME Response - IEEE1722.1-2021 Clause 7.4.77.1 */
@@ -3174,35 +2858,17 @@ std::tuple<entity::model::DescriptorType, entity::model::StreamIndex, std::uint6
 }
 
 /** GET_MAX_TRANSIT_TIME Command - IEEE1722.1-2021 Clause 7.4.77.1 */
+using GetMaxTransitTimeCommandLayout = layout::Layout<layout::Field<entity::model::DescriptorType>, layout::Field<entity::model::StreamIndex>>;
+static_assert(GetMaxTransitTimeCommandLayout::Size == AecpAemGetMaxTransitTimeCommandPayloadSize, "GET_MAX_TRANSIT_TIME Command layout does not match the protocol constant");
+
 Serializer<AecpAemGetMaxTransitTimeCommandPayloadSize> serializeGetMaxTransitTimeCommand(entity::model::DescriptorType const descriptorType, entity::model::StreamIndex const streamIndex)
 {
-	Serializer<AecpAemGetClockSourceCommandPayloadSize> ser;
-
-	ser << descriptorType << streamIndex;
-
-	AVDECC_ASSERT(ser.usedBytes() == ser.capacity(), "Used bytes do not match the protocol constant");
-
-	return ser;
+	return GetMaxTransitTimeCommandLayout::serialize(descriptorType, streamIndex);
 }
 
 std::tuple<entity::model::DescriptorType, entity::model::StreamIndex> deserializeGetMaxTransitTimeCommand(AemAecpdu::Payload const& payload)
 {
-	auto* const commandPayload = payload.first;
-	auto const commandPayloadLength = payload.second;
-
-	if (commandPayload == nullptr || commandPayloadLength < AecpAemGetMaxTransitTimeCommandPayloadSize) // Malformed packet
-		throw IncorrectPayloadSizeException();
-
-	// Check payload
-	Deserializer des(commandPayload, commandPayloadLength);
-	entity::model::DescriptorType descriptorType{ entity::model::DescriptorType::Invalid };
-	entity::model::StreamIndex streamIndex{ 0u };
-
-	des >> descriptorType >> streamIndex;
-
-	AVDECC_ASSERT(des.usedBytes() == AecpAemGetMaxTransitTimeCommandPayloadSize, "Unpacked bytes doesn't match protocol constant");
-
-	return std::make_tuple(descriptorType, streamIndex);
+	return GetMaxTransitTimeCommandLayout::deserialize(payload);
 }
 
 /** GET_MAX_TRANSIT_TIME Response - IEEE1722.1-2021 Clause 7.4.77.2 */
@@ -183,6 +183,24 @@ std::tuple<entity::model::ConfigurationIndex, entity::model::DescriptorType, ent
 Serializer<AemAecpdu::MaximumSendPayloadBufferLength> serializeReadDescriptorCommonResponse(entity::model::ConfigurationIndex const configurationIndex, entity::model::DescriptorType const descriptorType, entity::model::DescriptorIndex const descriptorIndex);
 void serializeReadEntityDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::EntityDescriptor const& entityDescriptor);
 void serializeReadConfigurationDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ConfigurationDescriptor const& configurationDescriptor);
+void serializeReadAudioUnitDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::AudioUnitDescriptor const& audioUnitDescriptor);
+void serializeReadStreamDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::StreamDescriptor const& streamDescriptor);
+void serializeReadJackDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::JackDescriptor const& jackDescriptor);
+void serializeReadAvbInterfaceDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::AvbInterfaceDescriptor const& avbInterfaceDescriptor);
+void serializeReadClockSourceDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ClockSourceDescriptor const& clockSourceDescriptor);
+void serializeReadMemoryObjectDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::MemoryObjectDescriptor const& memoryObjectDescriptor);
+void serializeReadLocaleDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::LocaleDescriptor const& localeDescriptor);
+void serializeReadStringsDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::StringsDescriptor const& stringsDescriptor);
+void serializeReadStreamPortDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::StreamPortDescriptor const& streamPortDescriptor);
+void serializeReadExternalPortDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ExternalPortDescriptor const& externalPortDescriptor);
+void serializeReadInternalPortDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::InternalPortDescriptor const& internalPortDescriptor);
+void serializeReadAudioClusterDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::AudioClusterDescriptor const& audioClusterDescriptor);
+void serializeReadAudioMapDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::AudioMapDescriptor const& audioMapDescriptor);
+void serializeReadControlDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ControlDescriptor const& controlDescriptor);
+void serializeReadClockDomainDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::ClockDomainDescriptor const& clockDomainDescriptor);
+void serializeReadTimingDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::TimingDescriptor const& timingDescriptor);
+void serializeReadPtpInstanceDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::PtpInstanceDescriptor const& ptpInstanceDescriptor);
+void serializeReadPtpPortDescriptorResponse(Serializer<AemAecpdu::MaximumSendPayloadBufferLength>& ser, entity::model::PtpPortDescriptor const& ptpPortDescriptor);
 std::tuple<size_t, entity::model::ConfigurationIndex, entity::model::DescriptorType, entity::model::DescriptorIndex> deserializeReadDescriptorCommonResponse(entity::LocalEntity::AemCommandStatus const status, AemAecpdu::Payload const& payload);
 entity::model::EntityDescriptor deserializeReadEntityDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status);
 entity::model::ConfigurationDescriptor deserializeReadConfigurationDescriptorResponse(AemAecpdu::Payload const& payload, size_t const commonSize, AemAecpStatus const status);
@@ -0,0 +1,234 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolBulkEndian.hpp
+* @author Christophe Calmejane
+* @brief Bulk conversion of big endian (network) arrays of 16, 32 or 64 bits values.
+* @details Values are byte-swapped 32 (AVX2) or 16 (SSSE3, SSE2, NEON) bytes at a time, remaining values using the portable scalar path.
+*          AVX2 and SSSE3 paths are only used when enabled by the compiler flags, SSE2 and NEON are part of the x86-64 and AArch64 baselines.
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/endian.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#	define AVDECC_BULK_ENDIAN_AVX2
+#endif
+#if defined(__SSSE3__) || defined(__AVX2__)
+#	define AVDECC_BULK_ENDIAN_SSSE3
+#	include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define AVDECC_BULK_ENDIAN_SSE2
+#	include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#	define AVDECC_BULK_ENDIAN_NEON
+#	include <arm_neon.h>
+#endif
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+namespace detail
+{
+template<std::size_t ValueSize>
+struct BulkValueType;
+template<>
+struct BulkValueType<2>
+{
+	using type = std::uint16_t;
+};
+template<>
+struct BulkValueType<4>
+{
+	using type = std::uint32_t;
+};
+template<>
+struct BulkValueType<8>
+{
+	using type = std::uint64_t;
+};
+
+/** Portable path: reverses the bytes of count values of ValueSize bytes. Also used for the values remaining after the vectorized path. */
+template<std::size_t ValueSize>
+inline void swapBytesArrayScalar(std::uint8_t* const dst, std::uint8_t const* const src, std::size_t const count) noexcept
+{
+	for (auto index = std::size_t{ 0u }; index < count; ++index)
+	{
+		auto const* const s = src + index * ValueSize;
+		auto* const d = dst + index * ValueSize;
+		for (auto byte = std::size_t{ 0u }; byte < ValueSize; ++byte)
+		{
+			d[byte] = s[ValueSize - 1 - byte];
+		}
+	}
+}
+
+#if defined(AVDECC_BULK_ENDIAN_SSSE3)
+template<std::size_t ValueSize>
+inline __m128i byteSwapShuffleMask() noexcept
+{
+	if constexpr (ValueSize == 2)
+	{
+		return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+	}
+	else if constexpr (ValueSize == 4)
+	{
+		return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+	}
+	else
+	{
+		return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+	}
+}
+#elif defined(AVDECC_BULK_ENDIAN_SSE2)
+template<std::size_t ValueSize>
+inline __m128i swapBytes128(__m128i value) noexcept
+{
+	// Reorder 16 bits words inside each value, then swap the bytes of each word
+	if constexpr (ValueSize == 4)
+	{
+		value = _mm_shufflehi_epi16(_mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+	}
+	else if constexpr (ValueSize == 8)
+	{
+		value = _mm_shufflehi_epi16(_mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+	}
+	return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+}
+#elif defined(AVDECC_BULK_ENDIAN_NEON)
+template<std::size_t ValueSize>
+inline uint8x16_t swapBytes128(uint8x16_t const value) noexcept
+{
+	if constexpr (ValueSize == 2)
+	{
+		return vrev16q_u8(value);
+	}
+	else if constexpr (ValueSize == 4)
+	{
+		return vrev32q_u8(value);
+	}
+	else
+	{
+		return vrev64q_u8(value);
+	}
+}
+#endif
+} // namespace detail
+
+/** Copies count values of ValueSize bytes from src to dst, reversing the bytes of each value. Pointers do not have to be aligned, but must not overlap. */
+template<std::size_t ValueSize>
+inline void swapBytesArray(void* const dst, void const* const src, std::size_t const count) noexcept
+{
+	static_assert(ValueSize == 2 || ValueSize == 4 || ValueSize == 8, "Unsupported value size");
+
+	auto* d = static_cast<std::uint8_t*>(dst);
+	auto const* s = static_cast<std::uint8_t const*>(src);
+	auto bytes = count * ValueSize;
+
+#if defined(AVDECC_BULK_ENDIAN_AVX2)
+	{
+		auto const mask = _mm256_broadcastsi128_si256(detail::byteSwapShuffleMask<ValueSize>());
+		for (; bytes >= 32u; bytes -= 32u, s += 32u, d += 32u)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(d), _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(s)), mask));
+		}
+	}
+#endif
+#if defined(AVDECC_BULK_ENDIAN_SSSE3)
+	{
+		auto const mask = detail::byteSwapShuffleMask<ValueSize>();
+		for (; bytes >= 16u; bytes -= 16u, s += 16u, d += 16u)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(d), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(s)), mask));
+		}
+	}
+#elif defined(AVDECC_BULK_ENDIAN_SSE2)
+	for (; bytes >= 16u; bytes -= 16u, s += 16u, d += 16u)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(d), detail::swapBytes128<ValueSize>(_mm_loadu_si128(reinterpret_cast<__m128i const*>(s))));
+	}
+#elif defined(AVDECC_BULK_ENDIAN_NEON)
+	for (; bytes >= 16u; bytes -= 16u, s += 16u, d += 16u)
+	{
+		vst1q_u8(d, detail::swapBytes128<ValueSize>(vld1q_u8(s)));
+	}
+#endif
+
+	detail::swapBytesArrayScalar<ValueSize>(d, s, bytes / ValueSize);
+}
+
+/** Converts count big endian values of ValueSize bytes from src (usually a received payload) to host endianness into dst. Pointers do not have to be aligned, but must not overlap. */
+template<std::size_t ValueSize>
+inline void loadBigEndianArray(void* const dst, void const* const src, std::size_t const count) noexcept
+{
+	static_assert(ValueSize == 2 || ValueSize == 4 || ValueSize == 8, "Unsupported value size");
+
+	if constexpr (Endianness::HostEndian == Endianness::BigEndian)
+	{
+		std::memcpy(dst, src, count * ValueSize);
+	}
+	else
+	{
+		swapBytesArray<ValueSize>(dst, src, count);
+	}
+}
+
+/** Converts count host endian values of ValueSize bytes from src to big endian into dst (usually a payload being serialized). Pointers do not have to be aligned, but must not overlap. */
+template<std::size_t ValueSize>
+inline void storeBigEndianArray(void* const dst, void const* const src, std::size_t const count) noexcept
+{
+	// Same operation in both directions
+	loadBigEndianArray<ValueSize>(dst, src, count);
+}
+
+/** Converts count big endian values of ValueSize bytes from src by batches into a stack buffer, then calls handler with each host endian value. Used when values are not stored contiguously (std::set for example). */
+template<std::size_t ValueSize, std::size_t BatchSize = 16, typename Handler>
+inline void forEachBigEndianValue(void const* const src, std::size_t const count, Handler&& handler)
+{
+	using ValueType = typename detail::BulkValueType<ValueSize>::type;
+
+	auto batch = std::array<ValueType, BatchSize>{};
+	auto const* s = static_cast<std::uint8_t const*>(src);
+	for (auto remaining = count; remaining != 0u;)
+	{
+		auto const batchCount = remaining < BatchSize ? remaining : BatchSize;
+		loadBigEndianArray<ValueSize>(batch.data(), s, batchCount);
+		for (auto index = std::size_t{ 0u }; index < batchCount; ++index)
+		{
+			handler(batch[index]);
+		}
+		s += batchCount * ValueSize;
+		remaining -= batchCount;
+	}
+}
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -24,6 +24,7 @@
 
 #include "la/avdecc/internals/protocolMvuAecpdu.hpp"
 
+#include "protocolPduPool.hpp"
 #include "logHelper.hpp"
 
 #include <cassert>
@@ -69,6 +70,7 @@ void LA_AVDECC_CALL_CONVENTION MvuAecpdu::setCommandSpecificData(void const* con
 	}
 
 	_commandSpecificDataLength = commandSpecificDataLength;
+	_borrowedCommandSpecificData = nullptr;
 	if (_commandSpecificDataLength > 0 && AVDECC_ASSERT_WITH_RET(commandSpecificData != nullptr, "commandSpecificData must not be nullptr"))
 	{
 		std::memcpy(_commandSpecificData.data(), commandSpecificData, _commandSpecificDataLength);
@@ -89,9 +91,18 @@ MvuCommandType LA_AVDECC_CALL_CONVENTION MvuAecpdu::getCommandType() const noexc
 
 MvuAecpdu::Payload LA_AVDECC_CALL_CONVENTION MvuAecpdu::getPayload() const noexcept
 {
+	if (_borrowedCommandSpecificData != nullptr)
+	{
+		return std::make_pair(_borrowedCommandSpecificData, _commandSpecificDataLength);
+	}
 	return std::make_pair(_commandSpecificData.data(), _commandSpecificDataLength);
 }
 
+bool LA_AVDECC_CALL_CONVENTION MvuAecpdu::isPayloadBorrowed() const noexcept
+{
+	return _borrowedCommandSpecificData != nullptr;
+}
+
 void LA_AVDECC_CALL_CONVENTION MvuAecpdu::serialize(SerializationBuffer& buffer) const
 {
 	// First call parent
@@ -109,7 +120,7 @@ void LA_AVDECC_CALL_CONVENTION MvuAecpdu::serialize(SerializationBuffer& buffer)
 		payloadLength = std::min(payloadLength, MaximumSendPayloadBufferLength); // Clamping
 	}
 
-	buffer.packBuffer(_commandSpecificData.data(), payloadLength);
+	buffer.packBuffer(getPayload().first, payloadLength);
 
 	if (!AVDECC_ASSERT_WITH_RET((buffer.size() - previousSize) == (HeaderLength + payloadLength), "MvuAecpdu::serialize error: Packed buffer length != expected header length"))
 	{
@@ -174,7 +185,16 @@ void LA_AVDECC_CALL_CONVENTION MvuAecpdu::deserialize(DeserializationBuffer& buf
 		_commandSpecificDataLength = std::min(_commandSpecificDataLength, MaximumRecvPayloadBufferLength); // Clamping
 	}
 
-	buffer.unpackBuffer(_commandSpecificData.data(), _commandSpecificDataLength);
+	// Reference the payload in the buffer if allowed, instead of copying it
+	if (buffer.isBorrowingAllowed())
+	{
+		_borrowedCommandSpecificData = static_cast<std::uint8_t const*>(buffer.borrowBuffer(_commandSpecificDataLength));
+	}
+	else
+	{
+		_borrowedCommandSpecificData = nullptr;
+		buffer.unpackBuffer(_commandSpecificData.data(), _commandSpecificDataLength);
+	}
 
 #ifdef DEBUG
 	// Do not log this error in release, it might happen too often if an entity is bugged or if the message contains data this version of the library do not unpack
@@ -199,7 +219,7 @@ Aecpdu::UniquePointer LA_AVDECC_CALL_CONVENTION MvuAecpdu::responseCopy() const
 	};
 
 	// Create a response message as a copy of this
-	auto response = UniquePointer(new MvuAecpdu(*this), deleter);
+	auto response = UniquePointer(PduPool<MvuAecpdu>::getInstance().create(*this), deleter);
 	auto& mvu = static_cast<MvuAecpdu&>(*response);
 
 	// Change the message type to be an VENDOR_UNIQUE_RESPONSE
@@ -209,22 +229,56 @@ Aecpdu::UniquePointer LA_AVDECC_CALL_CONVENTION MvuAecpdu::responseCopy() const
 	return response;
 }
 
-// Defaulted compiler auto-generated methods
-MvuAecpdu::MvuAecpdu(MvuAecpdu&&) = default;
-MvuAecpdu::MvuAecpdu(MvuAecpdu const&) = default;
-MvuAecpdu& LA_AVDECC_CALL_CONVENTION MvuAecpdu::operator=(MvuAecpdu const&) = default;
-MvuAecpdu& LA_AVDECC_CALL_CONVENTION MvuAecpdu::operator=(MvuAecpdu&&) = default;
+// Compiler auto-generated methods (copies always own their payload, as they may outlive the buffer a borrowed payload is referencing)
+MvuAecpdu::MvuAecpdu(MvuAecpdu&& other)
+	: MvuAecpdu(static_cast<MvuAecpdu const&>(other))
+{
+}
+
+MvuAecpdu::MvuAecpdu(MvuAecpdu const& other)
+	: VuAecpdu(other)
+	, _unsolicited{ other._unsolicited }
+	, _commandType{ other._commandType }
+	, _commandSpecificDataLength{ other._commandSpecificDataLength }
+{
+	if (_commandSpecificDataLength > 0)
+	{
+		std::memcpy(_commandSpecificData.data(), other.getPayload().first, _commandSpecificDataLength);
+	}
+}
+
+MvuAecpdu& LA_AVDECC_CALL_CONVENTION MvuAecpdu::operator=(MvuAecpdu const& other)
+{
+	if (this != &other)
+	{
+		VuAecpdu::operator=(other);
+		_unsolicited = other._unsolicited;
+		_commandType = other._commandType;
+		_commandSpecificDataLength = other._commandSpecificDataLength;
+		if (_commandSpecificDataLength > 0)
+		{
+			std::memcpy(_commandSpecificData.data(), other.getPayload().first, _commandSpecificDataLength);
+		}
+		_borrowedCommandSpecificData = nullptr;
+	}
+	return *this;
+}
+
+MvuAecpdu& LA_AVDECC_CALL_CONVENTION MvuAecpdu::operator=(MvuAecpdu&& other)
+{
+	return operator=(static_cast<MvuAecpdu const&>(other));
+}
 
 /** Entry point */
 MvuAecpdu* LA_AVDECC_CALL_CONVENTION MvuAecpdu::createRawMvuAecpdu(bool const isResponse) noexcept
 {
-	return new MvuAecpdu(isResponse);
+	return PduPool<MvuAecpdu>::getInstance().create(isResponse);
 }
 
 /** Destroy method for COM-like interface */
 void LA_AVDECC_CALL_CONVENTION MvuAecpdu::destroy() noexcept
 {
-	delete this;
+	PduPool<MvuAecpdu>::getInstance().destroy(this);
 }
 
 } // namespace protocol
@@ -0,0 +1,185 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolPduPool.hpp
+* @author Christophe Calmejane
+* @brief Thread-safe object pools used by the PDU create/destroy factories.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+struct PduPoolStatistics
+{
+	std::uint64_t heapAllocations{ 0u }; /** Count of objects whose storage was allocated from the heap */
+	std::uint64_t reusedAllocations{ 0u }; /** Count of objects whose storage was taken from the freelist */
+	std::uint64_t heapReleases{ 0u }; /** Count of objects whose storage was returned to the heap (freelist full) */
+	std::size_t inUse{ 0u }; /** Count of objects currently alive */
+	std::size_t peakInUse{ 0u }; /** Highest count of objects alive at the same time */
+	std::size_t cached{ 0u }; /** Count of storage blocks currently held in the freelist */
+};
+
+/**
+* @brief Freelist of storage blocks for a single PDU type.
+* @details Storage of destroyed objects is kept (up to MaxCachedObjects) and reused by the next creation, removing the heap allocation from the per-packet path.
+*          The pool for each type is created on first use and never destroyed, so that PDUs released during static destruction are still handled properly.
+* @note Thread-safe.
+*/
+template<class PduType, std::size_t MaxCachedObjects = 64>
+class PduPool final
+{
+public:
+	static PduPool& getInstance() noexcept
+	{
+		static auto* const s_Instance = new PduPool{};
+		return *s_Instance;
+	}
+
+	/** Constructs a new PduType in pooled storage. Returns nullptr if the storage cannot be allocated. */
+	template<typename... Args>
+	PduType* create(Args&&... args) noexcept
+	{
+		auto* storage = acquireStorage();
+		if (storage == nullptr)
+		{
+			return nullptr;
+		}
+		try
+		{
+			return new (storage) PduType(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			releaseStorage(storage);
+			return nullptr;
+		}
+	}
+
+	/** Destroys an object previously returned by create, and returns its storage to the pool */
+	void destroy(PduType* const pdu) noexcept
+	{
+		if (pdu != nullptr)
+		{
+			pdu->~PduType();
+			releaseStorage(pdu);
+		}
+	}
+
+	PduPoolStatistics getStatistics() const noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+		auto statistics = _statistics;
+		statistics.cached = _freeList.size();
+		return statistics;
+	}
+
+	/** Returns all cached storage blocks to the heap */
+	void trim() noexcept
+	{
+		auto freeList = decltype(_freeList){};
+		{
+			auto const lg = std::lock_guard{ _lock };
+			freeList.swap(_freeList);
+			_statistics.heapReleases += freeList.size();
+		}
+		for (auto* storage : freeList)
+		{
+			::operator delete(storage);
+		}
+	}
+
+	// Deleted compiler auto-generated methods
+	PduPool(PduPool&&) = delete;
+	PduPool(PduPool const&) = delete;
+	PduPool& operator=(PduPool const&) = delete;
+	PduPool& operator=(PduPool&&) = delete;
+
+private:
+	PduPool() noexcept
+	{
+		_freeList.reserve(MaxCachedObjects);
+	}
+
+	~PduPool() noexcept = default;
+
+	void* acquireStorage() noexcept
+	{
+		{
+			auto const lg = std::lock_guard{ _lock };
+			++_statistics.inUse;
+			if (_statistics.inUse > _statistics.peakInUse)
+			{
+				_statistics.peakInUse = _statistics.inUse;
+			}
+			if (!_freeList.empty())
+			{
+				auto* const storage = _freeList.back();
+				_freeList.pop_back();
+				++_statistics.reusedAllocations;
+				return storage;
+			}
+			++_statistics.heapAllocations;
+		}
+
+		auto* const storage = ::operator new(sizeof(PduType), std::nothrow);
+		if (storage == nullptr)
+		{
+			auto const lg = std::lock_guard{ _lock };
+			--_statistics.inUse;
+			--_statistics.heapAllocations;
+		}
+		return storage;
+	}
+
+	void releaseStorage(void* const storage) noexcept
+	{
+		{
+			auto const lg = std::lock_guard{ _lock };
+			--_statistics.inUse;
+			if (_freeList.size() < MaxCachedObjects)
+			{
+				_freeList.push_back(storage);
+				return;
+			}
+			++_statistics.heapReleases;
+		}
+		::operator delete(storage);
+	}
+
+	mutable std::mutex _lock{};
+	std::vector<void*> _freeList{};
+	PduPoolStatistics _statistics{};
+};
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
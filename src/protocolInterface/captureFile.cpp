@@ -0,0 +1,512 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file captureFile.cpp
+* @author Christophe Calmejane
+*/
+
+#include "captureFile.hpp"
+
+#include "la/avdecc/internals/endian.hpp"
+#include "la/avdecc/utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+namespace captureFile
+{
+// pcap (https://www.ietf.org/archive/id/draft-ietf-opsawg-pcap-04.html)
+static constexpr std::uint32_t PcapMagicMicroseconds = 0xA1B2C3D4;
+static constexpr std::uint32_t PcapMagicNanoseconds = 0xA1B23C4D;
+static constexpr std::size_t PcapFileHeaderLength = 24u;
+static constexpr std::size_t PcapRecordHeaderLength = 16u;
+
+// pcapng (https://www.ietf.org/archive/id/draft-ietf-opsawg-pcapng-02.html)
+static constexpr std::uint32_t PcapNgBlockTypeSectionHeader = 0x0A0D0D0A;
+static constexpr std::uint32_t PcapNgBlockTypeInterfaceDescription = 0x00000001;
+static constexpr std::uint32_t PcapNgBlockTypeSimplePacket = 0x00000003;
+static constexpr std::uint32_t PcapNgBlockTypeEnhancedPacket = 0x00000006;
+static constexpr std::uint32_t PcapNgByteOrderMagic = 0x1A2B3C4D;
+static constexpr std::uint16_t PcapNgOptionEndOfOpt = 0u;
+static constexpr std::uint16_t PcapNgOptionIfName = 2u;
+static constexpr std::uint16_t PcapNgOptionIfTsResol = 9u;
+static constexpr std::uint16_t PcapNgOptionEpbFlags = 2u;
+static constexpr std::uint8_t PcapNgTsResolNanoseconds = 9u;
+static constexpr std::size_t PcapNgMinimumBlockLength = 12u;
+static constexpr std::size_t PcapNgMaximumBlockLength = 16u * 1024u * 1024u; // Sanity check to prevent absurd allocations on corrupted files
+
+/** Computes (ticks * 1000000000) / ticksPerSecond without overflowing, ticks being lower than ticksPerSecond. */
+static std::uint64_t subSecondTicksToNanoseconds(std::uint64_t const ticks, std::uint64_t const ticksPerSecond) noexcept
+{
+	constexpr auto NanosecondsPerSecond = std::uint64_t{ 1000000000u };
+
+	// The product fits in 64 bits (always the case for resolutions up to about 1e10 ticks per second)
+	if (ticks <= (std::numeric_limits<std::uint64_t>::max() / NanosecondsPerSecond))
+	{
+		return (ticks * NanosecondsPerSecond) / ticksPerSecond;
+	}
+
+	// Finer resolution, compute one decimal digit at a time (long division), the remainder always staying lower than ticksPerSecond
+	auto nanoseconds = std::uint64_t{ 0u };
+	auto remainder = ticks;
+	for (auto digit = 0u; digit < 9u; ++digit)
+	{
+		// Split remainder * 10 into digitValue * ticksPerSecond + newRemainder, using additions that cannot overflow
+		auto digitValue = std::uint64_t{ 0u };
+		auto newRemainder = std::uint64_t{ 0u };
+		for (auto i = 0u; i < 10u; ++i)
+		{
+			if (newRemainder >= (ticksPerSecond - remainder))
+			{
+				newRemainder -= ticksPerSecond - remainder;
+				++digitValue;
+			}
+			else
+			{
+				newRemainder += remainder;
+			}
+		}
+		nanoseconds = nanoseconds * 10u + digitValue;
+		remainder = newRemainder;
+	}
+	return nanoseconds;
+}
+
+static std::chrono::nanoseconds ticksToNanoseconds(std::uint64_t const ticks, std::uint64_t const ticksPerSecond) noexcept
+{
+	if (ticksPerSecond == 0u)
+	{
+		return std::chrono::nanoseconds{ 0 };
+	}
+	auto const seconds = ticks / ticksPerSecond;
+	auto const remainder = ticks % ticksPerSecond;
+	return std::chrono::seconds{ seconds } + std::chrono::nanoseconds{ subSecondTicksToNanoseconds(remainder, ticksPerSecond) };
+}
+
+template<typename T>
+static T readValue(std::uint8_t const* const ptr) noexcept
+{
+	auto value = T{};
+	std::memcpy(&value, ptr, sizeof(T));
+	return value;
+}
+
+Reader::Reader(std::string const& filePath)
+	: _stream{ utils::filePathFromUTF8String(filePath), std::ios::binary | std::ios::in }
+{
+	if (!_stream.is_open())
+	{
+		throw std::invalid_argument("Cannot open capture file: " + filePath);
+	}
+
+	auto magic = std::uint32_t{ 0u };
+	if (!readBytes(&magic, sizeof(magic)))
+	{
+		throw std::invalid_argument("Not a capture file (too small)");
+	}
+
+	// pcap file
+	if (magic == PcapMagicMicroseconds || magic == PcapMagicNanoseconds || endianSwap<Endianness::LittleEndian, Endianness::BigEndian>(magic) == PcapMagicMicroseconds || endianSwap<Endianness::LittleEndian, Endianness::BigEndian>(magic) == PcapMagicNanoseconds)
+	{
+		_format = Format::Pcap;
+		_isSwapped = (magic != PcapMagicMicroseconds && magic != PcapMagicNanoseconds);
+		_pcapTicksPerSecond = (toHost(magic) == PcapMagicNanoseconds) ? 1000000000u : 1000000u;
+
+		auto header = std::array<std::uint8_t, PcapFileHeaderLength - sizeof(magic)>{};
+		if (!readBytes(header.data(), header.size()))
+		{
+			throw std::invalid_argument("Invalid pcap file header");
+		}
+		// version_major(2) version_minor(2) reserved1(4) reserved2(4) snaplen(4) linktype(4)
+		_pcapLinkType = toHost(readValue<std::uint32_t>(header.data() + 16)) & 0x0FFFFFFF; // Upper bits are FCS information
+		return;
+	}
+
+	// pcapng file (always starts with a Section Header Block, whose type is endianness agnostic)
+	if (magic == PcapNgBlockTypeSectionHeader)
+	{
+		_format = Format::PcapNg;
+		// Rewind so the Section Header Block is processed like any other block
+		_stream.seekg(0, std::ios::beg);
+		return;
+	}
+
+	throw std::invalid_argument("Unsupported capture file format");
+}
+
+std::optional<Frame> Reader::readNextFrame()
+{
+	switch (_format)
+	{
+		case Format::Pcap:
+			return readNextPcapFrame();
+		case Format::PcapNg:
+			return readNextPcapNgFrame();
+		default:
+			AVDECC_ASSERT(false, "Unhandled Format");
+			return std::nullopt;
+	}
+}
+
+bool Reader::readBytes(void* const buffer, std::size_t const length)
+{
+	_stream.read(static_cast<char*>(buffer), static_cast<std::streamsize>(length));
+	return static_cast<std::size_t>(_stream.gcount()) == length;
+}
+
+std::uint16_t Reader::toHost(std::uint16_t const value) const noexcept
+{
+	return _isSwapped ? endianSwap<Endianness::LittleEndian, Endianness::BigEndian>(value) : value;
+}
+
+std::uint32_t Reader::toHost(std::uint32_t const value) const noexcept
+{
+	return _isSwapped ? endianSwap<Endianness::LittleEndian, Endianness::BigEndian>(value) : value;
+}
+
+std::optional<Frame> Reader::readNextPcapFrame()
+{
+	while (true)
+	{
+		auto header = std::array<std::uint8_t, PcapRecordHeaderLength>{};
+		if (!readBytes(header.data(), header.size()))
+		{
+			return std::nullopt;
+		}
+
+		auto const seconds = toHost(readValue<std::uint32_t>(header.data()));
+		auto const subSeconds = toHost(readValue<std::uint32_t>(header.data() + 4));
+		auto const capturedLength = toHost(readValue<std::uint32_t>(header.data() + 8));
+
+		if (capturedLength > PcapNgMaximumBlockLength)
+		{
+			throw std::runtime_error("Corrupted pcap record (invalid captured length)");
+		}
+
+		auto frame = Frame{};
+		frame.timestamp = std::chrono::seconds{ seconds } + ticksToNanoseconds(subSeconds, _pcapTicksPerSecond);
+		frame.data.set_size(capturedLength);
+		if (!readBytes(frame.data.data(), capturedLength))
+		{
+			// Truncated last record, consider it as end of file
+			return std::nullopt;
+		}
+
+		if (_pcapLinkType == LinkTypeEthernet)
+		{
+			return frame;
+		}
+	}
+}
+
+std::optional<Frame> Reader::readNextPcapNgFrame()
+{
+	auto body = std::vector<std::uint8_t>{};
+
+	while (true)
+	{
+		auto blockType = std::uint32_t{ 0u };
+		auto blockLength = std::uint32_t{ 0u };
+		if (!readBytes(&blockType, sizeof(blockType)) || !readBytes(&blockLength, sizeof(blockLength)))
+		{
+			return std::nullopt;
+		}
+
+		// Section Header Block may change the byte order, peek the byte-order magic before decoding the length
+		if (blockType == PcapNgBlockTypeSectionHeader)
+		{
+			auto byteOrderMagic = std::uint32_t{ 0u };
+			if (!readBytes(&byteOrderMagic, sizeof(byteOrderMagic)))
+			{
+				return std::nullopt;
+			}
+			if (byteOrderMagic != PcapNgByteOrderMagic && endianSwap<Endianness::LittleEndian, Endianness::BigEndian>(byteOrderMagic) != PcapNgByteOrderMagic)
+			{
+				throw std::runtime_error("Corrupted pcapng Section Header Block (invalid byte-order magic)");
+			}
+			_isSwapped = (byteOrderMagic != PcapNgByteOrderMagic);
+			_stream.seekg(-static_cast<std::streamoff>(sizeof(byteOrderMagic)), std::ios::cur);
+		}
+
+		blockLength = toHost(blockLength);
+		if (blockLength < PcapNgMinimumBlockLength || blockLength > PcapNgMaximumBlockLength || (blockLength % 4) != 0)
+		{
+			throw std::runtime_error("Corrupted pcapng block (invalid block length)");
+		}
+
+		// Read block body and trailing length
+		body.resize(blockLength - PcapNgMinimumBlockLength);
+		auto trailingLength = std::uint32_t{ 0u };
+		if (!readBytes(body.data(), body.size()) || !readBytes(&trailingLength, sizeof(trailingLength)))
+		{
+			// Truncated last block, consider it as end of file
+			return std::nullopt;
+		}
+		if (toHost(trailingLength) != blockLength)
+		{
+			throw std::runtime_error("Corrupted pcapng block (mismatching trailing block length)");
+		}
+
+		switch (toHost(blockType))
+		{
+			case PcapNgBlockTypeSectionHeader:
+				parseSectionHeaderBlock(body);
+				break;
+			case PcapNgBlockTypeInterfaceDescription:
+				parseInterfaceDescriptionBlock(body);
+				break;
+			case PcapNgBlockTypeEnhancedPacket:
+			{
+				// interface_id(4) timestamp_high(4) timestamp_low(4) captured_length(4) original_length(4) data
+				if (body.size() < 20u)
+				{
+					throw std::runtime_error("Corrupted pcapng Enhanced Packet Block");
+				}
+				auto const interfaceID = toHost(readValue<std::uint32_t>(body.data()));
+				auto const timestampHigh = toHost(readValue<std::uint32_t>(body.data() + 4));
+				auto const timestampLow = toHost(readValue<std::uint32_t>(body.data() + 8));
+				auto const capturedLength = toHost(readValue<std::uint32_t>(body.data() + 12));
+				if (interfaceID >= _interfaces.size() || capturedLength > (body.size() - 20u))
+				{
+					throw std::runtime_error("Corrupted pcapng Enhanced Packet Block");
+				}
+				auto const& intfc = _interfaces[interfaceID];
+				if (intfc.linkType != LinkTypeEthernet)
+				{
+					break;
+				}
+				auto frame = Frame{};
+				frame.timestamp = ticksToNanoseconds((static_cast<std::uint64_t>(timestampHigh) << 32) | timestampLow, intfc.ticksPerSecond);
+				frame.interfaceID = interfaceID;
+				frame.data.assign(body.data() + 20, capturedLength);
+				return frame;
+			}
+			case PcapNgBlockTypeSimplePacket:
+			{
+				// original_length(4) data (always refers to the first interface, no timestamp)
+				if (body.size() < 4u || _interfaces.empty())
+				{
+					throw std::runtime_error("Corrupted pcapng Simple Packet Block");
+				}
+				if (_interfaces[0].linkType != LinkTypeEthernet)
+				{
+					break;
+				}
+				auto const originalLength = toHost(readValue<std::uint32_t>(body.data()));
+				auto frame = Frame{};
+				frame.data.assign(body.data() + 4, std::min(static_cast<std::size_t>(originalLength), body.size() - 4u));
+				return frame;
+			}
+			default:
+				// Ignore all other blocks
+				break;
+		}
+	}
+}
+
+void Reader::parseSectionHeaderBlock(std::vector<std::uint8_t> const& /*body*/)
+{
+	// A new section starts, Interface IDs are local to a section
+	_interfaces.clear();
+}
+
+void Reader::parseInterfaceDescriptionBlock(std::vector<std::uint8_t> const& body)
+{
+	// link_type(2) reserved(2) snap_len(4) options
+	if (body.size() < 8u)
+	{
+		throw std::runtime_error("Corrupted pcapng Interface Description Block");
+	}
+
+	auto intfc = InterfaceDescription{};
+	intfc.linkType = toHost(readValue<std::uint16_t>(body.data()));
+
+	// Parse options, looking for if_tsresol
+	auto offset = std::size_t{ 8u };
+	while ((offset + 4u) <= body.size())
+	{
+		auto const optionCode = toHost(readValue<std::uint16_t>(body.data() + offset));
+		auto const optionLength = toHost(readValue<std::uint16_t>(body.data() + offset + 2));
+		offset += 4u;
+		if (optionCode == PcapNgOptionEndOfOpt || (offset + optionLength) > body.size())
+		{
+			break;
+		}
+		if (optionCode == PcapNgOptionIfTsResol && optionLength >= 1u)
+		{
+			auto const resolution = body[offset];
+			auto const exponent = static_cast<std::uint8_t>(resolution & 0x7F);
+			auto const base = std::uint64_t{ (resolution & 0x80) ? 2u : 10u };
+			auto ticksPerSecond = std::uint64_t{ 1u };
+			for (auto i = 0u; i < exponent && ticksPerSecond <= (UINT64_MAX / base); ++i)
+			{
+				ticksPerSecond *= base;
+			}
+			intfc.ticksPerSecond = ticksPerSecond;
+		}
+		// Options are padded to 32 bits
+		offset += (optionLength + 3u) & ~std::size_t{ 3u };
+	}
+
+	_interfaces.push_back(intfc);
+}
+
+Writer::Writer(std::string const& filePath, std::string const& interfaceName, std::uint32_t const snapLength)
+	: _stream{ utils::filePathFromUTF8String(filePath), std::ios::binary | std::ios::out | std::ios::trunc }
+	, _snapLength{ snapLength }
+{
+	if (!_stream.is_open())
+	{
+		throw std::invalid_argument("Cannot create capture file: " + filePath);
+	}
+
+	try
+	{
+		// Section Header Block: byte_order_magic(4) major(2) minor(2) section_length(8), no option
+		{
+			auto const blockLength = static_cast<std::uint32_t>(PcapNgMinimumBlockLength + 16u);
+			auto const sectionLength = std::int64_t{ -1 }; // Unspecified
+			writeBytes(&PcapNgBlockTypeSectionHeader, sizeof(PcapNgBlockTypeSectionHeader));
+			writeBytes(&blockLength, sizeof(blockLength));
+			writeBytes(&PcapNgByteOrderMagic, sizeof(PcapNgByteOrderMagic));
+			auto const majorVersion = std::uint16_t{ 1u };
+			auto const minorVersion = std::uint16_t{ 0u };
+			writeBytes(&majorVersion, sizeof(majorVersion));
+			writeBytes(&minorVersion, sizeof(minorVersion));
+			writeBytes(&sectionLength, sizeof(sectionLength));
+			writeBytes(&blockLength, sizeof(blockLength));
+		}
+
+		// Interface Description Block: link_type(2) reserved(2) snap_len(4) if_name if_tsresol opt_endofopt
+		{
+			auto const nameLength = static_cast<std::uint16_t>(std::min<std::size_t>(interfaceName.size(), 0xFFFC));
+			auto const paddedNameLength = static_cast<std::uint32_t>((nameLength + 3u) & ~std::uint32_t{ 3u });
+			auto const optionsLength = (nameLength != 0u ? 4u + paddedNameLength : 0u) + 4u + 4u + 4u;
+			auto const blockLength = static_cast<std::uint32_t>(PcapNgMinimumBlockLength + 8u + optionsLength);
+			writeBytes(&PcapNgBlockTypeInterfaceDescription, sizeof(PcapNgBlockTypeInterfaceDescription));
+			writeBytes(&blockLength, sizeof(blockLength));
+			auto const linkType = LinkTypeEthernet;
+			auto const reserved = std::uint16_t{ 0u };
+			writeBytes(&linkType, sizeof(linkType));
+			writeBytes(&reserved, sizeof(reserved));
+			writeBytes(&_snapLength, sizeof(_snapLength));
+			if (nameLength != 0u)
+			{
+				writeBytes(&PcapNgOptionIfName, sizeof(PcapNgOptionIfName));
+				writeBytes(&nameLength, sizeof(nameLength));
+				writeBytes(interfaceName.data(), nameLength);
+				writePadding(nameLength);
+			}
+			auto const tsResolLength = std::uint16_t{ 1u };
+			writeBytes(&PcapNgOptionIfTsResol, sizeof(PcapNgOptionIfTsResol));
+			writeBytes(&tsResolLength, sizeof(tsResolLength));
+			writeBytes(&PcapNgTsResolNanoseconds, sizeof(PcapNgTsResolNanoseconds));
+			writePadding(sizeof(PcapNgTsResolNanoseconds));
+			auto const endOfOpt = std::uint32_t{ 0u };
+			writeBytes(&endOfOpt, sizeof(endOfOpt));
+			writeBytes(&blockLength, sizeof(blockLength));
+		}
+	}
+	catch (std::runtime_error const& e)
+	{
+		throw std::invalid_argument(e.what());
+	}
+}
+
+void Writer::writeFrame(std::chrono::nanoseconds const timestamp, std::uint8_t const* const data, std::size_t const capturedLength, std::size_t const originalLength, Direction const direction)
+{
+	auto const length = static_cast<std::uint32_t>(std::min<std::size_t>(capturedLength, _snapLength));
+	auto const paddedLength = (length + 3u) & ~std::uint32_t{ 3u };
+	auto const hasFlags = direction != Direction::Unknown;
+	auto const optionsLength = hasFlags ? (4u + 4u + 4u) : 0u;
+	auto const blockLength = static_cast<std::uint32_t>(PcapNgMinimumBlockLength + 20u + paddedLength + optionsLength);
+	auto const ticks = static_cast<std::uint64_t>(timestamp.count());
+	auto const timestampHigh = static_cast<std::uint32_t>(ticks >> 32);
+	auto const timestampLow = static_cast<std::uint32_t>(ticks & 0xFFFFFFFF);
+	auto const interfaceID = std::uint32_t{ 0u };
+	auto const origLength = static_cast<std::uint32_t>(originalLength);
+
+	// Enhanced Packet Block: interface_id(4) timestamp_high(4) timestamp_low(4) captured_length(4) original_length(4) data epb_flags opt_endofopt
+	writeBytes(&PcapNgBlockTypeEnhancedPacket, sizeof(PcapNgBlockTypeEnhancedPacket));
+	writeBytes(&blockLength, sizeof(blockLength));
+	writeBytes(&interfaceID, sizeof(interfaceID));
+	writeBytes(&timestampHigh, sizeof(timestampHigh));
+	writeBytes(&timestampLow, sizeof(timestampLow));
+	writeBytes(&length, sizeof(length));
+	writeBytes(&origLength, sizeof(origLength));
+	writeBytes(data, length);
+	writePadding(length);
+	if (hasFlags)
+	{
+		// epb_flags: bits 0-1 are the direction (01 = inbound, 10 = outbound)
+		auto const flagsLength = std::uint16_t{ 4u };
+		auto const flags = static_cast<std::uint32_t>(direction);
+		writeBytes(&PcapNgOptionEpbFlags, sizeof(PcapNgOptionEpbFlags));
+		writeBytes(&flagsLength, sizeof(flagsLength));
+		writeBytes(&flags, sizeof(flags));
+		auto const endOfOpt = std::uint32_t{ 0u };
+		writeBytes(&endOfOpt, sizeof(endOfOpt));
+	}
+	writeBytes(&blockLength, sizeof(blockLength));
+}
+
+void Writer::flush()
+{
+	_stream.flush();
+}
+
+std::uint64_t Writer::getFileSize() const noexcept
+{
+	return _fileSize;
+}
+
+void Writer::writeBytes(void const* const buffer, std::size_t const length)
+{
+	_stream.write(static_cast<char const*>(buffer), static_cast<std::streamsize>(length));
+	if (!_stream.good())
+	{
+		throw std::runtime_error("Failed to write to capture file");
+	}
+	_fileSize += length;
+}
+
+void Writer::writePadding(std::size_t const length)
+{
+	static constexpr auto Padding = std::array<std::uint8_t, 4>{};
+	auto const paddingLength = (4u - (length % 4u)) % 4u;
+	if (paddingLength != 0u)
+	{
+		writeBytes(Padding.data(), paddingLength);
+	}
+}
+
+} // namespace captureFile
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,156 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file captureFile.hpp
+* @author Christophe Calmejane
+* @brief Minimal reader and writer for pcap and pcapng capture files (Ethernet link type only).
+*/
+
+#pragma once
+
+#include "la/avdecc/memoryBuffer.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+namespace captureFile
+{
+/** LinkType for Ethernet frames (LINKTYPE_ETHERNET) */
+static constexpr std::uint16_t LinkTypeEthernet = 1u;
+
+/** Direction of a captured frame, relative to the capturing interface */
+enum class Direction
+{
+	Unknown = 0,
+	Inbound = 1,
+	Outbound = 2,
+};
+
+/** A single frame read from a capture file */
+struct Frame
+{
+	std::chrono::nanoseconds timestamp{}; /** Capture timestamp, relative to the epoch (or 0 if the capture format doesn't provide one for this frame) */
+	std::uint32_t interfaceID{ 0u }; /** Index of the capture interface (always 0 for pcap files) */
+	la::avdecc::MemoryBuffer data{}; /** Raw Ethernet frame (starting with the destination MAC address) */
+};
+
+/**
+* @brief Sequential reader for pcap and pcapng capture files.
+* @details The file format (pcap with microsecond or nanosecond resolution, pcapng) and its byte order are automatically detected.
+*          Only frames captured on an Ethernet interface are returned, all other blocks and frames are silently skipped.
+* @note Not thread-safe.
+*/
+class Reader final
+{
+public:
+	/** Opens the specified capture file. Throws std::invalid_argument if the file cannot be opened or is not a supported capture file. */
+	explicit Reader(std::string const& filePath);
+
+	/** Returns the next Ethernet frame of the file, or std::nullopt when the end of the file has been reached. Throws std::runtime_error if the file is corrupted. */
+	std::optional<Frame> readNextFrame();
+
+	// Defaulted compiler auto-generated methods
+	Reader(Reader&&) = default;
+	Reader& operator=(Reader&&) = default;
+
+	// Deleted compiler auto-generated methods
+	Reader(Reader const&) = delete;
+	Reader& operator=(Reader const&) = delete;
+
+private:
+	enum class Format
+	{
+		Pcap,
+		PcapNg,
+	};
+	struct InterfaceDescription
+	{
+		std::uint16_t linkType{ 0u };
+		std::uint64_t ticksPerSecond{ 1000000u }; /** if_tsresol (default is microseconds) */
+	};
+
+	bool readBytes(void* const buffer, std::size_t const length);
+	std::uint16_t toHost(std::uint16_t const value) const noexcept;
+	std::uint32_t toHost(std::uint32_t const value) const noexcept;
+	std::optional<Frame> readNextPcapFrame();
+	std::optional<Frame> readNextPcapNgFrame();
+	void parseSectionHeaderBlock(std::vector<std::uint8_t> const& body);
+	void parseInterfaceDescriptionBlock(std::vector<std::uint8_t> const& body);
+
+	std::ifstream _stream{};
+	Format _format{ Format::Pcap };
+	bool _isSwapped{ false };
+	std::uint64_t _pcapTicksPerSecond{ 1000000u };
+	std::uint32_t _pcapLinkType{ 0u };
+	std::vector<InterfaceDescription> _interfaces{};
+};
+
+/**
+* @brief Sequential pcapng writer.
+* @details Writes a Section Header Block and a single Ethernet Interface Description Block (nanosecond resolution) when the file is created,
+*          then one Enhanced Packet Block per frame, in host byte order.
+* @note Not thread-safe.
+*/
+class Writer final
+{
+public:
+	/** Creates (or truncates) the specified capture file. Throws std::invalid_argument if the file cannot be created. */
+	Writer(std::string const& filePath, std::string const& interfaceName, std::uint32_t const snapLength);
+
+	/** Writes a frame. The frame is truncated to the snapLength of the file. Throws std::runtime_error if the write failed. */
+	void writeFrame(std::chrono::nanoseconds const timestamp, std::uint8_t const* const data, std::size_t const capturedLength, std::size_t const originalLength, Direction const direction);
+
+	/** Flushes buffered data to the file. */
+	void flush();
+
+	/** Returns the current size of the file, in bytes. */
+	std::uint64_t getFileSize() const noexcept;
+
+	// Defaulted compiler auto-generated methods
+	Writer(Writer&&) = default;
+	Writer& operator=(Writer&&) = default;
+
+	// Deleted compiler auto-generated methods
+	Writer(Writer const&) = delete;
+	Writer& operator=(Writer const&) = delete;
+
+private:
+	void writeBytes(void const* const buffer, std::size_t const length);
+	void writePadding(std::size_t const length);
+
+	std::ofstream _stream{};
+	std::uint32_t _snapLength{ 0u };
+	std::uint64_t _fileSize{ 0u };
+};
+
+} // namespace captureFile
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -20,6 +20,8 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 #include "cobsSerialization.hpp"
@@ -43,32 +45,42 @@ std::size_t encode(const std::uint8_t* input, std::size_t input_length, std::uin
 {
 	std::size_t read_index = 0, write_index = 1;
 	std::size_t code_index = 0;
-	std::uint8_t code = 1;
 
-	while (read_index < input_length)
+	// Copy whole runs of non-zero bytes at once (a run is at most 254 bytes long)
+	while (true)
 	{
-		if (input[read_index] == 0)
+		auto const chunk_length = std::min<std::size_t>(input_length - read_index, 0xFE);
+		auto const* const zero = chunk_length != 0 ? static_cast<const std::uint8_t*>(std::memchr(input + read_index, 0, chunk_length)) : nullptr;
+		auto const run_length = zero != nullptr ? static_cast<std::size_t>(zero - (input + read_index)) : chunk_length;
+
+		if (run_length != 0)
+		{
+			std::memcpy(output + write_index, input + read_index, run_length);
+		}
+		write_index += run_length;
+		read_index += run_length;
+
+		if (zero != nullptr)
 		{
-			output[code_index] = code;
-			code = 1;
+			// Zero byte replaced by the code
+			output[code_index] = static_cast<std::uint8_t>(run_length + 1);
 			code_index = write_index++;
 			read_index++;
 		}
+		else if (run_length == 0xFE)
+		{
+			// Maximum run length reached
+			output[code_index] = 0xFF;
+			code_index = write_index++;
+		}
 		else
 		{
-			output[write_index++] = input[read_index++];
-			code++;
-			if (code == 0xFF)
-			{
-				output[code_index] = code;
-				code = 1;
-				code_index = write_index++;
-			}
+			// End of input
+			output[code_index] = static_cast<std::uint8_t>(run_length + 1);
+			break;
 		}
 	}
 
-	output[code_index] = code;
-
 	return write_index;
 }
 
@@ -118,6 +130,61 @@ std::size_t decode(const std::uint8_t* input, std::size_t input_length, std::uin
 	return write_index;
 }
 
+/**
+ * Decodes a COBS encoded message in place (the decoded message is always shorter than the encoded one)
+ * @param buffer [in,out] pointer to the COBS encoded message, replaced with the decoded message
+ * @param length [in] the length of the COBS encoded message
+ * @return the number of decoded bytes at the start of "buffer" if it was successfully
+ * unstuffed, and 0 if there was an error unstuffing "buffer".
+ */
+std::size_t decodeInPlace(std::uint8_t* buffer, std::size_t length) noexcept
+{
+	std::size_t read_index = 0, write_index = 0;
+
+	while (read_index < length)
+	{
+		auto const code = buffer[read_index];
+
+		if (read_index + code > length && code != 1)
+		{
+			return 0;
+		}
+
+		read_index++;
+
+		// Each block consumes (1 + run) bytes and produces at most (run + 1) bytes, so write_index never overtakes read_index
+		auto const run_length = code != 0 ? static_cast<std::size_t>(code - 1) : std::size_t{ 0u };
+		std::memmove(buffer + write_index, buffer + read_index, run_length);
+		write_index += run_length;
+		read_index += run_length;
+
+		if (code != 0xFF && read_index != length)
+		{
+			buffer[write_index++] = '\0';
+		}
+	}
+
+	return write_index;
+}
+
+/**
+ * Searches for the next DelimiterByte
+ * @param begin [in] pointer to the first byte to search
+ * @param end [in] pointer past the last byte to search
+ * @return pointer to the first DelimiterByte found, or "end" if there is none.
+ */
+const std::uint8_t* findDelimiter(const std::uint8_t* begin, const std::uint8_t* end) noexcept
+{
+	if (begin >= end)
+	{
+		return end;
+	}
+
+	// memchr is vectorized by all major C libraries
+	auto const* const delimiter = std::memchr(begin, DelimiterByte, static_cast<std::size_t>(end - begin));
+	return delimiter != nullptr ? static_cast<const std::uint8_t*>(delimiter) : end;
+}
+
 } // namespace cobs
 } // namespace protocol
 } // namespace avdecc
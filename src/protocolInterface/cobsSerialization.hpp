@@ -64,6 +64,23 @@ std::size_t encode(const std::uint8_t* input, std::size_t input_length, std::uin
  */
 std::size_t decode(const std::uint8_t* input, std::size_t input_length, std::uint8_t* output, std::size_t output_length);
 
+/**
+ * Decodes a COBS encoded message in place (the decoded message is always shorter than the encoded one)
+ * @param buffer [in,out] pointer to the COBS encoded message, replaced with the decoded message
+ * @param length [in] the length of the COBS encoded message
+ * @return the number of decoded bytes at the start of "buffer" if it was successfully
+ * unstuffed, and 0 if there was an error unstuffing "buffer".
+ */
+std::size_t decodeInPlace(std::uint8_t* buffer, std::size_t length) noexcept;
+
+/**
+ * Searches for the next DelimiterByte
+ * @param begin [in] pointer to the first byte to search
+ * @param end [in] pointer past the last byte to search
+ * @return pointer to the first DelimiterByte found, or "end" if there is none.
+ */
+const std::uint8_t* findDelimiter(const std::uint8_t* begin, const std::uint8_t* end) noexcept;
+
 } // namespace cobs
 } // namespace protocol
 } // namespace avdecc
@@ -63,6 +63,8 @@ public:
 
 			// Create a deserialization buffer
 			auto des = DeserializationBuffer(pkt_data, pkt_len);
+			// Created PDUs never outlive this method (handlers needing to retain one make a copy), so they can reference the payload in the frame instead of copying it
+			des.setBorrowingAllowed(true);
 
 			switch (subType)
 			{
@@ -93,28 +95,28 @@ public:
 				{
 					auto const messageType = static_cast<AecpMessageType>(controlData);
 
-					static std::unordered_map<AecpMessageType, std::function<Aecpdu::UniquePointer(BaseClass* const pi, EtherLayer2 const& etherLayer2, Deserializer& des, std::uint8_t const* const pkt_data, size_t const pkt_len)>, AecpMessageType::Hash> s_Dispatch{
-						{ AecpMessageType::AemCommand,
+					static auto const s_Dispatch = utils::DispatchTable<Aecpdu::UniquePointer(BaseClass* const pi, EtherLayer2 const& etherLayer2, Deserializer& des, std::uint8_t const* const pkt_data, size_t const pkt_len), 0x10>{ // AECP message_type is a 4 bits field
+						{ AecpMessageType::AemCommand.getValue(),
 							[](BaseClass* const /*pi*/, EtherLayer2 const& /*etherLayer2*/, Deserializer& /*des*/, std::uint8_t const* const /*pkt_data*/, size_t const /*pkt_len*/)
 							{
 								return AemAecpdu::create(false);
 							} },
-						{ AecpMessageType::AemResponse,
+						{ AecpMessageType::AemResponse.getValue(),
 							[](BaseClass* const /*pi*/, EtherLayer2 const& /*etherLayer2*/, Deserializer& /*des*/, std::uint8_t const* const /*pkt_data*/, size_t const /*pkt_len*/)
 							{
 								return AemAecpdu::create(true);
 							} },
-						{ AecpMessageType::AddressAccessCommand,
+						{ AecpMessageType::AddressAccessCommand.getValue(),
 							[](BaseClass* const /*pi*/, EtherLayer2 const& /*etherLayer2*/, Deserializer& /*des*/, std::uint8_t const* const /*pkt_data*/, size_t const /*pkt_len*/)
 							{
 								return AaAecpdu::create(false);
 							} },
-						{ AecpMessageType::AddressAccessResponse,
+						{ AecpMessageType::AddressAccessResponse.getValue(),
 							[](BaseClass* const /*pi*/, EtherLayer2 const& /*etherLayer2*/, Deserializer& /*des*/, std::uint8_t const* const /*pkt_data*/, size_t const /*pkt_len*/)
 							{
 								return AaAecpdu::create(true);
 							} },
-						{ AecpMessageType::VendorUniqueCommand,
+						{ AecpMessageType::VendorUniqueCommand.getValue(),
 							[](BaseClass* const pi, EtherLayer2 const& etherLayer2, Deserializer& des, std::uint8_t const* const pkt_data, size_t const pkt_len)
 							{
 								// We have to retrieve the ProtocolID to dispatch
@@ -155,7 +157,7 @@ public:
 
 								return Aecpdu::UniquePointer{ nullptr, nullptr };
 							} },
-						{ AecpMessageType::VendorUniqueResponse,
+						{ AecpMessageType::VendorUniqueResponse.getValue(),
 							[](BaseClass* const pi, EtherLayer2 const& etherLayer2, Deserializer& des, std::uint8_t const* const pkt_data, size_t const pkt_len)
 							{
 								// We have to retrieve the ProtocolID to dispatch
@@ -205,12 +207,12 @@ public:
 							} },
 					};
 
-					auto const& it = s_Dispatch.find(messageType);
-					if (it == s_Dispatch.end())
+					auto const dispatchHandler = s_Dispatch.find(messageType.getValue());
+					if (dispatchHandler == nullptr)
 						return; // Unsupported AECP message type
 
 					// Create aecpdu frame based on message type
-					auto aecpdu = it->second(_self, etherLayer2, des, pkt_data, pkt_len);
+					auto aecpdu = dispatchHandler(_self, etherLayer2, des, pkt_data, pkt_len);
 
 					if (aecpdu != nullptr)
 					{
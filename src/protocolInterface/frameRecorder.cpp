@@ -0,0 +1,322 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file frameRecorder.cpp
+* @author Christophe Calmejane
+*/
+
+#include "frameRecorder.hpp"
+
+#include "la/avdecc/utils.hpp"
+
+#include "logHelper.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+static constexpr auto WriterIdleDelay = std::chrono::milliseconds{ 10 };
+
+static std::size_t nextPowerOfTwo(std::size_t const value) noexcept
+{
+	auto result = std::size_t{ 1u };
+	while (result < value)
+	{
+		result <<= 1;
+	}
+	return result;
+}
+
+static std::string makeRotatedFilePath(std::string const& filePath, std::size_t const index)
+{
+	// 'dir/name.ext' -> 'dir/name.index.ext'
+	auto const path = utils::filePathFromUTF8String(filePath);
+	auto rotatedPath = path;
+	rotatedPath.replace_filename(path.stem().u8string() + "." + std::to_string(index) + path.extension().u8string());
+	return rotatedPath.u8string();
+}
+
+FrameRecorder::FrameRecorder(std::string const& filePath, std::string const& interfaceName, ProtocolInterface::FrameRecorderConfiguration const& configuration)
+	: _filePath{ filePath }
+	, _interfaceName{ interfaceName }
+	, _snapLength{ configuration.snapLength }
+	, _maxFileSize{ configuration.maxFileSize }
+	, _maxFiles{ configuration.maxFiles }
+{
+	if (configuration.ringSize == 0u || configuration.snapLength == 0u || configuration.snapLength > 0xFFFF || configuration.maxFiles == 0u)
+	{
+		throw std::invalid_argument("Invalid frame recorder configuration");
+	}
+
+	// Preallocate the ring, nothing will be allocated on the hot path
+	auto const ringSize = nextPowerOfTwo(configuration.ringSize);
+	_ringMask = ringSize - 1u;
+	_slots = std::make_unique<Slot[]>(ringSize);
+	_slotsData = std::make_unique<std::uint8_t[]>(ringSize * _snapLength);
+	for (auto i = std::size_t{ 0u }; i < ringSize; ++i)
+	{
+		_slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	// Create the first file (throws if it cannot be created)
+	_writer.emplace(_filePath, _interfaceName, static_cast<std::uint32_t>(_snapLength));
+
+	// Start the writer thread
+	_writerThread = std::thread(
+		[this]
+		{
+			utils::setCurrentThreadName("avdecc::FrameRecorder");
+			writerLoop();
+		});
+}
+
+FrameRecorder::~FrameRecorder() noexcept
+{
+	stop();
+}
+
+bool FrameRecorder::record(ProtocolInterface::FrameDirection const direction, std::uint8_t const* const header, std::size_t const headerSize, std::uint8_t const* const payload, std::size_t const payloadSize) noexcept
+{
+	// Register as an active producer, so stop() waits for the frame to be published before the final drain
+	auto const producerGuard = ProducerGuard{ _activeProducers };
+
+	// Reject frames once stopping, they would never be written
+	if (_isStopping.load())
+	{
+		++_droppedFrames;
+		return false;
+	}
+
+	auto const timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch());
+
+	// Reserve a slot
+	auto position = _enqueuePosition.load(std::memory_order_relaxed);
+	auto* slot = static_cast<Slot*>(nullptr);
+	while (true)
+	{
+		slot = &_slots[position & _ringMask];
+		auto const sequence = slot->sequence.load(std::memory_order_acquire);
+		auto const diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+		if (diff == 0)
+		{
+			if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (diff < 0)
+		{
+			// Ring is full, drop the frame
+			++_droppedFrames;
+			return false;
+		}
+		else
+		{
+			position = _enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	// Copy the frame (bounded by snapLength)
+	auto* const data = _slotsData.get() + (position & _ringMask) * _snapLength;
+	auto const headerLength = std::min(headerSize, _snapLength);
+	auto const payloadLength = std::min(payloadSize, _snapLength - headerLength);
+	if (headerLength != 0u)
+	{
+		std::memcpy(data, header, headerLength);
+	}
+	if (payloadLength != 0u)
+	{
+		std::memcpy(data + headerLength, payload, payloadLength);
+	}
+	slot->timestamp = timestamp;
+	slot->direction = direction;
+	slot->capturedLength = headerLength + payloadLength;
+	slot->originalLength = headerSize + payloadSize;
+
+	// Publish the slot
+	slot->sequence.store(position + 1, std::memory_order_release);
+	return true;
+}
+
+void FrameRecorder::stop() noexcept
+{
+	// Reject new frames and wait for in-flight ones to be published
+	_isStopping.store(true);
+	while (_activeProducers.load() != 0u)
+	{
+		std::this_thread::yield();
+	}
+
+	{
+		auto const lg = std::lock_guard{ _writerMutex };
+		_shouldTerminate = true;
+	}
+	_writerCondition.notify_all();
+
+	if (_writerThread.joinable())
+	{
+		_writerThread.join();
+	}
+}
+
+ProtocolInterface::FrameRecorderStatistics FrameRecorder::getStatistics() const noexcept
+{
+	auto statistics = ProtocolInterface::FrameRecorderStatistics{};
+	statistics.recordedFrames = _recordedFrames;
+	statistics.droppedFrames = _droppedFrames;
+	statistics.writtenBytes = _writtenBytes;
+	statistics.rotations = _rotations;
+	return statistics;
+}
+
+bool FrameRecorder::drain()
+{
+	auto didWork = false;
+
+	while (true)
+	{
+		auto& slot = _slots[_dequeuePosition & _ringMask];
+		if (slot.sequence.load(std::memory_order_acquire) != (_dequeuePosition + 1))
+		{
+			// Ring is empty
+			break;
+		}
+
+		if (_writer)
+		{
+			auto const previousSize = _writer->getFileSize();
+			try
+			{
+				auto const* const data = _slotsData.get() + (_dequeuePosition & _ringMask) * _snapLength;
+				_writer->writeFrame(slot.timestamp, data, slot.capturedLength, slot.originalLength, static_cast<captureFile::Direction>(slot.direction));
+				_writtenBytes += _writer->getFileSize() - previousSize;
+				++_recordedFrames;
+			}
+			catch ([[maybe_unused]] std::exception const& e)
+			{
+				LOG_PROTOCOL_INTERFACE_ERROR(networkInterface::MacAddress{}, networkInterface::MacAddress{}, "Frame recorder stopped: {}", e.what());
+				_writer.reset();
+			}
+		}
+		if (!_writer)
+		{
+			++_droppedFrames;
+		}
+
+		// Release the slot for the next lap
+		slot.sequence.store(_dequeuePosition + _ringMask + 1, std::memory_order_release);
+		++_dequeuePosition;
+		didWork = true;
+
+		if (_writer && _maxFileSize != 0u && _writer->getFileSize() >= _maxFileSize)
+		{
+			rotate();
+		}
+	}
+
+	return didWork;
+}
+
+void FrameRecorder::rotate()
+{
+	// Close current file
+	_writer.reset();
+
+	// Shift older files: name.(N-2).ext -> name.(N-1).ext, ..., name.ext -> name.1.ext
+	auto ec = std::error_code{};
+	if (_maxFiles > 1u)
+	{
+		std::filesystem::remove(utils::filePathFromUTF8String(makeRotatedFilePath(_filePath, _maxFiles - 1u)), ec);
+		for (auto index = _maxFiles - 1u; index > 1u; --index)
+		{
+			std::filesystem::rename(utils::filePathFromUTF8String(makeRotatedFilePath(_filePath, index - 1u)), utils::filePathFromUTF8String(makeRotatedFilePath(_filePath, index)), ec);
+		}
+		std::filesystem::rename(utils::filePathFromUTF8String(_filePath), utils::filePathFromUTF8String(makeRotatedFilePath(_filePath, 1u)), ec);
+	}
+
+	// Open a new file
+	try
+	{
+		_writer.emplace(_filePath, _interfaceName, static_cast<std::uint32_t>(_snapLength));
+		++_rotations;
+	}
+	catch ([[maybe_unused]] std::exception const& e)
+	{
+		LOG_PROTOCOL_INTERFACE_ERROR(networkInterface::MacAddress{}, networkInterface::MacAddress{}, "Frame recorder stopped: {}", e.what());
+	}
+}
+
+void FrameRecorder::writerLoop() noexcept
+{
+	while (true)
+	{
+		auto const didWork = drain();
+
+		auto lock = std::unique_lock{ _writerMutex };
+		if (_shouldTerminate)
+		{
+			break;
+		}
+		if (!didWork)
+		{
+			// Nothing to write, flush and wait a bit (producers never signal us, so they don't have to take the lock)
+			if (_writer)
+			{
+				try
+				{
+					_writer->flush();
+				}
+				catch (...)
+				{
+				}
+			}
+			_writerCondition.wait_for(lock, WriterIdleDelay,
+				[this]
+				{
+					return _shouldTerminate;
+				});
+		}
+	}
+
+	// Write remaining frames
+	drain();
+	if (_writer)
+	{
+		try
+		{
+			_writer->flush();
+		}
+		catch (...)
+		{
+		}
+	}
+}
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
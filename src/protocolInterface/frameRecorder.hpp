@@ -0,0 +1,147 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file frameRecorder.hpp
+* @author Christophe Calmejane
+* @brief Asynchronous pcapng recorder for raw frames sent and received by a ProtocolInterface.
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/protocolInterface.hpp"
+
+#include "captureFile.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+/**
+* @brief Records raw frames into a rotating pcapng file.
+* @details Producers (any thread sending or receiving frames) copy the frame into a preallocated slot of a bounded lock-free ring,
+*          a background thread drains the ring and writes the frames to disk.
+*          When the ring is full (writer falling behind), new frames are dropped and accounted for in the statistics, producers are never blocked.
+*/
+class FrameRecorder final
+{
+public:
+	/** Creates the recorder and its first capture file. Throws std::invalid_argument if the configuration is invalid or the file cannot be created. */
+	FrameRecorder(std::string const& filePath, std::string const& interfaceName, ProtocolInterface::FrameRecorderConfiguration const& configuration);
+
+	/** Stops the recorder, writing all pending frames */
+	~FrameRecorder() noexcept;
+
+	/** Copies a frame into the ring (the frame being the concatenation of header and payload). Returns false if the frame has been dropped (ring full or recorder stopped). Thread-safe, never blocks. */
+	bool record(ProtocolInterface::FrameDirection const direction, std::uint8_t const* const header, std::size_t const headerSize, std::uint8_t const* const payload, std::size_t const payloadSize) noexcept;
+
+	/** Stops the background writer after all pending frames have been written. Frames recorded after this call are rejected. */
+	void stop() noexcept;
+
+	/** Returns the recorder statistics */
+	ProtocolInterface::FrameRecorderStatistics getStatistics() const noexcept;
+
+	// Deleted compiler auto-generated methods
+	FrameRecorder(FrameRecorder&&) = delete;
+	FrameRecorder(FrameRecorder const&) = delete;
+	FrameRecorder& operator=(FrameRecorder const&) = delete;
+	FrameRecorder& operator=(FrameRecorder&&) = delete;
+
+private:
+	struct Slot
+	{
+		std::atomic<std::size_t> sequence{ 0u };
+		std::chrono::nanoseconds timestamp{};
+		ProtocolInterface::FrameDirection direction{ ProtocolInterface::FrameDirection::Inbound };
+		std::size_t capturedLength{ 0u };
+		std::size_t originalLength{ 0u };
+	};
+
+	/** RAII helper accounting for a producer currently inside record() */
+	class ProducerGuard final
+	{
+	public:
+		explicit ProducerGuard(std::atomic<std::size_t>& counter) noexcept
+			: _counter{ counter }
+		{
+			++_counter;
+		}
+		~ProducerGuard() noexcept
+		{
+			--_counter;
+		}
+
+		// Deleted compiler auto-generated methods
+		ProducerGuard(ProducerGuard&&) = delete;
+		ProducerGuard(ProducerGuard const&) = delete;
+		ProducerGuard& operator=(ProducerGuard const&) = delete;
+		ProducerGuard& operator=(ProducerGuard&&) = delete;
+
+	private:
+		std::atomic<std::size_t>& _counter;
+	};
+
+	bool drain();
+	void rotate();
+	void writerLoop() noexcept;
+
+	// Configuration
+	std::string const _filePath{};
+	std::string const _interfaceName{};
+	std::size_t const _snapLength{ 0u };
+	std::uint64_t const _maxFileSize{ 0u };
+	std::size_t const _maxFiles{ 0u };
+
+	// Ring (bounded MPSC queue, see http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue)
+	std::size_t _ringMask{ 0u };
+	std::unique_ptr<Slot[]> _slots{};
+	std::unique_ptr<std::uint8_t[]> _slotsData{};
+	alignas(64) std::atomic<std::size_t> _enqueuePosition{ 0u };
+	alignas(64) std::size_t _dequeuePosition{ 0u }; // Only accessed by the writer thread
+	std::atomic<std::size_t> _activeProducers{ 0u };
+	std::atomic_bool _isStopping{ false };
+
+	// Statistics
+	std::atomic<std::uint64_t> _recordedFrames{ 0u };
+	std::atomic<std::uint64_t> _droppedFrames{ 0u };
+	std::atomic<std::uint64_t> _writtenBytes{ 0u };
+	std::atomic<std::uint32_t> _rotations{ 0u };
+
+	// Writer
+	std::optional<captureFile::Writer> _writer{};
+	std::mutex _writerMutex{};
+	std::condition_variable _writerCondition{};
+	bool _shouldTerminate{ false };
+	std::thread _writerThread{};
+};
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -25,6 +25,17 @@
 #include "la/avdecc/internals/protocolInterface.hpp"
 #include "la/avdecc/executor.hpp"
 
+#include "frameRecorder.hpp"
+#include "protocolInterface/protocolInterface_composite.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
 // Protocol Interface
 #ifdef HAVE_PROTOCOL_INTERFACE_PCAP
 #	include "protocolInterface/protocolInterface_pcap.hpp"
@@ -33,7 +44,6 @@
 #	include "protocolInterface/protocolInterface_macNative.hpp"
 #endif // HAVE_PROTOCOL_INTERFACE_MAC
 #ifdef HAVE_PROTOCOL_INTERFACE_PROXY
-#	error "Not implemented yet"
 #	include "protocolInterface/protocolInterface_proxy.hpp"
 #endif // HAVE_PROTOCOL_INTERFACE_PROXY
 #ifdef HAVE_PROTOCOL_INTERFACE_VIRTUAL
@@ -45,6 +55,9 @@
 #ifdef HAVE_PROTOCOL_INTERFACE_LOCAL
 #	include "protocolInterface/protocolInterface_local.hpp"
 #endif // HAVE_PROTOCOL_INTERFACE_LOCAL
+#ifdef HAVE_PROTOCOL_INTERFACE_REPLAY
+#	include "protocolInterface/protocolInterface_replay.hpp"
+#endif // HAVE_PROTOCOL_INTERFACE_REPLAY
 
 namespace la
 {
@@ -53,9 +66,39 @@ namespace avdecc
 namespace protocol
 {
 // Throws an Exception if networkInterfaceID is not usable
+/** Frame recording state. The recorder is published through an atomic raw pointer for the hot path, producers being accounted for so it's never destroyed while in use. */
+struct ProtocolInterface::FrameRecording
+{
+	std::atomic<FrameRecorder*> recorder{ nullptr }; // Only dereferenced while accounted in activeProducers
+	std::atomic<std::size_t> activeProducers{ 0u };
+	std::mutex lock{}; // Protects owner
+	std::unique_ptr<FrameRecorder> owner{};
+
+	FrameRecorderStatistics stop() noexcept
+	{
+		auto recorderOwner = std::move(owner);
+		if (!recorderOwner)
+		{
+			return {};
+		}
+
+		// Unpublish the recorder and wait for producers still using it
+		recorder.store(nullptr);
+		while (activeProducers.load() != 0u)
+		{
+			std::this_thread::yield();
+		}
+
+		// Wait for pending frames to be written
+		recorderOwner->stop();
+		return recorderOwner->getStatistics();
+	}
+};
+
 ProtocolInterface::ProtocolInterface(std::string const& networkInterfaceID, std::string const& executorName)
 	: _networkInterfaceID(networkInterfaceID)
 	, _executorName{ executorName }
+	, _frameRecording{ std::make_shared<FrameRecording>() }
 {
 	// Check if the executor exists
 	if (!ExecutorManager::getInstance().isExecutorRegistered(_executorName))
@@ -83,6 +126,7 @@ ProtocolInterface::ProtocolInterface(std::string const& networkInterfaceID, netw
 	: _networkInterfaceID(networkInterfaceID)
 	, _networkInterfaceMacAddress(macAddress)
 	, _executorName{ executorName }
+	, _frameRecording{ std::make_shared<FrameRecording>() }
 {
 	// Check if the executor exists
 	if (!ExecutorManager::getInstance().isExecutorRegistered(_executorName))
@@ -139,6 +183,80 @@ ProtocolInterface::Error LA_AVDECC_CALL_CONVENTION ProtocolInterface::unregister
 	return Error::NoError;
 }
 
+ProtocolInterface::Error LA_AVDECC_CALL_CONVENTION ProtocolInterface::startFrameRecording(std::string const& filePath, FrameRecorderConfiguration const& configuration) noexcept
+{
+	auto const lg = std::lock_guard{ _frameRecording->lock };
+
+	// Stop any previous recording
+	_frameRecording->stop();
+
+	try
+	{
+		_frameRecording->owner = std::make_unique<FrameRecorder>(filePath, _networkInterfaceID, configuration);
+		_frameRecording->recorder.store(_frameRecording->owner.get());
+	}
+	catch (std::invalid_argument const&)
+	{
+		return Error::InvalidParameters;
+	}
+	catch (...)
+	{
+		return Error::InternalError;
+	}
+
+	return Error::NoError;
+}
+
+ProtocolInterface::FrameRecorderStatistics LA_AVDECC_CALL_CONVENTION ProtocolInterface::stopFrameRecording() noexcept
+{
+	auto const lg = std::lock_guard{ _frameRecording->lock };
+
+	return _frameRecording->stop();
+}
+
+ProtocolInterface::FrameRecorderStatistics LA_AVDECC_CALL_CONVENTION ProtocolInterface::getFrameRecorderStatistics() const noexcept
+{
+	auto const lg = std::lock_guard{ _frameRecording->lock };
+
+	if (_frameRecording->owner)
+	{
+		return _frameRecording->owner->getStatistics();
+	}
+	return {};
+}
+
+bool ProtocolInterface::isRecordingFrames() const noexcept
+{
+	return _frameRecording->recorder.load(std::memory_order_relaxed) != nullptr;
+}
+
+void ProtocolInterface::recordFrame(FrameDirection const direction, std::uint8_t const* const header, std::size_t const headerSize, std::uint8_t const* const payload, std::size_t const payloadSize) const noexcept
+{
+	// Account for this producer before loading the pointer, stop() waits for it to be released
+	++_frameRecording->activeProducers;
+	if (auto* const recorder = _frameRecording->recorder.load())
+	{
+		recorder->record(direction, header, headerSize, payload, payloadSize);
+	}
+	--_frameRecording->activeProducers;
+}
+
+void ProtocolInterface::recordFrame(FrameDirection const direction, EtherLayer2 const& etherLayer2, std::uint8_t const* const avtpdu, std::size_t const avtpduSize) const noexcept
+{
+	if (isRecordingFrames())
+	{
+		auto header = std::array<std::uint8_t, EtherLayer2::HeaderLength>{};
+		auto const& destAddress = etherLayer2.getDestAddress();
+		auto const& srcAddress = etherLayer2.getSrcAddress();
+		auto const etherType = etherLayer2.getEtherType();
+		std::copy(destAddress.begin(), destAddress.end(), header.begin());
+		std::copy(srcAddress.begin(), srcAddress.end(), header.begin() + destAddress.size());
+		header[12] = static_cast<std::uint8_t>(etherType >> 8);
+		header[13] = static_cast<std::uint8_t>(etherType & 0xFF);
+		recordFrame(direction, header.data(), header.size(), avtpdu, avtpduSize);
+	}
+}
+
 bool ProtocolInterface::isAecpResponseMessageType(AecpMessageType const messageType) noexcept
 {
 	if (messageType == protocol::AecpMessageType::AemResponse || messageType == protocol::AecpMessageType::AddressAccessResponse || messageType == protocol::AecpMessageType::AvcResponse || messageType == protocol::AecpMessageType::VendorUniqueResponse || messageType == protocol::AecpMessageType::HdcpAemResponse || messageType == protocol::AecpMessageType::ExtendedResponse)
@@ -146,6 +264,29 @@ bool ProtocolInterface::isAecpResponseMessageType(AecpMessageType const messageT
 	return false;
 }
 
+UniqueIdentifier ProtocolInterface::generateDynamicEID() const noexcept
+{
+	static auto s_randomLock = std::mutex{};
+	static auto s_randomEngine = std::mt19937{ std::random_device{}() };
+
+	auto eid = UniqueIdentifier::value_type{ 0u };
+	auto const& macAddress = getMacAddress();
+
+	for (auto const byte : macAddress)
+	{
+		eid <<= 8;
+		eid += byte;
+	}
+	eid <<= 16;
+
+	{
+		auto const lg = std::lock_guard{ s_randomLock };
+		eid += std::uniform_int_distribution<std::uint16_t>{ 0x0001, 0xFFFE }(s_randomEngine);
+	}
+
+	return UniqueIdentifier{ eid };
+}
+
 std::uint32_t ProtocolInterface::getVendorUniqueCommandTimeout(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept
 {
 	auto timeout = std::uint32_t{ 250u };
@@ -227,8 +368,7 @@ ProtocolInterface* LA_AVDECC_CALL_CONVENTION ProtocolInterface::createRawProtoco
 #endif // HAVE_PROTOCOL_INTERFACE_MAC
 #if defined(HAVE_PROTOCOL_INTERFACE_PROXY)
 		case Type::Proxy:
-			AVDECC_ASSERT(false, "TODO: Proxy protocol interface to create");
-			break;
+			return ProtocolInterfaceProxy::createRawProtocolInterfaceProxy(networkInterfaceID, executorName);
 #endif // HAVE_PROTOCOL_INTERFACE_PROXY
 #if defined(HAVE_PROTOCOL_INTERFACE_VIRTUAL)
 		case Type::Virtual:
@@ -242,6 +382,10 @@ ProtocolInterface* LA_AVDECC_CALL_CONVENTION ProtocolInterface::createRawProtoco
 		case Type::Local:
 			return ProtocolInterfaceLocal::createRawProtocolInterfaceLocal(networkInterfaceID, executorName);
 #endif // HAVE_PROTOCOL_INTERFACE_LOCAL
+#if defined(HAVE_PROTOCOL_INTERFACE_REPLAY)
+		case Type::Replay:
+			return ProtocolInterfaceReplay::createRawProtocolInterfaceReplay(networkInterfaceID, executorName);
+#endif // HAVE_PROTOCOL_INTERFACE_REPLAY
 		default:
 			break;
 	}
@@ -249,6 +393,11 @@ ProtocolInterface* LA_AVDECC_CALL_CONVENTION ProtocolInterface::createRawProtoco
 	throw Exception(Error::InterfaceNotSupported, "Unknown protocol interface type");
 }
 
+ProtocolInterface* LA_AVDECC_CALL_CONVENTION ProtocolInterface::createRawCompositeProtocolInterface(std::vector<UniquePointer>&& protocolInterfaces)
+{
+	return ProtocolInterfaceComposite::createRawProtocolInterfaceComposite(std::move(protocolInterfaces));
+}
+
 bool LA_AVDECC_CALL_CONVENTION ProtocolInterface::isSupportedProtocolInterfaceType(Type const protocolInterfaceType) noexcept
 {
 	auto const types = getSupportedProtocolInterfaceTypes();
@@ -272,6 +421,8 @@ std::string LA_AVDECC_CALL_CONVENTION ProtocolInterface::typeToString(Type const
 			return "Serial port";
 		case Type::Local:
 			return "Local domain socket";
+		case Type::Replay:
+			return "Capture file replay";
 		default:
 			return "Unknown protocol interface type";
 	}
@@ -330,6 +481,14 @@ ProtocolInterface::SupportedProtocolInterfaceTypes LA_AVDECC_CALL_CONVENTION Pro
 			s_supportedProtocolInterfaceTypes.set(Type::Local);
 		}
 #endif // HAVE_PROTOCOL_INTERFACE_LOCAL
+
+		// Capture file replay
+#if defined(HAVE_PROTOCOL_INTERFACE_REPLAY)
+		if (protocol::ProtocolInterfaceReplay::isSupported())
+		{
+			s_supportedProtocolInterfaceTypes.set(Type::Replay);
+		}
+#endif // HAVE_PROTOCOL_INTERFACE_REPLAY
 	}
 
 	return s_supportedProtocolInterfaceTypes;
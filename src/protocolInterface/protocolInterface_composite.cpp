@@ -0,0 +1,1125 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_composite.cpp
+* @author Christophe Calmejane
+*/
+
+#include "la/avdecc/internals/protocolAemAecpdu.hpp"
+#include "la/avdecc/internals/protocolAaAecpdu.hpp"
+#include "la/avdecc/internals/protocolMvuAecpdu.hpp"
+#include "la/avdecc/executor.hpp"
+#include "la/avdecc/utils.hpp"
+
+#include "stateMachine/stateMachineManager.hpp"
+#include "protocolInterface_composite.hpp"
+#include "logHelper.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+/** Delay during which a multicast message received on an interface is considered a duplicate if received again on another interface */
+static constexpr auto DuplicateDetectionWindow = std::chrono::milliseconds{ 1000 };
+
+class ProtocolInterfaceCompositeImpl final : public ProtocolInterfaceComposite, private stateMachine::ProtocolInterfaceDelegate, private stateMachine::AdvertiseStateMachine::Delegate, private stateMachine::DiscoveryStateMachine::Delegate, private stateMachine::CommandStateMachine::Delegate
+{
+public:
+	/* ************************************************************ */
+	/* Public APIs                                                  */
+	/* ************************************************************ */
+	/** Constructor */
+	ProtocolInterfaceCompositeImpl(std::string const& networkInterfaceID, std::vector<ProtocolInterface::UniquePointer>&& protocolInterfaces);
+
+	/** Destructor */
+	virtual ~ProtocolInterfaceCompositeImpl() noexcept;
+
+	/** Destroy method for COM-like interface */
+	virtual void destroy() noexcept override;
+
+	// Deleted compiler auto-generated methods
+	ProtocolInterfaceCompositeImpl(ProtocolInterfaceCompositeImpl&&) = delete;
+	ProtocolInterfaceCompositeImpl(ProtocolInterfaceCompositeImpl const&) = delete;
+	ProtocolInterfaceCompositeImpl& operator=(ProtocolInterfaceCompositeImpl const&) = delete;
+	ProtocolInterfaceCompositeImpl& operator=(ProtocolInterfaceCompositeImpl&&) = delete;
+
+private:
+	/* ************************************************************ */
+	/* Private types                                                */
+	/* ************************************************************ */
+	struct Interface
+	{
+		ProtocolInterface::UniquePointer protocolInterface;
+		networkInterface::MacAddress macAddress{};
+		bool isActive{ true }; // Protected by _routingLock
+	};
+
+	/** Identification of a multicast message, for duplicate detection */
+	struct MulticastMessageKey
+	{
+		networkInterface::MacAddress srcAddress{};
+		std::uint8_t subType{ 0u };
+		std::uint8_t messageType{ 0u };
+		UniqueIdentifier::value_type firstID{ 0u };
+		UniqueIdentifier::value_type secondID{ 0u };
+		UniqueIdentifier::value_type thirdID{ 0u };
+		std::uint64_t extra{ 0u };
+
+		bool operator==(MulticastMessageKey const& other) const noexcept
+		{
+			return srcAddress == other.srcAddress && subType == other.subType && messageType == other.messageType && firstID == other.firstID && secondID == other.secondID && thirdID == other.thirdID && extra == other.extra;
+		}
+
+		struct hash
+		{
+			std::size_t operator()(MulticastMessageKey const& key) const noexcept
+			{
+				auto h = networkInterface::MacAddressHash{}(key.srcAddress);
+				auto const combine = [&h](std::uint64_t const value)
+				{
+					h ^= std::hash<std::uint64_t>{}(value) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+				};
+				combine((static_cast<std::uint64_t>(key.subType) << 8) | key.messageType);
+				combine(key.firstID);
+				combine(key.secondID);
+				combine(key.thirdID);
+				combine(key.extra);
+				return h;
+			}
+		};
+	};
+
+	struct MulticastMessageInfo
+	{
+		std::size_t interfaceIndex{ 0u };
+		std::chrono::steady_clock::time_point lastSeen{};
+	};
+
+	/** Observer and VendorUniqueDelegate registered to all the aggregated interfaces */
+	class InterfaceObserver final : public ProtocolInterface::Observer, public ProtocolInterface::VendorUniqueDelegate
+	{
+	public:
+		InterfaceObserver(ProtocolInterfaceCompositeImpl& composite) noexcept
+			: _composite{ composite }
+		{
+		}
+
+	private:
+		/* ProtocolInterface::Observer overrides */
+		virtual void onTransportError(ProtocolInterface* const pi) noexcept override
+		{
+			_composite.onInterfaceTransportError(pi);
+		}
+		virtual void onAdpduReceived(ProtocolInterface* const pi, Adpdu const& adpdu) noexcept override
+		{
+			_composite.onInterfaceAdpdu(pi, adpdu);
+		}
+		virtual void onAecpduReceived(ProtocolInterface* const pi, Aecpdu const& aecpdu) noexcept override
+		{
+			_composite.onInterfaceAecpdu(pi, aecpdu);
+		}
+		virtual void onAcmpduReceived(ProtocolInterface* const pi, Acmpdu const& acmpdu) noexcept override
+		{
+			_composite.onInterfaceAcmpdu(pi, acmpdu);
+		}
+
+		/* ProtocolInterface::VendorUniqueDelegate overrides */
+		virtual Aecpdu::UniquePointer createAecpdu(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, bool const isResponse) noexcept override
+		{
+			if (auto* const delegate = _composite.getVendorUniqueDelegate(protocolIdentifier))
+			{
+				return delegate->createAecpdu(protocolIdentifier, isResponse);
+			}
+			// No delegate registered to the composite (yet), the message will be ignored (only registering for MVU)
+			return MvuAecpdu::create(isResponse);
+		}
+		virtual bool areHandledByControllerStateMachine(VuAecpdu::ProtocolIdentifier const& protocolIdentifier) const noexcept override
+		{
+			return _composite.isVendorUniqueHandledByControllerStateMachine(protocolIdentifier);
+		}
+		virtual std::uint32_t getVuAecpCommandTimeoutMsec(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept override
+		{
+			return _composite.getVendorUniqueCommandTimeout(protocolIdentifier, aecpdu);
+		}
+		virtual void onVuAecpCommand(ProtocolInterface* const pi, VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) noexcept override
+		{
+			_composite.onInterfaceVuAecpdu(pi, protocolIdentifier, aecpdu, false);
+		}
+		virtual void onVuAecpResponse(ProtocolInterface* const pi, VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) noexcept override
+		{
+			_composite.onInterfaceVuAecpdu(pi, protocolIdentifier, aecpdu, true);
+		}
+		// Unsolicited responses are detected by the composite's own state machine (isVuAecpUnsolicitedResponse always returns false for the aggregated interfaces)
+
+		ProtocolInterfaceCompositeImpl& _composite;
+	};
+
+	/* ************************************************************ */
+	/* ProtocolInterface overrides                                  */
+	/* ************************************************************ */
+	virtual void shutdown() noexcept override;
+	virtual UniqueIdentifier getDynamicEID() const noexcept override;
+	virtual void releaseDynamicEID(UniqueIdentifier const entityID) const noexcept override;
+	virtual Error registerLocalEntity(entity::LocalEntity& entity) noexcept override;
+	virtual Error unregisterLocalEntity(entity::LocalEntity& entity) noexcept override;
+	virtual Error injectRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept override;
+	virtual Error setEntityNeedsAdvertise(entity::LocalEntity const& entity, entity::LocalEntity::AdvertiseFlags const flags) noexcept override;
+	virtual Error enableEntityAdvertising(entity::LocalEntity& entity) noexcept override;
+	virtual Error disableEntityAdvertising(entity::LocalEntity const& entity) noexcept override;
+	virtual Error discoverRemoteEntities() const noexcept override;
+	virtual Error discoverRemoteEntity(UniqueIdentifier const entityID) const noexcept override;
+	virtual Error forgetRemoteEntity(UniqueIdentifier const entityID) const noexcept override;
+	virtual Error setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) const noexcept override;
+	virtual bool isDirectMessageSupported() const noexcept override;
+	virtual Error sendAdpMessage(Adpdu const& adpdu) const noexcept override;
+	virtual Error sendAecpMessage(Aecpdu const& aecpdu) const noexcept override;
+	virtual Error sendAcmpMessage(Acmpdu const& acmpdu) const noexcept override;
+	virtual Error sendAecpCommand(Aecpdu::UniquePointer&& aecpdu, AecpCommandResultHandler const& onResult) const noexcept override;
+	virtual Error sendAecpResponse(Aecpdu::UniquePointer&& aecpdu) const noexcept override;
+	virtual Error sendAcmpCommand(Acmpdu::UniquePointer&& acmpdu, AcmpCommandResultHandler const& onResult) const noexcept override;
+	virtual Error sendAcmpResponse(Acmpdu::UniquePointer&& acmpdu) const noexcept override;
+	virtual void lock() const noexcept override;
+	virtual void unlock() const noexcept override;
+	virtual bool isSelfLocked() const noexcept override;
+
+	/* ************************************************************ */
+	/* ProtocolInterfaceComposite overrides                         */
+	/* ************************************************************ */
+	virtual std::size_t getProtocolInterfacesCount() const noexcept override;
+	virtual std::size_t getActiveProtocolInterfacesCount() const noexcept override;
+
+	/* ************************************************************ */
+	/* stateMachine::ProtocolInterfaceDelegate overrides            */
+	/* ************************************************************ */
+	virtual void onAecpCommand(Aecpdu const& aecpdu) noexcept override;
+	virtual void onVuAecpUnsolicitedResponse(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) noexcept override;
+	virtual void onAcmpCommand(Acmpdu const& acmpdu) noexcept override;
+	virtual void onAcmpResponse(Acmpdu const& acmpdu) noexcept override;
+	virtual Error sendMessage(Adpdu const& adpdu) const noexcept override;
+	virtual Error sendMessage(Aecpdu const& aecpdu) const noexcept override;
+	virtual Error sendMessage(Acmpdu const& acmpdu) const noexcept override;
+	virtual std::uint32_t getVuAecpCommandTimeoutMsec(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept override;
+	virtual bool isVuAecpUnsolicitedResponse(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept override;
+
+	/* ************************************************************ */
+	/* stateMachine::AdvertiseStateMachine::Delegate overrides      */
+	/* ************************************************************ */
+
+	/* ************************************************************ */
+	/* stateMachine::DiscoveryStateMachine::Delegate overrides      */
+	/* ************************************************************ */
+	virtual void onLocalEntityOnline(entity::Entity const& entity) noexcept override;
+	virtual void onLocalEntityOffline(UniqueIdentifier const entityID) noexcept override;
+	virtual void onLocalEntityUpdated(entity::Entity const& entity) noexcept override;
+	virtual void onRemoteEntityOnline(entity::Entity const& entity) noexcept override;
+	virtual void onRemoteEntityOffline(UniqueIdentifier const entityID) noexcept override;
+	virtual void onRemoteEntityUpdated(entity::Entity const& entity) noexcept override;
+
+	/* ************************************************************ */
+	/* stateMachine::CommandStateMachine::Delegate overrides        */
+	/* ************************************************************ */
+	virtual void onAecpAemUnsolicitedResponse(AemAecpdu const& aecpdu) noexcept override;
+	virtual void onAecpAemIdentifyNotification(AemAecpdu const& aecpdu) noexcept override;
+	virtual void onAecpRetry(UniqueIdentifier const& entityID) noexcept override;
+	virtual void onAecpTimeout(UniqueIdentifier const& entityID) noexcept override;
+	virtual void onAecpUnexpectedResponse(UniqueIdentifier const& entityID) noexcept override;
+	virtual void onAecpResponseTime(UniqueIdentifier const& entityID, std::chrono::milliseconds const& responseTime) noexcept override;
+
+	/* ************************************************************ */
+	/* la::avdecc::utils::Subject overrides                         */
+	/* ************************************************************ */
+	virtual void onObserverRegistered(observer_type* const observer) noexcept override;
+
+	/* ************************************************************ */
+	/* Aggregated interfaces notifications                          */
+	/* ************************************************************ */
+	void onInterfaceTransportError(ProtocolInterface* const pi) noexcept;
+	void onInterfaceAdpdu(ProtocolInterface* const pi, Adpdu const& adpdu) noexcept;
+	void onInterfaceAecpdu(ProtocolInterface* const pi, Aecpdu const& aecpdu) noexcept;
+	void onInterfaceAcmpdu(ProtocolInterface* const pi, Acmpdu const& acmpdu) noexcept;
+	void onInterfaceVuAecpdu(ProtocolInterface* const pi, VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu, bool const isResponse) noexcept;
+
+	/* ************************************************************ */
+	/* Private methods                                              */
+	/* ************************************************************ */
+	bool isVendorUniqueHandledByControllerStateMachine(VuAecpdu::ProtocolIdentifier const& protocolIdentifier) const noexcept;
+	/** Returns true if a message received from the specified interface should be processed, learning the route to the source MacAddress (and checking for a duplicate if a key is specified). */
+	bool acceptMessage(ProtocolInterface const* const pi, networkInterface::MacAddress const& srcAddress, std::optional<MulticastMessageKey> const& key) noexcept;
+	/** Returns the indexes of all active interfaces. */
+	std::vector<std::size_t> getActiveInterfaces() const noexcept;
+	/** Returns the index of the active interface to use to reach the specified MacAddress, or std::nullopt if all interfaces failed. */
+	std::optional<std::size_t> getRouteToMacAddress(networkInterface::MacAddress const& macAddress) const noexcept;
+	Error sendOnInterface(std::size_t const interfaceIndex, Aecpdu const& aecpdu) const noexcept;
+
+	// Private variables
+	std::vector<Interface> _interfaces{}; // Immutable once constructed (except for the isActive flag)
+	mutable std::mutex _routingLock{};
+	std::unordered_map<networkInterface::MacAddress, std::size_t, networkInterface::MacAddressHash> _macAddressRoutes{}; // Protected by _routingLock
+	std::unordered_map<MulticastMessageKey, MulticastMessageInfo, MulticastMessageKey::hash> _recentMulticastMessages{}; // Protected by _routingLock
+	std::chrono::steady_clock::time_point _lastRecentMessagesPurge{}; // Protected by _routingLock
+	InterfaceObserver _interfaceObserver{ *this };
+	mutable stateMachine::Manager _stateMachineManager{ this, this, this, this, this };
+};
+
+/* ************************************************************ */
+/* Public APIs                                                  */
+/* ************************************************************ */
+/** Constructor */
+ProtocolInterfaceCompositeImpl::ProtocolInterfaceCompositeImpl(std::string const& networkInterfaceID, std::vector<ProtocolInterface::UniquePointer>&& protocolInterfaces)
+	: ProtocolInterfaceComposite(networkInterfaceID, protocolInterfaces.front()->getMacAddress(), protocolInterfaces.front()->getExecutorName())
+{
+	_interfaces.reserve(protocolInterfaces.size());
+	for (auto& pi : protocolInterfaces)
+	{
+		auto const macAddress = pi->getMacAddress();
+		_interfaces.push_back(Interface{ std::move(pi), macAddress });
+	}
+
+	// Observe all interfaces, and handle MVU messages on their behalf
+	for (auto& intfc : _interfaces)
+	{
+		intfc.protocolInterface->registerVendorUniqueDelegate(MvuAecpdu::ProtocolID, &_interfaceObserver);
+		intfc.protocolInterface->registerObserver(&_interfaceObserver);
+	}
+
+	// Start the state machines
+	_stateMachineManager.startStateMachines();
+}
+
+/** Destructor */
+ProtocolInterfaceCompositeImpl::~ProtocolInterfaceCompositeImpl() noexcept
+{
+	shutdown();
+}
+
+void ProtocolInterfaceCompositeImpl::destroy() noexcept
+{
+	delete this;
+}
+
+/* ************************************************************ */
+/* ProtocolInterface overrides                                  */
+/* ************************************************************ */
+void ProtocolInterfaceCompositeImpl::shutdown() noexcept
+{
+	// Stop the state machines
+	_stateMachineManager.stopStateMachines();
+
+	// Stop observing the aggregated interfaces, then shut them down
+	for (auto& intfc : _interfaces)
+	{
+		try
+		{
+			intfc.protocolInterface->unregisterObserver(&_interfaceObserver);
+		}
+		catch (...)
+		{
+			// Already unregistered
+		}
+		intfc.protocolInterface->unregisterVendorUniqueDelegate(MvuAecpdu::ProtocolID);
+		intfc.protocolInterface->shutdown();
+	}
+
+	// Flush executor jobs
+	la::avdecc::ExecutorManager::getInstance().flush(getExecutorName());
+}
+
+UniqueIdentifier ProtocolInterfaceCompositeImpl::getDynamicEID() const noexcept
+{
+	return _interfaces.front().protocolInterface->getDynamicEID();
+}
+
+void ProtocolInterfaceCompositeImpl::releaseDynamicEID(UniqueIdentifier const entityID) const noexcept
+{
+	_interfaces.front().protocolInterface->releaseDynamicEID(entityID);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::registerLocalEntity(entity::LocalEntity& entity) noexcept
+{
+	// Checks if entity has declared an InterfaceInformation matching this ProtocolInterface
+	auto const index = _stateMachineManager.getMatchingInterfaceIndex(entity);
+
+	if (index)
+	{
+		return _stateMachineManager.registerLocalEntity(entity);
+	}
+
+	return Error::InvalidParameters;
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::unregisterLocalEntity(entity::LocalEntity& entity) noexcept
+{
+	return _stateMachineManager.unregisterLocalEntity(entity);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::injectRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept
+{
+	// Inject through the primary interface, the message will be forwarded to us like any other received message
+	return _interfaces.front().protocolInterface->injectRawPacket(std::move(packet));
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::setEntityNeedsAdvertise(entity::LocalEntity const& entity, entity::LocalEntity::AdvertiseFlags const /*flags*/) noexcept
+{
+	return _stateMachineManager.setEntityNeedsAdvertise(entity);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::enableEntityAdvertising(entity::LocalEntity& entity) noexcept
+{
+	return _stateMachineManager.enableEntityAdvertising(entity);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::disableEntityAdvertising(entity::LocalEntity const& entity) noexcept
+{
+	return _stateMachineManager.disableEntityAdvertising(entity);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::discoverRemoteEntities() const noexcept
+{
+	return discoverRemoteEntity(UniqueIdentifier::getNullUniqueIdentifier());
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::discoverRemoteEntity(UniqueIdentifier const entityID) const noexcept
+{
+	auto const frame = stateMachine::Manager::makeDiscoveryMessage(getMacAddress(), entityID);
+	auto const err = sendMessage(frame);
+	if (!err)
+	{
+		_stateMachineManager.discoverMessageSent(); // Notify we are sending a discover message
+	}
+	return err;
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::forgetRemoteEntity(UniqueIdentifier const entityID) const noexcept
+{
+	return _stateMachineManager.forgetRemoteEntity(entityID);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) const noexcept
+{
+	return _stateMachineManager.setAutomaticDiscoveryDelay(delay);
+}
+
+bool ProtocolInterfaceCompositeImpl::isDirectMessageSupported() const noexcept
+{
+	return true;
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendAdpMessage(Adpdu const& adpdu) const noexcept
+{
+	// Directly send the message on the network
+	return sendMessage(adpdu);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendAecpMessage(Aecpdu const& aecpdu) const noexcept
+{
+	// Directly send the message on the network
+	return sendMessage(aecpdu);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendAcmpMessage(Acmpdu const& acmpdu) const noexcept
+{
+	// Directly send the message on the network
+	return sendMessage(acmpdu);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendAecpCommand(Aecpdu::UniquePointer&& aecpdu, AecpCommandResultHandler const& onResult) const noexcept
+{
+	auto const messageType = aecpdu->getMessageType();
+
+	if (!AVDECC_ASSERT_WITH_RET(!isAecpResponseMessageType(messageType), "Calling sendAecpCommand with a Response MessageType"))
+	{
+		return Error::MessageNotSupported;
+	}
+
+	// Special check for VendorUnique messages
+	if (messageType == AecpMessageType::VendorUniqueCommand)
+	{
+		auto& vuAecp = static_cast<VuAecpdu&>(*aecpdu);
+
+		auto const vuProtocolID = vuAecp.getProtocolIdentifier();
+		auto* vuDelegate = getVendorUniqueDelegate(vuProtocolID);
+
+		// No delegate, or the messages are not handled by the ControllerStateMachine
+		if (!vuDelegate || !vuDelegate->areHandledByControllerStateMachine(vuProtocolID))
+		{
+			return Error::MessageNotSupported;
+		}
+	}
+
+	// Command goes through the state machine to handle timeout, retry and response
+	return _stateMachineManager.sendAecpCommand(std::move(aecpdu), onResult);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendAecpResponse(Aecpdu::UniquePointer&& aecpdu) const noexcept
+{
+	auto const messageType = aecpdu->getMessageType();
+
+	if (!AVDECC_ASSERT_WITH_RET(isAecpResponseMessageType(messageType), "Calling sendAecpResponse with a Command MessageType"))
+	{
+		return Error::MessageNotSupported;
+	}
+
+	// Special check for VendorUnique messages
+	if (messageType == AecpMessageType::VendorUniqueResponse)
+	{
+		auto& vuAecp = static_cast<VuAecpdu&>(*aecpdu);
+
+		auto const vuProtocolID = vuAecp.getProtocolIdentifier();
+		auto* vuDelegate = getVendorUniqueDelegate(vuProtocolID);
+
+		// No delegate, or the messages are not handled by the ControllerStateMachine
+		if (!vuDelegate || !vuDelegate->areHandledByControllerStateMachine(vuProtocolID))
+		{
+			return Error::MessageNotSupported;
+		}
+	}
+
+	// Response can be directly sent
+	return sendMessage(static_cast<Aecpdu const&>(*aecpdu));
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendAcmpCommand(Acmpdu::UniquePointer&& acmpdu, AcmpCommandResultHandler const& onResult) const noexcept
+{
+	// Command goes through the state machine to handle timeout, retry and response
+	return _stateMachineManager.sendAcmpCommand(std::move(acmpdu), onResult);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendAcmpResponse(Acmpdu::UniquePointer&& acmpdu) const noexcept
+{
+	// Response can be directly sent
+	return sendMessage(static_cast<Acmpdu const&>(*acmpdu));
+}
+
+void ProtocolInterfaceCompositeImpl::lock() const noexcept
+{
+	_stateMachineManager.lock();
+}
+
+void ProtocolInterfaceCompositeImpl::unlock() const noexcept
+{
+	_stateMachineManager.unlock();
+}
+
+bool ProtocolInterfaceCompositeImpl::isSelfLocked() const noexcept
+{
+	return _stateMachineManager.isSelfLocked();
+}
+
+/* ************************************************************ */
+/* ProtocolInterfaceComposite overrides                         */
+/* ************************************************************ */
+std::size_t ProtocolInterfaceCompositeImpl::getProtocolInterfacesCount() const noexcept
+{
+	return _interfaces.size();
+}
+
+std::size_t ProtocolInterfaceCompositeImpl::getActiveProtocolInterfacesCount() const noexcept
+{
+	return getActiveInterfaces().size();
+}
+
+/* ************************************************************ */
+/* stateMachine::ProtocolInterfaceDelegate overrides            */
+/* ************************************************************ */
+void ProtocolInterfaceCompositeImpl::onAecpCommand(Aecpdu const& aecpdu) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpCommand, this, aecpdu);
+}
+
+void ProtocolInterfaceCompositeImpl::onVuAecpUnsolicitedResponse(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) noexcept
+{
+	handleVendorUniqueUnsolicitedResponse(protocolIdentifier, aecpdu);
+}
+
+void ProtocolInterfaceCompositeImpl::onAcmpCommand(Acmpdu const& acmpdu) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpCommand, this, acmpdu);
+}
+
+void ProtocolInterfaceCompositeImpl::onAcmpResponse(Acmpdu const& acmpdu) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpResponse, this, acmpdu);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendMessage(Adpdu const& adpdu) const noexcept
+{
+	auto const interfaces = getActiveInterfaces();
+	auto error = interfaces.empty() ? Error::TransportError : Error::NoError;
+	auto sentCount = std::size_t{ 0u };
+
+	// ADP is multicast, send it on all interfaces using each interface's MacAddress
+	for (auto const index : interfaces)
+	{
+		auto const& intfc = _interfaces[index];
+		auto err = Error::NoError;
+		if (adpdu.getSrcAddress() == getMacAddress())
+		{
+			auto frame = adpdu;
+			frame.setSrcAddress(intfc.macAddress);
+			err = intfc.protocolInterface->sendAdpMessage(frame);
+		}
+		else
+		{
+			err = intfc.protocolInterface->sendAdpMessage(adpdu);
+		}
+		if (!err)
+		{
+			++sentCount;
+		}
+		else
+		{
+			error = err;
+		}
+	}
+
+	// Success if the message was sent on at least one interface
+	return sentCount != 0u ? Error::NoError : error;
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendMessage(Aecpdu const& aecpdu) const noexcept
+{
+	auto const& destAddress = aecpdu.getDestAddress();
+
+	// Multicast AECP (identify notification), send it on all interfaces
+	if ((destAddress[0] & 0x01) != 0)
+	{
+		auto const interfaces = getActiveInterfaces();
+		auto error = interfaces.empty() ? Error::TransportError : Error::NoError;
+		auto sentCount = std::size_t{ 0u };
+		for (auto const index : interfaces)
+		{
+			auto const err = sendOnInterface(index, aecpdu);
+			if (!err)
+			{
+				++sentCount;
+			}
+			else
+			{
+				error = err;
+			}
+		}
+		return sentCount != 0u ? Error::NoError : error;
+	}
+
+	// Unicast AECP, send it on the interface the destination was last seen on
+	auto const index = getRouteToMacAddress(destAddress);
+	if (!index)
+	{
+		return Error::TransportError;
+	}
+	return sendOnInterface(*index, aecpdu);
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendMessage(Acmpdu const& acmpdu) const noexcept
+{
+	auto const interfaces = getActiveInterfaces();
+	auto error = interfaces.empty() ? Error::TransportError : Error::NoError;
+	auto sentCount = std::size_t{ 0u };
+
+	// ACMP is multicast, send it on all interfaces using each interface's MacAddress (responses received on more than one interface are filtered out)
+	for (auto const index : interfaces)
+	{
+		auto const& intfc = _interfaces[index];
+		auto err = Error::NoError;
+		if (acmpdu.getSrcAddress() == getMacAddress())
+		{
+			auto frame = acmpdu;
+			frame.setSrcAddress(intfc.macAddress);
+			err = intfc.protocolInterface->sendAcmpMessage(frame);
+		}
+		else
+		{
+			err = intfc.protocolInterface->sendAcmpMessage(acmpdu);
+		}
+		if (!err)
+		{
+			++sentCount;
+		}
+		else
+		{
+			error = err;
+		}
+	}
+
+	// Success if the message was sent on at least one interface
+	return sentCount != 0u ? Error::NoError : error;
+}
+
+/* *** Other methods **** */
+std::uint32_t ProtocolInterfaceCompositeImpl::getVuAecpCommandTimeoutMsec(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept
+{
+	return getVendorUniqueCommandTimeout(protocolIdentifier, aecpdu);
+}
+
+bool ProtocolInterfaceCompositeImpl::isVuAecpUnsolicitedResponse(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept
+{
+	return isVendorUniqueUnsolicitedResponse(protocolIdentifier, aecpdu);
+}
+
+/* ************************************************************ */
+/* stateMachine::AdvertiseStateMachine::Delegate overrides      */
+/* ************************************************************ */
+
+/* ************************************************************ */
+/* stateMachine::DiscoveryStateMachine::Delegate overrides      */
+/* ************************************************************ */
+void ProtocolInterfaceCompositeImpl::onLocalEntityOnline(entity::Entity const& entity) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityOnline, this, entity);
+}
+
+void ProtocolInterfaceCompositeImpl::onLocalEntityOffline(UniqueIdentifier const entityID) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityOffline, this, entityID);
+}
+
+void ProtocolInterfaceCompositeImpl::onLocalEntityUpdated(entity::Entity const& entity) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityUpdated, this, entity);
+}
+
+void ProtocolInterfaceCompositeImpl::onRemoteEntityOnline(entity::Entity const& entity) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityOnline, this, entity);
+}
+
+void ProtocolInterfaceCompositeImpl::onRemoteEntityOffline(UniqueIdentifier const entityID) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityOffline, this, entityID);
+
+	// Notify the StateMachineManager
+	_stateMachineManager.onRemoteEntityOffline(entityID);
+}
+
+void ProtocolInterfaceCompositeImpl::onRemoteEntityUpdated(entity::Entity const& entity) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityUpdated, this, entity);
+}
+
+/* ************************************************************ */
+/* stateMachine::CommandStateMachine::Delegate overrides        */
+/* ************************************************************ */
+void ProtocolInterfaceCompositeImpl::onAecpAemUnsolicitedResponse(AemAecpdu const& aecpdu) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpAemUnsolicitedResponse, this, aecpdu);
+}
+
+void ProtocolInterfaceCompositeImpl::onAecpAemIdentifyNotification(AemAecpdu const& aecpdu) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpAemIdentifyNotification, this, aecpdu);
+}
+
+void ProtocolInterfaceCompositeImpl::onAecpRetry(UniqueIdentifier const& entityID) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpRetry, this, entityID);
+}
+
+void ProtocolInterfaceCompositeImpl::onAecpTimeout(UniqueIdentifier const& entityID) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpTimeout, this, entityID);
+}
+
+void ProtocolInterfaceCompositeImpl::onAecpUnexpectedResponse(UniqueIdentifier const& entityID) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpUnexpectedResponse, this, entityID);
+}
+
+void ProtocolInterfaceCompositeImpl::onAecpResponseTime(UniqueIdentifier const& entityID, std::chrono::milliseconds const& responseTime) noexcept
+{
+	// Notify observers
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpResponseTime, this, entityID, responseTime);
+}
+
+/* ************************************************************ */
+/* la::avdecc::utils::Subject overrides                         */
+/* ************************************************************ */
+void ProtocolInterfaceCompositeImpl::onObserverRegistered(observer_type* const observer) noexcept
+{
+	if (observer)
+	{
+		class DiscoveryDelegate final : public stateMachine::DiscoveryStateMachine::Delegate
+		{
+		public:
+			DiscoveryDelegate(ProtocolInterface& pi, ProtocolInterface::Observer& obs)
+				: _pi{ pi }
+				, _obs{ obs }
+			{
+			}
+
+		private:
+			virtual void onLocalEntityOnline(la::avdecc::entity::Entity const& entity) noexcept override
+			{
+				utils::invokeProtectedMethod(&ProtocolInterface::Observer::onLocalEntityOnline, &_obs, &_pi, entity);
+			}
+			virtual void onLocalEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
+			virtual void onLocalEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+			virtual void onRemoteEntityOnline(la::avdecc::entity::Entity const& entity) noexcept override
+			{
+				utils::invokeProtectedMethod(&ProtocolInterface::Observer::onRemoteEntityOnline, &_obs, &_pi, entity);
+			}
+			virtual void onRemoteEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
+			virtual void onRemoteEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+
+			ProtocolInterface& _pi;
+			ProtocolInterface::Observer& _obs;
+		};
+		auto discoveryDelegate = DiscoveryDelegate{ *this, static_cast<ProtocolInterface::Observer&>(*observer) };
+
+		_stateMachineManager.notifyDiscoveredEntities(discoveryDelegate);
+	}
+}
+
+/* ************************************************************ */
+/* Aggregated interfaces notifications                          */
+/* ************************************************************ */
+void ProtocolInterfaceCompositeImpl::onInterfaceTransportError(ProtocolInterface* const pi) noexcept
+{
+	auto hasActiveInterface = false;
+	{
+		auto const lg = std::lock_guard{ _routingLock };
+		for (auto& intfc : _interfaces)
+		{
+			if (intfc.protocolInterface.get() == pi)
+			{
+				intfc.isActive = false;
+				LOG_PROTOCOL_INTERFACE_WARN(intfc.macAddress, networkInterface::MacAddress{}, "Aggregated interface reported a transport error, no longer using it");
+			}
+			hasActiveInterface |= intfc.isActive;
+		}
+		// Forget routes, they will be learnt again on the remaining interfaces
+		_macAddressRoutes.clear();
+	}
+
+	// Only critical once all interfaces failed
+	if (!hasActiveInterface)
+	{
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onTransportError, this);
+	}
+}
+
+void ProtocolInterfaceCompositeImpl::onInterfaceAdpdu(ProtocolInterface* const pi, Adpdu const& adpdu) noexcept
+{
+	// Identify the advertising interface of the entity, not the advertisement itself (its available index changes each time), so that an entity seen on several links is followed through the link it is first seen on
+	auto key = MulticastMessageKey{ adpdu.getSrcAddress(), AvtpSubType_Adp, adpdu.getMessageType().getValue() };
+	key.firstID = adpdu.getEntityID().getValue();
+	key.extra = adpdu.getInterfaceIndex();
+
+	if (acceptMessage(pi, adpdu.getSrcAddress(), key))
+	{
+		// Low level notification
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAdpduReceived, this, adpdu);
+
+		// Forward to our state machine
+		_stateMachineManager.processAdpdu(adpdu);
+	}
+}
+
+void ProtocolInterfaceCompositeImpl::onInterfaceAecpdu(ProtocolInterface* const pi, Aecpdu const& aecpdu) noexcept
+{
+	if (!acceptMessage(pi, aecpdu.getSrcAddress(), std::nullopt))
+	{
+		return;
+	}
+
+	// Low level notification
+	notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpduReceived, this, aecpdu);
+
+	// VendorUnique messages not handled by the ControllerStateMachine are forwarded through onInterfaceVuAecpdu
+	auto const messageType = aecpdu.getMessageType();
+	if (messageType == AecpMessageType::VendorUniqueCommand)
+	{
+		return;
+	}
+	if (messageType == AecpMessageType::VendorUniqueResponse && !isVendorUniqueHandledByControllerStateMachine(static_cast<VuAecpdu const&>(aecpdu).getProtocolIdentifier()))
+	{
+		return;
+	}
+
+	// Forward to our state machine
+	_stateMachineManager.processAecpdu(aecpdu);
+}
+
+void ProtocolInterfaceCompositeImpl::onInterfaceAcmpdu(ProtocolInterface* const pi, Acmpdu const& acmpdu) noexcept
+{
+	auto key = MulticastMessageKey{ acmpdu.getSrcAddress(), AvtpSubType_Acmp, acmpdu.getMessageType().getValue() };
+	key.firstID = acmpdu.getControllerEntityID().getValue();
+	key.secondID = acmpdu.getTalkerEntityID().getValue();
+	key.thirdID = acmpdu.getListenerEntityID().getValue();
+	key.extra = (static_cast<std::uint64_t>(acmpdu.getSequenceID()) << 32) | (static_cast<std::uint64_t>(acmpdu.getTalkerUniqueID()) << 16) | acmpdu.getListenerUniqueID();
+
+	if (acceptMessage(pi, acmpdu.getSrcAddress(), key))
+	{
+		// Low level notification
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpduReceived, this, acmpdu);
+
+		// Forward to our state machine
+		_stateMachineManager.processAcmpdu(acmpdu);
+	}
+}
+
+void ProtocolInterfaceCompositeImpl::onInterfaceVuAecpdu(ProtocolInterface* const pi, VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu, bool const isResponse) noexcept
+{
+	if (!acceptMessage(pi, aecpdu.getSrcAddress(), std::nullopt))
+	{
+		return;
+	}
+
+	if (auto* const delegate = getVendorUniqueDelegate(protocolIdentifier))
+	{
+		if (isResponse)
+		{
+			delegate->onVuAecpResponse(this, protocolIdentifier, aecpdu);
+		}
+		else
+		{
+			delegate->onVuAecpCommand(this, protocolIdentifier, aecpdu);
+		}
+	}
+}
+
+/* ************************************************************ */
+/* Private methods                                              */
+/* ************************************************************ */
+bool ProtocolInterfaceCompositeImpl::isVendorUniqueHandledByControllerStateMachine(VuAecpdu::ProtocolIdentifier const& protocolIdentifier) const noexcept
+{
+	auto const* const delegate = getVendorUniqueDelegate(protocolIdentifier);
+	return delegate != nullptr && delegate->areHandledByControllerStateMachine(protocolIdentifier);
+}
+
+bool ProtocolInterfaceCompositeImpl::acceptMessage(ProtocolInterface const* const pi, networkInterface::MacAddress const& srcAddress, std::optional<MulticastMessageKey> const& key) noexcept
+{
+	auto const lg = std::lock_guard{ _routingLock };
+
+	auto interfaceIndex = std::optional<std::size_t>{};
+	for (auto index = 0u; index < _interfaces.size(); ++index)
+	{
+		auto const& intfc = _interfaces[index];
+		if (intfc.protocolInterface.get() == pi)
+		{
+			interfaceIndex = index;
+		}
+		// A message sent by another of our interfaces (segments are bridged together), ignore it
+		else if (intfc.macAddress == srcAddress)
+		{
+			return false;
+		}
+	}
+	if (!interfaceIndex || !_interfaces[*interfaceIndex].isActive)
+	{
+		return false;
+	}
+
+	// Duplicate detection
+	if (key)
+	{
+		auto const now = std::chrono::steady_clock::now();
+
+		// Purge old messages
+		if ((now - _lastRecentMessagesPurge) > DuplicateDetectionWindow)
+		{
+			for (auto it = _recentMulticastMessages.begin(); it != _recentMulticastMessages.end();)
+			{
+				if ((now - it->second.lastSeen) > DuplicateDetectionWindow)
+				{
+					it = _recentMulticastMessages.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+			_lastRecentMessagesPurge = now;
+		}
+
+		auto& info = _recentMulticastMessages[*key];
+		// Same message recently received on another interface
+		if (info.lastSeen != std::chrono::steady_clock::time_point{} && info.interfaceIndex != *interfaceIndex && (now - info.lastSeen) <= DuplicateDetectionWindow)
+		{
+			return false;
+		}
+		info.interfaceIndex = *interfaceIndex;
+		info.lastSeen = now;
+	}
+
+	// Learn the route to the sender (not from duplicates, so that the route doesn't change with the link delivering the last copy)
+	_macAddressRoutes[srcAddress] = *interfaceIndex;
+
+	return true;
+}
+
+std::vector<std::size_t> ProtocolInterfaceCompositeImpl::getActiveInterfaces() const noexcept
+{
+	auto const lg = std::lock_guard{ _routingLock };
+
+	auto interfaces = std::vector<std::size_t>{};
+	for (auto index = 0u; index < _interfaces.size(); ++index)
+	{
+		if (_interfaces[index].isActive)
+		{
+			interfaces.push_back(index);
+		}
+	}
+	return interfaces;
+}
+
+std::optional<std::size_t> ProtocolInterfaceCompositeImpl::getRouteToMacAddress(networkInterface::MacAddress const& macAddress) const noexcept
+{
+	auto const lg = std::lock_guard{ _routingLock };
+
+	// Known route
+	if (auto const routeIt = _macAddressRoutes.find(macAddress); routeIt != _macAddressRoutes.end() && _interfaces[routeIt->second].isActive)
+	{
+		return routeIt->second;
+	}
+
+	// Unknown destination, use the first active interface
+	for (auto index = 0u; index < _interfaces.size(); ++index)
+	{
+		if (_interfaces[index].isActive)
+		{
+			return index;
+		}
+	}
+	return std::nullopt;
+}
+
+/** Returns a copy of an Aecpdu, or nullptr if its type cannot be copied (Vendor Unique messages other than Milan ones) */
+static Aecpdu::UniquePointer copyAecpdu(Aecpdu const& aecpdu) noexcept
+{
+	auto const copy = [](auto const& message) -> Aecpdu::UniquePointer
+	{
+		using Message = std::decay_t<decltype(message)>;
+		try
+		{
+			return Aecpdu::UniquePointer{ new Message(message), [](Aecpdu* self)
+				{
+					delete static_cast<Message*>(self);
+				} };
+		}
+		catch (...)
+		{
+			return Aecpdu::UniquePointer{ nullptr, nullptr };
+		}
+	};
+
+	auto const messageType = aecpdu.getMessageType();
+	if (messageType == AecpMessageType::AemCommand || messageType == AecpMessageType::AemResponse)
+	{
+		return copy(static_cast<AemAecpdu const&>(aecpdu));
+	}
+	if (messageType == AecpMessageType::AddressAccessCommand || messageType == AecpMessageType::AddressAccessResponse)
+	{
+		return copy(static_cast<AaAecpdu const&>(aecpdu));
+	}
+	if (messageType == AecpMessageType::VendorUniqueCommand || messageType == AecpMessageType::VendorUniqueResponse)
+	{
+		auto const& vuAecpdu = static_cast<VuAecpdu const&>(aecpdu);
+		if (vuAecpdu.getProtocolIdentifier() == MvuAecpdu::ProtocolID)
+		{
+			return copy(static_cast<MvuAecpdu const&>(vuAecpdu));
+		}
+	}
+	return Aecpdu::UniquePointer{ nullptr, nullptr };
+}
+
+ProtocolInterface::Error ProtocolInterfaceCompositeImpl::sendOnInterface(std::size_t const interfaceIndex, Aecpdu const& aecpdu) const noexcept
+{
+	auto const& intfc = _interfaces[interfaceIndex];
+
+	// Messages sent with our MacAddress must use the MacAddress of the interface they are sent on, so that responses are received on the same interface
+	if (aecpdu.getSrcAddress() == getMacAddress() && intfc.macAddress != getMacAddress())
+	{
+		// The message belongs to the caller (and may be sent on several interfaces), change the source address of a copy
+		if (auto message = copyAecpdu(aecpdu))
+		{
+			message->setSrcAddress(intfc.macAddress);
+			return intfc.protocolInterface->sendAecpMessage(*message);
+		}
+		LOG_PROTOCOL_INTERFACE_DEBUG(intfc.macAddress, aecpdu.getDestAddress(), "Cannot copy this AECPDU, sending it with the composite MacAddress");
+	}
+
+	return intfc.protocolInterface->sendAecpMessage(aecpdu);
+}
+
+ProtocolInterfaceComposite::ProtocolInterfaceComposite(std::string const& networkInterfaceID, networkInterface::MacAddress const& macAddress, std::string const& executorName)
+	: ProtocolInterface(networkInterfaceID, macAddress, executorName)
+{
+}
+
+bool ProtocolInterfaceComposite::isSupported() noexcept
+{
+	return true;
+}
+
+ProtocolInterfaceComposite* ProtocolInterfaceComposite::createRawProtocolInterfaceComposite(std::vector<ProtocolInterface::UniquePointer>&& protocolInterfaces)
+{
+	if (protocolInterfaces.empty())
+	{
+		throw Exception(Error::InvalidParameters, "At least one ProtocolInterface is required");
+	}
+
+	auto networkInterfaceID = std::string{ "Composite" };
+	auto const& executorName = protocolInterfaces.front() ? protocolInterfaces.front()->getExecutorName() : std::string{};
+	for (auto const& pi : protocolInterfaces)
+	{
+		if (!pi)
+		{
+			throw Exception(Error::InvalidParameters, "Invalid ProtocolInterface");
+		}
+		if (!pi->isDirectMessageSupported())
+		{
+			throw Exception(Error::InterfaceNotSupported, "All ProtocolInterfaces must support direct messages");
+		}
+		// Messages from all interfaces must be processed by the same thread
+		if (pi->getExecutorName() != executorName)
+		{
+			throw Exception(Error::InvalidParameters, "All ProtocolInterfaces must use the same executor");
+		}
+		networkInterfaceID += "+" + networkInterface::NetworkInterfaceHelper::macAddressToString(pi->getMacAddress(), true);
+	}
+
+	return new ProtocolInterfaceCompositeImpl(networkInterfaceID, std::move(protocolInterfaces));
+}
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
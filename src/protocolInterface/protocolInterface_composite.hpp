@@ -0,0 +1,78 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_composite.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/protocolInterface.hpp"
+
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+class ProtocolInterfaceComposite : public ProtocolInterface
+{
+public:
+	/**
+	* @brief Factory method to create a new ProtocolInterfaceComposite.
+	* @details Creates a new ProtocolInterfaceComposite as a raw pointer, taking ownership of the specified ProtocolInterfaces.
+	*          The composite runs its own state machines and exposes the MacAddress of the first (primary) interface. Messages are sent and received through the aggregated interfaces:
+	*           - ADP and ACMP messages are sent on all interfaces (with the source MacAddress of each interface)
+	*           - AECP messages are sent on the interface the destination MacAddress was last seen on (the primary interface if it's unknown), so that responses are routed back on the interface the command arrived on
+	*           - ADP and ACMP messages received on more than one interface are only processed once
+	*          Only the MVU VendorUnique protocol is forwarded from the aggregated interfaces.
+	* @param[in] protocolInterfaces The ProtocolInterfaces to aggregate. They must all support direct messages and use the same executor.
+	* @return A new ProtocolInterfaceComposite as a raw pointer.
+	* @note Throws Exception if #protocolInterfaces is empty or contains an unsupported interface.
+	*/
+	static ProtocolInterfaceComposite* createRawProtocolInterfaceComposite(std::vector<ProtocolInterface::UniquePointer>&& protocolInterfaces);
+
+	/** Returns true if this ProtocolInterface is supported (runtime check) */
+	static bool isSupported() noexcept;
+
+	/** Returns the count of aggregated ProtocolInterfaces. */
+	virtual std::size_t getProtocolInterfacesCount() const noexcept = 0;
+
+	/** Returns the count of aggregated ProtocolInterfaces that did not report a transport error. */
+	virtual std::size_t getActiveProtocolInterfacesCount() const noexcept = 0;
+
+	/** Destructor */
+	virtual ~ProtocolInterfaceComposite() noexcept = default;
+
+	// Deleted compiler auto-generated methods
+	ProtocolInterfaceComposite(ProtocolInterfaceComposite&&) = delete;
+	ProtocolInterfaceComposite(ProtocolInterfaceComposite const&) = delete;
+	ProtocolInterfaceComposite& operator=(ProtocolInterfaceComposite const&) = delete;
+	ProtocolInterfaceComposite& operator=(ProtocolInterfaceComposite&&) = delete;
+
+protected:
+	ProtocolInterfaceComposite(std::string const& networkInterfaceID, networkInterface::MacAddress const& macAddress, std::string const& executorName);
+};
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
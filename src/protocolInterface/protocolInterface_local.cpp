@@ -584,6 +584,16 @@ private:
 	/* ************************************************************ */
 	void processRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept
 	{
+		// Record the frame
+		if (isRecordingFrames())
+		{
+			auto etherLayer2 = EtherLayer2{};
+			etherLayer2.setEtherType(AvtpEtherType);
+			etherLayer2.setSrcAddress(Peer_Mac_Address);
+			etherLayer2.setDestAddress(Local_Mac_Address);
+			recordFrame(FrameDirection::Inbound, etherLayer2, packet.data(), packet.size());
+		}
+
 		la::avdecc::ExecutorManager::getInstance().pushJob(getExecutorName(),
 			[this, msg = std::move(packet)]()
 			{
@@ -643,6 +653,16 @@ private:
 
 	Error sendPacket(SerializationBuffer const& buffer) const noexcept
 	{
+		// Record the frame
+		if (isRecordingFrames())
+		{
+			auto etherLayer2 = EtherLayer2{};
+			etherLayer2.setEtherType(AvtpEtherType);
+			etherLayer2.setSrcAddress(Local_Mac_Address);
+			etherLayer2.setDestAddress(Peer_Mac_Address);
+			recordFrame(FrameDirection::Outbound, etherLayer2, buffer.data(), buffer.size());
+		}
+
 		auto iov = iovec{ const_cast<void*>(reinterpret_cast<const void*>(buffer.data())), buffer.size() };
 		msghdr msg{};
 
@@ -672,6 +672,9 @@ private:
 	{
 		auto* self = reinterpret_cast<ProtocolInterfacePcapImpl*>(user);
 
+		// Record the frame
+		self->recordFrame(FrameDirection::Inbound, pkt_data, header->caplen);
+
 		// Make a copy of the pcap message and forward to the processing queue
 		auto pcapMessage = la::avdecc::MemoryBuffer{ pkt_data, header->caplen };
 		self->processRawPacket(std::move(pcapMessage));
@@ -693,7 +696,10 @@ private:
 			if (pcap != nullptr)
 			{
 				if (_pcapLibrary.sendpacket(pcap, buffer.data(), static_cast<int>(length)) == 0)
+				{
+					recordFrame(FrameDirection::Outbound, buffer.data(), length);
 					return Error::NoError;
+				}
 			}
 		}
 		catch (...)
@@ -0,0 +1,1123 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_proxy.cpp
+* @author Christophe Calmejane
+*/
+
+#include "la/avdecc/internals/serialization.hpp"
+#include "la/avdecc/internals/protocolAemAecpdu.hpp"
+#include "la/avdecc/internals/protocolAaAecpdu.hpp"
+#include "la/avdecc/watchDog.hpp"
+#include "la/avdecc/utils.hpp"
+#include "la/avdecc/executor.hpp"
+
+#include "stateMachine/stateMachineManager.hpp"
+#include "ethernetPacketDispatch.hpp"
+#include "protocolInterface_proxy.hpp"
+#include "proxyProtocol.hpp"
+#include "logHelper.hpp"
+
+#include <stdexcept>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <string>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+#include <poll.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+static constexpr int SocketLoopTimeout = 250u;
+static constexpr auto ConnectTimeout = std::chrono::seconds{ 5 };
+static constexpr std::size_t SocketReceiveBufferLength = 64u * 1024u;
+static constexpr std::size_t MaxPendingSendBytes = 1024u * 1024u; // Don't let the send queue grow indefinitely if the server doesn't read fast enough
+
+/** An established connection with a proxy server (HTTP handshake done and LINK_UP received) */
+struct ProxyConnection
+{
+	int fd{ -1 };
+	networkInterface::MacAddress macAddress{};
+	proxy::MessageReader reader{};
+	std::vector<std::pair<networkInterface::MacAddress, la::avdecc::MemoryBuffer>> pendingMessages{}; // AVDECC messages received along with the LINK_UP message
+};
+
+static std::pair<std::string, std::uint16_t> parseServerAddress(std::string const& networkInterfaceName)
+{
+	auto host = std::string{};
+	auto port = std::string{};
+
+	// [IPv6]:port
+	if (!networkInterfaceName.empty() && networkInterfaceName[0] == '[')
+	{
+		auto const closingPos = networkInterfaceName.find(']');
+		if (closingPos == std::string::npos)
+		{
+			throw ProtocolInterface::Exception(ProtocolInterface::Error::InvalidParameters, "Invalid proxy server address (missing closing bracket)");
+		}
+		host = networkInterfaceName.substr(1, closingPos - 1);
+		auto const remaining = networkInterfaceName.substr(closingPos + 1);
+		if (!remaining.empty())
+		{
+			if (remaining[0] != ':')
+			{
+				throw ProtocolInterface::Exception(ProtocolInterface::Error::InvalidParameters, "Invalid proxy server address");
+			}
+			port = remaining.substr(1);
+		}
+	}
+	else
+	{
+		auto const colonPos = networkInterfaceName.rfind(':');
+		// Only split if there is a single colon (otherwise it's an IPv6 address without port)
+		if (colonPos != std::string::npos && networkInterfaceName.find(':') == colonPos)
+		{
+			host = networkInterfaceName.substr(0, colonPos);
+			port = networkInterfaceName.substr(colonPos + 1);
+		}
+		else
+		{
+			host = networkInterfaceName;
+		}
+	}
+
+	if (host.empty())
+	{
+		throw ProtocolInterface::Exception(ProtocolInterface::Error::InvalidParameters, "Invalid proxy server address (empty host)");
+	}
+
+	if (port.empty())
+	{
+		return { host, proxy::DefaultPort };
+	}
+
+	try
+	{
+		auto pos = std::size_t{ 0u };
+		auto const value = std::stoul(port, &pos);
+		if (pos != port.size() || value == 0u || value > 65535u)
+		{
+			throw std::invalid_argument("Out of range");
+		}
+		return { host, static_cast<std::uint16_t>(value) };
+	}
+	catch (std::exception const&)
+	{
+		throw ProtocolInterface::Exception(ProtocolInterface::Error::InvalidParameters, "Invalid proxy server port: " + port);
+	}
+}
+
+/** Waits for the specified poll events on the socket, until the deadline. Returns false if the deadline expired. */
+static bool waitForSocket(int const fd, short const events, std::chrono::steady_clock::time_point const deadline) noexcept
+{
+	while (true)
+	{
+		auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+		if (remaining <= 0)
+		{
+			return false;
+		}
+		auto pfd = pollfd{ fd, events, 0 };
+		auto const ret = ::poll(&pfd, 1, static_cast<int>(remaining));
+		if (ret > 0)
+		{
+			return true;
+		}
+		if (ret < 0 && errno != EINTR)
+		{
+			return false;
+		}
+	}
+}
+
+static int connectSocket(std::string const& host, std::uint16_t const port, std::chrono::steady_clock::time_point const deadline)
+{
+	auto hints = addrinfo{};
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+
+	auto* result = static_cast<addrinfo*>(nullptr);
+	if (::getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &result) != 0 || result == nullptr)
+	{
+		throw ProtocolInterface::Exception(ProtocolInterface::Error::InterfaceNotFound, "Cannot resolve proxy server address: " + host);
+	}
+
+	auto fd = -1;
+	for (auto* ai = result; ai != nullptr; ai = ai->ai_next)
+	{
+		fd = ::socket(ai->ai_family, ai->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, ai->ai_protocol);
+		if (fd < 0)
+		{
+			continue;
+		}
+		if (::connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+		{
+			break;
+		}
+		if (errno == EINPROGRESS && waitForSocket(fd, POLLOUT, deadline))
+		{
+			auto error = int{ 0 };
+			auto errorLength = static_cast<socklen_t>(sizeof(error));
+			if (::getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &errorLength) == 0 && error == 0)
+			{
+				break;
+			}
+		}
+		::close(fd);
+		fd = -1;
+	}
+	::freeaddrinfo(result);
+
+	if (fd < 0)
+	{
+		throw ProtocolInterface::Exception(ProtocolInterface::Error::TransportError, "Failed to connect to proxy server " + host + ":" + std::to_string(port));
+	}
+
+	// Messages are coalesced by the interface itself, send them as soon as possible
+	auto const noDelay = int{ 1 };
+	::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+	return fd;
+}
+
+static ProxyConnection connectToServer(std::string const& networkInterfaceName)
+{
+	auto const [host, port] = parseServerAddress(networkInterfaceName);
+	auto const deadline = std::chrono::steady_clock::now() + ConnectTimeout;
+
+	auto connection = ProxyConnection{};
+	connection.fd = connectSocket(host, port, deadline);
+
+	try
+	{
+		// Send the HTTP CONNECT request
+		auto const request = proxy::makeConnectRequest(host, port);
+		auto sent = std::size_t{ 0u };
+		while (sent < request.size())
+		{
+			auto const ret = ::send(connection.fd, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+			if (ret > 0)
+			{
+				sent += static_cast<std::size_t>(ret);
+			}
+			else if ((errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) || !waitForSocket(connection.fd, POLLOUT, deadline))
+			{
+				throw ProtocolInterface::Exception(ProtocolInterface::Error::TransportError, "Failed to send request to proxy server");
+			}
+		}
+
+		auto isLinkUp = false;
+		auto const handler = [&connection, &isLinkUp](proxy::MessageType const messageType, networkInterface::MacAddress const& address, std::uint8_t const* const payload, std::size_t const payloadLength)
+		{
+			switch (messageType)
+			{
+				case proxy::MessageType::LinkUp:
+					connection.macAddress = address;
+					isLinkUp = true;
+					break;
+				case proxy::MessageType::AvdeccFromAps:
+					if (isLinkUp)
+					{
+						connection.pendingMessages.emplace_back(address, la::avdecc::MemoryBuffer{ payload, payloadLength });
+					}
+					break;
+				default:
+					break;
+			}
+		};
+
+		// Read the HTTP response, then wait for the LINK_UP message
+		auto httpResponse = std::vector<std::uint8_t>{};
+		auto isHttpResponseReceived = false;
+		auto buffer = std::array<std::uint8_t, 2048>{};
+		while (!isLinkUp)
+		{
+			if (!waitForSocket(connection.fd, POLLIN, deadline))
+			{
+				throw ProtocolInterface::Exception(ProtocolInterface::Error::Timeout, "Timeout waiting for proxy server response");
+			}
+			auto const ret = ::recv(connection.fd, buffer.data(), buffer.size(), 0);
+			if (ret == 0)
+			{
+				throw ProtocolInterface::Exception(ProtocolInterface::Error::TransportError, "Proxy server closed the connection");
+			}
+			if (ret < 0)
+			{
+				if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+				{
+					continue;
+				}
+				throw ProtocolInterface::Exception(ProtocolInterface::Error::TransportError, "Failed to read from proxy server");
+			}
+
+			auto const* data = buffer.data();
+			auto length = static_cast<std::size_t>(ret);
+			if (!isHttpResponseReceived)
+			{
+				httpResponse.insert(httpResponse.end(), data, data + length);
+				auto const headerLength = proxy::getHttpHeaderLength(httpResponse.data(), httpResponse.size());
+				if (!headerLength)
+				{
+					if (httpResponse.size() > proxy::MaximumHttpHeaderLength)
+					{
+						throw ProtocolInterface::Exception(ProtocolInterface::Error::TransportError, "Invalid proxy server response");
+					}
+					continue;
+				}
+				if (!proxy::isSuccessfulResponse(httpResponse.data(), *headerLength))
+				{
+					throw ProtocolInterface::Exception(ProtocolInterface::Error::TransportError, "Proxy server refused the connection");
+				}
+				isHttpResponseReceived = true;
+
+				// Bytes following the HTTP response are APPDUs
+				data = httpResponse.data() + *headerLength;
+				length = httpResponse.size() - *headerLength;
+			}
+			if (!connection.reader.feed(data, length, handler))
+			{
+				throw ProtocolInterface::Exception(ProtocolInterface::Error::TransportError, "Invalid message received from proxy server");
+			}
+		}
+	}
+	catch (...)
+	{
+		::close(connection.fd);
+		throw;
+	}
+
+	return connection;
+}
+
+class ProtocolInterfaceProxyImpl final : public ProtocolInterfaceProxy, private stateMachine::ProtocolInterfaceDelegate, private stateMachine::AdvertiseStateMachine::Delegate, private stateMachine::DiscoveryStateMachine::Delegate, private stateMachine::CommandStateMachine::Delegate
+{
+public:
+	/* ************************************************************ */
+	/* Public APIs                                                  */
+	/* ************************************************************ */
+	/** Constructor */
+	ProtocolInterfaceProxyImpl(std::string const& networkInterfaceName, ProxyConnection&& connection, std::string const& executorName)
+		: ProtocolInterfaceProxy(networkInterfaceName, connection.macAddress, executorName)
+		, _fd{ connection.fd }
+		, _reader{ std::move(connection.reader) }
+	{
+		_eventFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+		if (_eventFd < 0 || _epollFd < 0)
+		{
+			_fd = -1; // Socket is closed by the factory
+			closeDescriptors();
+			throw Exception(Error::TransportError, "Failed to create epoll instance");
+		}
+
+		auto socketEvent = epoll_event{};
+		socketEvent.events = EPOLLIN;
+		socketEvent.data.fd = _fd;
+		auto wakeEvent = epoll_event{};
+		wakeEvent.events = EPOLLIN;
+		wakeEvent.data.fd = _eventFd;
+		if (::epoll_ctl(_epollFd, EPOLL_CTL_ADD, _fd, &socketEvent) < 0 || ::epoll_ctl(_epollFd, EPOLL_CTL_ADD, _eventFd, &wakeEvent) < 0)
+		{
+			_fd = -1; // Socket is closed by the factory
+			closeDescriptors();
+			throw Exception(Error::TransportError, "Failed to register socket to epoll instance");
+		}
+
+		// Start the state machines (before processing any message)
+		_stateMachineManager.startStateMachines();
+
+		// Process messages received along with the LINK_UP message
+		for (auto& [srcAddress, message] : connection.pendingMessages)
+		{
+			processRawPacket(srcAddress, std::move(message));
+		}
+
+		// Start the I/O thread
+		_ioThread = std::thread(
+			[this]
+			{
+				utils::setCurrentThreadName("avdecc::ProxyInterface::IO");
+				socketLoop();
+				_isConnected = false;
+				if (!_shouldTerminate)
+				{
+					notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onTransportError, this);
+				}
+			});
+	}
+
+	/** Destructor */
+	virtual ~ProtocolInterfaceProxyImpl() noexcept
+	{
+		shutdown();
+	}
+
+	/** Destroy method for COM-like interface */
+	virtual void destroy() noexcept override
+	{
+		delete this;
+	}
+
+	// Deleted compiler auto-generated methods
+	ProtocolInterfaceProxyImpl(ProtocolInterfaceProxyImpl&&) = delete;
+	ProtocolInterfaceProxyImpl(ProtocolInterfaceProxyImpl const&) = delete;
+	ProtocolInterfaceProxyImpl& operator=(ProtocolInterfaceProxyImpl const&) = delete;
+	ProtocolInterfaceProxyImpl& operator=(ProtocolInterfaceProxyImpl&&) = delete;
+
+private:
+	/* ************************************************************ */
+	/* ProtocolInterface overrides                                  */
+	/* ************************************************************ */
+	virtual void shutdown() noexcept override
+	{
+		// Stop the state machines
+		_stateMachineManager.stopStateMachines();
+
+		// Notify the thread we are shutting down
+		_shouldTerminate = true;
+		wakeIOThread();
+
+		// Wait for the thread to complete its pending tasks
+		if (_ioThread.joinable())
+		{
+			_ioThread.join();
+		}
+
+		// Flush executor jobs
+		la::avdecc::ExecutorManager::getInstance().flush(getExecutorName());
+
+		// Close underlying file descriptors
+		closeDescriptors();
+	}
+
+	virtual UniqueIdentifier getDynamicEID() const noexcept override
+	{
+		return generateDynamicEID();
+	}
+
+	virtual void releaseDynamicEID(UniqueIdentifier const /*entityID*/) const noexcept override
+	{
+		// Nothing to do
+	}
+
+	virtual Error registerLocalEntity(entity::LocalEntity& entity) noexcept override
+	{
+		// Checks if entity has declared an InterfaceInformation matching this ProtocolInterface
+		auto const index = _stateMachineManager.getMatchingInterfaceIndex(entity);
+
+		if (index)
+		{
+			return _stateMachineManager.registerLocalEntity(entity);
+		}
+
+		return Error::InvalidParameters;
+	}
+
+	virtual Error unregisterLocalEntity(entity::LocalEntity& entity) noexcept override
+	{
+		return _stateMachineManager.unregisterLocalEntity(entity);
+	}
+
+	virtual Error injectRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept override
+	{
+		processRawPacket(getMacAddress(), std::move(packet));
+		return Error::NoError;
+	}
+
+	virtual Error setEntityNeedsAdvertise(entity::LocalEntity const& entity, entity::LocalEntity::AdvertiseFlags const /*flags*/) noexcept override
+	{
+		return _stateMachineManager.setEntityNeedsAdvertise(entity);
+	}
+
+	virtual Error enableEntityAdvertising(entity::LocalEntity& entity) noexcept override
+	{
+		return _stateMachineManager.enableEntityAdvertising(entity);
+	}
+
+	virtual Error disableEntityAdvertising(entity::LocalEntity const& entity) noexcept override
+	{
+		return _stateMachineManager.disableEntityAdvertising(entity);
+	}
+
+	virtual Error discoverRemoteEntities() const noexcept override
+	{
+		return discoverRemoteEntity(UniqueIdentifier::getNullUniqueIdentifier());
+	}
+
+	virtual Error discoverRemoteEntity(UniqueIdentifier const entityID) const noexcept override
+	{
+		auto const frame = stateMachine::Manager::makeDiscoveryMessage(getMacAddress(), entityID);
+		auto const err = sendMessage(frame);
+		if (!err)
+		{
+			_stateMachineManager.discoverMessageSent(); // Notify we are sending a discover message
+		}
+		return err;
+	}
+
+	virtual Error forgetRemoteEntity(UniqueIdentifier const entityID) const noexcept override
+	{
+		return _stateMachineManager.forgetRemoteEntity(entityID);
+	}
+
+	virtual Error setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) const noexcept override
+	{
+		return _stateMachineManager.setAutomaticDiscoveryDelay(delay);
+	}
+
+	virtual bool isDirectMessageSupported() const noexcept override
+	{
+		return true;
+	}
+
+	virtual Error sendAdpMessage(Adpdu const& adpdu) const noexcept override
+	{
+		return sendMessage(adpdu);
+	}
+
+	virtual Error sendAecpMessage(Aecpdu const& aecpdu) const noexcept override
+	{
+		return sendMessage(aecpdu);
+	}
+
+	virtual Error sendAcmpMessage(Acmpdu const& acmpdu) const noexcept override
+	{
+		return sendMessage(acmpdu);
+	}
+
+	virtual Error sendAecpCommand(Aecpdu::UniquePointer&& aecpdu, AecpCommandResultHandler const& onResult) const noexcept override
+	{
+		auto const messageType = aecpdu->getMessageType();
+
+		if (!AVDECC_ASSERT_WITH_RET(!isAecpResponseMessageType(messageType), "Calling sendAecpCommand with a Response MessageType"))
+		{
+			return Error::MessageNotSupported;
+		}
+
+		// Special check for VendorUnique messages
+		if (messageType == AecpMessageType::VendorUniqueCommand)
+		{
+			auto& vuAecp = static_cast<VuAecpdu&>(*aecpdu);
+
+			auto const vuProtocolID = vuAecp.getProtocolIdentifier();
+			auto* vuDelegate = getVendorUniqueDelegate(vuProtocolID);
+
+			// No delegate, or the messages are not handled by the ControllerStateMachine
+			if (!vuDelegate || !vuDelegate->areHandledByControllerStateMachine(vuProtocolID))
+			{
+				return Error::MessageNotSupported;
+			}
+		}
+
+		// Command goes through the state machine to handle timeout, retry and response
+		return _stateMachineManager.sendAecpCommand(std::move(aecpdu), onResult);
+	}
+
+	virtual Error sendAecpResponse(Aecpdu::UniquePointer&& aecpdu) const noexcept override
+	{
+		auto const messageType = aecpdu->getMessageType();
+
+		if (!AVDECC_ASSERT_WITH_RET(isAecpResponseMessageType(messageType), "Calling sendAecpResponse with a Command MessageType"))
+		{
+			return Error::MessageNotSupported;
+		}
+
+		// Special check for VendorUnique messages
+		if (messageType == AecpMessageType::VendorUniqueResponse)
+		{
+			auto& vuAecp = static_cast<VuAecpdu&>(*aecpdu);
+
+			auto const vuProtocolID = vuAecp.getProtocolIdentifier();
+			auto* vuDelegate = getVendorUniqueDelegate(vuProtocolID);
+
+			// No delegate, or the messages are not handled by the ControllerStateMachine
+			if (!vuDelegate || !vuDelegate->areHandledByControllerStateMachine(vuProtocolID))
+			{
+				return Error::MessageNotSupported;
+			}
+		}
+
+		// Response can be directly sent
+		return sendMessage(static_cast<Aecpdu const&>(*aecpdu));
+	}
+
+	virtual Error sendAcmpCommand(Acmpdu::UniquePointer&& acmpdu, AcmpCommandResultHandler const& onResult) const noexcept override
+	{
+		// Command goes through the state machine to handle timeout, retry and response
+		return _stateMachineManager.sendAcmpCommand(std::move(acmpdu), onResult);
+	}
+
+	virtual Error sendAcmpResponse(Acmpdu::UniquePointer&& acmpdu) const noexcept override
+	{
+		// Response can be directly sent
+		return sendMessage(static_cast<Acmpdu const&>(*acmpdu));
+	}
+
+	virtual void lock() const noexcept override
+	{
+		_stateMachineManager.lock();
+	}
+
+	virtual void unlock() const noexcept override
+	{
+		_stateMachineManager.unlock();
+	}
+
+	virtual bool isSelfLocked() const noexcept override
+	{
+		return _stateMachineManager.isSelfLocked();
+	}
+
+	/* ************************************************************ */
+	/* stateMachine::ProtocolInterfaceDelegate overrides            */
+	/* ************************************************************ */
+	/* **** AECP notifications **** */
+	virtual void onAecpCommand(Aecpdu const& aecpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpCommand, this, aecpdu);
+	}
+
+	virtual void onVuAecpUnsolicitedResponse(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) noexcept override
+	{
+		handleVendorUniqueUnsolicitedResponse(protocolIdentifier, aecpdu);
+	}
+
+	/* **** ACMP notifications **** */
+	virtual void onAcmpCommand(Acmpdu const& acmpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpCommand, this, acmpdu);
+	}
+
+	virtual void onAcmpResponse(Acmpdu const& acmpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpResponse, this, acmpdu);
+	}
+
+	/* **** Sending methods **** */
+	virtual Error sendMessage(Adpdu const& adpdu) const noexcept override
+	{
+		try
+		{
+			SerializationBuffer buffer;
+
+			// Then Avtp control
+			serialize<AvtpduControl>(adpdu, buffer);
+			// Then with Adp
+			serialize<Adpdu>(adpdu, buffer);
+
+			// Send the message
+			return sendPacket(adpdu.getDestAddress(), buffer);
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(adpdu.getSrcAddress(), adpdu.getDestAddress(), std::string("Failed to serialize ADPDU: ") + e.what());
+			return Error::InternalError;
+		}
+	}
+
+	virtual Error sendMessage(Aecpdu const& aecpdu) const noexcept override
+	{
+		try
+		{
+			SerializationBuffer buffer;
+
+			// Then Avtp control
+			serialize<AvtpduControl>(aecpdu, buffer);
+			// Then with Aecp
+			serialize<Aecpdu>(aecpdu, buffer);
+
+			// Send the message
+			return sendPacket(aecpdu.getDestAddress(), buffer);
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(aecpdu.getSrcAddress(), aecpdu.getDestAddress(), std::string("Failed to serialize AECPDU: ") + e.what());
+			return Error::InternalError;
+		}
+	}
+
+	virtual Error sendMessage(Acmpdu const& acmpdu) const noexcept override
+	{
+		try
+		{
+			SerializationBuffer buffer;
+
+			// Then Avtp control
+			serialize<AvtpduControl>(acmpdu, buffer);
+			// Then with Acmp
+			serialize<Acmpdu>(acmpdu, buffer);
+
+			// Send the message
+			return sendPacket(Acmpdu::Multicast_Mac_Address, buffer);
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(acmpdu.getSrcAddress(), Acmpdu::Multicast_Mac_Address, "Failed to serialize ACMPDU: {}", e.what());
+			return Error::InternalError;
+		}
+	}
+
+	/* *** Other methods **** */
+	virtual std::uint32_t getVuAecpCommandTimeoutMsec(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept override
+	{
+		return getVendorUniqueCommandTimeout(protocolIdentifier, aecpdu);
+	}
+
+	virtual bool isVuAecpUnsolicitedResponse(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept override
+	{
+		return isVendorUniqueUnsolicitedResponse(protocolIdentifier, aecpdu);
+	}
+
+	/* ************************************************************ */
+	/* stateMachine::AdvertiseStateMachine::Delegate overrides      */
+	/* ************************************************************ */
+
+	/* ************************************************************ */
+	/* stateMachine::DiscoveryStateMachine::Delegate overrides      */
+	/* ************************************************************ */
+	virtual void onLocalEntityOnline(entity::Entity const& entity) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityOnline, this, entity);
+	}
+
+	virtual void onLocalEntityOffline(UniqueIdentifier const entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityOffline, this, entityID);
+	}
+
+	virtual void onLocalEntityUpdated(entity::Entity const& entity) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityUpdated, this, entity);
+	}
+
+	virtual void onRemoteEntityOnline(entity::Entity const& entity) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityOnline, this, entity);
+	}
+
+	virtual void onRemoteEntityOffline(UniqueIdentifier const entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityOffline, this, entityID);
+
+		// Notify the StateMachineManager
+		_stateMachineManager.onRemoteEntityOffline(entityID);
+	}
+
+	virtual void onRemoteEntityUpdated(entity::Entity const& entity) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityUpdated, this, entity);
+	}
+
+	/* ************************************************************ */
+	/* stateMachine::CommandStateMachine::Delegate overrides        */
+	/* ************************************************************ */
+	virtual void onAecpAemUnsolicitedResponse(AemAecpdu const& aecpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpAemUnsolicitedResponse, this, aecpdu);
+	}
+	virtual void onAecpAemIdentifyNotification(AemAecpdu const& aecpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpAemIdentifyNotification, this, aecpdu);
+	}
+	virtual void onAecpRetry(UniqueIdentifier const& entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpRetry, this, entityID);
+	}
+	virtual void onAecpTimeout(UniqueIdentifier const& entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpTimeout, this, entityID);
+	}
+	virtual void onAecpUnexpectedResponse(UniqueIdentifier const& entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpUnexpectedResponse, this, entityID);
+	}
+	virtual void onAecpResponseTime(UniqueIdentifier const& entityID, std::chrono::milliseconds const& responseTime) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpResponseTime, this, entityID, responseTime);
+	}
+
+	/* ************************************************************ */
+	/* la::avdecc::utils::Subject overrides                         */
+	/* ************************************************************ */
+	virtual void onObserverRegistered(observer_type* const observer) noexcept override
+	{
+		if (observer)
+		{
+			class DiscoveryDelegate final : public stateMachine::DiscoveryStateMachine::Delegate
+			{
+			public:
+				DiscoveryDelegate(ProtocolInterface& pi, ProtocolInterface::Observer& obs)
+					: _pi{ pi }
+					, _obs{ obs }
+				{
+				}
+
+			private:
+				virtual void onLocalEntityOnline(la::avdecc::entity::Entity const& entity) noexcept override
+				{
+					utils::invokeProtectedMethod(&ProtocolInterface::Observer::onLocalEntityOnline, &_obs, &_pi, entity);
+				}
+				virtual void onLocalEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
+				virtual void onLocalEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+				virtual void onRemoteEntityOnline(la::avdecc::entity::Entity const& entity) noexcept override
+				{
+					utils::invokeProtectedMethod(&ProtocolInterface::Observer::onRemoteEntityOnline, &_obs, &_pi, entity);
+				}
+				virtual void onRemoteEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
+				virtual void onRemoteEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+
+				ProtocolInterface& _pi;
+				ProtocolInterface::Observer& _obs;
+			};
+			auto discoveryDelegate = DiscoveryDelegate{ *this, static_cast<ProtocolInterface::Observer&>(*observer) };
+
+			_stateMachineManager.notifyDiscoveredEntities(discoveryDelegate);
+		}
+	}
+
+	/* ************************************************************ */
+	/* Private methods                                              */
+	/* ************************************************************ */
+	void processRawPacket(networkInterface::MacAddress const& srcAddress, la::avdecc::MemoryBuffer&& packet) const noexcept
+	{
+		if (packet.size() < AvtpduControl::HeaderLength)
+		{
+			return;
+		}
+
+		// Proxied messages don't carry the destination address, rebuild it from the kind of message
+		auto etherLayer2 = EtherLayer2{};
+		etherLayer2.setEtherType(AvtpEtherType);
+		etherLayer2.setSrcAddress(srcAddress);
+		etherLayer2.setDestAddress((packet.data()[0] & 0x7f) == AvtpSubType_Aecp ? getMacAddress() : Adpdu::Multicast_Mac_Address);
+
+		// Record the frame
+		if (isRecordingFrames())
+		{
+			recordFrame(FrameDirection::Inbound, etherLayer2, packet.data(), packet.size());
+		}
+
+		la::avdecc::ExecutorManager::getInstance().pushJob(getExecutorName(),
+			[this, etherLayer2, msg = std::move(packet)]()
+			{
+				std::uint8_t const* avtpdu = msg.data(); // Start of AVB Transport Protocol
+				auto avtpdu_size = msg.size();
+
+				// Check AVTP control bit (meaning AVDECC packet)
+				std::uint8_t avtp_sub_type_control = avtpdu[0];
+				if ((avtp_sub_type_control & 0xF0) == 0)
+				{
+					return;
+				}
+
+				// Try to detect possible deadlock
+				{
+					_watchDog.registerWatch("avdecc::ProxyInterface::dispatchAvdeccMessage::" + utils::toHexString(reinterpret_cast<size_t>(this)), std::chrono::milliseconds{ 1000u }, true);
+					_ethernetPacketDispatcher.dispatchAvdeccMessage(avtpdu, avtpdu_size, etherLayer2);
+					_watchDog.unregisterWatch("avdecc::ProxyInterface::dispatchAvdeccMessage::" + utils::toHexString(reinterpret_cast<size_t>(this)), true);
+				}
+			});
+	}
+
+	void processProxyMessage(proxy::MessageType const messageType, networkInterface::MacAddress const& address, std::uint8_t const* const payload, std::size_t const payloadLength) const noexcept
+	{
+		switch (messageType)
+		{
+			case proxy::MessageType::AvdeccFromAps:
+				processRawPacket(address, la::avdecc::MemoryBuffer{ payload, payloadLength });
+				break;
+			case proxy::MessageType::LinkUp:
+				LOG_PROTOCOL_INTERFACE_DEBUG(address, getMacAddress(), "Proxy server network link is up");
+				break;
+			case proxy::MessageType::LinkDown:
+				LOG_PROTOCOL_INTERFACE_WARN(address, getMacAddress(), "Proxy server network link is down");
+				break;
+			default:
+				// Ignore other messages (NOP, EntityID and vendor messages)
+				break;
+		}
+	}
+
+	void wakeIOThread() const noexcept
+	{
+		if (_eventFd >= 0)
+		{
+			auto const value = std::uint64_t{ 1u };
+			[[maybe_unused]] auto const ret = ::write(_eventFd, &value, sizeof(value));
+		}
+	}
+
+	void closeDescriptors() noexcept
+	{
+		for (auto* fd : { &_epollFd, &_eventFd, &_fd })
+		{
+			if (*fd != -1)
+			{
+				::close(*fd);
+				*fd = -1;
+			}
+		}
+	}
+
+	/** Reads everything available on the socket. Returns false if the connection has been closed or is corrupted. */
+	bool readSocket() noexcept
+	{
+		while (true)
+		{
+			auto const bytesReceived = ::recv(_fd, _receiveBuffer.get(), SocketReceiveBufferLength, 0);
+			if (bytesReceived > 0)
+			{
+				auto const result = _reader.feed(_receiveBuffer.get(), static_cast<std::size_t>(bytesReceived),
+					[this](proxy::MessageType const messageType, networkInterface::MacAddress const& address, std::uint8_t const* const payload, std::size_t const payloadLength)
+					{
+						processProxyMessage(messageType, address, payload, payloadLength);
+					});
+				if (!result)
+				{
+					LOG_PROTOCOL_INTERFACE_ERROR(networkInterface::MacAddress{}, getMacAddress(), "Invalid message received from proxy server, closing connection");
+					return false;
+				}
+				continue;
+			}
+			if (bytesReceived == 0)
+			{
+				LOG_PROTOCOL_INTERFACE_WARN(networkInterface::MacAddress{}, getMacAddress(), "Proxy server closed the connection");
+				return false;
+			}
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return errno == EAGAIN || errno == EWOULDBLOCK;
+		}
+	}
+
+	/** Writes as much pending data as possible in a single call. Returns false if the connection has been closed. */
+	bool flushSendQueue() noexcept
+	{
+		// Grab everything queued since last time (coalescing all pending messages into a single write)
+		if (_writeOffset == _writeBuffer.size())
+		{
+			_writeBuffer.clear();
+			_writeOffset = 0u;
+			auto const lg = std::lock_guard{ _sendLock };
+			_writeBuffer.swap(_sendQueue);
+		}
+
+		while (_writeOffset < _writeBuffer.size())
+		{
+			auto const bytesSent = ::send(_fd, _writeBuffer.data() + _writeOffset, _writeBuffer.size() - _writeOffset, MSG_NOSIGNAL);
+			if (bytesSent > 0)
+			{
+				_writeOffset += static_cast<std::size_t>(bytesSent);
+				continue;
+			}
+			if (bytesSent < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if (bytesSent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+			{
+				break;
+			}
+			return false;
+		}
+
+		// Only poll for write readiness when the socket buffer is full
+		auto const needsPollOut = _writeOffset < _writeBuffer.size();
+		if (needsPollOut != _isPollingOut)
+		{
+			auto socketEvent = epoll_event{};
+			socketEvent.events = EPOLLIN | (needsPollOut ? EPOLLOUT : 0u);
+			socketEvent.data.fd = _fd;
+			::epoll_ctl(_epollFd, EPOLL_CTL_MOD, _fd, &socketEvent);
+			_isPollingOut = needsPollOut;
+		}
+
+		return true;
+	}
+
+	void socketLoop() noexcept
+	{
+		auto events = std::array<epoll_event, 4>{};
+
+		while (!_shouldTerminate)
+		{
+			auto const count = ::epoll_wait(_epollFd, events.data(), static_cast<int>(events.size()), SocketLoopTimeout); // timeout so we can check _shouldTerminate
+			if (count < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				break;
+			}
+
+			for (auto i = 0; i < count; ++i)
+			{
+				auto const& event = events[i];
+				if (event.data.fd == _eventFd)
+				{
+					auto value = std::uint64_t{ 0u };
+					[[maybe_unused]] auto const ret = ::read(_eventFd, &value, sizeof(value));
+				}
+				else if (event.data.fd == _fd)
+				{
+					if ((event.events & EPOLLIN) != 0 && !readSocket())
+					{
+						return;
+					}
+					if ((event.events & (EPOLLERR | EPOLLHUP)) != 0 && (event.events & EPOLLIN) == 0)
+					{
+						return;
+					}
+				}
+			}
+
+			if (!flushSendQueue())
+			{
+				LOG_PROTOCOL_INTERFACE_WARN(networkInterface::MacAddress{}, getMacAddress(), "Failed to send to proxy server, closing connection");
+				return;
+			}
+		}
+	}
+
+	Error sendPacket(networkInterface::MacAddress const& destAddress, SerializationBuffer const& buffer) const noexcept
+	{
+		if (!_isConnected)
+		{
+			return Error::TransportError;
+		}
+
+		// Record the frame
+		if (isRecordingFrames())
+		{
+			auto etherLayer2 = EtherLayer2{};
+			etherLayer2.setEtherType(AvtpEtherType);
+			etherLayer2.setSrcAddress(getMacAddress());
+			etherLayer2.setDestAddress(destAddress);
+			recordFrame(FrameDirection::Outbound, etherLayer2, buffer.data(), buffer.size());
+		}
+
+		auto wasEmpty = false;
+		{
+			auto const lg = std::lock_guard{ _sendLock };
+			if ((_sendQueue.size() + proxy::HeaderLength + buffer.size()) > MaxPendingSendBytes)
+			{
+				LOG_PROTOCOL_INTERFACE_WARN(getMacAddress(), destAddress, "Proxy send queue full, dropping message");
+				return Error::TransportError;
+			}
+			wasEmpty = _sendQueue.empty();
+			proxy::appendMessage(_sendQueue, proxy::MessageType::AvdeccFromApc, destAddress, buffer.data(), buffer.size());
+		}
+
+		// Only wake the I/O thread for the first queued message, all messages queued until it runs are written at once
+		if (wasEmpty)
+		{
+			wakeIOThread();
+		}
+
+		return Error::NoError;
+	}
+
+	// Private variables
+	watchDog::WatchDog::SharedPointer _watchDogSharedPointer{ watchDog::WatchDog::getInstance() };
+	watchDog::WatchDog& _watchDog{ *_watchDogSharedPointer };
+	int _fd{ -1 };
+	int _eventFd{ -1 };
+	int _epollFd{ -1 };
+	std::atomic_bool _shouldTerminate{ false };
+	std::atomic_bool _isConnected{ true };
+	// Receive path (only accessed by the I/O thread)
+	proxy::MessageReader _reader{};
+	std::unique_ptr<std::uint8_t[]> _receiveBuffer{ std::make_unique<std::uint8_t[]>(SocketReceiveBufferLength) };
+	// Send path
+	mutable std::mutex _sendLock{};
+	mutable std::vector<std::uint8_t> _sendQueue{}; // Messages queued by any thread, protected by _sendLock
+	std::vector<std::uint8_t> _writeBuffer{}; // Messages being written (only accessed by the I/O thread)
+	std::size_t _writeOffset{ 0u };
+	bool _isPollingOut{ false };
+	mutable stateMachine::Manager _stateMachineManager{ this, this, this, this, this };
+	std::thread _ioThread{};
+	friend class EthernetPacketDispatcher<ProtocolInterfaceProxyImpl>;
+	EthernetPacketDispatcher<ProtocolInterfaceProxyImpl> _ethernetPacketDispatcher{ this, _stateMachineManager };
+};
+
+ProtocolInterfaceProxy::ProtocolInterfaceProxy(std::string const& networkInterfaceName, networkInterface::MacAddress const& macAddress, std::string const& executorName)
+	: ProtocolInterface(networkInterfaceName, macAddress, executorName)
+{
+}
+
+bool ProtocolInterfaceProxy::isSupported() noexcept
+{
+	return true;
+}
+
+ProtocolInterfaceProxy* ProtocolInterfaceProxy::createRawProtocolInterfaceProxy(std::string const& networkInterfaceName, std::string const& executorName)
+{
+	auto connection = connectToServer(networkInterfaceName);
+	try
+	{
+		return new ProtocolInterfaceProxyImpl(networkInterfaceName, std::move(connection), executorName);
+	}
+	catch (...)
+	{
+		// The constructor doesn't own the socket until it successfully returns
+		::close(connection.fd);
+		throw;
+	}
+}
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,69 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_proxy.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/protocolInterface.hpp"
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+class ProtocolInterfaceProxy : public ProtocolInterface
+{
+public:
+	/**
+	* @brief Factory method to create a new ProtocolInterfaceProxy.
+	* @details Creates a new ProtocolInterfaceProxy as a raw pointer.
+	*          The interface connects to an AVDECC Proxy Server (IEEE Std 1722.1 Annex C) over TCP and tunnels all AVDECC messages through it.
+	*          The MAC address of the interface is the one of the proxy server network port (as announced in its LINK_UP message).
+	*          Outgoing messages are coalesced into as few TCP segments as possible, and sent without delay (TCP_NODELAY).
+	* @param[in] networkInterfaceName The address of the proxy server, as `host[:port]` (use brackets for IPv6 addresses, e.g. `[::1]:17221`). Default port is 17221.
+	* @param[in] executorName The name of the executor to use to dispatch incoming messages.
+	* @return A new ProtocolInterfaceProxy as a raw pointer.
+	* @note Throws Exception if #networkInterfaceName is invalid, if the server cannot be reached or if it refuses the connection.
+	*/
+	static ProtocolInterfaceProxy* createRawProtocolInterfaceProxy(std::string const& networkInterfaceName, std::string const& executorName);
+
+	/** Returns true if this ProtocolInterface is supported (runtime check) */
+	static bool isSupported() noexcept;
+
+	/** Destructor */
+	virtual ~ProtocolInterfaceProxy() noexcept = default;
+
+	// Deleted compiler auto-generated methods
+	ProtocolInterfaceProxy(ProtocolInterfaceProxy&&) = delete;
+	ProtocolInterfaceProxy(ProtocolInterfaceProxy const&) = delete;
+	ProtocolInterfaceProxy& operator=(ProtocolInterfaceProxy const&) = delete;
+	ProtocolInterfaceProxy& operator=(ProtocolInterfaceProxy&&) = delete;
+
+protected:
+	ProtocolInterfaceProxy(std::string const& networkInterfaceName, networkInterface::MacAddress const& macAddress, std::string const& executorName);
+};
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,1074 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_replay.cpp
+* @author Christophe Calmejane
+*/
+
+#include "la/avdecc/internals/serialization.hpp"
+#include "la/avdecc/internals/protocolAemAecpdu.hpp"
+#include "la/avdecc/internals/protocolAaAecpdu.hpp"
+#include "la/avdecc/watchDog.hpp"
+#include "la/avdecc/utils.hpp"
+#include "la/avdecc/executor.hpp"
+
+#include "stateMachine/stateMachineManager.hpp"
+#include "ethernetPacketDispatch.hpp"
+#include "protocolInterface_replay.hpp"
+#include "captureFile.hpp"
+#include "logHelper.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <optional>
+#include <functional>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+// We need a valid non-zero MAC address to represent the replay interface (locally administered address)
+static constexpr networkInterface::MacAddress Local_Mac_Address = { 0x0A, 0xE9, 0x1B, 0x00, 0x00, 0x01 };
+
+static constexpr std::uint16_t VlanEtherType = 0x8100;
+static constexpr std::size_t VlanTagLength = 4u;
+
+// Offsets in AECPDU and ACMPDU (from the start of the AVTPDU)
+static constexpr std::size_t AvtpduControlHeaderLength = 12u;
+static constexpr std::size_t ControllerEntityIDOffset = 12u; // Same for AECP and ACMP
+static constexpr std::size_t AecpSequenceIDOffset = 20u;
+static constexpr std::size_t AecpCommandTypeOffset = 22u;
+static constexpr std::size_t VuAecpCommandTypeOffset = 28u; // After the ProtocolIdentifier
+static constexpr std::size_t AcmpStreamFieldsOffset = 20u; // TalkerEntityID, ListenerEntityID, TalkerUniqueID, ListenerUniqueID
+static constexpr std::size_t AcmpStreamFieldsLength = 20u;
+static constexpr std::size_t AcmpSequenceIDOffset = 48u;
+static constexpr std::size_t AcmpduLength = 56u;
+
+/** Returns the AVTPDU of an Ethernet frame (skipping the 802.1Q tag, if any), or nullptr if the frame is not an AVDECC frame */
+static std::uint8_t const* getAvdeccAvtpdu(std::uint8_t const* const frame, std::size_t const frameSize, std::size_t& avtpduSize) noexcept
+{
+	if (frameSize < EtherLayer2::HeaderLength)
+	{
+		return nullptr;
+	}
+
+	// Skip 802.1Q tag, if any
+	auto etherTypeOffset = std::size_t{ 12u };
+	auto etherType = AVDECC_UNPACK_TYPE(*((std::uint16_t const*)(frame + etherTypeOffset)), std::uint16_t);
+	if (etherType == VlanEtherType && frameSize >= (EtherLayer2::HeaderLength + VlanTagLength))
+	{
+		etherTypeOffset += VlanTagLength;
+		etherType = AVDECC_UNPACK_TYPE(*((std::uint16_t const*)(frame + etherTypeOffset)), std::uint16_t);
+	}
+
+	// Capture files may contain anything, filter out non-AVTP frames
+	if (etherType != AvtpEtherType)
+	{
+		return nullptr;
+	}
+
+	auto const* const avtpdu = frame + etherTypeOffset + 2; // Start of AVB Transport Protocol
+	avtpduSize = frameSize - etherTypeOffset - 2;
+	// Check AVTP control bit (meaning AVDECC packet)
+	if (avtpduSize == 0 || (avtpdu[0] & 0xF0) == 0)
+	{
+		return nullptr;
+	}
+
+	return avtpdu;
+}
+
+/** Identification of an AECP or ACMP command or response */
+struct ExchangeInfo
+{
+	bool isCommand{ false };
+	std::size_t sequenceIDOffset{ 0u };
+	std::string exchangeKey{}; // AVTP subtype, controller EntityID, target EntityID (AECP only) and sequenceID, shared by a command and its response
+	std::string commandKey{}; // AVTP subtype, message type and all the fields of a command except the controller EntityID and the sequenceID
+};
+
+/** Returns the exchange information of an AECPDU or ACMPDU, or std::nullopt for other messages (including unsolicited responses) */
+static std::optional<ExchangeInfo> getExchangeInfo(std::uint8_t const* const avtpdu, std::size_t const avtpduSize)
+{
+	if (avtpduSize < AvtpduControlHeaderLength)
+	{
+		return std::nullopt;
+	}
+
+	auto const appendBytes = [avtpdu](std::string& key, std::size_t const offset, std::size_t const length)
+	{
+		key.append(reinterpret_cast<char const*>(avtpdu + offset), length);
+	};
+	auto const subType = static_cast<std::uint8_t>(avtpdu[0] & 0x7F);
+	auto const messageType = static_cast<std::uint8_t>(avtpdu[1] & 0x0F);
+	auto info = ExchangeInfo{};
+	// Commands have even message types, their response being the next odd value (for both AECP and ACMP)
+	info.isCommand = (messageType % 2u) == 0u;
+	info.exchangeKey.push_back(static_cast<char>(subType));
+	info.exchangeKey.push_back(static_cast<char>(messageType & 0x0E));
+	info.commandKey.push_back(static_cast<char>(subType));
+	info.commandKey.push_back(static_cast<char>(messageType));
+
+	if (subType == AvtpSubType_Aecp)
+	{
+		auto const controlDataLength = static_cast<std::size_t>(((avtpdu[2] & 0x07) << 8) | avtpdu[3]);
+		auto const pduLength = std::min(avtpduSize, AvtpduControlHeaderLength + controlDataLength);
+		if (pduLength < (AecpCommandTypeOffset + 2u))
+		{
+			return std::nullopt;
+		}
+		// Unsolicited responses are not part of an exchange
+		if (messageType == AecpMessageType::AemResponse.getValue() && (avtpdu[AecpCommandTypeOffset] & 0x80) != 0)
+		{
+			return std::nullopt;
+		}
+		if (messageType == AecpMessageType::VendorUniqueResponse.getValue() && pduLength >= (VuAecpCommandTypeOffset + 2u) && (avtpdu[VuAecpCommandTypeOffset] & 0x80) != 0)
+		{
+			return std::nullopt;
+		}
+		info.sequenceIDOffset = AecpSequenceIDOffset;
+		// TargetEntityID, ControllerEntityID and SequenceID
+		appendBytes(info.exchangeKey, 4u, AecpCommandTypeOffset - 4u);
+		// TargetEntityID and everything following the SequenceID
+		appendBytes(info.commandKey, 4u, 8u);
+		appendBytes(info.commandKey, AecpCommandTypeOffset, pduLength - AecpCommandTypeOffset);
+		return info;
+	}
+
+	if (subType == AvtpSubType_Acmp)
+	{
+		if (avtpduSize < AcmpduLength)
+		{
+			return std::nullopt;
+		}
+		info.sequenceIDOffset = AcmpSequenceIDOffset;
+		appendBytes(info.exchangeKey, ControllerEntityIDOffset, 8u);
+		appendBytes(info.exchangeKey, AcmpSequenceIDOffset, 2u);
+		appendBytes(info.commandKey, AcmpStreamFieldsOffset, AcmpStreamFieldsLength);
+		return info;
+	}
+
+	return std::nullopt;
+}
+
+class ProtocolInterfaceReplayImpl final : public ProtocolInterfaceReplay, private stateMachine::ProtocolInterfaceDelegate, private stateMachine::AdvertiseStateMachine::Delegate, private stateMachine::DiscoveryStateMachine::Delegate, private stateMachine::CommandStateMachine::Delegate
+{
+public:
+	/* ************************************************************ */
+	/* Public APIs                                                  */
+	/* ************************************************************ */
+	/** Constructor */
+	ProtocolInterfaceReplayImpl(std::string const& networkInterfaceName, std::string const& executorName)
+		: ProtocolInterfaceReplay(networkInterfaceName, Local_Mac_Address, executorName)
+	{
+		auto fileParameters = utils::tokenizeString(networkInterfaceName, '@', false);
+
+		if (fileParameters.size() < 1 || fileParameters.size() > 3)
+		{
+			throw Exception(Error::InvalidParameters, "Expected capture file name format path[@speed][@silent]");
+		}
+
+		// Get replay options
+		auto isSpeedSet = false;
+		for (auto paramIndex = std::size_t{ 1u }; paramIndex < fileParameters.size(); ++paramIndex)
+		{
+			auto const& param = fileParameters[paramIndex];
+			if (param == "silent")
+			{
+				_isSilent = true;
+			}
+			else if (isSpeedSet)
+			{
+				throw Exception(Error::InvalidParameters, "Expected capture file name format path[@speed][@silent]");
+			}
+			else if (param == "max")
+			{
+				_speedFactor = 0.0;
+				isSpeedSet = true;
+			}
+			else
+			{
+				try
+				{
+					_speedFactor = std::stod(param);
+				}
+				catch (...)
+				{
+					_speedFactor = -1.0;
+				}
+				if (_speedFactor < 0.0)
+				{
+					throw Exception(Error::InvalidParameters, "Invalid replay speed (expected a positive multiplier or 'max')");
+				}
+				isSpeedSet = true;
+			}
+		}
+
+		// Open capture file
+		try
+		{
+			_reader.emplace(fileParameters[0]);
+		}
+		catch (std::exception const& e)
+		{
+			throw Exception(Error::InterfaceNotFound, e.what());
+		}
+
+		// Index the recorded responses, to answer the commands sent through this interface
+		if (!_isSilent)
+		{
+			indexRecordedResponses(fileParameters[0]);
+		}
+
+		// Start the state machines (the replay itself is started once observers and local entities are ready)
+		_stateMachineManager.startStateMachines();
+	}
+
+	/** Destructor */
+	virtual ~ProtocolInterfaceReplayImpl() noexcept
+	{
+		shutdown();
+	}
+
+	/** Destroy method for COM-like interface */
+	virtual void destroy() noexcept override
+	{
+		delete this;
+	}
+
+	// Deleted compiler auto-generated methods
+	ProtocolInterfaceReplayImpl(ProtocolInterfaceReplayImpl&&) = delete;
+	ProtocolInterfaceReplayImpl(ProtocolInterfaceReplayImpl const&) = delete;
+	ProtocolInterfaceReplayImpl& operator=(ProtocolInterfaceReplayImpl const&) = delete;
+	ProtocolInterfaceReplayImpl& operator=(ProtocolInterfaceReplayImpl&&) = delete;
+
+private:
+	/* ************************************************************ */
+	/* ProtocolInterfaceReplay overrides                            */
+	/* ************************************************************ */
+	virtual void startReplay() noexcept override
+	{
+		{
+			auto const lg = std::lock_guard{ _replayMutex };
+			_isReplayControlled = true;
+			_isReplayPaused = false;
+			startReplayThread();
+		}
+		_replayCondition.notify_all();
+	}
+
+	virtual void pauseReplay() noexcept override
+	{
+		{
+			auto const lg = std::lock_guard{ _replayMutex };
+			_isReplayControlled = true;
+			_isReplayPaused = true;
+		}
+		_replayCondition.notify_all();
+	}
+
+	virtual bool waitForReplayCompletion(std::chrono::milliseconds const timeout) const noexcept override
+	{
+		{
+			auto lock = std::unique_lock{ _replayMutex };
+			if (!_replayCondition.wait_for(lock, timeout,
+						[this]
+						{
+							return _replayCompleted;
+						}))
+			{
+				return false;
+			}
+		}
+
+		// Wait for all injected frames to be processed
+		la::avdecc::ExecutorManager::getInstance().flush(getExecutorName());
+
+		return true;
+	}
+
+	virtual std::uint64_t getInjectedFramesCount() const noexcept override
+	{
+		return _injectedFramesCount;
+	}
+
+	/* ************************************************************ */
+	/* ProtocolInterface overrides                                  */
+	/* ************************************************************ */
+	virtual void shutdown() noexcept override
+	{
+		// Stop the state machines
+		_stateMachineManager.stopStateMachines();
+
+		// Notify the thread we are shutting down
+		{
+			auto const lg = std::lock_guard{ _replayMutex };
+			_shouldTerminate = true;
+		}
+		_replayCondition.notify_all();
+
+		// Wait for the thread to complete its pending tasks
+		if (_replayThread.joinable())
+		{
+			_replayThread.join();
+		}
+
+		// Flush executor jobs
+		la::avdecc::ExecutorManager::getInstance().flush(getExecutorName());
+	}
+
+	virtual UniqueIdentifier getDynamicEID() const noexcept override
+	{
+		return generateDynamicEID();
+	}
+
+	virtual void releaseDynamicEID(UniqueIdentifier const /*entityID*/) const noexcept override
+	{
+		// Nothing to do
+	}
+
+	virtual Error registerLocalEntity(entity::LocalEntity& entity) noexcept override
+	{
+		// Checks if entity has declared an InterfaceInformation matching this ProtocolInterface
+		auto const index = _stateMachineManager.getMatchingInterfaceIndex(entity);
+
+		if (index)
+		{
+			auto const error = _stateMachineManager.registerLocalEntity(entity);
+
+			// Automatically start the replay when the replay is not explicitly driven (ProtocolInterface created by a Controller or an EndStation), now that an entity observes the frames
+			if (!error)
+			{
+				auto const lg = std::lock_guard{ _replayMutex };
+				if (!_isReplayControlled)
+				{
+					startReplayThread();
+				}
+			}
+
+			return error;
+		}
+
+		return Error::InvalidParameters;
+	}
+
+	virtual Error unregisterLocalEntity(entity::LocalEntity& entity) noexcept override
+	{
+		return _stateMachineManager.unregisterLocalEntity(entity);
+	}
+
+	virtual Error injectRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept override
+	{
+		processRawPacket(std::move(packet));
+		return Error::NoError;
+	}
+
+	virtual Error setEntityNeedsAdvertise(entity::LocalEntity const& entity, entity::LocalEntity::AdvertiseFlags const /*flags*/) noexcept override
+	{
+		return _stateMachineManager.setEntityNeedsAdvertise(entity);
+	}
+
+	virtual Error enableEntityAdvertising(entity::LocalEntity& entity) noexcept override
+	{
+		return _stateMachineManager.enableEntityAdvertising(entity);
+	}
+
+	virtual Error disableEntityAdvertising(entity::LocalEntity const& entity) noexcept override
+	{
+		return _stateMachineManager.disableEntityAdvertising(entity);
+	}
+
+	virtual Error discoverRemoteEntities() const noexcept override
+	{
+		return discoverRemoteEntity(UniqueIdentifier::getNullUniqueIdentifier());
+	}
+
+	virtual Error discoverRemoteEntity(UniqueIdentifier const entityID) const noexcept override
+	{
+		auto const frame = stateMachine::Manager::makeDiscoveryMessage(getMacAddress(), entityID);
+		auto const err = sendMessage(frame);
+		if (!err)
+		{
+			_stateMachineManager.discoverMessageSent(); // Notify we are sending a discover message
+		}
+		return err;
+	}
+
+	virtual Error forgetRemoteEntity(UniqueIdentifier const entityID) const noexcept override
+	{
+		return _stateMachineManager.forgetRemoteEntity(entityID);
+	}
+
+	virtual Error setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) const noexcept override
+	{
+		return _stateMachineManager.setAutomaticDiscoveryDelay(delay);
+	}
+
+	virtual bool isDirectMessageSupported() const noexcept override
+	{
+		return true;
+	}
+
+	virtual Error sendAdpMessage(Adpdu const& adpdu) const noexcept override
+	{
+		return sendMessage(adpdu);
+	}
+
+	virtual Error sendAecpMessage(Aecpdu const& aecpdu) const noexcept override
+	{
+		return sendMessage(aecpdu);
+	}
+
+	virtual Error sendAcmpMessage(Acmpdu const& acmpdu) const noexcept override
+	{
+		return sendMessage(acmpdu);
+	}
+
+	virtual Error sendAecpCommand(Aecpdu::UniquePointer&& aecpdu, AecpCommandResultHandler const& onResult) const noexcept override
+	{
+		auto const messageType = aecpdu->getMessageType();
+
+		if (!AVDECC_ASSERT_WITH_RET(!isAecpResponseMessageType(messageType), "Calling sendAecpCommand with a Response MessageType"))
+		{
+			return Error::MessageNotSupported;
+		}
+
+		// Special check for VendorUnique messages
+		if (messageType == AecpMessageType::VendorUniqueCommand)
+		{
+			auto& vuAecp = static_cast<VuAecpdu&>(*aecpdu);
+
+			auto const vuProtocolID = vuAecp.getProtocolIdentifier();
+			auto* vuDelegate = getVendorUniqueDelegate(vuProtocolID);
+
+			// No delegate, or the messages are not handled by the ControllerStateMachine
+			if (!vuDelegate || !vuDelegate->areHandledByControllerStateMachine(vuProtocolID))
+			{
+				return Error::MessageNotSupported;
+			}
+		}
+
+		// Command goes through the state machine to handle timeout, retry and response
+		return _stateMachineManager.sendAecpCommand(std::move(aecpdu), onResult);
+	}
+
+	virtual Error sendAecpResponse(Aecpdu::UniquePointer&& aecpdu) const noexcept override
+	{
+		auto const messageType = aecpdu->getMessageType();
+
+		if (!AVDECC_ASSERT_WITH_RET(isAecpResponseMessageType(messageType), "Calling sendAecpResponse with a Command MessageType"))
+		{
+			return Error::MessageNotSupported;
+		}
+
+		// Special check for VendorUnique messages
+		if (messageType == AecpMessageType::VendorUniqueResponse)
+		{
+			auto& vuAecp = static_cast<VuAecpdu&>(*aecpdu);
+
+			auto const vuProtocolID = vuAecp.getProtocolIdentifier();
+			auto* vuDelegate = getVendorUniqueDelegate(vuProtocolID);
+
+			// No delegate, or the messages are not handled by the ControllerStateMachine
+			if (!vuDelegate || !vuDelegate->areHandledByControllerStateMachine(vuProtocolID))
+			{
+				return Error::MessageNotSupported;
+			}
+		}
+
+		// Response can be directly sent
+		return sendMessage(static_cast<Aecpdu const&>(*aecpdu));
+	}
+
+	virtual Error sendAcmpCommand(Acmpdu::UniquePointer&& acmpdu, AcmpCommandResultHandler const& onResult) const noexcept override
+	{
+		// Command goes through the state machine to handle timeout, retry and response
+		return _stateMachineManager.sendAcmpCommand(std::move(acmpdu), onResult);
+	}
+
+	virtual Error sendAcmpResponse(Acmpdu::UniquePointer&& acmpdu) const noexcept override
+	{
+		// Response can be directly sent
+		return sendMessage(static_cast<Acmpdu const&>(*acmpdu));
+	}
+
+	virtual void lock() const noexcept override
+	{
+		_stateMachineManager.lock();
+	}
+
+	virtual void unlock() const noexcept override
+	{
+		_stateMachineManager.unlock();
+	}
+
+	virtual bool isSelfLocked() const noexcept override
+	{
+		return _stateMachineManager.isSelfLocked();
+	}
+
+	/* ************************************************************ */
+	/* stateMachine::ProtocolInterfaceDelegate overrides            */
+	/* ************************************************************ */
+	/* **** AECP notifications **** */
+	virtual void onAecpCommand(Aecpdu const& aecpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpCommand, this, aecpdu);
+	}
+
+	virtual void onVuAecpUnsolicitedResponse(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) noexcept override
+	{
+		handleVendorUniqueUnsolicitedResponse(protocolIdentifier, aecpdu);
+	}
+
+	/* **** ACMP notifications **** */
+	virtual void onAcmpCommand(Acmpdu const& acmpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpCommand, this, acmpdu);
+	}
+
+	virtual void onAcmpResponse(Acmpdu const& acmpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAcmpResponse, this, acmpdu);
+	}
+
+	/* **** Sending methods **** */
+	virtual Error sendMessage(Adpdu const& adpdu) const noexcept override
+	{
+		try
+		{
+			SerializationBuffer buffer;
+
+			// Start with EtherLayer2
+			serialize<EtherLayer2>(adpdu, buffer);
+			// Then Avtp control
+			serialize<AvtpduControl>(adpdu, buffer);
+			// Then with Adp
+			serialize<Adpdu>(adpdu, buffer);
+
+			// Send the message
+			return sendPacket(buffer);
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(adpdu.getSrcAddress(), adpdu.getDestAddress(), std::string("Failed to serialize ADPDU: ") + e.what());
+			return Error::InternalError;
+		}
+	}
+
+	virtual Error sendMessage(Aecpdu const& aecpdu) const noexcept override
+	{
+		try
+		{
+			SerializationBuffer buffer;
+
+			// Start with EtherLayer2
+			serialize<EtherLayer2>(aecpdu, buffer);
+			// Then Avtp control
+			serialize<AvtpduControl>(aecpdu, buffer);
+			// Then with Aecp
+			serialize<Aecpdu>(aecpdu, buffer);
+
+			// Send the message
+			return sendPacket(buffer);
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(aecpdu.getSrcAddress(), aecpdu.getDestAddress(), std::string("Failed to serialize AECPDU: ") + e.what());
+			return Error::InternalError;
+		}
+	}
+
+	virtual Error sendMessage(Acmpdu const& acmpdu) const noexcept override
+	{
+		try
+		{
+			SerializationBuffer buffer;
+
+			// Start with EtherLayer2
+			serialize<EtherLayer2>(acmpdu, buffer);
+			// Then Avtp control
+			serialize<AvtpduControl>(acmpdu, buffer);
+			// Then with Acmp
+			serialize<Acmpdu>(acmpdu, buffer);
+
+			// Send the message
+			return sendPacket(buffer);
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(acmpdu.getSrcAddress(), Acmpdu::Multicast_Mac_Address, "Failed to serialize ACMPDU: {}", e.what());
+			return Error::InternalError;
+		}
+	}
+
+	/* *** Other methods **** */
+	virtual std::uint32_t getVuAecpCommandTimeoutMsec(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept override
+	{
+		return getVendorUniqueCommandTimeout(protocolIdentifier, aecpdu);
+	}
+
+	virtual bool isVuAecpUnsolicitedResponse(VuAecpdu::ProtocolIdentifier const& protocolIdentifier, VuAecpdu const& aecpdu) const noexcept override
+	{
+		return isVendorUniqueUnsolicitedResponse(protocolIdentifier, aecpdu);
+	}
+
+	/* ************************************************************ */
+	/* stateMachine::AdvertiseStateMachine::Delegate overrides      */
+	/* ************************************************************ */
+
+	/* ************************************************************ */
+	/* stateMachine::DiscoveryStateMachine::Delegate overrides      */
+	/* ************************************************************ */
+	virtual void onLocalEntityOnline(entity::Entity const& entity) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityOnline, this, entity);
+	}
+
+	virtual void onLocalEntityOffline(UniqueIdentifier const entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityOffline, this, entityID);
+	}
+
+	virtual void onLocalEntityUpdated(entity::Entity const& entity) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onLocalEntityUpdated, this, entity);
+	}
+
+	virtual void onRemoteEntityOnline(entity::Entity const& entity) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityOnline, this, entity);
+	}
+
+	virtual void onRemoteEntityOffline(UniqueIdentifier const entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityOffline, this, entityID);
+
+		// Notify the StateMachineManager
+		_stateMachineManager.onRemoteEntityOffline(entityID);
+	}
+
+	virtual void onRemoteEntityUpdated(entity::Entity const& entity) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onRemoteEntityUpdated, this, entity);
+	}
+
+	/* ************************************************************ */
+	/* stateMachine::CommandStateMachine::Delegate overrides        */
+	/* ************************************************************ */
+	virtual void onAecpAemUnsolicitedResponse(AemAecpdu const& aecpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpAemUnsolicitedResponse, this, aecpdu);
+	}
+	virtual void onAecpAemIdentifyNotification(AemAecpdu const& aecpdu) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpAemIdentifyNotification, this, aecpdu);
+	}
+	virtual void onAecpRetry(UniqueIdentifier const& entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpRetry, this, entityID);
+	}
+	virtual void onAecpTimeout(UniqueIdentifier const& entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpTimeout, this, entityID);
+	}
+	virtual void onAecpUnexpectedResponse(UniqueIdentifier const& entityID) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpUnexpectedResponse, this, entityID);
+	}
+	virtual void onAecpResponseTime(UniqueIdentifier const& entityID, std::chrono::milliseconds const& responseTime) noexcept override
+	{
+		// Notify observers
+		notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onAecpResponseTime, this, entityID, responseTime);
+	}
+
+	/* ************************************************************ */
+	/* la::avdecc::utils::Subject overrides                         */
+	/* ************************************************************ */
+	virtual void onObserverRegistered(observer_type* const observer) noexcept override
+	{
+		if (observer)
+		{
+			class DiscoveryDelegate final : public stateMachine::DiscoveryStateMachine::Delegate
+			{
+			public:
+				DiscoveryDelegate(ProtocolInterface& pi, ProtocolInterface::Observer& obs)
+					: _pi{ pi }
+					, _obs{ obs }
+				{
+				}
+
+			private:
+				virtual void onLocalEntityOnline(la::avdecc::entity::Entity const& entity) noexcept override
+				{
+					utils::invokeProtectedMethod(&ProtocolInterface::Observer::onLocalEntityOnline, &_obs, &_pi, entity);
+				}
+				virtual void onLocalEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
+				virtual void onLocalEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+				virtual void onRemoteEntityOnline(la::avdecc::entity::Entity const& entity) noexcept override
+				{
+					utils::invokeProtectedMethod(&ProtocolInterface::Observer::onRemoteEntityOnline, &_obs, &_pi, entity);
+				}
+				virtual void onRemoteEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
+				virtual void onRemoteEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+
+				ProtocolInterface& _pi;
+				ProtocolInterface::Observer& _obs;
+			};
+			auto discoveryDelegate = DiscoveryDelegate{ *this, static_cast<ProtocolInterface::Observer&>(*observer) };
+
+			_stateMachineManager.notifyDiscoveredEntities(discoveryDelegate);
+		}
+	}
+
+	/* ************************************************************ */
+	/* Private methods                                              */
+	/* ************************************************************ */
+	void processRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept
+	{
+		la::avdecc::ExecutorManager::getInstance().pushJob(getExecutorName(),
+			[this, msg = std::move(packet)]()
+			{
+				auto avtpdu_size = std::size_t{ 0u };
+				auto const* const avtpdu = getAvdeccAvtpdu(msg.data(), msg.size(), avtpdu_size);
+				if (!avtpdu)
+				{
+					return;
+				}
+
+				// Packet received, process it
+				auto des = DeserializationBuffer(msg);
+				EtherLayer2 etherLayer2;
+				deserialize<EtherLayer2>(&etherLayer2, des);
+
+				// Try to detect possible deadlock
+				{
+					_watchDog.registerWatch("avdecc::ReplayInterface::dispatchAvdeccMessage::" + utils::toHexString(reinterpret_cast<size_t>(this)), std::chrono::milliseconds{ 1000u }, true);
+					_ethernetPacketDispatcher.dispatchAvdeccMessage(avtpdu, avtpdu_size, etherLayer2);
+					_watchDog.unregisterWatch("avdecc::ReplayInterface::dispatchAvdeccMessage::" + utils::toHexString(reinterpret_cast<size_t>(this)), true);
+				}
+			});
+	}
+
+	/** Starts the replay thread, if not already started. _replayMutex must be locked. */
+	void startReplayThread() noexcept
+	{
+		if (_replayThread.joinable() || _shouldTerminate)
+		{
+			return;
+		}
+
+		_replayThread = std::thread(
+			[this]
+			{
+				utils::setCurrentThreadName("avdecc::ReplayInterface::Replay");
+				replayLoop();
+				if (!_shouldTerminate && _replayError)
+				{
+					notifyObserversMethod<ProtocolInterface::Observer>(&ProtocolInterface::Observer::onTransportError, this);
+				}
+			});
+	}
+
+	/** Reads the whole capture file and stores the responses to the recorded commands, indexed by the command they answer */
+	void indexRecordedResponses(std::string const& filePath) noexcept
+	{
+		try
+		{
+			auto reader = captureFile::Reader{ filePath };
+			auto pendingCommands = std::unordered_map<std::string, std::string>{}; // Map of exchangeKey to commandKey
+
+			while (auto frame = reader.readNextFrame())
+			{
+				auto avtpduSize = std::size_t{ 0u };
+				auto const* const avtpdu = getAvdeccAvtpdu(frame->data.data(), frame->data.size(), avtpduSize);
+				if (!avtpdu)
+				{
+					continue;
+				}
+				auto info = getExchangeInfo(avtpdu, avtpduSize);
+				if (!info)
+				{
+					continue;
+				}
+
+				if (info->isCommand)
+				{
+					pendingCommands[info->exchangeKey] = std::move(info->commandKey);
+				}
+				else if (auto const commandIt = pendingCommands.find(info->exchangeKey); commandIt != pendingCommands.end())
+				{
+					// Keep the first response to a command (the same command might have been sent several times)
+					_recordedResponses.try_emplace(commandIt->second, std::move(frame->data));
+					_answeredExchanges.insert(info->exchangeKey);
+				}
+			}
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			// Error will be reported by the replay thread, keep what has been indexed so far
+			LOG_PROTOCOL_INTERFACE_WARN(networkInterface::MacAddress{}, networkInterface::MacAddress{}, "Failed to index capture file responses: {}", e.what());
+		}
+	}
+
+	/** Returns true if the frame is a response to a recorded command (injected when answering the same command instead of being replayed) */
+	bool isAnsweredResponse(MemoryBuffer const& frame) const noexcept
+	{
+		if (_answeredExchanges.empty())
+		{
+			return false;
+		}
+
+		try
+		{
+			auto avtpduSize = std::size_t{ 0u };
+			auto const* const avtpdu = getAvdeccAvtpdu(frame.data(), frame.size(), avtpduSize);
+			if (avtpdu)
+			{
+				auto const info = getExchangeInfo(avtpdu, avtpduSize);
+				return info && !info->isCommand && _answeredExchanges.count(info->exchangeKey) != 0;
+			}
+		}
+		catch (...)
+		{
+		}
+		return false;
+	}
+
+	/** Injects the recorded response to the specified outgoing command, if any, rewritten to match the command */
+	void answerFromCapture(std::uint8_t const* const frame, std::size_t const frameSize) const noexcept
+	{
+		if (_recordedResponses.empty())
+		{
+			return;
+		}
+
+		try
+		{
+			auto commandAvtpduSize = std::size_t{ 0u };
+			auto const* const commandAvtpdu = getAvdeccAvtpdu(frame, frameSize, commandAvtpduSize);
+			if (!commandAvtpdu)
+			{
+				return;
+			}
+			auto const commandInfo = getExchangeInfo(commandAvtpdu, commandAvtpduSize);
+			if (!commandInfo || !commandInfo->isCommand)
+			{
+				return;
+			}
+			auto const responseIt = _recordedResponses.find(commandInfo->commandKey);
+			if (responseIt == _recordedResponses.end())
+			{
+				return;
+			}
+
+			auto response = responseIt->second;
+			auto responseAvtpduSize = std::size_t{ 0u };
+			auto const* const recordedAvtpdu = getAvdeccAvtpdu(response.data(), response.size(), responseAvtpduSize);
+			if (!recordedAvtpdu)
+			{
+				return;
+			}
+			auto* const responseAvtpdu = response.data() + (recordedAvtpdu - response.data());
+
+			// Address the response to the sender of the command, using its ControllerEntityID and SequenceID
+			if ((commandAvtpdu[0] & 0x7F) == AvtpSubType_Aecp)
+			{
+				std::memcpy(response.data(), frame + 6u, 6u); // Destination MAC address is the source MAC address of the command
+			}
+			std::memcpy(responseAvtpdu + ControllerEntityIDOffset, commandAvtpdu + ControllerEntityIDOffset, 8u);
+			std::memcpy(responseAvtpdu + commandInfo->sequenceIDOffset, commandAvtpdu + commandInfo->sequenceIDOffset, 2u);
+
+			recordFrame(FrameDirection::Inbound, response.data(), response.size());
+			processRawPacket(std::move(response));
+		}
+		catch (...)
+		{
+		}
+	}
+
+	void replayLoop() noexcept
+	{
+		using Clock = std::chrono::steady_clock;
+
+		auto startTime = Clock::now();
+		auto firstTimestamp = std::optional<std::chrono::nanoseconds>{};
+
+		while (!_shouldTerminate)
+		{
+			auto frame = std::optional<captureFile::Frame>{};
+			try
+			{
+				frame = _reader->readNextFrame();
+			}
+			catch ([[maybe_unused]] std::exception const& e)
+			{
+				LOG_PROTOCOL_INTERFACE_ERROR(networkInterface::MacAddress{}, networkInterface::MacAddress{}, "Failed to read capture file: {}", e.what());
+				_replayError = true;
+				break;
+			}
+
+			// End of file
+			if (!frame)
+			{
+				break;
+			}
+
+			// Responses to recorded commands are only injected when answering
+			if (isAnsweredResponse(frame->data))
+			{
+				continue;
+			}
+
+			if (!firstTimestamp)
+			{
+				firstTimestamp = frame->timestamp;
+			}
+
+			// Wait for the frame injection time (capture timing scaled by the speed factor), honoring pause requests
+			{
+				auto lock = std::unique_lock{ _replayMutex };
+				while (true)
+				{
+					if (_isReplayPaused)
+					{
+						auto const pauseTime = Clock::now();
+						_replayCondition.wait(lock,
+							[this]
+							{
+								return _shouldTerminate || !_isReplayPaused;
+							});
+						// Shift the capture timeline by the duration of the pause
+						startTime += Clock::now() - pauseTime;
+					}
+					if (_shouldTerminate || _speedFactor <= 0.0)
+					{
+						break;
+					}
+
+					auto const captureOffset = std::chrono::duration<double, std::nano>{ frame->timestamp - *firstTimestamp } / _speedFactor;
+					auto const injectTime = startTime + std::chrono::duration_cast<Clock::duration>(captureOffset);
+
+					// Woken up before the injection time only to terminate or to pause
+					if (!_replayCondition.wait_until(lock, injectTime,
+								[this]
+								{
+									return _shouldTerminate || _isReplayPaused;
+								}))
+					{
+						break;
+					}
+				}
+			}
+			if (_shouldTerminate)
+			{
+				break;
+			}
+
+			recordFrame(FrameDirection::Inbound, frame->data.data(), frame->data.size());
+			processRawPacket(std::move(frame->data));
+			++_injectedFramesCount;
+		}
+
+		// Release the file as soon as possible
+		_reader.reset();
+
+		// Signal completion
+		{
+			auto const lg = std::lock_guard{ _replayMutex };
+			_replayCompleted = true;
+		}
+		_replayCondition.notify_all();
+	}
+
+	Error sendPacket(SerializationBuffer const& buffer) const noexcept
+	{
+		// Nothing to send to, only answer the commands found in the capture file (but still record the message)
+		recordFrame(FrameDirection::Outbound, buffer.data(), buffer.size());
+		answerFromCapture(buffer.data(), buffer.size());
+		return Error::NoError;
+	}
+
+	// Private variables
+	watchDog::WatchDog::SharedPointer _watchDogSharedPointer{ watchDog::WatchDog::getInstance() };
+	watchDog::WatchDog& _watchDog{ *_watchDogSharedPointer };
+	std::optional<captureFile::Reader> _reader{ std::nullopt };
+	double _speedFactor{ 1.0 };
+	bool _isSilent{ false };
+	std::unordered_map<std::string, MemoryBuffer> _recordedResponses{}; // Recorded responses, indexed by the commandKey they answer (immutable once constructed)
+	std::unordered_set<std::string> _answeredExchanges{}; // ExchangeKeys of the recorded responses (immutable once constructed)
+	mutable std::mutex _replayMutex{};
+	mutable std::condition_variable _replayCondition{};
+	std::atomic_bool _shouldTerminate{ false };
+	bool _isReplayControlled{ false }; // startReplay or pauseReplay has been called, don't start automatically
+	bool _isReplayPaused{ false };
+	bool _replayCompleted{ false };
+	std::atomic_bool _replayError{ false };
+	std::atomic<std::uint64_t> _injectedFramesCount{ 0u };
+	mutable stateMachine::Manager _stateMachineManager{ this, this, this, this, this };
+	std::thread _replayThread{};
+	friend class EthernetPacketDispatcher<ProtocolInterfaceReplayImpl>;
+	EthernetPacketDispatcher<ProtocolInterfaceReplayImpl> _ethernetPacketDispatcher{ this, _stateMachineManager };
+};
+
+ProtocolInterfaceReplay::ProtocolInterfaceReplay(std::string const& networkInterfaceName, networkInterface::MacAddress const& macAddress, std::string const& executorName)
+	: ProtocolInterface(networkInterfaceName, macAddress, executorName)
+{
+}
+
+bool ProtocolInterfaceReplay::isSupported() noexcept
+{
+	return true;
+}
+
+ProtocolInterfaceReplay* ProtocolInterfaceReplay::createRawProtocolInterfaceReplay(std::string const& networkInterfaceName, std::string const& executorName)
+{
+	return new ProtocolInterfaceReplayImpl(networkInterfaceName, executorName);
+}
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
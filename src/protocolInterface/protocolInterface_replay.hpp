@@ -0,0 +1,86 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_replay.hpp
+* @author Christophe Calmejane
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/protocolInterface.hpp"
+
+#include <chrono>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+class ProtocolInterfaceReplay : public ProtocolInterface
+{
+public:
+	/**
+	* @brief Factory method to create a new ProtocolInterfaceReplay.
+	* @details Creates a new ProtocolInterfaceReplay as a raw pointer.
+	*          The interface injects all AVDECC frames found in a pcap or pcapng capture file into the receive path, then stays idle.
+	*          The replay starts with startReplay(), or as soon as the first local entity is registered if neither startReplay() nor pauseReplay() has been called (so that a Controller or EndStation created through the generic factory observes all the frames).
+	*          Outgoing AECP and ACMP commands matching a command found in the capture file are answered with the recorded response (rewritten for the sender), the recorded responses not being injected on their own.
+	*          Other outgoing messages are discarded, so commands not found in the capture file will eventually time out.
+	* @param[in] networkInterfaceName The capture file path, with the replay speed and the 'silent' flag as optional suffixes (e.g. `/tmp/dump.pcapng@4` or `/tmp/dump.pcapng@max@silent`).
+	*            The speed is a multiplier applied to the capture timing (1 being real time, which is the default), or `max` (or `0`) to inject frames as fast as possible.
+	*            When 'silent' is specified, outgoing commands are never answered and all the frames of the capture file are injected.
+	* @param[in] executorName The name of the executor to use to dispatch incoming messages.
+	* @return A new ProtocolInterfaceReplay as a raw pointer.
+	* @note Throws Exception if #networkInterfaceName is invalid or if the file is inaccessible or not a valid capture file.
+	*/
+	static ProtocolInterfaceReplay* createRawProtocolInterfaceReplay(std::string const& networkInterfaceName, std::string const& executorName);
+
+	/** Returns true if this ProtocolInterface is supported (runtime check) */
+	static bool isSupported() noexcept;
+
+	/** Starts injecting the frames of the capture file, or resumes a paused replay. */
+	virtual void startReplay() noexcept = 0;
+
+	/** Pauses the replay (the capture timing is shifted by the duration of the pause when resumed). Prevents the replay from automatically starting if called before startReplay(). */
+	virtual void pauseReplay() noexcept = 0;
+
+	/** Blocks the calling thread until all frames of the capture file have been injected and processed, or until the timeout expires. Returns true if the replay completed. */
+	virtual bool waitForReplayCompletion(std::chrono::milliseconds const timeout) const noexcept = 0;
+
+	/** Returns the count of frames injected so far. */
+	virtual std::uint64_t getInjectedFramesCount() const noexcept = 0;
+
+	/** Destructor */
+	virtual ~ProtocolInterfaceReplay() noexcept = default;
+
+	// Deleted compiler auto-generated methods
+	ProtocolInterfaceReplay(ProtocolInterfaceReplay&&) = delete;
+	ProtocolInterfaceReplay(ProtocolInterfaceReplay const&) = delete;
+	ProtocolInterfaceReplay& operator=(ProtocolInterfaceReplay const&) = delete;
+	ProtocolInterfaceReplay& operator=(ProtocolInterfaceReplay&&) = delete;
+
+protected:
+	ProtocolInterfaceReplay(std::string const& networkInterfaceName, networkInterface::MacAddress const& macAddress, std::string const& executorName);
+};
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -42,6 +42,8 @@
 #include <thread>
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include <mutex>
 #include <functional>
 #include <memory>
 #include <chrono>
@@ -598,8 +600,18 @@ private:
 	/* ************************************************************ */
 	void processRawPacket(la::avdecc::MemoryBuffer&& packet) const noexcept
 	{
+		// Record the frame
+		if (isRecordingFrames())
+		{
+			auto etherLayer2 = EtherLayer2{};
+			etherLayer2.setEtherType(AvtpEtherType);
+			etherLayer2.setSrcAddress(Peer_Mac_Address);
+			etherLayer2.setDestAddress(Local_Mac_Address);
+			recordFrame(FrameDirection::Inbound, etherLayer2, packet.data(), packet.size());
+		}
+
 		la::avdecc::ExecutorManager::getInstance().pushJob(getExecutorName(),
-			[this, msg = std::move(packet)]()
+			[this, msg = std::move(packet)]() mutable
 			{
 				std::uint8_t const* avtpdu = msg.data(); // Start of AVB Transport Protocol
 				auto avtpdu_size = msg.size();
@@ -615,39 +627,71 @@ private:
 					_ethernetPacketDispatcher.dispatchAvdeccMessage(avtpdu, avtpdu_size, etherLayer2);
 					_watchDog.unregisterWatch("avdecc::SerialInterface::dispatchAvdeccMessage::" + utils::toHexString(reinterpret_cast<size_t>(this)), true);
 				}
+
+				// Give the buffer back to the pool
+				releaseFrameBuffer(std::move(msg));
 			});
 	}
 
 	static constexpr std::size_t AvtpMaxCobsEncodedPayloadLength = (1 + AvtpMaxPayloadLength + COBS_BUFFER_PAD(AvtpMaxPayloadLength) + 1);
+	static constexpr std::size_t SerialReadBufferLength = 16u * 1024u; // Read as many bytes as possible at once, a single read can contain many frames
+	static constexpr std::size_t MaxPooledFrameBuffers = 64u;
+
+	/** Returns an empty buffer large enough to hold a COBS encoded frame, from the pool if possible */
+	la::avdecc::MemoryBuffer acquireFrameBuffer() const noexcept
+	{
+		{
+			auto const lg = std::lock_guard{ _frameBuffersPoolLock };
+			if (!_frameBuffersPool.empty())
+			{
+				auto buffer = std::move(_frameBuffersPool.back());
+				_frameBuffersPool.pop_back();
+				return buffer;
+			}
+		}
+
+		auto buffer = la::avdecc::MemoryBuffer{};
+		buffer.reserve(AvtpMaxCobsEncodedPayloadLength);
+		return buffer;
+	}
+
+	/** Gives a buffer back to the pool (freeing it if the pool is full) */
+	void releaseFrameBuffer(la::avdecc::MemoryBuffer&& buffer) const noexcept
+	{
+		if (buffer.capacity() < AvtpMaxCobsEncodedPayloadLength)
+		{
+			return;
+		}
+
+		buffer.clear();
+
+		auto const lg = std::lock_guard{ _frameBuffersPoolLock };
+		if (_frameBuffersPool.size() < MaxPooledFrameBuffers)
+		{
+			_frameBuffersPool.push_back(std::move(buffer));
+		}
+	}
 
 	enum class SerialState : std::uint8_t
 	{
 		Synchronizing,
 		Reading,
-		Finished
 	};
 
 	void serialReceiveLoop(void) noexcept
 	{
 		struct ::pollfd pollfd;
-		std::uint8_t cobsEncodedBuffer[AvtpMaxCobsEncodedPayloadLength];
-		SerialState state = SerialState::Synchronizing;
-		size_t cobsBytesRead;
+		auto readBuffer = std::make_unique<std::uint8_t[]>(SerialReadBufferLength);
+		auto frameBuffer = acquireFrameBuffer();
+		auto state = SerialState::Synchronizing;
 
 		pollfd.fd = _fd;
 
 		while (!_shouldTerminate)
 		{
-			std::uint8_t readBuffer[AvtpMaxCobsEncodedPayloadLength];
-
 			pollfd.events = POLLIN;
 			pollfd.revents = 0;
 
-			if (state == SerialState::Synchronizing)
-			{
-				cobsBytesRead = 0;
-			}
-
 			auto const err = poll(&pollfd, 1, SerialReceiveLoopTimeout); // timeout so we can check _shouldTerminate
 			if (err < 0)
 			{
@@ -658,7 +702,7 @@ private:
 				continue; // timed out or no input events
 			}
 
-			auto const bytesRead = read(_fd, readBuffer, sizeof(readBuffer));
+			auto const bytesRead = read(_fd, readBuffer.get(), SerialReadBufferLength);
 			if (bytesRead == 0 || (bytesRead < 0 && errno == EAGAIN))
 			{
 				continue;
@@ -668,58 +712,80 @@ private:
 				break;
 			}
 
-			for (auto i = 0; i < bytesRead; i++)
+			// Process the whole batch, jumping from delimiter to delimiter
+			auto const* ptr = readBuffer.get();
+			auto const* const end = ptr + bytesRead;
+			while (ptr < end)
 			{
-				if (cobsBytesRead >= AvtpMaxCobsEncodedPayloadLength)
-				{
-					state = SerialState::Synchronizing;
-					break;
-				}
+				auto const* const delimiter = cobs::findDelimiter(ptr, end);
 
 				switch (state)
 				{
 					case SerialState::Synchronizing:
-						if (readBuffer[i] == cobs::DelimiterByte)
+						// Discard everything up to the start of frame marker
+						if (delimiter != end)
 						{
+							frameBuffer.clear();
 							state = SerialState::Reading;
 						}
 						break;
 					case SerialState::Reading:
-						if (readBuffer[i] != cobs::DelimiterByte)
-						{
-							cobsEncodedBuffer[cobsBytesRead++] = readBuffer[i];
-							break;
-						}
-						else
-						{
-							state = SerialState::Finished;
-							[[fallthrough]]; // end of frame marker
-						}
-					case SerialState::Finished:
 					{
-						std::uint8_t payloadBuffer[AvtpMaxPayloadLength];
-						try
+						// Append the encoded bytes to the current frame
+						auto const length = static_cast<std::size_t>(delimiter - ptr);
+						if (frameBuffer.size() + length > AvtpMaxCobsEncodedPayloadLength)
 						{
-							auto payloadLength = cobs::decode(cobsEncodedBuffer, cobsBytesRead, payloadBuffer, sizeof(payloadBuffer));
-							if (payloadLength != 0)
+							// Frame too big, drop it and resynchronize (on the current delimiter if any)
+							frameBuffer.clear();
+							if (delimiter == end)
 							{
-								auto message = la::avdecc::MemoryBuffer{ payloadBuffer, payloadLength };
-								processRawPacket(std::move(message));
+								state = SerialState::Synchronizing;
 							}
+							break;
 						}
-						catch (...)
+						frameBuffer.append(ptr, length);
+
+						// End of frame marker, decode in place and dispatch
+						if (delimiter != end)
 						{
+							// Empty frames (consecutive delimiters) are ignored, the delimiter is then considered as a start of frame marker
+							if (frameBuffer.size() != 0)
+							{
+								auto const payloadLength = cobs::decodeInPlace(frameBuffer.data(), frameBuffer.size());
+								if (payloadLength != 0 && payloadLength <= AvtpMaxPayloadLength)
+								{
+									frameBuffer.set_size(payloadLength);
+									processRawPacket(std::move(frameBuffer));
+									frameBuffer = acquireFrameBuffer();
+								}
+								else
+								{
+									frameBuffer.clear();
+								}
+							}
 						}
-						state = SerialState::Synchronizing;
 						break;
 					}
 				}
+
+				// Skip the delimiter
+				ptr = (delimiter != end) ? delimiter + 1 : end;
 			}
 		}
 	}
 
 	Error sendPacket(SerializationBuffer const& buffer) const noexcept
 	{
+		// Record the frame
+		if (isRecordingFrames())
+		{
+			auto etherLayer2 = EtherLayer2{};
+			etherLayer2.setEtherType(AvtpEtherType);
+			etherLayer2.setSrcAddress(Local_Mac_Address);
+			etherLayer2.setDestAddress(Peer_Mac_Address);
+			recordFrame(FrameDirection::Outbound, etherLayer2, buffer.data(), buffer.size());
+		}
+
 		std::uint8_t cobsEncodedBuffer[AvtpMaxCobsEncodedPayloadLength] = { cobs::DelimiterByte };
 		auto cobsBytesEncoded = 1 + cobs::encode(buffer.data(), buffer.size(), &cobsEncodedBuffer[1]);
 		cobsEncodedBuffer[cobsBytesEncoded++] = cobs::DelimiterByte;
@@ -819,7 +885,10 @@ private:
 		// set 8 data bits, local mode, receiver enabled
 		tty.c_cflag |= (CS8 | CLOCAL | CREAD);
 		// disable canonical mode and signals
-		tty.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG);
+		tty.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG | IEXTEN);
+		// binary transport: disable any input/output bytes processing (CR/NL translation, software flow control, ...)
+		tty.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON | IXOFF | IXANY);
+		tty.c_oflag &= ~(OPOST);
 
 #ifdef __linux__
 		if (ioctl(_fd, TCSETS2, &tty) < 0)
@@ -838,6 +907,8 @@ private:
 	watchDog::WatchDog& _watchDog{ *_watchDogSharedPointer };
 	int _fd{ -1 };
 	bool _shouldTerminate{ false };
+	mutable std::mutex _frameBuffersPoolLock{};
+	mutable std::vector<la::avdecc::MemoryBuffer> _frameBuffersPool{};
 	mutable stateMachine::Manager _stateMachineManager{ this, this, this, this, this };
 	std::thread _captureThread{};
 	friend class EthernetPacketDispatcher<ProtocolInterfaceSerialImpl>;
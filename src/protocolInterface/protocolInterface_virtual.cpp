@@ -838,6 +838,8 @@ void ProtocolInterfaceVirtualImpl::onAecpResponseTime(UniqueIdentifier const& en
 /* ************************************************************ */
 void ProtocolInterfaceVirtualImpl::onMessage(SerializationBuffer const& message) noexcept
 {
+	recordFrame(FrameDirection::Inbound, message.data(), message.size());
+
 	auto msg = la::avdecc::MemoryBuffer{ message.data(), message.size() };
 	processRawPacket(std::move(msg));
 }
@@ -938,6 +940,7 @@ ProtocolInterface::Error ProtocolInterfaceVirtualImpl::sendPacket(SerializationB
 		// Push the buffer to the message dispatcher
 		auto& dispatcher = MessageDispatcher::getInstance();
 		dispatcher.push(_networkInterfaceID, buffer);
+		recordFrame(FrameDirection::Outbound, buffer.data(), buffer.size());
 		return Error::NoError;
 	}
 	catch (...)
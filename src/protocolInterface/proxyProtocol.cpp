@@ -0,0 +1,192 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file proxyProtocol.cpp
+* @author Christophe Calmejane
+*/
+
+#include "proxyProtocol.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+namespace proxy
+{
+static constexpr std::uint8_t HttpHeaderTerminator[] = { '\r', '\n', '\r', '\n' };
+
+void appendMessage(std::vector<std::uint8_t>& buffer, MessageType const messageType, networkInterface::MacAddress const& address, std::uint8_t const* const payload, std::size_t const payloadLength)
+{
+	auto const offset = buffer.size();
+	buffer.resize(offset + HeaderLength + payloadLength);
+
+	auto* ptr = buffer.data() + offset;
+	ptr[0] = Version;
+	ptr[1] = static_cast<std::uint8_t>(messageType);
+	ptr[2] = static_cast<std::uint8_t>(payloadLength >> 8);
+	ptr[3] = static_cast<std::uint8_t>(payloadLength & 0xFF);
+	std::memcpy(ptr + 4, address.data(), address.size());
+	ptr[10] = 0u; // Reserved
+	ptr[11] = 0u; // Reserved
+	if (payloadLength != 0u)
+	{
+		std::memcpy(ptr + HeaderLength, payload, payloadLength);
+	}
+}
+
+std::string makeConnectRequest(std::string const& host, std::uint16_t const port)
+{
+	auto const hostPort = host + ":" + std::to_string(port);
+	return "CONNECT /avdecc HTTP/1.1\r\nHost: " + hostPort + "\r\n\r\n";
+}
+
+std::string makeConnectResponse(bool const accepted)
+{
+	if (accepted)
+	{
+		return "HTTP/1.1 200 OK\r\n\r\n";
+	}
+	return "HTTP/1.1 400 Bad Request\r\n\r\n";
+}
+
+std::optional<std::size_t> getHttpHeaderLength(std::uint8_t const* const data, std::size_t const length) noexcept
+{
+	auto const* const end = data + length;
+	auto const it = std::search(data, end, std::begin(HttpHeaderTerminator), std::end(HttpHeaderTerminator));
+	if (it == end)
+	{
+		return std::nullopt;
+	}
+	return static_cast<std::size_t>(it - data) + sizeof(HttpHeaderTerminator);
+}
+
+bool isConnectRequest(std::uint8_t const* const data, std::size_t const length) noexcept
+{
+	static constexpr char Method[] = "CONNECT ";
+	auto constexpr MethodLength = sizeof(Method) - 1;
+	return length >= MethodLength && std::memcmp(data, Method, MethodLength) == 0;
+}
+
+bool isSuccessfulResponse(std::uint8_t const* const data, std::size_t const length) noexcept
+{
+	// Status-Line = HTTP-Version SP Status-Code SP Reason-Phrase CRLF
+	static constexpr char HttpVersion[] = "HTTP/1.";
+	auto constexpr VersionLength = sizeof(HttpVersion) - 1;
+	// "HTTP/1.x 2"
+	if (length < VersionLength + 3 || std::memcmp(data, HttpVersion, VersionLength) != 0)
+	{
+		return false;
+	}
+	return data[VersionLength + 1] == ' ' && data[VersionLength + 2] == '2';
+}
+
+bool MessageReader::feed(std::uint8_t const* const data, std::size_t const length, Handler const& handler)
+{
+	auto const* ptr = data;
+	auto remaining = length;
+
+	// Complete the pending message first
+	if (!_pending.empty())
+	{
+		// Get enough bytes to know the size of the message
+		if (_pending.size() < HeaderLength)
+		{
+			auto const count = std::min(HeaderLength - _pending.size(), remaining);
+			_pending.insert(_pending.end(), ptr, ptr + count);
+			ptr += count;
+			remaining -= count;
+			if (_pending.size() < HeaderLength)
+			{
+				return true;
+			}
+		}
+
+		auto const payloadLength = static_cast<std::size_t>((_pending[2] << 8) | _pending[3]);
+		auto const messageLength = HeaderLength + payloadLength;
+		if (_pending[0] != Version || payloadLength > MaximumPayloadLength)
+		{
+			return false;
+		}
+
+		auto const count = std::min(messageLength - _pending.size(), remaining);
+		_pending.insert(_pending.end(), ptr, ptr + count);
+		ptr += count;
+		remaining -= count;
+		if (_pending.size() < messageLength)
+		{
+			return true;
+		}
+
+		auto const consumed = parse(_pending.data(), _pending.size(), handler);
+		if (!consumed)
+		{
+			return false;
+		}
+		_pending.clear();
+	}
+
+	// Then process all complete messages directly from the specified data
+	auto const consumed = parse(ptr, remaining, handler);
+	if (!consumed)
+	{
+		return false;
+	}
+
+	// Keep incomplete trailing bytes
+	_pending.assign(ptr + *consumed, ptr + remaining);
+	return true;
+}
+
+std::optional<std::size_t> MessageReader::parse(std::uint8_t const* const data, std::size_t const length, Handler const& handler)
+{
+	auto offset = std::size_t{ 0u };
+
+	while ((length - offset) >= HeaderLength)
+	{
+		auto const* const header = data + offset;
+		auto const payloadLength = static_cast<std::size_t>((header[2] << 8) | header[3]);
+		if (header[0] != Version || payloadLength > MaximumPayloadLength)
+		{
+			return std::nullopt;
+		}
+		if ((length - offset) < (HeaderLength + payloadLength))
+		{
+			break;
+		}
+
+		auto address = networkInterface::MacAddress{};
+		std::memcpy(address.data(), header + 4, address.size());
+		handler(static_cast<MessageType>(header[1]), address, header + HeaderLength, payloadLength);
+
+		offset += HeaderLength + payloadLength;
+	}
+
+	return offset;
+}
+
+} // namespace proxy
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,111 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file proxyProtocol.hpp
+* @author Christophe Calmejane
+* @brief AVDECC Proxy Protocol (IEEE Std 1722.1-2013 Annex C) helpers, shared by the proxy ProtocolInterface (APC) and the proxy server (APS).
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/protocolDefines.hpp"
+
+#include <la/networkInterfaceHelper/networkInterfaceHelper.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+namespace proxy
+{
+/** Default TCP port of an AVDECC Proxy Server */
+static constexpr std::uint16_t DefaultPort = 17221u;
+/** Supported APPDU version */
+static constexpr std::uint8_t Version = 0u;
+/** APPDU header length: version (1) + message_type (1) + payload_length (2) + address (6) + reserved (2) */
+static constexpr std::size_t HeaderLength = 12u;
+/** Maximum APPDU payload length (an AVDECC message without the Ethernet header) */
+static constexpr std::size_t MaximumPayloadLength = AvtpMaxPayloadLength;
+/** Maximum length of the HTTP request or response used to open the connection */
+static constexpr std::size_t MaximumHttpHeaderLength = 4096u;
+
+/** APPDU message types (IEEE Std 1722.1-2013 Table C.1) */
+enum class MessageType : std::uint8_t
+{
+	Nop = 0x00, /**< Keep alive */
+	EntityIdRequest = 0x01, /**< APC to APS */
+	EntityIdResponse = 0x02, /**< APS to APC */
+	LinkUp = 0x03, /**< APS to APC, address is the MAC address of the APS network port */
+	LinkDown = 0x04, /**< APS to APC */
+	AvdeccFromAps = 0x05, /**< APS to APC, address is the source MAC address of the AVDECC message */
+	AvdeccFromApc = 0x06, /**< APC to APS, address is the destination MAC address of the AVDECC message */
+	Vendor = 0x7F, /**< Vendor specific */
+};
+
+/** Appends a complete APPDU (header and payload) to the specified buffer */
+void appendMessage(std::vector<std::uint8_t>& buffer, MessageType const messageType, networkInterface::MacAddress const& address, std::uint8_t const* const payload, std::size_t const payloadLength);
+
+/** Returns the HTTP request an APC sends to open the connection with an APS */
+std::string makeConnectRequest(std::string const& host, std::uint16_t const port);
+
+/** Returns the HTTP response an APS sends to accept (or reject) a connection */
+std::string makeConnectResponse(bool const accepted);
+
+/** Returns the length of the HTTP header block (including the terminating empty line) found at the start of the buffer, or std::nullopt if it's not complete yet */
+std::optional<std::size_t> getHttpHeaderLength(std::uint8_t const* const data, std::size_t const length) noexcept;
+
+/** Returns true if the HTTP header block is a CONNECT request */
+bool isConnectRequest(std::uint8_t const* const data, std::size_t const length) noexcept;
+
+/** Returns true if the HTTP header block is a successful (2xx) response */
+bool isSuccessfulResponse(std::uint8_t const* const data, std::size_t const length) noexcept;
+
+/**
+* @brief Reassembles APPDUs from a TCP byte stream.
+* @details Complete messages are handed to the handler without copy whenever possible, only incomplete trailing bytes are buffered until the next call.
+* @note Not thread-safe.
+*/
+class MessageReader final
+{
+public:
+	using Handler = std::function<void(MessageType const messageType, networkInterface::MacAddress const& address, std::uint8_t const* const payload, std::size_t const payloadLength)>;
+
+	/** Parses all complete messages found in previously buffered bytes followed by the specified data. Returns false if the stream is corrupted (unsupported version or payload too big). */
+	bool feed(std::uint8_t const* const data, std::size_t const length, Handler const& handler);
+
+private:
+	/** Parses as many complete messages as possible, returns the count of consumed bytes or std::nullopt if the stream is corrupted */
+	static std::optional<std::size_t> parse(std::uint8_t const* const data, std::size_t const length, Handler const& handler);
+
+	std::vector<std::uint8_t> _pending{};
+};
+
+} // namespace proxy
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
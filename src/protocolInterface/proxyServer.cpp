@@ -0,0 +1,679 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file proxyServer.cpp
+* @author Christophe Calmejane
+*/
+
+#include "la/avdecc/internals/serialization.hpp"
+#include "la/avdecc/internals/protocolAemAecpdu.hpp"
+#include "la/avdecc/internals/protocolAaAecpdu.hpp"
+#include "la/avdecc/internals/protocolMvuAecpdu.hpp"
+#include "la/avdecc/utils.hpp"
+
+#include "proxyServer.hpp"
+#include "proxyProtocol.hpp"
+#include "logHelper.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+static constexpr int ServerLoopTimeout = 250u;
+static constexpr std::size_t ServerReceiveBufferLength = 64u * 1024u;
+static constexpr std::size_t MaxPendingClientBytes = 4u * 1024u * 1024u; // Drop messages for clients that don't read fast enough
+static constexpr std::size_t MaxEventsPerLoop = 64u;
+
+class ProxyServerImpl final : public ProxyServer, private ProtocolInterface::Observer, private ProtocolInterface::VendorUniqueDelegate
+{
+public:
+	ProxyServerImpl(ProtocolInterface& protocolInterface, std::uint16_t const port, std::string const& bindAddress)
+		: _protocolInterface{ protocolInterface }
+	{
+		createListeningSocket(port, bindAddress);
+
+		_eventFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+		if (_eventFd < 0 || _epollFd < 0 || !addToEpoll(_listenFd, EPOLLIN) || !addToEpoll(_eventFd, EPOLLIN))
+		{
+			closeDescriptors();
+			throw ProtocolInterface::Exception(ProtocolInterface::Error::TransportError, "Failed to create epoll instance");
+		}
+
+		// Milan Vendor Unique messages are only notified if a delegate is registered
+		_protocolInterface.registerVendorUniqueDelegate(MvuAecpdu::ProtocolID, this);
+
+		// Listen to all messages received on the network
+		_protocolInterface.registerObserver(this);
+
+		// Start the I/O thread
+		_ioThread = std::thread(
+			[this]
+			{
+				utils::setCurrentThreadName("avdecc::ProxyServer::IO");
+				serverLoop();
+			});
+	}
+
+	virtual ~ProxyServerImpl() noexcept
+	{
+		// Stop receiving messages from the network
+		_protocolInterface.unregisterObserver(this);
+		_protocolInterface.unregisterVendorUniqueDelegate(MvuAecpdu::ProtocolID);
+
+		// Stop the I/O thread
+		_shouldTerminate = true;
+		wakeIOThread();
+		if (_ioThread.joinable())
+		{
+			_ioThread.join();
+		}
+
+		// Disconnect all clients
+		for (auto const& [fd, client] : _clients)
+		{
+			::close(fd);
+		}
+		_clients.clear();
+
+		closeDescriptors();
+	}
+
+	// Deleted compiler auto-generated methods
+	ProxyServerImpl(ProxyServerImpl&&) = delete;
+	ProxyServerImpl(ProxyServerImpl const&) = delete;
+	ProxyServerImpl& operator=(ProxyServerImpl const&) = delete;
+	ProxyServerImpl& operator=(ProxyServerImpl&&) = delete;
+
+private:
+	struct Client
+	{
+		int fd{ -1 };
+		bool isConnected{ false }; // HTTP handshake completed (protected by _clientsLock)
+		std::vector<std::uint8_t> sendQueue{}; // Data queued by any thread (protected by _clientsLock)
+		// Only accessed by the I/O thread
+		std::vector<std::uint8_t> httpRequest{};
+		proxy::MessageReader reader{};
+		std::vector<std::uint8_t> writeBuffer{};
+		std::size_t writeOffset{ 0u };
+		bool isPollingOut{ false };
+	};
+
+	/* ************************************************************ */
+	/* ProxyServer overrides                                        */
+	/* ************************************************************ */
+	virtual std::uint16_t getPort() const noexcept override
+	{
+		return _port;
+	}
+
+	virtual std::size_t getConnectedClientsCount() const noexcept override
+	{
+		auto const lg = std::lock_guard{ _clientsLock };
+		auto count = std::size_t{ 0u };
+		for (auto const& [fd, client] : _clients)
+		{
+			if (client->isConnected)
+			{
+				++count;
+			}
+		}
+		return count;
+	}
+
+	/* ************************************************************ */
+	/* ProtocolInterface::Observer overrides                        */
+	/* ************************************************************ */
+	virtual void onTransportError(ProtocolInterface* const /*pi*/) noexcept override
+	{
+		queueToClients(proxy::MessageType::LinkDown, _protocolInterface.getMacAddress(), nullptr, 0u);
+	}
+
+	virtual void onAdpduReceived(ProtocolInterface* const /*pi*/, Adpdu const& adpdu) noexcept override
+	{
+		try
+		{
+			auto buffer = SerializationBuffer{};
+			serialize<AvtpduControl>(adpdu, buffer);
+			serialize<Adpdu>(adpdu, buffer);
+			queueToClients(proxy::MessageType::AvdeccFromAps, adpdu.getSrcAddress(), buffer.data(), buffer.size());
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(adpdu.getSrcAddress(), adpdu.getDestAddress(), std::string("ProxyServer: Failed to serialize ADPDU: ") + e.what());
+		}
+	}
+
+	virtual void onAecpduReceived(ProtocolInterface* const /*pi*/, Aecpdu const& aecpdu) noexcept override
+	{
+		try
+		{
+			auto buffer = SerializationBuffer{};
+			serialize<AvtpduControl>(aecpdu, buffer);
+			serialize<Aecpdu>(aecpdu, buffer);
+			queueToClients(proxy::MessageType::AvdeccFromAps, aecpdu.getSrcAddress(), buffer.data(), buffer.size());
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(aecpdu.getSrcAddress(), aecpdu.getDestAddress(), std::string("ProxyServer: Failed to serialize AECPDU: ") + e.what());
+		}
+	}
+
+	virtual void onAcmpduReceived(ProtocolInterface* const /*pi*/, Acmpdu const& acmpdu) noexcept override
+	{
+		try
+		{
+			auto buffer = SerializationBuffer{};
+			serialize<AvtpduControl>(acmpdu, buffer);
+			serialize<Acmpdu>(acmpdu, buffer);
+			queueToClients(proxy::MessageType::AvdeccFromAps, acmpdu.getSrcAddress(), buffer.data(), buffer.size());
+		}
+		catch ([[maybe_unused]] std::exception const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(acmpdu.getSrcAddress(), Acmpdu::Multicast_Mac_Address, "ProxyServer: Failed to serialize ACMPDU: {}", e.what());
+		}
+	}
+
+	/* ************************************************************ */
+	/* ProtocolInterface::VendorUniqueDelegate overrides            */
+	/* ************************************************************ */
+	virtual Aecpdu::UniquePointer createAecpdu(VuAecpdu::ProtocolIdentifier const& /*protocolIdentifier*/, bool const isResponse) noexcept override
+	{
+		return MvuAecpdu::create(isResponse);
+	}
+
+	virtual bool areHandledByControllerStateMachine(VuAecpdu::ProtocolIdentifier const& /*protocolIdentifier*/) const noexcept override
+	{
+		// We only want the low level notification, the messages are handled by the clients
+		return false;
+	}
+
+	/* ************************************************************ */
+	/* Private methods                                              */
+	/* ************************************************************ */
+	void createListeningSocket(std::uint16_t const port, std::string const& bindAddress)
+	{
+		auto hints = addrinfo{};
+		hints.ai_family = AF_UNSPEC;
+		hints.ai_socktype = SOCK_STREAM;
+		hints.ai_flags = AI_PASSIVE;
+
+		auto* result = static_cast<addrinfo*>(nullptr);
+		if (::getaddrinfo(bindAddress.empty() ? nullptr : bindAddress.c_str(), std::to_string(port).c_str(), &hints, &result) != 0 || result == nullptr)
+		{
+			throw ProtocolInterface::Exception(ProtocolInterface::Error::InvalidParameters, "ProxyServer: Cannot resolve bind address: " + bindAddress);
+		}
+
+		for (auto* ai = result; ai != nullptr; ai = ai->ai_next)
+		{
+			auto const fd = ::socket(ai->ai_family, ai->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, ai->ai_protocol);
+			if (fd < 0)
+			{
+				continue;
+			}
+			auto const reuseAddress = int{ 1 };
+			::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+			if (::bind(fd, ai->ai_addr, ai->ai_addrlen) == 0 && ::listen(fd, SOMAXCONN) == 0)
+			{
+				_listenFd = fd;
+				break;
+			}
+			::close(fd);
+		}
+		::freeaddrinfo(result);
+
+		if (_listenFd < 0)
+		{
+			throw ProtocolInterface::Exception(ProtocolInterface::Error::TransportError, "ProxyServer: Failed to listen on port " + std::to_string(port));
+		}
+
+		// Retrieve the actual port
+		auto address = sockaddr_storage{};
+		auto addressLength = static_cast<socklen_t>(sizeof(address));
+		if (::getsockname(_listenFd, reinterpret_cast<sockaddr*>(&address), &addressLength) == 0)
+		{
+			if (address.ss_family == AF_INET)
+			{
+				_port = ntohs(reinterpret_cast<sockaddr_in const&>(address).sin_port);
+			}
+			else if (address.ss_family == AF_INET6)
+			{
+				_port = ntohs(reinterpret_cast<sockaddr_in6 const&>(address).sin6_port);
+			}
+		}
+	}
+
+	bool addToEpoll(int const fd, std::uint32_t const events) noexcept
+	{
+		auto event = epoll_event{};
+		event.events = events;
+		event.data.fd = fd;
+		return ::epoll_ctl(_epollFd, EPOLL_CTL_ADD, fd, &event) == 0;
+	}
+
+	void wakeIOThread() const noexcept
+	{
+		if (_eventFd >= 0)
+		{
+			auto const value = std::uint64_t{ 1u };
+			[[maybe_unused]] auto const ret = ::write(_eventFd, &value, sizeof(value));
+		}
+	}
+
+	void closeDescriptors() noexcept
+	{
+		for (auto* fd : { &_epollFd, &_eventFd, &_listenFd })
+		{
+			if (*fd != -1)
+			{
+				::close(*fd);
+				*fd = -1;
+			}
+		}
+	}
+
+	/** Queues a message for all connected clients, and wakes the I/O thread if needed. Thread-safe. */
+	void queueToClients(proxy::MessageType const messageType, networkInterface::MacAddress const& address, std::uint8_t const* const payload, std::size_t const payloadLength) noexcept
+	{
+		auto shouldWake = false;
+		{
+			auto const lg = std::lock_guard{ _clientsLock };
+			for (auto& [fd, client] : _clients)
+			{
+				if (!client->isConnected)
+				{
+					continue;
+				}
+				if ((client->sendQueue.size() + proxy::HeaderLength + payloadLength) > MaxPendingClientBytes)
+				{
+					LOG_PROTOCOL_INTERFACE_WARN(address, networkInterface::MacAddress{}, "ProxyServer: Client send queue full, dropping message");
+					continue;
+				}
+				shouldWake |= client->sendQueue.empty();
+				proxy::appendMessage(client->sendQueue, messageType, address, payload, payloadLength);
+			}
+		}
+
+		// Only wake the I/O thread for the first queued message, all messages queued until it runs are written at once
+		if (shouldWake)
+		{
+			wakeIOThread();
+		}
+	}
+
+	/** Sends an AVDECC message received from a client on the network */
+	void forwardToNetwork(networkInterface::MacAddress const& destAddress, std::uint8_t const* const payload, std::size_t const payloadLength) noexcept
+	{
+		if (payloadLength < AvtpduControl::HeaderLength)
+		{
+			return;
+		}
+
+		auto const subType = static_cast<std::uint8_t>(payload[0] & 0x7f);
+		auto const controlData = static_cast<std::uint8_t>(payload[1] & 0x7f);
+		auto des = DeserializationBuffer(payload, payloadLength);
+		auto error = ProtocolInterface::Error::NoError;
+
+		try
+		{
+			switch (subType)
+			{
+				case AvtpSubType_Adp:
+				{
+					auto adpdu = Adpdu{};
+					adpdu.setSrcAddress(_protocolInterface.getMacAddress());
+					adpdu.setDestAddress(destAddress);
+					deserialize<AvtpduControl>(&adpdu, des);
+					deserialize<Adpdu>(&adpdu, des);
+					error = _protocolInterface.sendAdpMessage(adpdu);
+					break;
+				}
+				case AvtpSubType_Aecp:
+				{
+					auto aecpdu = createAecpdu(AecpMessageType{ controlData }, payload, payloadLength);
+					if (!aecpdu)
+					{
+						LOG_PROTOCOL_INTERFACE_DEBUG(_protocolInterface.getMacAddress(), destAddress, "ProxyServer: Unsupported AECP message type from client: {}", utils::toHexString(controlData, true));
+						return;
+					}
+					aecpdu->setSrcAddress(_protocolInterface.getMacAddress());
+					aecpdu->setDestAddress(destAddress);
+					deserialize<AvtpduControl>(aecpdu.get(), des);
+					deserialize<Aecpdu>(aecpdu.get(), des);
+					error = _protocolInterface.sendAecpMessage(*aecpdu);
+					break;
+				}
+				case AvtpSubType_Acmp:
+				{
+					auto acmpdu = Acmpdu{};
+					acmpdu.setSrcAddress(_protocolInterface.getMacAddress());
+					deserialize<AvtpduControl>(&acmpdu, des);
+					deserialize<Acmpdu>(&acmpdu, des);
+					error = _protocolInterface.sendAcmpMessage(acmpdu);
+					break;
+				}
+				default:
+					return;
+			}
+		}
+		catch ([[maybe_unused]] std::invalid_argument const& e)
+		{
+			LOG_PROTOCOL_INTERFACE_WARN(_protocolInterface.getMacAddress(), destAddress, std::string("ProxyServer: Message from client dropped: ") + e.what());
+			return;
+		}
+
+		if (!!error)
+		{
+			LOG_PROTOCOL_INTERFACE_DEBUG(_protocolInterface.getMacAddress(), destAddress, "ProxyServer: Failed to send message from client: {}", utils::to_integral(error));
+		}
+	}
+
+	static Aecpdu::UniquePointer createAecpdu(AecpMessageType const messageType, std::uint8_t const* const payload, std::size_t const payloadLength) noexcept
+	{
+		if (messageType == AecpMessageType::AemCommand || messageType == AecpMessageType::AemResponse)
+		{
+			return AemAecpdu::create(messageType == AecpMessageType::AemResponse);
+		}
+		if (messageType == AecpMessageType::AddressAccessCommand || messageType == AecpMessageType::AddressAccessResponse)
+		{
+			return AaAecpdu::create(messageType == AecpMessageType::AddressAccessResponse);
+		}
+		if (messageType == AecpMessageType::VendorUniqueCommand || messageType == AecpMessageType::VendorUniqueResponse)
+		{
+			// Only Milan Vendor Unique messages are supported
+			auto const protocolIdentifierOffset = AvtpduControl::HeaderLength + Aecpdu::HeaderLength;
+			if (payloadLength >= (protocolIdentifierOffset + VuAecpdu::ProtocolIdentifier::Size))
+			{
+				auto protocolIdentifier = VuAecpdu::ProtocolIdentifier::ArrayType{};
+				std::memcpy(protocolIdentifier.data(), payload + protocolIdentifierOffset, VuAecpdu::ProtocolIdentifier::Size);
+				if (VuAecpdu::ProtocolIdentifier{ protocolIdentifier } == MvuAecpdu::ProtocolID)
+				{
+					return MvuAecpdu::create(messageType == AecpMessageType::VendorUniqueResponse);
+				}
+			}
+		}
+		return Aecpdu::UniquePointer{ nullptr, nullptr };
+	}
+
+	void acceptClients() noexcept
+	{
+		while (true)
+		{
+			auto const fd = ::accept4(_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+			if (fd < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				return;
+			}
+
+			auto const noDelay = int{ 1 };
+			::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+			if (!addToEpoll(fd, EPOLLIN))
+			{
+				::close(fd);
+				continue;
+			}
+
+			auto client = std::make_unique<Client>();
+			client->fd = fd;
+			auto const lg = std::lock_guard{ _clientsLock };
+			_clients.emplace(fd, std::move(client));
+		}
+	}
+
+	void closeClient(int const fd) noexcept
+	{
+		::epoll_ctl(_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+		::close(fd);
+		auto const lg = std::lock_guard{ _clientsLock };
+		_clients.erase(fd);
+	}
+
+	/** Processes the HTTP CONNECT request of a client. Returns false if the client should be disconnected. */
+	bool processHandshake(Client& client, std::uint8_t const* const data, std::size_t const length) noexcept
+	{
+		client.httpRequest.insert(client.httpRequest.end(), data, data + length);
+		auto const headerLength = proxy::getHttpHeaderLength(client.httpRequest.data(), client.httpRequest.size());
+		if (!headerLength)
+		{
+			return client.httpRequest.size() <= proxy::MaximumHttpHeaderLength;
+		}
+
+		if (!proxy::isConnectRequest(client.httpRequest.data(), *headerLength))
+		{
+			auto const response = proxy::makeConnectResponse(false);
+			[[maybe_unused]] auto const ret = ::send(client.fd, response.data(), response.size(), MSG_NOSIGNAL);
+			return false;
+		}
+
+		// Accept the connection and announce our network port
+		{
+			auto const response = proxy::makeConnectResponse(true);
+			auto const lg = std::lock_guard{ _clientsLock };
+			client.sendQueue.insert(client.sendQueue.end(), response.begin(), response.end());
+			proxy::appendMessage(client.sendQueue, proxy::MessageType::LinkUp, _protocolInterface.getMacAddress(), nullptr, 0u);
+			client.isConnected = true;
+		}
+
+		// Bytes following the HTTP request are APPDUs
+		auto const request = std::move(client.httpRequest);
+		return processMessages(client, request.data() + *headerLength, request.size() - *headerLength);
+	}
+
+	/** Processes APPDUs from a connected client. Returns false if the client should be disconnected. */
+	bool processMessages(Client& client, std::uint8_t const* const data, std::size_t const length) noexcept
+	{
+		return client.reader.feed(data, length,
+			[this](proxy::MessageType const messageType, networkInterface::MacAddress const& address, std::uint8_t const* const payload, std::size_t const payloadLength)
+			{
+				if (messageType == proxy::MessageType::AvdeccFromApc)
+				{
+					forwardToNetwork(address, payload, payloadLength);
+				}
+				// Ignore other messages (NOP, EntityID and vendor messages)
+			});
+	}
+
+	/** Reads everything available from a client. Returns false if the client should be disconnected. */
+	bool readClient(Client& client) noexcept
+	{
+		while (true)
+		{
+			auto const bytesReceived = ::recv(client.fd, _receiveBuffer.get(), ServerReceiveBufferLength, 0);
+			if (bytesReceived > 0)
+			{
+				auto const length = static_cast<std::size_t>(bytesReceived);
+				auto isConnected = false;
+				{
+					auto const lg = std::lock_guard{ _clientsLock };
+					isConnected = client.isConnected;
+				}
+				auto const result = isConnected ? processMessages(client, _receiveBuffer.get(), length) : processHandshake(client, _receiveBuffer.get(), length);
+				if (!result)
+				{
+					return false;
+				}
+				continue;
+			}
+			if (bytesReceived == 0)
+			{
+				return false;
+			}
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return errno == EAGAIN || errno == EWOULDBLOCK;
+		}
+	}
+
+	/** Writes as much pending data as possible to a client. Returns false if the client should be disconnected. */
+	bool flushClient(Client& client) noexcept
+	{
+		// Grab everything queued since last time (coalescing all pending messages into a single write)
+		if (client.writeOffset == client.writeBuffer.size())
+		{
+			client.writeBuffer.clear();
+			client.writeOffset = 0u;
+			auto const lg = std::lock_guard{ _clientsLock };
+			client.writeBuffer.swap(client.sendQueue);
+		}
+
+		while (client.writeOffset < client.writeBuffer.size())
+		{
+			auto const bytesSent = ::send(client.fd, client.writeBuffer.data() + client.writeOffset, client.writeBuffer.size() - client.writeOffset, MSG_NOSIGNAL);
+			if (bytesSent > 0)
+			{
+				client.writeOffset += static_cast<std::size_t>(bytesSent);
+				continue;
+			}
+			if (bytesSent < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if (bytesSent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+			{
+				break;
+			}
+			return false;
+		}
+
+		// Only poll for write readiness when the socket buffer is full
+		auto const needsPollOut = client.writeOffset < client.writeBuffer.size();
+		if (needsPollOut != client.isPollingOut)
+		{
+			auto event = epoll_event{};
+			event.events = EPOLLIN | (needsPollOut ? EPOLLOUT : 0u);
+			event.data.fd = client.fd;
+			::epoll_ctl(_epollFd, EPOLL_CTL_MOD, client.fd, &event);
+			client.isPollingOut = needsPollOut;
+		}
+
+		return true;
+	}
+
+	void serverLoop() noexcept
+	{
+		auto events = std::array<epoll_event, MaxEventsPerLoop>{};
+		auto clientsToClose = std::vector<int>{};
+
+		while (!_shouldTerminate)
+		{
+			auto const count = ::epoll_wait(_epollFd, events.data(), static_cast<int>(events.size()), ServerLoopTimeout); // timeout so we can check _shouldTerminate
+			if (count < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				LOG_PROTOCOL_INTERFACE_ERROR(networkInterface::MacAddress{}, networkInterface::MacAddress{}, "ProxyServer: epoll_wait failed");
+				return;
+			}
+
+			for (auto i = 0; i < count; ++i)
+			{
+				auto const& event = events[i];
+				auto const fd = event.data.fd;
+				if (fd == _eventFd)
+				{
+					auto value = std::uint64_t{ 0u };
+					[[maybe_unused]] auto const ret = ::read(_eventFd, &value, sizeof(value));
+				}
+				else if (fd == _listenFd)
+				{
+					acceptClients();
+				}
+				else
+				{
+					// Clients map is only modified by this thread, no need to lock for lookup
+					auto const clientIt = _clients.find(fd);
+					if (clientIt == _clients.end())
+					{
+						continue;
+					}
+					auto const hasInput = (event.events & EPOLLIN) != 0;
+					if ((hasInput && !readClient(*clientIt->second)) || (!hasInput && (event.events & (EPOLLERR | EPOLLHUP)) != 0))
+					{
+						closeClient(fd);
+					}
+				}
+			}
+
+			// Write pending data to all clients
+			for (auto const& [fd, client] : _clients)
+			{
+				if (!flushClient(*client))
+				{
+					clientsToClose.push_back(fd);
+				}
+			}
+			for (auto const fd : clientsToClose)
+			{
+				closeClient(fd);
+			}
+			clientsToClose.clear();
+		}
+	}
+
+	// Private variables
+	ProtocolInterface& _protocolInterface;
+	std::uint16_t _port{ 0u };
+	int _listenFd{ -1 };
+	int _eventFd{ -1 };
+	int _epollFd{ -1 };
+	std::atomic_bool _shouldTerminate{ false };
+	std::unique_ptr<std::uint8_t[]> _receiveBuffer{ std::make_unique<std::uint8_t[]>(ServerReceiveBufferLength) };
+	mutable std::mutex _clientsLock{};
+	std::unordered_map<int, std::unique_ptr<Client>> _clients{}; // Only modified by the I/O thread, under _clientsLock
+	std::thread _ioThread{};
+};
+
+ProxyServer::UniquePointer ProxyServer::create(ProtocolInterface& protocolInterface, std::uint16_t const port, std::string const& bindAddress)
+{
+	return std::make_unique<ProxyServerImpl>(protocolInterface, port, bindAddress);
+}
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
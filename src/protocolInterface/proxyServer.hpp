@@ -0,0 +1,84 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file proxyServer.hpp
+* @author Christophe Calmejane
+* @brief Lightweight AVDECC Proxy Server (IEEE Std 1722.1 Annex C), bridging a ProtocolInterface with remote proxy clients over TCP.
+*/
+
+#pragma once
+
+#include "la/avdecc/internals/protocolInterface.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace la
+{
+namespace avdecc
+{
+namespace protocol
+{
+/**
+* @brief AVDECC Proxy Server (APS).
+* @details Accepts AVDECC Proxy Clients (such as ProtocolInterfaceProxy) on a TCP port, then:
+*          - forwards all AVDECC messages received by the ProtocolInterface to all connected clients,
+*          - sends all AVDECC messages received from a client using the ProtocolInterface.
+*          Supported messages are ADP, ACMP, AEM, Address Access and Milan Vendor Unique AECP. Messages are not forwarded between clients.
+*          All sockets are non-blocking and driven by a single epoll thread. Messages sent to a client are coalesced into as few TCP segments as possible.
+*/
+class ProxyServer
+{
+public:
+	using UniquePointer = std::unique_ptr<ProxyServer>;
+
+	/**
+	* @brief Factory method to create a new ProxyServer.
+	* @param[in] protocolInterface The ProtocolInterface to bridge, which must outlive the server. The server registers itself as the Milan VendorUniqueDelegate of this interface, so it should not be shared with local entities.
+	* @param[in] port The TCP port to listen on (0 to let the system choose one, see getPort).
+	* @param[in] bindAddress The local address to listen on (empty to listen on all addresses).
+	* @return A new ProxyServer.
+	* @note Throws ProtocolInterface::Exception if the listening socket cannot be created.
+	*/
+	static UniquePointer create(ProtocolInterface& protocolInterface, std::uint16_t const port, std::string const& bindAddress = {});
+
+	/** Returns the TCP port the server is listening on */
+	virtual std::uint16_t getPort() const noexcept = 0;
+
+	/** Returns the count of clients that completed the connection handshake */
+	virtual std::size_t getConnectedClientsCount() const noexcept = 0;
+
+	/** Destructor. Disconnects all clients. */
+	virtual ~ProxyServer() noexcept = default;
+
+	// Deleted compiler auto-generated methods
+	ProxyServer(ProxyServer&&) = delete;
+	ProxyServer(ProxyServer const&) = delete;
+	ProxyServer& operator=(ProxyServer const&) = delete;
+	ProxyServer& operator=(ProxyServer&&) = delete;
+
+protected:
+	ProxyServer() noexcept = default;
+};
+
+} // namespace protocol
+} // namespace avdecc
+} // namespace la
@@ -0,0 +1,116 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file aemHandler_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost (time and heap allocations) of a READ_DESCRIPTOR command answered by a local entity exposing an entity model.
+*/
+
+#include "benchmarkProtocolInterface.hpp"
+#include "allocationCounter.hpp"
+
+// Internal API
+#include "protocol/protocolAemPayloads.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+auto const RemoteMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x1b, 0x92, 0x00, 0x00, 0x01 } };
+auto const RemoteControllerEntityID = la::avdecc::UniqueIdentifier{ 0x001b92fffe000001 };
+auto const ModelEntityID = la::avdecc::UniqueIdentifier{ 0x0001020304050002 };
+constexpr auto StreamsCount = std::uint16_t{ 64u };
+
+la::avdecc::entity::model::EntityTree makeEntityTree()
+{
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	auto& configTree = entityTree.configurationTrees[la::avdecc::entity::model::ConfigurationIndex{ 0u }];
+
+	for (auto streamIndex = la::avdecc::entity::model::StreamIndex{ 0u }; streamIndex < StreamsCount; ++streamIndex)
+	{
+		auto& streamModels = configTree.streamInputModels[streamIndex];
+		for (auto i = 0u; i < 8u; ++i)
+		{
+			streamModels.staticModel.formats.insert(la::avdecc::entity::model::StreamFormat{ 0x0205022000406000u + i });
+		}
+		streamModels.dynamicModel.streamFormat = la::avdecc::entity::model::StreamFormat{ 0x0205022000406000 };
+	}
+
+	return entityTree;
+}
+
+/** READ_DESCRIPTOR commands for each STREAM_INPUT of the model */
+std::vector<BenchmarkFrame> makeReadStreamInputDescriptorFrames()
+{
+	auto frames = std::vector<BenchmarkFrame>{};
+
+	for (auto streamIndex = la::avdecc::entity::model::StreamIndex{ 0u }; streamIndex < StreamsCount; ++streamIndex)
+	{
+		auto aemAecpdu = la::avdecc::protocol::AemAecpdu::create(false);
+		auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*aemAecpdu);
+		aem.setSrcAddress(RemoteMacAddress);
+		aem.setDestAddress(BenchmarkProtocolInterface::LocalMacAddress);
+		aem.setStatus(la::avdecc::protocol::AecpStatus::Success);
+		aem.setTargetEntityID(ModelEntityID);
+		aem.setControllerEntityID(RemoteControllerEntityID);
+		aem.setSequenceID(streamIndex);
+		aem.setUnsolicited(false);
+		aem.setCommandType(la::avdecc::protocol::AemCommandType::ReadDescriptor);
+		auto const ser = la::avdecc::protocol::aemPayload::serializeReadDescriptorCommand(la::avdecc::entity::model::ConfigurationIndex{ 0u }, la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex);
+		aem.setCommandSpecificData(ser.data(), ser.size());
+		frames.push_back(makeBenchmarkFrame(aem));
+	}
+
+	return frames;
+}
+} // namespace
+
+/** READ_DESCRIPTOR (STREAM_INPUT) received by an entity exposing an entity model, up to the response being sent */
+static void BM_AemHandlerReadDescriptor(benchmark::State& state)
+{
+	auto environment = BenchmarkEnvironment{};
+	auto& pi = environment.getProtocolInterface();
+
+	auto const entityTree = makeEntityTree();
+	auto const commonInformation = la::avdecc::entity::Entity::CommonInformation{ ModelEntityID, la::avdecc::UniqueIdentifier{ 0x0001020304050000 }, la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported }, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+	auto const interfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ BenchmarkProtocolInterface::LocalMacAddress, 31u, 0u, std::nullopt, std::nullopt };
+	auto const modelEntity = la::avdecc::entity::ControllerEntity::create(&pi, commonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, interfaceInfo } }, &entityTree, nullptr);
+
+	auto const frames = makeReadStreamInputDescriptorFrames();
+	auto frameIndex = std::size_t{ 0u };
+
+	auto allocations = std::uint64_t{ 0u };
+	for (auto _ : state)
+	{
+		auto const allocationsBefore = benchmarks::getAllocationsCount();
+
+		auto const& frame = frames[frameIndex];
+		frameIndex = (frameIndex + 1u) % frames.size();
+		pi.dispatchAvdeccMessage(frame.avtpdu.data(), frame.avtpdu.size(), frame.etherLayer2);
+
+		allocations += benchmarks::getAllocationsCount() - allocationsBefore;
+	}
+
+	state.counters["Allocations"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_AemHandlerReadDescriptor);
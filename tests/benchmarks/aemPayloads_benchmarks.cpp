@@ -0,0 +1,250 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file aemPayloads_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost of AEM payloads (de)serialization: field by field Serializer/Deserializer (previous implementation) vs compile-time layouts and bulk array conversion.
+*        All functions are called through a pointer, so that the reference implementation is not inlined when the library one cannot be.
+*/
+
+// Internal API
+#include "protocol/protocolAemPayloads.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <tuple>
+
+namespace
+{
+namespace reference
+{
+auto serializeAcquireEntityCommand(la::avdecc::protocol::AemAcquireEntityFlags const flags, la::avdecc::UniqueIdentifier const ownerID, la::avdecc::entity::model::DescriptorType const descriptorType, la::avdecc::entity::model::DescriptorIndex const descriptorIndex)
+{
+	la::avdecc::Serializer<la::avdecc::protocol::aemPayload::AecpAemAcquireEntityCommandPayloadSize> ser;
+
+	ser << flags;
+	ser << ownerID;
+	ser << descriptorType << descriptorIndex;
+
+	return ser;
+}
+
+auto deserializeAcquireEntityCommand(la::avdecc::protocol::AemAecpdu::Payload const& payload)
+{
+	auto* const commandPayload = payload.first;
+	auto const commandPayloadLength = payload.second;
+
+	if (commandPayload == nullptr || commandPayloadLength < la::avdecc::protocol::aemPayload::AecpAemAcquireEntityCommandPayloadSize) // Malformed packet
+		throw la::avdecc::protocol::aemPayload::IncorrectPayloadSizeException();
+
+	la::avdecc::Deserializer des(commandPayload, commandPayloadLength);
+	la::avdecc::protocol::AemAcquireEntityFlags flags{ la::avdecc::protocol::AemAcquireEntityFlags::None };
+	la::avdecc::UniqueIdentifier ownerID{};
+	la::avdecc::entity::model::DescriptorType descriptorType{ la::avdecc::entity::model::DescriptorType::Invalid };
+	la::avdecc::entity::model::DescriptorIndex descriptorIndex{ 0u };
+
+	des >> flags;
+	des >> ownerID;
+	des >> descriptorType >> descriptorIndex;
+
+	return std::make_tuple(flags, ownerID, descriptorType, descriptorIndex);
+}
+
+la::avdecc::entity::model::EntityDescriptor deserializeReadEntityDescriptorResponse(la::avdecc::protocol::AemAecpdu::Payload const& payload, size_t const commonSize)
+{
+	auto entityDescriptor = la::avdecc::entity::model::EntityDescriptor{};
+	auto* const commandPayload = payload.first;
+	auto const commandPayloadLength = payload.second;
+
+	if (commandPayload == nullptr || commandPayloadLength < la::avdecc::protocol::aemPayload::AecpAemReadEntityDescriptorResponsePayloadSize) // Malformed packet
+		throw la::avdecc::protocol::aemPayload::IncorrectPayloadSizeException();
+
+	la::avdecc::Deserializer des(commandPayload, commandPayloadLength);
+	des.setPosition(commonSize);
+	des >> entityDescriptor.entityID >> entityDescriptor.entityModelID >> entityDescriptor.entityCapabilities;
+	des >> entityDescriptor.talkerStreamSources >> entityDescriptor.talkerCapabilities;
+	des >> entityDescriptor.listenerStreamSinks >> entityDescriptor.listenerCapabilities;
+	des >> entityDescriptor.controllerCapabilities;
+	des >> entityDescriptor.availableIndex;
+	des >> entityDescriptor.associationID;
+	des >> entityDescriptor.entityName;
+	des >> entityDescriptor.vendorNameString >> entityDescriptor.modelNameString;
+	des >> entityDescriptor.firmwareVersion;
+	des >> entityDescriptor.groupName;
+	des >> entityDescriptor.serialNumber;
+	des >> entityDescriptor.configurationsCount >> entityDescriptor.currentConfiguration;
+
+	return entityDescriptor;
+}
+
+auto deserializeAddAudioMappingsCommand(la::avdecc::protocol::AemAecpdu::Payload const& payload)
+{
+	la::avdecc::Deserializer des(payload.first, payload.second);
+	la::avdecc::entity::model::DescriptorType descriptorType{ la::avdecc::entity::model::DescriptorType::Invalid };
+	la::avdecc::entity::model::DescriptorIndex descriptorIndex{ 0u };
+	std::uint16_t numberOfMappings{ 0u };
+	std::uint16_t reserved{ 0u };
+
+	des >> descriptorType >> descriptorIndex;
+	des >> numberOfMappings >> reserved;
+
+	la::avdecc::entity::model::AudioMappings mappings;
+	for (auto index = 0u; index < numberOfMappings; ++index)
+	{
+		la::avdecc::entity::model::AudioMapping mapping;
+		des >> mapping.streamIndex >> mapping.streamChannel >> mapping.clusterOffset >> mapping.clusterChannel;
+		mappings.push_back(mapping);
+	}
+
+	return std::make_tuple(descriptorType, descriptorIndex, mappings);
+}
+} // namespace reference
+
+auto const s_OwnerID = la::avdecc::UniqueIdentifier{ 0x0102030405060708 };
+
+auto makeEntityDescriptorPayload()
+{
+	auto entityDescriptor = la::avdecc::entity::model::EntityDescriptor{};
+	entityDescriptor.entityID = s_OwnerID;
+	entityDescriptor.entityName = std::string{ "Benchmark entity" };
+	entityDescriptor.configurationsCount = 2u;
+	auto ser = la::avdecc::protocol::aemPayload::serializeReadDescriptorCommonResponse(0u, la::avdecc::entity::model::DescriptorType::Entity, 0u);
+	la::avdecc::protocol::aemPayload::serializeReadEntityDescriptorResponse(ser, entityDescriptor);
+	return ser;
+}
+
+auto makeAddAudioMappingsPayload()
+{
+	auto mappings = la::avdecc::entity::model::AudioMappings{};
+	for (auto i = 0u; i < 48u; ++i)
+	{
+		mappings.push_back(la::avdecc::entity::model::AudioMapping{ static_cast<la::avdecc::entity::model::StreamIndex>(i / 8u), static_cast<std::uint16_t>(i % 8u), static_cast<la::avdecc::entity::model::ClusterIndex>(i), 0u });
+	}
+	return la::avdecc::protocol::aemPayload::serializeAddAudioMappingsCommand(la::avdecc::entity::model::DescriptorType::StreamPortInput, 0u, mappings);
+}
+} // namespace
+
+static void BM_SerializeAcquireEntityCommandReference(benchmark::State& state)
+{
+	auto* serialize = &reference::serializeAcquireEntityCommand;
+	benchmark::DoNotOptimize(serialize);
+	for (auto _ : state)
+	{
+		auto const ser = serialize(la::avdecc::protocol::AemAcquireEntityFlags::Persistent, s_OwnerID, la::avdecc::entity::model::DescriptorType::Entity, 0u);
+		benchmark::DoNotOptimize(ser.data());
+	}
+}
+BENCHMARK(BM_SerializeAcquireEntityCommandReference);
+
+static void BM_SerializeAcquireEntityCommandLayout(benchmark::State& state)
+{
+	auto* serialize = &la::avdecc::protocol::aemPayload::serializeAcquireEntityCommand;
+	benchmark::DoNotOptimize(serialize);
+	for (auto _ : state)
+	{
+		auto const ser = serialize(la::avdecc::protocol::AemAcquireEntityFlags::Persistent, s_OwnerID, la::avdecc::entity::model::DescriptorType::Entity, 0u);
+		benchmark::DoNotOptimize(ser.data());
+	}
+}
+BENCHMARK(BM_SerializeAcquireEntityCommandLayout);
+
+static void BM_DeserializeAcquireEntityCommandReference(benchmark::State& state)
+{
+	auto const ser = reference::serializeAcquireEntityCommand(la::avdecc::protocol::AemAcquireEntityFlags::Persistent, s_OwnerID, la::avdecc::entity::model::DescriptorType::Entity, 0u);
+	auto const payload = la::avdecc::protocol::AemAecpdu::Payload{ ser.data(), ser.size() };
+	auto* deserialize = &reference::deserializeAcquireEntityCommand;
+	benchmark::DoNotOptimize(deserialize);
+	for (auto _ : state)
+	{
+		auto const result = deserialize(payload);
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(BM_DeserializeAcquireEntityCommandReference);
+
+static void BM_DeserializeAcquireEntityCommandLayout(benchmark::State& state)
+{
+	auto const ser = reference::serializeAcquireEntityCommand(la::avdecc::protocol::AemAcquireEntityFlags::Persistent, s_OwnerID, la::avdecc::entity::model::DescriptorType::Entity, 0u);
+	auto const payload = la::avdecc::protocol::AemAecpdu::Payload{ ser.data(), ser.size() };
+	auto* deserialize = &la::avdecc::protocol::aemPayload::deserializeAcquireEntityCommand;
+	benchmark::DoNotOptimize(deserialize);
+	for (auto _ : state)
+	{
+		auto const result = deserialize(payload);
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(BM_DeserializeAcquireEntityCommandLayout);
+
+static void BM_DeserializeEntityDescriptorReference(benchmark::State& state)
+{
+	auto const ser = makeEntityDescriptorPayload();
+	auto const payload = la::avdecc::protocol::AemAecpdu::Payload{ ser.data(), ser.size() };
+	auto* deserialize = &reference::deserializeReadEntityDescriptorResponse;
+	benchmark::DoNotOptimize(deserialize);
+	for (auto _ : state)
+	{
+		auto const entityDescriptor = deserialize(payload, la::avdecc::protocol::aemPayload::AecpAemReadCommonDescriptorResponsePayloadSize);
+		benchmark::DoNotOptimize(entityDescriptor);
+	}
+}
+BENCHMARK(BM_DeserializeEntityDescriptorReference);
+
+static void BM_DeserializeEntityDescriptorLayout(benchmark::State& state)
+{
+	auto const ser = makeEntityDescriptorPayload();
+	auto const payload = la::avdecc::protocol::AemAecpdu::Payload{ ser.data(), ser.size() };
+	auto* deserialize = &la::avdecc::protocol::aemPayload::deserializeReadEntityDescriptorResponse;
+	benchmark::DoNotOptimize(deserialize);
+	for (auto _ : state)
+	{
+		auto const entityDescriptor = deserialize(payload, la::avdecc::protocol::aemPayload::AecpAemReadCommonDescriptorResponsePayloadSize, static_cast<la::avdecc::protocol::AemAecpStatus>(la::avdecc::protocol::AemAecpStatus::Success));
+		benchmark::DoNotOptimize(entityDescriptor);
+	}
+}
+BENCHMARK(BM_DeserializeEntityDescriptorLayout);
+
+static void BM_DeserializeAudioMappingsReference(benchmark::State& state)
+{
+	auto const ser = makeAddAudioMappingsPayload();
+	auto const payload = la::avdecc::protocol::AemAecpdu::Payload{ ser.data(), ser.size() };
+	auto* deserialize = &reference::deserializeAddAudioMappingsCommand;
+	benchmark::DoNotOptimize(deserialize);
+	for (auto _ : state)
+	{
+		auto const result = deserialize(payload);
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(BM_DeserializeAudioMappingsReference);
+
+static void BM_DeserializeAudioMappingsBulk(benchmark::State& state)
+{
+	auto const ser = makeAddAudioMappingsPayload();
+	auto const payload = la::avdecc::protocol::AemAecpdu::Payload{ ser.data(), ser.size() };
+	auto* deserialize = &la::avdecc::protocol::aemPayload::deserializeAddAudioMappingsCommand;
+	benchmark::DoNotOptimize(deserialize);
+	for (auto _ : state)
+	{
+		auto const result = deserialize(payload);
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(BM_DeserializeAudioMappingsBulk);
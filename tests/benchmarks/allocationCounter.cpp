@@ -0,0 +1,76 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file allocationCounter.cpp
+* @author Christophe Calmejane
+*/
+
+#include "allocationCounter.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+static std::uint64_t s_allocationsCount{ 0u };
+static std::uint64_t s_allocatedBytes{ 0u };
+
+// Each allocation is prefixed with its size, so the operator delete can account for the freed bytes
+static constexpr auto HeaderSize = alignof(std::max_align_t);
+
+void* operator new(std::size_t const size)
+{
+	++s_allocationsCount;
+	if (auto* const ptr = static_cast<std::byte*>(std::malloc(HeaderSize + size)))
+	{
+		*reinterpret_cast<std::size_t*>(ptr) = size;
+		s_allocatedBytes += size;
+		return ptr + HeaderSize;
+	}
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* const ptr) noexcept
+{
+	if (ptr != nullptr)
+	{
+		auto* const basePtr = static_cast<std::byte*>(ptr) - HeaderSize;
+		s_allocatedBytes -= *reinterpret_cast<std::size_t*>(basePtr);
+		std::free(basePtr);
+	}
+}
+
+void operator delete(void* const ptr, std::size_t const /*size*/) noexcept
+{
+	operator delete(ptr);
+}
+
+namespace benchmarks
+{
+std::uint64_t getAllocationsCount() noexcept
+{
+	return s_allocationsCount;
+}
+
+std::uint64_t getAllocatedBytes() noexcept
+{
+	return s_allocatedBytes;
+}
+
+} // namespace benchmarks
@@ -0,0 +1,38 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file allocationCounter.hpp
+* @author Christophe Calmejane
+* @brief Count of heap allocations made through the global operator new, for benchmarks reporting allocations per iteration or memory usage.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace benchmarks
+{
+/** Number of calls to the global operator new since the start of the process (benchmarks are single threaded) */
+std::uint64_t getAllocationsCount() noexcept;
+
+/** Number of bytes currently allocated through the global operator new (benchmarks are single threaded) */
+std::uint64_t getAllocatedBytes() noexcept;
+
+} // namespace benchmarks
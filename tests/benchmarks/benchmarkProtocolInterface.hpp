@@ -0,0 +1,284 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file benchmarkProtocolInterface.hpp
+* @author Christophe Calmejane
+* @brief ProtocolInterface without any transport, giving direct access to its EthernetPacketDispatcher and state machines.
+*        Sent messages are dropped (only the last AECP SequenceID is recorded), so that benchmarks only measure the library code paths.
+*/
+
+#pragma once
+
+// Public API
+#include <la/avdecc/executor.hpp>
+#include <la/avdecc/internals/controllerEntity.hpp>
+#include <la/avdecc/internals/protocolInterface.hpp>
+
+// Internal API
+#include "protocolInterface/ethernetPacketDispatch.hpp"
+#include "stateMachine/stateMachineManager.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class BenchmarkProtocolInterface final : public la::avdecc::protocol::ProtocolInterface, private la::avdecc::protocol::stateMachine::ProtocolInterfaceDelegate, private la::avdecc::protocol::stateMachine::AdvertiseStateMachine::Delegate, private la::avdecc::protocol::stateMachine::DiscoveryStateMachine::Delegate, private la::avdecc::protocol::stateMachine::CommandStateMachine::Delegate
+{
+public:
+	static constexpr auto ExecutorName = "avdecc::benchmark::PI";
+	static inline auto const LocalMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } };
+	static inline auto const ControllerEntityID = la::avdecc::UniqueIdentifier{ 0x0001020304050001 };
+
+	BenchmarkProtocolInterface()
+		: ProtocolInterface("BenchmarkInterface", LocalMacAddress, ExecutorName)
+	{
+	}
+
+	/** Dispatches a received AVTPDU (Ethernet header already removed) */
+	void dispatchAvdeccMessage(std::uint8_t const* const pkt_data, size_t const pkt_len, la::avdecc::protocol::EtherLayer2 const& etherLayer2) const noexcept
+	{
+		_ethernetPacketDispatcher.dispatchAvdeccMessage(pkt_data, pkt_len, etherLayer2);
+	}
+
+	la::avdecc::protocol::stateMachine::Manager& getStateMachineManager() noexcept
+	{
+		return _stateMachineManager;
+	}
+
+	la::avdecc::protocol::AecpSequenceID getLastSentAecpSequenceID() const noexcept
+	{
+		return _lastSentAecpSequenceID;
+	}
+
+	/** Notifies the observers (the local entities) that a remote entity is online, without going through the DiscoveryStateMachine */
+	void notifyRemoteEntityOnline(la::avdecc::entity::Entity const& entity) noexcept
+	{
+		notifyObserversMethod<la::avdecc::protocol::ProtocolInterface::Observer>(&la::avdecc::protocol::ProtocolInterface::Observer::onRemoteEntityOnline, this, entity);
+	}
+
+	// Deleted compiler auto-generated methods
+	BenchmarkProtocolInterface(BenchmarkProtocolInterface&&) = delete;
+	BenchmarkProtocolInterface(BenchmarkProtocolInterface const&) = delete;
+	BenchmarkProtocolInterface& operator=(BenchmarkProtocolInterface const&) = delete;
+	BenchmarkProtocolInterface& operator=(BenchmarkProtocolInterface&&) = delete;
+
+private:
+	/* ************************************************************ */
+	/* ProtocolInterface overrides                                  */
+	/* ************************************************************ */
+	virtual void destroy() noexcept override
+	{
+		delete this;
+	}
+	virtual void shutdown() noexcept override
+	{
+		_stateMachineManager.stopStateMachines();
+	}
+	virtual la::avdecc::UniqueIdentifier getDynamicEID() const noexcept override
+	{
+		return la::avdecc::UniqueIdentifier::getNullUniqueIdentifier();
+	}
+	virtual void releaseDynamicEID(la::avdecc::UniqueIdentifier const /*entityID*/) const noexcept override {}
+	virtual Error registerLocalEntity(la::avdecc::entity::LocalEntity& entity) noexcept override
+	{
+		return _stateMachineManager.registerLocalEntity(entity);
+	}
+	virtual Error unregisterLocalEntity(la::avdecc::entity::LocalEntity& entity) noexcept override
+	{
+		return _stateMachineManager.unregisterLocalEntity(entity);
+	}
+	virtual Error injectRawPacket(la::avdecc::MemoryBuffer&& /*packet*/) const noexcept override
+	{
+		return Error::MessageNotSupported;
+	}
+	virtual Error setEntityNeedsAdvertise(la::avdecc::entity::LocalEntity const& entity, la::avdecc::entity::LocalEntity::AdvertiseFlags const /*flags*/) noexcept override
+	{
+		return _stateMachineManager.setEntityNeedsAdvertise(entity);
+	}
+	virtual Error enableEntityAdvertising(la::avdecc::entity::LocalEntity& entity) noexcept override
+	{
+		return _stateMachineManager.enableEntityAdvertising(entity);
+	}
+	virtual Error disableEntityAdvertising(la::avdecc::entity::LocalEntity const& entity) noexcept override
+	{
+		return _stateMachineManager.disableEntityAdvertising(entity);
+	}
+	virtual Error discoverRemoteEntities() const noexcept override
+	{
+		return Error::NoError;
+	}
+	virtual Error discoverRemoteEntity(la::avdecc::UniqueIdentifier const /*entityID*/) const noexcept override
+	{
+		return Error::NoError;
+	}
+	virtual Error forgetRemoteEntity(la::avdecc::UniqueIdentifier const entityID) const noexcept override
+	{
+		return _stateMachineManager.forgetRemoteEntity(entityID);
+	}
+	virtual Error setAutomaticDiscoveryDelay(std::chrono::milliseconds const delay) const noexcept override
+	{
+		return _stateMachineManager.setAutomaticDiscoveryDelay(delay);
+	}
+	virtual bool isDirectMessageSupported() const noexcept override
+	{
+		return true;
+	}
+	virtual Error sendAdpMessage(la::avdecc::protocol::Adpdu const& adpdu) const noexcept override
+	{
+		return sendMessage(adpdu);
+	}
+	virtual Error sendAecpMessage(la::avdecc::protocol::Aecpdu const& aecpdu) const noexcept override
+	{
+		return sendMessage(aecpdu);
+	}
+	virtual Error sendAcmpMessage(la::avdecc::protocol::Acmpdu const& acmpdu) const noexcept override
+	{
+		return sendMessage(acmpdu);
+	}
+	virtual Error sendAecpCommand(la::avdecc::protocol::Aecpdu::UniquePointer&& aecpdu, AecpCommandResultHandler const& onResult) const noexcept override
+	{
+		return _stateMachineManager.sendAecpCommand(std::move(aecpdu), onResult);
+	}
+	virtual Error sendAecpResponse(la::avdecc::protocol::Aecpdu::UniquePointer&& aecpdu) const noexcept override
+	{
+		return sendMessage(static_cast<la::avdecc::protocol::Aecpdu const&>(*aecpdu));
+	}
+	virtual Error sendAcmpCommand(la::avdecc::protocol::Acmpdu::UniquePointer&& acmpdu, AcmpCommandResultHandler const& onResult) const noexcept override
+	{
+		return _stateMachineManager.sendAcmpCommand(std::move(acmpdu), onResult);
+	}
+	virtual Error sendAcmpResponse(la::avdecc::protocol::Acmpdu::UniquePointer&& acmpdu) const noexcept override
+	{
+		return sendMessage(static_cast<la::avdecc::protocol::Acmpdu const&>(*acmpdu));
+	}
+	virtual void lock() const noexcept override
+	{
+		_stateMachineManager.lock();
+	}
+	virtual void unlock() const noexcept override
+	{
+		_stateMachineManager.unlock();
+	}
+	virtual bool isSelfLocked() const noexcept override
+	{
+		return _stateMachineManager.isSelfLocked();
+	}
+
+	/* ************************************************************ */
+	/* stateMachine::ProtocolInterfaceDelegate overrides            */
+	/* ************************************************************ */
+	virtual void onAecpCommand(la::avdecc::protocol::Aecpdu const& /*aecpdu*/) noexcept override {}
+	virtual void onVuAecpUnsolicitedResponse(la::avdecc::protocol::VuAecpdu::ProtocolIdentifier const& /*protocolIdentifier*/, la::avdecc::protocol::VuAecpdu const& /*aecpdu*/) noexcept override {}
+	virtual void onAcmpCommand(la::avdecc::protocol::Acmpdu const& /*acmpdu*/) noexcept override {}
+	virtual void onAcmpResponse(la::avdecc::protocol::Acmpdu const& /*acmpdu*/) noexcept override {}
+	virtual Error sendMessage(la::avdecc::protocol::Adpdu const& /*adpdu*/) const noexcept override
+	{
+		return Error::NoError;
+	}
+	virtual Error sendMessage(la::avdecc::protocol::Aecpdu const& aecpdu) const noexcept override
+	{
+		_lastSentAecpSequenceID = aecpdu.getSequenceID();
+		return Error::NoError;
+	}
+	virtual Error sendMessage(la::avdecc::protocol::Acmpdu const& /*acmpdu*/) const noexcept override
+	{
+		return Error::NoError;
+	}
+	virtual std::uint32_t getVuAecpCommandTimeoutMsec(la::avdecc::protocol::VuAecpdu::ProtocolIdentifier const& protocolIdentifier, la::avdecc::protocol::VuAecpdu const& aecpdu) const noexcept override
+	{
+		return getVendorUniqueCommandTimeout(protocolIdentifier, aecpdu);
+	}
+	virtual bool isVuAecpUnsolicitedResponse(la::avdecc::protocol::VuAecpdu::ProtocolIdentifier const& protocolIdentifier, la::avdecc::protocol::VuAecpdu const& aecpdu) const noexcept override
+	{
+		return isVendorUniqueUnsolicitedResponse(protocolIdentifier, aecpdu);
+	}
+
+	/* ************************************************************ */
+	/* stateMachine::DiscoveryStateMachine::Delegate overrides      */
+	/* ************************************************************ */
+	virtual void onLocalEntityOnline(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+	virtual void onLocalEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
+	virtual void onLocalEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+	virtual void onRemoteEntityOnline(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+	virtual void onRemoteEntityOffline(la::avdecc::UniqueIdentifier const /*entityID*/) noexcept override {}
+	virtual void onRemoteEntityUpdated(la::avdecc::entity::Entity const& /*entity*/) noexcept override {}
+
+	/* ************************************************************ */
+	/* stateMachine::CommandStateMachine::Delegate overrides        */
+	/* ************************************************************ */
+	virtual void onAecpAemUnsolicitedResponse(la::avdecc::protocol::AemAecpdu const& /*aecpdu*/) noexcept override {}
+	virtual void onAecpAemIdentifyNotification(la::avdecc::protocol::AemAecpdu const& /*aecpdu*/) noexcept override {}
+	virtual void onAecpRetry(la::avdecc::UniqueIdentifier const& /*entityID*/) noexcept override {}
+	virtual void onAecpTimeout(la::avdecc::UniqueIdentifier const& /*entityID*/) noexcept override {}
+	virtual void onAecpUnexpectedResponse(la::avdecc::UniqueIdentifier const& /*entityID*/) noexcept override {}
+	virtual void onAecpResponseTime(la::avdecc::UniqueIdentifier const& /*entityID*/, std::chrono::milliseconds const& /*responseTime*/) noexcept override {}
+
+	// Private variables
+	mutable la::avdecc::protocol::AecpSequenceID _lastSentAecpSequenceID{ 0u };
+	mutable la::avdecc::protocol::stateMachine::Manager _stateMachineManager{ this, this, this, this, this };
+	friend class la::avdecc::protocol::EthernetPacketDispatcher<BenchmarkProtocolInterface>;
+	la::avdecc::protocol::EthernetPacketDispatcher<BenchmarkProtocolInterface> _ethernetPacketDispatcher{ this, _stateMachineManager };
+};
+
+/** Received AVTPDU (Ethernet header removed) and its EtherLayer2 information, as given to the EthernetPacketDispatcher */
+struct BenchmarkFrame
+{
+	std::vector<std::uint8_t> avtpdu{};
+	la::avdecc::protocol::EtherLayer2 etherLayer2{};
+};
+
+/** Serializes a PDU the way a transport would receive it */
+template<class PduType>
+BenchmarkFrame makeBenchmarkFrame(PduType const& pdu)
+{
+	auto buffer = la::avdecc::protocol::SerializationBuffer{};
+	la::avdecc::protocol::serialize<la::avdecc::protocol::AvtpduControl>(pdu, buffer);
+	la::avdecc::protocol::serialize<PduType>(pdu, buffer);
+
+	return BenchmarkFrame{ std::vector<std::uint8_t>{ buffer.data(), buffer.data() + buffer.size() }, static_cast<la::avdecc::protocol::EtherLayer2 const&>(pdu) };
+}
+
+/** Creates the executor, the ProtocolInterface and a ControllerEntity registered on it. Destroyed in reverse order. */
+class BenchmarkEnvironment final
+{
+public:
+	BenchmarkEnvironment()
+	{
+		auto const commonInformation = la::avdecc::entity::Entity::CommonInformation{ BenchmarkProtocolInterface::ControllerEntityID, la::avdecc::UniqueIdentifier{ 0x0001020304050000 }, la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported }, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+		auto const interfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ BenchmarkProtocolInterface::LocalMacAddress, 31u, 0u, std::nullopt, std::nullopt };
+		_controller = la::avdecc::entity::ControllerEntity::create(_protocolInterface.get(), commonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, interfaceInfo } }, nullptr, nullptr);
+	}
+
+	BenchmarkProtocolInterface& getProtocolInterface() noexcept
+	{
+		return *_protocolInterface;
+	}
+
+	la::avdecc::entity::ControllerEntity& getController() noexcept
+	{
+		return *_controller;
+	}
+
+private:
+	la::avdecc::ExecutorManager::ExecutorWrapper::UniquePointer _executor{ la::avdecc::ExecutorManager::getInstance().registerExecutor(BenchmarkProtocolInterface::ExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(BenchmarkProtocolInterface::ExecutorName)) };
+	std::unique_ptr<BenchmarkProtocolInterface> _protocolInterface{ std::make_unique<BenchmarkProtocolInterface>() };
+	la::avdecc::entity::ControllerEntity::UniquePointer _controller{ nullptr, nullptr };
+};
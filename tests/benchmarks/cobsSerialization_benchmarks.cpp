@@ -0,0 +1,126 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file cobsSerialization_benchmarks.cpp
+* @author Christophe Calmejane
+*/
+
+// Internal API
+#include "protocolInterface/cobsSerialization.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+/** Builds a payload looking like an AVDECC message (about 1 byte out of 8 being a zero) */
+std::vector<std::uint8_t> makePayload(std::size_t const length)
+{
+	auto generator = std::mt19937{ 42u };
+	auto distribution = std::uniform_int_distribution<int>{ 0, 255 };
+	auto payload = std::vector<std::uint8_t>(length);
+	for (auto& b : payload)
+	{
+		b = (distribution(generator) < 32) ? 0u : static_cast<std::uint8_t>(distribution(generator));
+	}
+	return payload;
+}
+
+std::vector<std::uint8_t> encodePayload(std::vector<std::uint8_t> const& payload)
+{
+	auto encoded = std::vector<std::uint8_t>(payload.size() + COBS_BUFFER_PAD(payload.size()) + 1);
+	encoded.resize(la::avdecc::protocol::cobs::encode(payload.data(), payload.size(), encoded.data()));
+	return encoded;
+}
+} // namespace
+
+static void BM_CobsEncode(benchmark::State& state)
+{
+	auto const payload = makePayload(static_cast<std::size_t>(state.range(0)));
+	auto encoded = std::vector<std::uint8_t>(payload.size() + COBS_BUFFER_PAD(payload.size()) + 1);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(la::avdecc::protocol::cobs::encode(payload.data(), payload.size(), encoded.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_CobsEncode)->Arg(64)->Arg(512)->Arg(1500);
+
+static void BM_CobsDecode(benchmark::State& state)
+{
+	auto const encoded = encodePayload(makePayload(static_cast<std::size_t>(state.range(0))));
+	auto decoded = std::vector<std::uint8_t>(encoded.size());
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(la::avdecc::protocol::cobs::decode(encoded.data(), encoded.size(), decoded.data(), decoded.size()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_CobsDecode)->Arg(64)->Arg(512)->Arg(1500);
+
+static void BM_CobsDecodeInPlace(benchmark::State& state)
+{
+	auto const encoded = encodePayload(makePayload(static_cast<std::size_t>(state.range(0))));
+	auto buffer = encoded;
+
+	for (auto _ : state)
+	{
+		// Restoring the encoded data is part of the measure, as the serial interface would have to copy the received bytes anyway
+		std::copy(encoded.begin(), encoded.end(), buffer.begin());
+		benchmark::DoNotOptimize(la::avdecc::protocol::cobs::decodeInPlace(buffer.data(), buffer.size()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_CobsDecodeInPlace)->Arg(64)->Arg(512)->Arg(1500);
+
+static void BM_CobsFindDelimiter(benchmark::State& state)
+{
+	// Simulate a 16KiB serial read containing frames of the specified size
+	auto const encoded = encodePayload(makePayload(static_cast<std::size_t>(state.range(0))));
+	auto stream = std::vector<std::uint8_t>{};
+	while (stream.size() < 16u * 1024u)
+	{
+		stream.push_back(la::avdecc::protocol::cobs::DelimiterByte);
+		stream.insert(stream.end(), encoded.begin(), encoded.end());
+	}
+
+	for (auto _ : state)
+	{
+		auto frames = std::size_t{ 0u };
+		auto const* ptr = stream.data();
+		auto const* const end = stream.data() + stream.size();
+		while (ptr < end)
+		{
+			auto const* const delimiter = la::avdecc::protocol::cobs::findDelimiter(ptr, end);
+			frames += (delimiter != end);
+			ptr = (delimiter != end) ? delimiter + 1 : end;
+		}
+		benchmark::DoNotOptimize(frames);
+	}
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(stream.size()));
+}
+BENCHMARK(BM_CobsFindDelimiter)->Arg(64)->Arg(512)->Arg(1500);
@@ -0,0 +1,120 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file commandStateMachine_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost of an AEM command round trip through the CommandStateMachine: command sent, then its response dispatched and matched with the inflight command.
+*/
+
+#include "benchmarkProtocolInterface.hpp"
+
+// Internal API
+#include "protocol/protocolAemPayloads.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace
+{
+auto const RemoteMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x1b, 0x92, 0x00, 0x00, 0x01 } };
+auto const RemoteEntityIDBase = la::avdecc::UniqueIdentifier::value_type{ 0x001b92fffe000000 };
+/** The CommandStateMachine throttles commands sent to the same entity (1 msec), so commands are sent to enough different entities for each one to be idle when targeted again */
+constexpr auto RemoteEntitiesCount = std::uint32_t{ 4096u };
+/** Offset of the target_entity_id field in an AECPDU (stream_id field of the AVTP control header) */
+constexpr auto TargetEntityIDOffset = std::size_t{ 4u };
+/** Offset of the sequence_id field in an AECPDU (after the AVTP control header and the controller_entity_id) */
+constexpr auto SequenceIDOffset = la::avdecc::protocol::AvtpduControl::HeaderLength + sizeof(la::avdecc::UniqueIdentifier::value_type);
+
+void storeBigEndian(std::uint8_t* const dst, std::uint64_t const value, std::size_t const size) noexcept
+{
+	for (auto i = std::size_t{ 0u }; i < size; ++i)
+	{
+		dst[i] = static_cast<std::uint8_t>(value >> ((size - 1 - i) * 8));
+	}
+}
+
+la::avdecc::protocol::AemAecpdu::UniquePointer makeGetStreamInfoCommand(la::avdecc::UniqueIdentifier const targetEntityID)
+{
+	auto aemAecpdu = la::avdecc::protocol::AemAecpdu::create(false);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*aemAecpdu);
+	aem.setSrcAddress(BenchmarkProtocolInterface::LocalMacAddress);
+	aem.setDestAddress(RemoteMacAddress);
+	aem.setStatus(la::avdecc::protocol::AecpStatus::Success);
+	aem.setTargetEntityID(targetEntityID);
+	aem.setControllerEntityID(BenchmarkProtocolInterface::ControllerEntityID);
+	aem.setUnsolicited(false);
+	aem.setCommandType(la::avdecc::protocol::AemCommandType::GetStreamInfo);
+	auto const ser = la::avdecc::protocol::aemPayload::serializeGetStreamInfoCommand(la::avdecc::entity::model::DescriptorType::StreamInput, 0u);
+	aem.setCommandSpecificData(ser.data(), ser.size());
+	return aemAecpdu;
+}
+
+BenchmarkFrame makeGetStreamInfoResponseFrame()
+{
+	auto aemAecpdu = la::avdecc::protocol::AemAecpdu::create(true);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*aemAecpdu);
+	aem.setSrcAddress(RemoteMacAddress);
+	aem.setDestAddress(BenchmarkProtocolInterface::LocalMacAddress);
+	aem.setStatus(la::avdecc::protocol::AecpStatus::Success);
+	aem.setTargetEntityID(la::avdecc::UniqueIdentifier{ RemoteEntityIDBase });
+	aem.setControllerEntityID(BenchmarkProtocolInterface::ControllerEntityID);
+	aem.setUnsolicited(false);
+	aem.setCommandType(la::avdecc::protocol::AemCommandType::GetStreamInfo);
+	auto const ser = la::avdecc::protocol::aemPayload::serializeGetStreamInfoResponse(la::avdecc::entity::model::DescriptorType::StreamInput, 0u, la::avdecc::entity::model::StreamInfo{});
+	aem.setCommandSpecificData(ser.data(), ser.size());
+	return makeBenchmarkFrame(aem);
+}
+} // namespace
+
+static void BM_AemCommandRoundTrip(benchmark::State& state)
+{
+	auto environment = BenchmarkEnvironment{};
+	auto& pi = environment.getProtocolInterface();
+	auto& manager = pi.getStateMachineManager();
+	auto response = makeGetStreamInfoResponseFrame();
+	auto completedCount = std::int64_t{ 0 };
+	auto remoteEntityIndex = std::uint32_t{ 0u };
+	auto const onResult = la::avdecc::protocol::ProtocolInterface::AecpCommandResultHandler{ [&completedCount](la::avdecc::protocol::Aecpdu const* const aecpdu, la::avdecc::protocol::ProtocolInterface::Error const error)
+		{
+			if (aecpdu != nullptr && !error)
+			{
+				++completedCount;
+			}
+		} };
+
+	for (auto _ : state)
+	{
+		auto const targetEntityID = RemoteEntityIDBase + remoteEntityIndex;
+		remoteEntityIndex = (remoteEntityIndex + 1u) % RemoteEntitiesCount;
+		manager.sendAecpCommand(makeGetStreamInfoCommand(la::avdecc::UniqueIdentifier{ targetEntityID }), onResult);
+
+		// Answer from the targeted entity, with the SequenceID of the command just sent
+		storeBigEndian(response.avtpdu.data() + TargetEntityIDOffset, targetEntityID, sizeof(targetEntityID));
+		storeBigEndian(response.avtpdu.data() + SequenceIDOffset, pi.getLastSentAecpSequenceID(), sizeof(la::avdecc::protocol::AecpSequenceID));
+		pi.dispatchAvdeccMessage(response.avtpdu.data(), response.avtpdu.size(), response.etherLayer2);
+	}
+
+	if (completedCount != static_cast<std::int64_t>(state.iterations()))
+	{
+		state.SkipWithError("Some commands did not complete");
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_AemCommandRoundTrip);
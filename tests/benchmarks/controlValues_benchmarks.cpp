@@ -0,0 +1,102 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controlValues_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost (time and heap allocations) of decoding the dynamic values of a meter control (as received in an unsolicited SET_CONTROL) and of storing and reading them back.
+*/
+
+// Public API
+#include <la/avdecc/internals/entityModelControlValues.hpp>
+#include <la/avdecc/internals/entityModelControlValuesTraits.hpp>
+
+#include "allocationCounter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace
+{
+using MeterValues = la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueDynamic<std::int16_t>>;
+
+la::avdecc::MemoryBuffer makePackedMeterValues(std::uint16_t const count)
+{
+	auto packed = la::avdecc::MemoryBuffer{};
+	for (auto i = std::uint16_t{ 0u }; i < count; ++i)
+	{
+		auto const value = static_cast<std::uint16_t>(0xFF00u + i);
+		packed.append(static_cast<std::uint8_t>(value >> 8));
+		packed.append(static_cast<std::uint8_t>(value & 0xFFu));
+	}
+	return packed;
+}
+
+la::avdecc::entity::model::ControlValues makeMeterValues(std::uint16_t const count)
+{
+	auto values = MeterValues{};
+	for (auto i = std::uint16_t{ 0u }; i < count; ++i)
+	{
+		values.addValue({ static_cast<std::int16_t>(-100 + i) });
+	}
+	return la::avdecc::entity::model::ControlValues{ std::move(values) };
+}
+} // namespace
+
+/** Decoding of state.range(0) LINEAR_INT16 values */
+static void BM_UnpackMeterControlValues(benchmark::State& state)
+{
+	auto const count = static_cast<std::uint16_t>(state.range(0));
+	auto const packed = makePackedMeterValues(count);
+
+	auto const allocationsBefore = benchmarks::getAllocationsCount();
+	for (auto _ : state)
+	{
+		auto values = la::avdecc::entity::model::unpackDynamicControlValues(packed, la::avdecc::entity::model::ControlValueType::Type::ControlLinearInt16, count);
+		if (!values || !values->isValid())
+		{
+			state.SkipWithError("Failed to unpack control values");
+			break;
+		}
+		benchmark::DoNotOptimize(values);
+	}
+	state.counters["Allocations"] = benchmark::Counter(static_cast<double>(benchmarks::getAllocationsCount() - allocationsBefore), benchmark::Counter::kAvgIterations);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_UnpackMeterControlValues)->Arg(1)->Arg(16);
+
+/** Storing state.range(0) decoded LINEAR_INT16 values over the previous ones (as done in the controller model), then reading them back */
+static void BM_StoreMeterControlValues(benchmark::State& state)
+{
+	auto const count = static_cast<std::uint16_t>(state.range(0));
+	auto const received = makeMeterValues(count);
+	auto stored = makeMeterValues(count);
+
+	auto const allocationsBefore = benchmarks::getAllocationsCount();
+	for (auto _ : state)
+	{
+		stored = received;
+		auto const values = stored.getValues<MeterValues>();
+		benchmark::DoNotOptimize(values.getValues().data());
+	}
+	state.counters["Allocations"] = benchmark::Counter(static_cast<double>(benchmarks::getAllocationsCount() - allocationsBefore), benchmark::Counter::kAvgIterations);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_StoreMeterControlValues)->Arg(1)->Arg(16);
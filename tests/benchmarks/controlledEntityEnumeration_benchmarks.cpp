@@ -0,0 +1,119 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controlledEntityEnumeration_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost (time and heap allocations) of the bookkeeping done by a ControlledEntity while enumerating an entity with many streams.
+*/
+
+// Internal API
+#include "controller/avdeccControlledEntityImpl.hpp"
+
+#include "allocationCounter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+
+/** Simulates the enumeration of an entity with state.range(0) input and output streams (and as many input jacks): expected queries are registered, then each response is checked and stored in the model */
+static void BM_ControlledEntityEnumeration(benchmark::State& state)
+{
+	using ControlledEntityImpl = la::avdecc::controller::ControlledEntityImpl;
+	namespace model = la::avdecc::entity::model;
+
+	auto const streamsCount = static_cast<std::uint16_t>(state.range(0));
+	auto commonInfo = la::avdecc::entity::Entity::CommonInformation{};
+	commonInfo.entityID = la::avdecc::UniqueIdentifier{ 0x0001020304050607 };
+	commonInfo.entityCapabilities = la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported };
+	auto const entity = la::avdecc::entity::Entity{ commonInfo, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, la::avdecc::entity::Entity::InterfaceInformation{} } } };
+	auto const lockInfo = std::make_shared<ControlledEntityImpl::LockInformation>();
+	auto const configurationIndex = model::ConfigurationIndex{ 0u };
+
+	auto const entityDescriptor = model::EntityDescriptor{};
+	auto const configurationDescriptor = model::ConfigurationDescriptor{};
+	auto streamDescriptor = model::StreamDescriptor{};
+	for (auto i = 0u; i < 8u; ++i)
+	{
+		streamDescriptor.formats.insert(model::StreamFormat{ 0x0205022000406000 + i });
+	}
+	auto const jackDescriptor = model::JackDescriptor{};
+
+	auto allocations = std::uint64_t{ 0u };
+	for (auto _ : state)
+	{
+		auto const allocationsBefore = benchmarks::getAllocationsCount();
+		{
+			auto controlledEntity = ControlledEntityImpl{ entity, lockInfo, false };
+			lockInfo->lock();
+
+			controlledEntity.setEntityDescriptor(entityDescriptor);
+			controlledEntity.setConfigurationDescriptor(configurationDescriptor, configurationIndex);
+
+			// Register all the queries sent to the entity
+			for (auto index = model::DescriptorIndex{ 0u }; index < streamsCount; ++index)
+			{
+				controlledEntity.setDescriptorExpected(configurationIndex, model::DescriptorType::StreamInput, index);
+				controlledEntity.setDescriptorExpected(configurationIndex, model::DescriptorType::StreamOutput, index);
+				controlledEntity.setDescriptorExpected(configurationIndex, model::DescriptorType::JackInput, index);
+				controlledEntity.setDynamicInfoExpected(configurationIndex, ControlledEntityImpl::DynamicInfoType::InputStreamState, index);
+				controlledEntity.setDynamicInfoExpected(configurationIndex, ControlledEntityImpl::DynamicInfoType::InputStreamInfo, index);
+				controlledEntity.setDynamicInfoExpected(configurationIndex, ControlledEntityImpl::DynamicInfoType::OutputStreamState, index);
+				controlledEntity.setDynamicInfoExpected(configurationIndex, ControlledEntityImpl::DynamicInfoType::OutputStreamInfo, index);
+				controlledEntity.setDescriptorDynamicInfoExpected(configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::InputStreamName, index);
+				controlledEntity.setDescriptorDynamicInfoExpected(configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::OutputStreamName, index);
+			}
+
+			// Process all the responses
+			for (auto index = model::DescriptorIndex{ 0u }; index < streamsCount; ++index)
+			{
+				if (controlledEntity.checkAndClearExpectedDescriptor(configurationIndex, model::DescriptorType::StreamInput, index))
+				{
+					controlledEntity.setStreamInputDescriptor(streamDescriptor, configurationIndex, index);
+				}
+				if (controlledEntity.checkAndClearExpectedDescriptor(configurationIndex, model::DescriptorType::StreamOutput, index))
+				{
+					controlledEntity.setStreamOutputDescriptor(streamDescriptor, configurationIndex, index);
+				}
+				if (controlledEntity.checkAndClearExpectedDescriptor(configurationIndex, model::DescriptorType::JackInput, index))
+				{
+					controlledEntity.setJackInputDescriptor(jackDescriptor, configurationIndex, index);
+				}
+				controlledEntity.checkAndClearExpectedDynamicInfo(configurationIndex, ControlledEntityImpl::DynamicInfoType::InputStreamState, index);
+				controlledEntity.checkAndClearExpectedDynamicInfo(configurationIndex, ControlledEntityImpl::DynamicInfoType::InputStreamInfo, index);
+				controlledEntity.checkAndClearExpectedDynamicInfo(configurationIndex, ControlledEntityImpl::DynamicInfoType::OutputStreamState, index);
+				controlledEntity.checkAndClearExpectedDynamicInfo(configurationIndex, ControlledEntityImpl::DynamicInfoType::OutputStreamInfo, index);
+				controlledEntity.checkAndClearExpectedDescriptorDynamicInfo(configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::InputStreamName, index);
+				controlledEntity.checkAndClearExpectedDescriptorDynamicInfo(configurationIndex, ControlledEntityImpl::DescriptorDynamicInfoType::OutputStreamName, index);
+			}
+
+			if (!controlledEntity.gotAllExpectedDescriptors() || !controlledEntity.gotAllExpectedDynamicInfo() || !controlledEntity.gotAllExpectedDescriptorDynamicInfo())
+			{
+				state.SkipWithError("Some expected queries were not cleared");
+			}
+
+			lockInfo->unlock();
+		}
+		allocations += benchmarks::getAllocationsCount() - allocationsBefore;
+	}
+	state.counters["Allocations"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * streamsCount);
+}
+BENCHMARK(BM_ControlledEntityEnumeration)->Arg(8)->Arg(64)->Arg(256);
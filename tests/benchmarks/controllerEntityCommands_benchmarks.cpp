@@ -0,0 +1,128 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controllerEntityCommands_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost (time and heap allocations) of a command sent through the ControllerEntity API, from the call to the result handler being invoked.
+*/
+
+#include "benchmarkProtocolInterface.hpp"
+#include "allocationCounter.hpp"
+
+// Internal API
+#include "protocol/protocolAemPayloads.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace
+{
+auto const RemoteMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x1b, 0x92, 0x00, 0x00, 0x01 } };
+auto const RemoteEntityIDBase = la::avdecc::UniqueIdentifier::value_type{ 0x001b92fffe000000 };
+/** The CommandStateMachine throttles commands sent to the same entity (1 msec), so commands are sent to enough different entities for each one to be idle when targeted again */
+constexpr auto RemoteEntitiesCount = std::uint32_t{ 4096u };
+/** Offset of the target_entity_id field in an AECPDU (stream_id field of the AVTP control header) */
+constexpr auto TargetEntityIDOffset = std::size_t{ 4u };
+/** Offset of the sequence_id field in an AECPDU (after the AVTP control header and the controller_entity_id) */
+constexpr auto SequenceIDOffset = la::avdecc::protocol::AvtpduControl::HeaderLength + sizeof(la::avdecc::UniqueIdentifier::value_type);
+
+void storeBigEndian(std::uint8_t* const dst, std::uint64_t const value, std::size_t const size) noexcept
+{
+	for (auto i = std::size_t{ 0u }; i < size; ++i)
+	{
+		dst[i] = static_cast<std::uint8_t>(value >> ((size - 1 - i) * 8));
+	}
+}
+
+/** Declares the remote entities to the ControllerEntity, which refuses to send commands to unknown entities */
+void declareRemoteEntities(BenchmarkProtocolInterface& pi)
+{
+	auto commonInfo = la::avdecc::entity::Entity::CommonInformation{};
+	commonInfo.entityCapabilities = la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported };
+	auto const interfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ RemoteMacAddress, 31u, 0u, std::nullopt, std::nullopt };
+
+	for (auto index = std::uint32_t{ 0u }; index < RemoteEntitiesCount; ++index)
+	{
+		commonInfo.entityID = la::avdecc::UniqueIdentifier{ RemoteEntityIDBase + index };
+		pi.notifyRemoteEntityOnline(la::avdecc::entity::Entity{ commonInfo, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, interfaceInfo } } });
+	}
+}
+
+BenchmarkFrame makeGetStreamInfoResponseFrame()
+{
+	auto aemAecpdu = la::avdecc::protocol::AemAecpdu::create(true);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*aemAecpdu);
+	aem.setSrcAddress(RemoteMacAddress);
+	aem.setDestAddress(BenchmarkProtocolInterface::LocalMacAddress);
+	aem.setStatus(la::avdecc::protocol::AecpStatus::Success);
+	aem.setTargetEntityID(la::avdecc::UniqueIdentifier{ RemoteEntityIDBase });
+	aem.setControllerEntityID(BenchmarkProtocolInterface::ControllerEntityID);
+	aem.setUnsolicited(false);
+	aem.setCommandType(la::avdecc::protocol::AemCommandType::GetStreamInfo);
+	auto const ser = la::avdecc::protocol::aemPayload::serializeGetStreamInfoResponse(la::avdecc::entity::model::DescriptorType::StreamInput, 0u, la::avdecc::entity::model::StreamInfo{});
+	aem.setCommandSpecificData(ser.data(), ser.size());
+	return makeBenchmarkFrame(aem);
+}
+} // namespace
+
+/** GET_STREAM_INFO sent with ControllerEntity::getStreamInputInfo, then its response dispatched up to the result handler */
+static void BM_ControllerEntityCommand(benchmark::State& state)
+{
+	auto environment = BenchmarkEnvironment{};
+	auto& pi = environment.getProtocolInterface();
+	auto& controller = environment.getController();
+	declareRemoteEntities(pi);
+
+	auto response = makeGetStreamInfoResponseFrame();
+	auto completedCount = std::int64_t{ 0 };
+	auto remoteEntityIndex = std::uint32_t{ 0u };
+	auto const handler = la::avdecc::entity::controller::Interface::GetStreamInputInfoHandler{ [&completedCount](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::StreamIndex const /*streamIndex*/, la::avdecc::entity::model::StreamInfo const& /*info*/)
+		{
+			if (!!status)
+			{
+				++completedCount;
+			}
+		} };
+
+	auto allocations = std::uint64_t{ 0u };
+	for (auto _ : state)
+	{
+		auto const allocationsBefore = benchmarks::getAllocationsCount();
+
+		auto const targetEntityID = RemoteEntityIDBase + remoteEntityIndex;
+		remoteEntityIndex = (remoteEntityIndex + 1u) % RemoteEntitiesCount;
+		controller.getStreamInputInfo(la::avdecc::UniqueIdentifier{ targetEntityID }, 0u, handler);
+
+		// Answer from the targeted entity, with the SequenceID of the command just sent
+		storeBigEndian(response.avtpdu.data() + TargetEntityIDOffset, targetEntityID, sizeof(targetEntityID));
+		storeBigEndian(response.avtpdu.data() + SequenceIDOffset, pi.getLastSentAecpSequenceID(), sizeof(la::avdecc::protocol::AecpSequenceID));
+		pi.dispatchAvdeccMessage(response.avtpdu.data(), response.avtpdu.size(), response.etherLayer2);
+
+		allocations += benchmarks::getAllocationsCount() - allocationsBefore;
+	}
+
+	if (completedCount != static_cast<std::int64_t>(state.iterations()))
+	{
+		state.SkipWithError("Some commands did not complete");
+	}
+	state.counters["Allocations"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ControllerEntityCommand);
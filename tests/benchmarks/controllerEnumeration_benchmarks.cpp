@@ -0,0 +1,169 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controllerEnumeration_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Time for a Controller to enumerate many entities coming online at once on a virtual network, depending on the maximum count of concurrent enumerations.
+*/
+
+// Public API
+#include <la/avdecc/executor.hpp>
+#include <la/avdecc/controller/avdeccController.hpp>
+
+// Internal API
+#include "entity/controllerEntityImpl.hpp"
+#include "protocolInterface/protocolInterface_virtual.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace
+{
+auto constexpr ExecutorName = "avdecc::protocol::PI";
+auto constexpr NetworkInterfaceID = "BenchmarkEnumeration";
+auto const EntitiesMacAddress = la::networkInterface::MacAddress{ { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 } };
+auto constexpr EntityIDBase = la::avdecc::UniqueIdentifier::value_type{ 0x001b92fffe000000 };
+auto constexpr EntityModelID = la::avdecc::UniqueIdentifier{ 0x001b920000000001 };
+auto constexpr EnumerationTimeout = std::chrono::seconds{ 60 };
+
+using EntityGuard = la::avdecc::entity::LocalEntityGuard<la::avdecc::entity::ControllerEntityImpl>;
+
+/** Records the time each entity is advertised by the Controller (fully enumerated) */
+class EnumerationObserver final : public la::avdecc::controller::Controller::DefaultedObserver
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	explicit EnumerationObserver(std::size_t const expectedCount) noexcept
+		: _expectedCount{ expectedCount }
+	{
+	}
+
+	/** Waits for all entities to be advertised, returning the time to the first one and the time to the last one (in seconds) */
+	std::optional<std::pair<double, double>> waitForAll(Clock::time_point const startTime) noexcept
+	{
+		auto lock = std::unique_lock{ _lock };
+		if (!_allEnumerated.wait_for(lock, EnumerationTimeout,
+					[this]
+					{
+						return _onlineTimes.size() == _expectedCount;
+					}))
+		{
+			return std::nullopt;
+		}
+		return std::make_pair(std::chrono::duration<double>(_onlineTimes.front() - startTime).count(), std::chrono::duration<double>(_onlineTimes.back() - startTime).count());
+	}
+
+private:
+	virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const /*entity*/) noexcept override
+	{
+		auto const lg = std::lock_guard{ _lock };
+		_onlineTimes.push_back(Clock::now());
+		if (_onlineTimes.size() == _expectedCount)
+		{
+			_allEnumerated.notify_all();
+		}
+	}
+
+	std::size_t const _expectedCount{ 0u };
+	std::mutex _lock{};
+	std::condition_variable _allEnumerated{};
+	std::vector<Clock::time_point> _onlineTimes{};
+	DECLARE_AVDECC_OBSERVER_GUARD(EnumerationObserver);
+};
+
+la::avdecc::entity::model::EntityTree makeEntityTree()
+{
+	namespace model = la::avdecc::entity::model;
+
+	auto entityTree = model::EntityTree{};
+	entityTree.dynamicModel.entityName = model::AvdeccFixedString{ "Enumerated Entity" };
+	auto& configTree = entityTree.configurationTrees[model::ConfigurationIndex{ 0u }];
+	configTree.audioUnitTrees[model::AudioUnitIndex{ 0u }].dynamicModel.currentSamplingRate = model::SamplingRate{ 0, 48000 };
+	for (auto streamIndex = model::StreamIndex{ 0u }; streamIndex < 2u; ++streamIndex)
+	{
+		configTree.streamInputModels[streamIndex].dynamicModel.streamFormat = model::StreamFormat{ 0x00A0020140000100u };
+		configTree.streamOutputModels[streamIndex].dynamicModel.streamFormat = model::StreamFormat{ 0x00A0020140000100u };
+	}
+	return entityTree;
+}
+} // namespace
+
+/** state.range(0) entities exposing an EntityModel come online at once, the Controller enumerating at most state.range(1) of them at the same time (0 for no limit). Reports the time for the first and for all entities to be enumerated. */
+static void BM_ControllerEnumeration(benchmark::State& state)
+{
+	auto const entitiesCount = static_cast<std::size_t>(state.range(0));
+	auto const maximumConcurrentEnumerations = static_cast<std::size_t>(state.range(1));
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(ExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(ExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto const entityTree = makeEntityTree();
+
+	auto timeToFirst = 0.0;
+	auto timeToAll = 0.0;
+	for (auto _ : state)
+	{
+		auto controller = la::avdecc::controller::Controller::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, NetworkInterfaceID, 0x0001, la::avdecc::UniqueIdentifier{}, "en", nullptr, std::string{ ExecutorName }, nullptr);
+		controller->setMaximumConcurrentEnumerations(maximumConcurrentEnumerations);
+		auto observer = EnumerationObserver{ entitiesCount };
+		controller->registerObserver(&observer);
+
+		// All entities share the same ProtocolInterface (AECP messages are dispatched to the targeted entity)
+		auto protocolInterface = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>{ la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual(NetworkInterfaceID, EntitiesMacAddress, ExecutorName) };
+		auto entities = std::vector<std::unique_ptr<EntityGuard>>{};
+		entities.reserve(entitiesCount);
+		for (auto index = std::size_t{ 0u }; index < entitiesCount; ++index)
+		{
+			auto const commonInformation = la::avdecc::entity::Entity::CommonInformation{ la::avdecc::UniqueIdentifier{ EntityIDBase + index }, EntityModelID, la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported }, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+			auto const interfaceInformation = la::avdecc::entity::Entity::InterfaceInformation{ EntitiesMacAddress, 31u, 0u, std::nullopt, std::nullopt };
+			entities.push_back(std::make_unique<EntityGuard>(protocolInterface.get(), commonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, interfaceInformation } }, &entityTree, nullptr));
+		}
+
+		// All entities come online at once
+		auto const startTime = EnumerationObserver::Clock::now();
+		for (auto& entity : entities)
+		{
+			static_cast<la::avdecc::entity::ControllerEntity&>(*entity).enableEntityAdvertising(10);
+		}
+
+		auto const times = observer.waitForAll(startTime);
+		if (!times)
+		{
+			state.SkipWithError("Not all entities were enumerated");
+			break;
+		}
+		timeToFirst += times->first;
+		timeToAll += times->second;
+		state.SetIterationTime(times->second);
+
+		controller.reset();
+		entities.clear();
+		protocolInterface.reset();
+	}
+	state.counters["TimeToFirst"] = benchmark::Counter(timeToFirst, benchmark::Counter::kAvgIterations);
+	state.counters["TimeToAll"] = benchmark::Counter(timeToAll, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ControllerEnumeration)->ArgsProduct({ { 64 }, { 0, 8, 16 } })->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(1);
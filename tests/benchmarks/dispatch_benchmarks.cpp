@@ -0,0 +1,123 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file dispatch_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost of dispatching a response to its handler: std::unordered_map of std::function (previous implementation) vs utils::DispatchTable.
+*/
+
+// Public API
+#include <la/avdecc/utils.hpp>
+#include <la/avdecc/internals/protocolDefines.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/** Count of AEM command types handled by the controller response dispatcher (ACQUIRE_ENTITY up to GET_MAX_TRANSIT_TIME) */
+constexpr auto HandledCommandTypesCount = std::size_t{ 0x4e };
+constexpr auto TableSize = std::size_t{ 0x80 };
+
+using HandlerSignature = void(std::uint64_t& accumulator, std::uint16_t const commandType);
+
+template<std::size_t Index>
+void handler(std::uint64_t& accumulator, std::uint16_t const commandType)
+{
+	accumulator += Index ^ commandType;
+}
+
+template<std::size_t... Indexes>
+auto makeUnorderedMap(std::index_sequence<Indexes...>)
+{
+	return std::unordered_map<la::avdecc::protocol::AemCommandType::value_type, std::function<HandlerSignature>>{ { static_cast<la::avdecc::protocol::AemCommandType::value_type>(Indexes), [](std::uint64_t& accumulator, std::uint16_t const commandType)
+		{
+			handler<Indexes>(accumulator, commandType);
+		} }... };
+}
+
+template<std::size_t... Indexes>
+auto makeDispatchTable(std::index_sequence<Indexes...>)
+{
+	return la::avdecc::utils::DispatchTable<HandlerSignature, TableSize>{ { Indexes, &handler<Indexes> }... };
+}
+
+/** Builds a sequence of received responses, mostly handled command types with a few unknown ones */
+std::vector<std::uint16_t> makeResponses()
+{
+	auto generator = std::mt19937{ 42u };
+	auto distribution = std::uniform_int_distribution<std::uint16_t>{ 0u, static_cast<std::uint16_t>(HandledCommandTypesCount + 2u) };
+	auto responses = std::vector<std::uint16_t>(1024);
+	for (auto& r : responses)
+	{
+		r = distribution(generator);
+	}
+	return responses;
+}
+} // namespace
+
+static void BM_DispatchUnorderedMap(benchmark::State& state)
+{
+	static auto const s_Dispatch = makeUnorderedMap(std::make_index_sequence<HandledCommandTypesCount>{});
+	auto const responses = makeResponses();
+	auto accumulator = std::uint64_t{ 0u };
+
+	for (auto _ : state)
+	{
+		for (auto const commandType : responses)
+		{
+			auto const& it = s_Dispatch.find(commandType);
+			if (it != s_Dispatch.end())
+			{
+				it->second(accumulator, commandType);
+			}
+		}
+		benchmark::DoNotOptimize(accumulator);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(responses.size()));
+}
+BENCHMARK(BM_DispatchUnorderedMap);
+
+static void BM_DispatchTable(benchmark::State& state)
+{
+	static auto const s_Dispatch = makeDispatchTable(std::make_index_sequence<HandledCommandTypesCount>{});
+	auto const responses = makeResponses();
+	auto accumulator = std::uint64_t{ 0u };
+
+	for (auto _ : state)
+	{
+		for (auto const commandType : responses)
+		{
+			auto const dispatchHandler = s_Dispatch.find(commandType);
+			if (dispatchHandler != nullptr)
+			{
+				dispatchHandler(accumulator, commandType);
+			}
+		}
+		benchmark::DoNotOptimize(accumulator);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(responses.size()));
+}
+BENCHMARK(BM_DispatchTable);
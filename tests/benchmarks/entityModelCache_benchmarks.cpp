@@ -0,0 +1,108 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file entityModelCache_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Memory used by a network of identical entities adopting the same cached EntityModel.
+*/
+
+#ifdef ENABLE_AVDECC_FEATURE_JSON
+
+// Public API
+#include <la/avdecc/controller/avdeccController.hpp>
+
+// Internal API
+#include "controller/avdeccControlledEntityImpl.hpp"
+#include "controller/avdeccEntityModelCache.hpp"
+
+#include "allocationCounter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/** Simulates state.range(0) entities getting their model from the cache (ChannelConnection device), and reports the heap memory held by the whole network. When state.range(1) is set, each entity also keeps its EntityTree (as validation used to do) */
+static void BM_CachedEntityModelMemory(benchmark::State& state)
+{
+	using ControlledEntityImpl = la::avdecc::controller::ControlledEntityImpl;
+	namespace model = la::avdecc::entity::model;
+
+	auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan };
+	auto const [error, msg, controlledEntity] = la::avdecc::controller::Controller::deserializeControlledEntityFromJson("data/ChannelConnection/Entity_0x01.json", flags);
+	if (!!error || !controlledEntity)
+	{
+		state.SkipWithError(("Failed to load data/ChannelConnection/Entity_0x01.json: " + msg).c_str());
+		return;
+	}
+	auto const entitiesCount = static_cast<std::size_t>(state.range(0));
+	auto const keepEntityTree = state.range(1) != 0;
+	auto const lockInfo = std::make_shared<ControlledEntityImpl::LockInformation>();
+
+	// Shared cached model
+	auto const cachedModel = la::avdecc::controller::EntityModelCache::SharedEntityNode{ std::make_shared<la::avdecc::controller::model::EntityNode const>(controlledEntity->getEntityNode()) };
+	auto entityDescriptor = model::EntityDescriptor{};
+	entityDescriptor.vendorNameString = cachedModel->staticModel.vendorNameString;
+	entityDescriptor.modelNameString = cachedModel->staticModel.modelNameString;
+	entityDescriptor.configurationsCount = static_cast<std::uint16_t>(cachedModel->configurations.size());
+	entityDescriptor.currentConfiguration = cachedModel->dynamicModel.currentConfiguration;
+
+	auto bytesPerEntity = std::uint64_t{ 0u };
+	for (auto _ : state)
+	{
+		auto entities = std::vector<std::unique_ptr<ControlledEntityImpl>>{};
+		entities.reserve(entitiesCount);
+
+		auto const bytesBefore = benchmarks::getAllocatedBytes();
+		for (auto entityIndex = 0u; entityIndex < entitiesCount; ++entityIndex)
+		{
+			auto commonInfo = la::avdecc::entity::Entity::CommonInformation{};
+			commonInfo.entityID = la::avdecc::UniqueIdentifier{ std::uint64_t{ 0x0001020300000000 } + entityIndex };
+			commonInfo.entityCapabilities = la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported };
+			auto const entity = la::avdecc::entity::Entity{ commonInfo, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, la::avdecc::entity::Entity::InterfaceInformation{} } } };
+
+			auto& entityImpl = *entities.emplace_back(std::make_unique<ControlledEntityImpl>(entity, lockInfo, false));
+			lockInfo->lock();
+			if (!entityImpl.setCachedEntityNode(*cachedModel, entityDescriptor, true))
+			{
+				lockInfo->unlock();
+				state.SkipWithError("Cached EntityModel not accepted");
+				return;
+			}
+			// Entity model validation
+			if (keepEntityTree)
+			{
+				benchmark::DoNotOptimize(entityImpl.getEntityModelTree());
+			}
+			else
+			{
+				benchmark::DoNotOptimize(entityImpl.buildEntityModelTree());
+			}
+			lockInfo->unlock();
+		}
+		bytesPerEntity += (benchmarks::getAllocatedBytes() - bytesBefore) / entitiesCount;
+	}
+	state.counters["BytesPerEntity"] = benchmark::Counter(static_cast<double>(bytesPerEntity), benchmark::Counter::kAvgIterations);
+	state.counters["NetworkBytes"] = benchmark::Counter(static_cast<double>(bytesPerEntity * entitiesCount), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_CachedEntityModelMemory)->Args({ 200, 0 })->Args({ 200, 1 })->Unit(benchmark::kMillisecond);
+
+#endif // ENABLE_AVDECC_FEATURE_JSON
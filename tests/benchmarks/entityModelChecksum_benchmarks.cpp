@@ -0,0 +1,60 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file entityModelChecksum_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost of computing the entity model checksum of a TalkerListener dump, for each checksum version.
+*/
+
+#ifdef ENABLE_AVDECC_FEATURE_JSON
+
+// Public API
+#include <la/avdecc/controller/avdeccController.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+static void BM_ComputeEntityModelChecksum(benchmark::State& state)
+{
+	auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan };
+	auto const [error, msg, controlledEntity] = la::avdecc::controller::Controller::deserializeControlledEntityFromJson("data/TalkerListener.json", flags);
+	if (!!error || !controlledEntity)
+	{
+		state.SkipWithError(("Failed to load data/TalkerListener.json: " + msg).c_str());
+		return;
+	}
+	auto const checksumVersion = static_cast<std::uint32_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		auto checksum = la::avdecc::controller::Controller::computeEntityModelChecksum(*controlledEntity, checksumVersion);
+		if (!checksum)
+		{
+			state.SkipWithError("Entity model not valid for checksum");
+			break;
+		}
+		benchmark::DoNotOptimize(checksum);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ComputeEntityModelChecksum)->DenseRange(1, la::avdecc::controller::Controller::ChecksumVersion);
+
+#endif // ENABLE_AVDECC_FEATURE_JSON
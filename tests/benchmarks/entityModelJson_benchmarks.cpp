@@ -0,0 +1,131 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file entityModelJson_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost of the EntityTree JSON serializer, in both directions, on the entity model of a TalkerListener dump.
+*/
+
+#ifdef ENABLE_AVDECC_FEATURE_JSON
+
+// Public API
+#include <la/avdecc/internals/jsonSerialization.hpp>
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace
+{
+auto const Flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel };
+
+/** Loads the "entity_model" node of a controlled entity dump (data folder copied next to the Benchmarks binary) */
+nlohmann::json loadEntityModelObject()
+{
+	auto ifs = std::ifstream{ "data/TalkerListener.json" };
+	if (!ifs.is_open())
+	{
+		return {};
+	}
+	auto const object = nlohmann::json::parse(ifs);
+	return object.at("entity_model");
+}
+} // namespace
+
+static void BM_EntityTreeToJson(benchmark::State& state)
+{
+	auto const object = loadEntityModelObject();
+	if (object.is_null())
+	{
+		state.SkipWithError("Failed to load data/TalkerListener.json");
+		return;
+	}
+	auto const entityTree = la::avdecc::entity::model::jsonSerializer::createEntityTree(object, Flags);
+
+	for (auto _ : state)
+	{
+		auto json = la::avdecc::entity::model::jsonSerializer::createJsonObject(entityTree, Flags);
+		benchmark::DoNotOptimize(json);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_EntityTreeToJson);
+
+static void BM_JsonToEntityTree(benchmark::State& state)
+{
+	auto const object = loadEntityModelObject();
+	if (object.is_null())
+	{
+		state.SkipWithError("Failed to load data/TalkerListener.json");
+		return;
+	}
+
+	for (auto _ : state)
+	{
+		auto entityTree = la::avdecc::entity::model::jsonSerializer::createEntityTree(object, Flags);
+		benchmark::DoNotOptimize(entityTree);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_JsonToEntityTree);
+
+static void BM_EntityTreeJsonDump(benchmark::State& state)
+{
+	auto const object = loadEntityModelObject();
+	if (object.is_null())
+	{
+		state.SkipWithError("Failed to load data/TalkerListener.json");
+		return;
+	}
+	auto const entityTree = la::avdecc::entity::model::jsonSerializer::createEntityTree(object, Flags);
+	auto bytes = std::int64_t{ 0 };
+
+	for (auto _ : state)
+	{
+		auto const text = la::avdecc::entity::model::jsonSerializer::createJsonObject(entityTree, Flags).dump();
+		bytes += static_cast<std::int64_t>(text.size());
+	}
+	state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_EntityTreeJsonDump);
+
+static void BM_EntityTreeJsonParse(benchmark::State& state)
+{
+	auto const object = loadEntityModelObject();
+	if (object.is_null())
+	{
+		state.SkipWithError("Failed to load data/TalkerListener.json");
+		return;
+	}
+	auto const text = object.dump();
+
+	for (auto _ : state)
+	{
+		auto entityTree = la::avdecc::entity::model::jsonSerializer::createEntityTree(nlohmann::json::parse(text), Flags);
+		benchmark::DoNotOptimize(entityTree);
+	}
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(BM_EntityTreeJsonParse);
+
+#endif // ENABLE_AVDECC_FEATURE_JSON
@@ -0,0 +1,122 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file ethernetPacketDispatch_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Cost of dispatching received AVTPDUs (deserialization and state machines processing) through the EthernetPacketDispatcher.
+*/
+
+#include "benchmarkProtocolInterface.hpp"
+
+// Internal API
+#include "protocol/protocolAemPayloads.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace
+{
+auto const RemoteMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x1b, 0x92, 0x00, 0x00, 0x01 } };
+auto const RemoteEntityID = la::avdecc::UniqueIdentifier{ 0x001b92fffe000001 };
+
+BenchmarkFrame makeEntityAvailableFrame()
+{
+	auto adpdu = la::avdecc::protocol::Adpdu::create();
+	auto& adp = static_cast<la::avdecc::protocol::Adpdu&>(*adpdu);
+	adp.setSrcAddress(RemoteMacAddress);
+	adp.setMessageType(la::avdecc::protocol::AdpMessageType::EntityAvailable);
+	adp.setValidTime(31u);
+	adp.setEntityID(RemoteEntityID);
+	adp.setEntityModelID(la::avdecc::UniqueIdentifier{ 0x001b92fffe000000 });
+	adp.setEntityCapabilities(la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported, la::avdecc::entity::EntityCapability::ClassASupported, la::avdecc::entity::EntityCapability::GptpSupported });
+	adp.setTalkerStreamSources(8u);
+	adp.setTalkerCapabilities(la::avdecc::entity::TalkerCapabilities{ la::avdecc::entity::TalkerCapability::Implemented, la::avdecc::entity::TalkerCapability::AudioSource });
+	adp.setListenerStreamSinks(8u);
+	adp.setListenerCapabilities(la::avdecc::entity::ListenerCapabilities{ la::avdecc::entity::ListenerCapability::Implemented, la::avdecc::entity::ListenerCapability::AudioSink });
+	adp.setAvailableIndex(1u);
+	adp.setGptpGrandmasterID(la::avdecc::UniqueIdentifier{ 0x001b92fffe0000ff });
+	adp.setInterfaceIndex(0u);
+	return makeBenchmarkFrame(adp);
+}
+
+BenchmarkFrame makeUnsolicitedGetStreamInfoFrame()
+{
+	auto aemAecpdu = la::avdecc::protocol::AemAecpdu::create(true);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*aemAecpdu);
+	aem.setSrcAddress(RemoteMacAddress);
+	aem.setDestAddress(BenchmarkProtocolInterface::LocalMacAddress);
+	aem.setStatus(la::avdecc::protocol::AecpStatus::Success);
+	aem.setTargetEntityID(RemoteEntityID);
+	aem.setControllerEntityID(BenchmarkProtocolInterface::ControllerEntityID);
+	aem.setSequenceID(1u);
+	aem.setUnsolicited(true);
+	aem.setCommandType(la::avdecc::protocol::AemCommandType::GetStreamInfo);
+	auto const ser = la::avdecc::protocol::aemPayload::serializeGetStreamInfoResponse(la::avdecc::entity::model::DescriptorType::StreamInput, 0u, la::avdecc::entity::model::StreamInfo{});
+	aem.setCommandSpecificData(ser.data(), ser.size());
+	return makeBenchmarkFrame(aem);
+}
+
+BenchmarkFrame makeGetRxStateResponseFrame()
+{
+	auto acmpdu = la::avdecc::protocol::Acmpdu::create();
+	auto& acmp = static_cast<la::avdecc::protocol::Acmpdu&>(*acmpdu);
+	acmp.setSrcAddress(RemoteMacAddress);
+	acmp.setMessageType(la::avdecc::protocol::AcmpMessageType::GetRxStateResponse);
+	acmp.setStatus(la::avdecc::protocol::AcmpStatus::Success);
+	acmp.setControllerEntityID(BenchmarkProtocolInterface::ControllerEntityID);
+	acmp.setTalkerEntityID(la::avdecc::UniqueIdentifier{ 0x001b92fffe000002 });
+	acmp.setListenerEntityID(RemoteEntityID);
+	acmp.setTalkerUniqueID(0u);
+	acmp.setListenerUniqueID(0u);
+	acmp.setConnectionCount(1u);
+	acmp.setSequenceID(1u);
+	return makeBenchmarkFrame(acmp);
+}
+
+void runDispatchBenchmark(benchmark::State& state, BenchmarkFrame const& frame)
+{
+	auto environment = BenchmarkEnvironment{};
+	auto const& pi = environment.getProtocolInterface();
+
+	for (auto _ : state)
+	{
+		pi.dispatchAvdeccMessage(frame.avtpdu.data(), frame.avtpdu.size(), frame.etherLayer2);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+} // namespace
+
+static void BM_DispatchAdpEntityAvailable(benchmark::State& state)
+{
+	runDispatchBenchmark(state, makeEntityAvailableFrame());
+}
+BENCHMARK(BM_DispatchAdpEntityAvailable);
+
+static void BM_DispatchAemUnsolicitedResponse(benchmark::State& state)
+{
+	runDispatchBenchmark(state, makeUnsolicitedGetStreamInfoFrame());
+}
+BENCHMARK(BM_DispatchAemUnsolicitedResponse);
+
+static void BM_DispatchAcmpResponse(benchmark::State& state)
+{
+	runDispatchBenchmark(state, makeGetRxStateResponseFrame());
+}
+BENCHMARK(BM_DispatchAcmpResponse);
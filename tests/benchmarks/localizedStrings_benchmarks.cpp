@@ -0,0 +1,97 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file localizedStrings_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Memory used by the strings of a network of identical entities (STRINGS descriptors and aggregated localized strings).
+*/
+
+// Internal API
+#include "controller/avdeccControlledEntityImpl.hpp"
+
+#include "allocationCounter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Simulates the enumeration of the localized strings of state.range(0) entities sharing the same model (16 STRINGS descriptors each), and reports the heap memory held by the whole network */
+static void BM_LocalizedStringsMemory(benchmark::State& state)
+{
+	using ControlledEntityImpl = la::avdecc::controller::ControlledEntityImpl;
+	namespace model = la::avdecc::entity::model;
+
+	auto constexpr StringsDescriptorsCount = std::uint16_t{ 16u };
+	auto const entitiesCount = static_cast<std::size_t>(state.range(0));
+	auto const lockInfo = std::make_shared<ControlledEntityImpl::LockInformation>();
+	auto const configurationIndex = model::ConfigurationIndex{ 0u };
+
+	auto const entityDescriptor = model::EntityDescriptor{};
+	auto configurationDescriptor = model::ConfigurationDescriptor{};
+	configurationDescriptor.descriptorCounts[model::DescriptorType::Locale] = 1u;
+	configurationDescriptor.descriptorCounts[model::DescriptorType::Strings] = StringsDescriptorsCount;
+	auto localeDescriptor = model::LocaleDescriptor{};
+	localeDescriptor.localeID = model::AvdeccFixedString{ std::string{ "en-US" } };
+	localeDescriptor.numberOfStringDescriptors = StringsDescriptorsCount;
+	localeDescriptor.baseStringDescriptorIndex = 0u;
+	auto stringsDescriptors = std::vector<model::StringsDescriptor>(StringsDescriptorsCount);
+	for (auto stringsIndex = 0u; stringsIndex < StringsDescriptorsCount; ++stringsIndex)
+	{
+		for (auto strIndex = 0u; strIndex < stringsDescriptors[stringsIndex].strings.size(); ++strIndex)
+		{
+			stringsDescriptors[stringsIndex].strings[strIndex] = model::AvdeccFixedString{ "Localized string " + std::to_string(stringsIndex * 7u + strIndex) };
+		}
+	}
+
+	auto bytesPerEntity = std::uint64_t{ 0u };
+	for (auto _ : state)
+	{
+		auto entities = std::vector<std::unique_ptr<ControlledEntityImpl>>{};
+		entities.reserve(entitiesCount);
+
+		auto const bytesBefore = benchmarks::getAllocatedBytes();
+		for (auto entityIndex = 0u; entityIndex < entitiesCount; ++entityIndex)
+		{
+			auto commonInfo = la::avdecc::entity::Entity::CommonInformation{};
+			commonInfo.entityID = la::avdecc::UniqueIdentifier{ std::uint64_t{ 0x0001020300000000 } + entityIndex };
+			commonInfo.entityCapabilities = la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported };
+			auto const entity = la::avdecc::entity::Entity{ commonInfo, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, la::avdecc::entity::Entity::InterfaceInformation{} } } };
+
+			auto& controlledEntity = *entities.emplace_back(std::make_unique<ControlledEntityImpl>(entity, lockInfo, false));
+			lockInfo->lock();
+			controlledEntity.setEntityDescriptor(entityDescriptor);
+			controlledEntity.setConfigurationDescriptor(configurationDescriptor, configurationIndex);
+			controlledEntity.setLocaleDescriptor(localeDescriptor, configurationIndex, model::LocaleIndex{ 0u });
+			controlledEntity.setSelectedLocaleStringsIndexesRange(configurationIndex, localeDescriptor.baseStringDescriptorIndex, localeDescriptor.numberOfStringDescriptors, la::avdecc::controller::TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull);
+			for (auto stringsIndex = model::StringsIndex{ 0u }; stringsIndex < StringsDescriptorsCount; ++stringsIndex)
+			{
+				controlledEntity.setStringsDescriptor(stringsDescriptors[stringsIndex], configurationIndex, stringsIndex);
+			}
+			lockInfo->unlock();
+		}
+		bytesPerEntity += (benchmarks::getAllocatedBytes() - bytesBefore) / entitiesCount;
+	}
+	state.counters["BytesPerEntity"] = benchmark::Counter(static_cast<double>(bytesPerEntity), benchmark::Counter::kAvgIterations);
+	state.counters["NetworkBytes"] = benchmark::Counter(static_cast<double>(bytesPerEntity * entitiesCount), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_LocalizedStringsMemory)->Arg(1000)->Unit(benchmark::kMillisecond);
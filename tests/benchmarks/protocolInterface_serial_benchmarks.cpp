@@ -0,0 +1,208 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_serial_benchmarks.cpp
+* @author Christophe Calmejane
+* @brief Feeds a synthetic high-rate stream of COBS framed ADPDUs to the serial ProtocolInterface, through a pseudo-terminal pair.
+*/
+
+// Public API
+#include <la/avdecc/executor.hpp>
+#include <la/avdecc/internals/serialization.hpp>
+#include <la/avdecc/internals/protocolAdpdu.hpp>
+
+// Internal API
+#include "protocolInterface/protocolInterface_serial.hpp"
+#include "protocolInterface/cobsSerialization.hpp"
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace
+{
+static auto constexpr ExecutorName = "avdecc::protocol::PI";
+
+class PseudoTerminal final
+{
+public:
+	PseudoTerminal()
+	{
+		_master = ::posix_openpt(O_RDWR | O_NOCTTY);
+		if (_master < 0 || ::grantpt(_master) != 0 || ::unlockpt(_master) != 0)
+		{
+			throw std::runtime_error("Failed to create pseudo-terminal");
+		}
+		_slaveName = ::ptsname(_master);
+
+		// Drain everything the serial interface sends (discovery messages), so it never blocks
+		_drainThread = std::thread(
+			[this]
+			{
+				auto buffer = std::array<std::uint8_t, 4096>{};
+				auto pfd = pollfd{ _master, POLLIN, 0 };
+				while (!_shouldTerminate)
+				{
+					if (::poll(&pfd, 1, 10) > 0 && (pfd.revents & POLLIN) != 0)
+					{
+						[[maybe_unused]] auto const ret = ::read(_master, buffer.data(), buffer.size());
+					}
+				}
+			});
+	}
+
+	~PseudoTerminal() noexcept
+	{
+		_shouldTerminate = true;
+		if (_drainThread.joinable())
+		{
+			_drainThread.join();
+		}
+		if (_master >= 0)
+		{
+			::close(_master);
+		}
+	}
+
+	std::string const& getSlaveName() const noexcept
+	{
+		return _slaveName;
+	}
+
+	void write(std::vector<std::uint8_t> const& data) const
+	{
+		auto remaining = data.size();
+		auto const* ptr = data.data();
+		while (remaining > 0)
+		{
+			auto const written = ::write(_master, ptr, remaining);
+			if (written < 0)
+			{
+				if (errno == EAGAIN || errno == EINTR)
+				{
+					continue;
+				}
+				throw std::runtime_error("Failed to write to pseudo-terminal");
+			}
+			ptr += written;
+			remaining -= static_cast<std::size_t>(written);
+		}
+	}
+
+private:
+	int _master{ -1 };
+	std::string _slaveName{};
+	std::atomic_bool _shouldTerminate{ false };
+	std::thread _drainThread{};
+};
+
+class Observer final : public la::avdecc::protocol::ProtocolInterface::Observer
+{
+public:
+	std::uint64_t getCount() const noexcept
+	{
+		return _count;
+	}
+
+private:
+	virtual void onAdpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Adpdu const& /*adpdu*/) noexcept override
+	{
+		++_count;
+	}
+	std::atomic<std::uint64_t> _count{ 0u };
+	DECLARE_AVDECC_OBSERVER_GUARD(Observer);
+};
+
+/** Builds a stream of 'count' COBS framed ADPDUs, the way a device would send them */
+std::vector<std::uint8_t> buildStream(std::size_t const count)
+{
+	auto adpdu = la::avdecc::protocol::Adpdu{};
+	adpdu.setSrcAddress({ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 });
+	adpdu.setDestAddress(la::avdecc::protocol::Adpdu::Multicast_Mac_Address);
+	adpdu.setMessageType(la::avdecc::protocol::AdpMessageType::EntityAvailable);
+	adpdu.setValidTime(31);
+	adpdu.setEntityID(la::avdecc::UniqueIdentifier{ 0x0001020304050607 });
+	adpdu.setEntityModelID(la::avdecc::UniqueIdentifier{ 0x0001020304050608 });
+	adpdu.setControllerCapabilities(la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented });
+	adpdu.setAvailableIndex(1);
+
+	// Serial transport doesn't carry the Ethernet header
+	auto buffer = la::avdecc::protocol::SerializationBuffer{};
+	la::avdecc::protocol::serialize<la::avdecc::protocol::AvtpduControl>(adpdu, buffer);
+	la::avdecc::protocol::serialize<la::avdecc::protocol::Adpdu>(adpdu, buffer);
+
+	auto frame = std::vector<std::uint8_t>(buffer.size() + COBS_BUFFER_PAD(buffer.size()) + 3);
+	frame[0] = la::avdecc::protocol::cobs::DelimiterByte;
+	auto const encodedLength = la::avdecc::protocol::cobs::encode(buffer.data(), buffer.size(), frame.data() + 1);
+	frame.resize(1 + encodedLength);
+	frame.push_back(la::avdecc::protocol::cobs::DelimiterByte);
+
+	auto stream = std::vector<std::uint8_t>{};
+	stream.reserve(frame.size() * count);
+	for (auto i = std::size_t{ 0u }; i < count; ++i)
+	{
+		stream.insert(stream.end(), frame.begin(), frame.end());
+	}
+	return stream;
+}
+} // namespace
+
+static void BM_SerialReceiveThroughput(benchmark::State& state)
+{
+	auto const framesPerIteration = static_cast<std::size_t>(state.range(0));
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(ExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(ExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	auto pty = PseudoTerminal{};
+	auto obs = Observer{};
+	auto intfc = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceSerial>(la::avdecc::protocol::ProtocolInterfaceSerial::createRawProtocolInterfaceSerial(pty.getSlaveName(), ExecutorName));
+	intfc->registerObserver(&obs);
+
+	auto const stream = buildStream(framesPerIteration);
+	auto expected = std::uint64_t{ 0u };
+
+	for (auto _ : state)
+	{
+		pty.write(stream);
+		expected += framesPerIteration;
+
+		// Wait for all frames to be dispatched
+		while (obs.getCount() < expected)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	intfc->unregisterObserver(&obs);
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * framesPerIteration));
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * stream.size()));
+}
+BENCHMARK(BM_SerialReceiveThroughput)->Arg(1)->Arg(64)->Arg(1024)->UseRealTime();
@@ -32,10 +32,12 @@
 
 // Internal API
 #include "protocol/protocolAemPayloads.hpp"
+#include "protocol/protocolAemPayloadLayout.hpp"
 
 #include <gtest/gtest.h>
 #include <array>
 #include <cstdint>
+#include <cstring>
 
 // Test disable on gcc because of a compilation error in the checkPayload template caused by the UniqueIdentifier class (was fine when it was a simple type). TODO: Fix this
 #if defined(_WIN32) || defined(__APPLE__)
@@ -777,3 +779,143 @@ TEST(AemPayloads, DeserializeReadControlDescriptorResponse_Utf8)
 #	endif // ENABLE_AVDECC_FEATURE_JSON
 
 #endif // _WIN32 || __APPLE__
+
+TEST(AemPayloadLayout, ReservedFieldsAndOffsets)
+{
+	using TestLayout = la::avdecc::protocol::aemPayload::layout::Layout<la::avdecc::protocol::aemPayload::layout::Field<std::uint16_t>, la::avdecc::protocol::aemPayload::layout::Reserved<2>, la::avdecc::protocol::aemPayload::layout::Field<la::avdecc::entity::model::DescriptorType>, la::avdecc::protocol::aemPayload::layout::Field<std::uint32_t>>;
+	static_assert(TestLayout::Size == 10u, "Layout size should be the sum of all fields");
+	static_assert(std::tuple_size_v<TestLayout::Values> == 3u, "Reserved fields should not be returned");
+
+	auto const ser = TestLayout::serialize(std::uint16_t{ 0x0102 }, la::avdecc::entity::model::DescriptorType::StreamInput, std::uint32_t{ 0x03040506 });
+	auto const expected = std::array<std::uint8_t, 10>{ 0x01, 0x02, 0x00, 0x00, 0x00, 0x05, 0x03, 0x04, 0x05, 0x06 };
+	ASSERT_EQ(expected.size(), ser.size());
+	EXPECT_EQ(0, std::memcmp(expected.data(), ser.data(), expected.size()));
+
+	// Reserved bytes are ignored when reading
+	auto received = expected;
+	received[2] = 0xff;
+	received[3] = 0xff;
+	auto const [value, descriptorType, value2] = TestLayout::deserialize({ received.data(), received.size() });
+	EXPECT_EQ(0x0102, value);
+	EXPECT_EQ(la::avdecc::entity::model::DescriptorType::StreamInput, descriptorType);
+	EXPECT_EQ(0x03040506u, value2);
+}
+
+TEST(AemPayloadLayout, DeserializeTooSmall)
+{
+	auto const ser = la::avdecc::protocol::aemPayload::serializeReadDescriptorCommand(1u, la::avdecc::entity::model::DescriptorType::StreamInput, 3u);
+	ASSERT_EQ(la::avdecc::protocol::aemPayload::AecpAemReadDescriptorCommandPayloadSize, ser.size());
+
+	EXPECT_THROW(la::avdecc::protocol::aemPayload::deserializeReadDescriptorCommand({ ser.data(), ser.size() - 1u });, la::avdecc::protocol::aemPayload::IncorrectPayloadSizeException);
+	EXPECT_THROW(la::avdecc::protocol::aemPayload::deserializeReadDescriptorCommand({ nullptr, ser.size() });, la::avdecc::protocol::aemPayload::IncorrectPayloadSizeException);
+
+	auto const [configurationIndex, descriptorType, descriptorIndex] = la::avdecc::protocol::aemPayload::deserializeReadDescriptorCommand({ ser.data(), ser.size() });
+	EXPECT_EQ(1u, configurationIndex);
+	EXPECT_EQ(la::avdecc::entity::model::DescriptorType::StreamInput, descriptorType);
+	EXPECT_EQ(3u, descriptorIndex);
+}
+
+TEST(AemPayloadLayout, WireOrderDiffersFromValuesOrder)
+{
+	// SET_MEMORY_OBJECT_LENGTH has memory_object_index before configuration_index on the wire
+	auto const ser = la::avdecc::protocol::aemPayload::serializeSetMemoryObjectLengthCommand(1u, 2u, 0x0102030405060708u);
+	ASSERT_EQ(la::avdecc::protocol::aemPayload::AecpAemSetMemoryObjectLengthCommandPayloadSize, ser.size());
+	EXPECT_EQ(0x00, ser.data()[0]);
+	EXPECT_EQ(0x02, ser.data()[1]);
+
+	auto const [configurationIndex, memoryObjectIndex, length] = la::avdecc::protocol::aemPayload::deserializeSetMemoryObjectLengthCommand({ ser.data(), ser.size() });
+	EXPECT_EQ(1u, configurationIndex);
+	EXPECT_EQ(2u, memoryObjectIndex);
+	EXPECT_EQ(0x0102030405060708u, length);
+}
+
+TEST(AemPayloadLayout, EntityDescriptor)
+{
+	auto entityDescriptor = la::avdecc::entity::model::EntityDescriptor{};
+	entityDescriptor.entityID = la::avdecc::UniqueIdentifier{ 0x0102030405060708 };
+	entityDescriptor.entityModelID = la::avdecc::UniqueIdentifier{ 0x1112131415161718 };
+	entityDescriptor.entityCapabilities = la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported };
+	entityDescriptor.talkerStreamSources = 4u;
+	entityDescriptor.availableIndex = 42u;
+	entityDescriptor.entityName = std::string{ "Entity name" };
+	entityDescriptor.vendorNameString = la::avdecc::entity::model::LocalizedStringReference{ 0x0010 };
+	entityDescriptor.serialNumber = std::string{ "Serial" };
+	entityDescriptor.configurationsCount = 2u;
+	entityDescriptor.currentConfiguration = 1u;
+
+	auto ser = la::avdecc::protocol::aemPayload::serializeReadDescriptorCommonResponse(0u, la::avdecc::entity::model::DescriptorType::Entity, 0u);
+	la::avdecc::protocol::aemPayload::serializeReadEntityDescriptorResponse(ser, entityDescriptor);
+	ASSERT_EQ(la::avdecc::protocol::aemPayload::AecpAemReadEntityDescriptorResponsePayloadSize, ser.size());
+
+	auto const [commonSize, configurationIndex, descriptorType, descriptorIndex] = la::avdecc::protocol::aemPayload::deserializeReadDescriptorCommonResponse(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, { ser.data(), ser.size() });
+	EXPECT_EQ(la::avdecc::protocol::aemPayload::AecpAemReadCommonDescriptorResponsePayloadSize, commonSize);
+	EXPECT_EQ(la::avdecc::entity::model::DescriptorType::Entity, descriptorType);
+
+	auto const status = static_cast<la::avdecc::protocol::AemAecpStatus>(la::avdecc::protocol::AemAecpStatus::Success);
+	auto const result = la::avdecc::protocol::aemPayload::deserializeReadEntityDescriptorResponse({ ser.data(), ser.size() }, commonSize, status);
+	EXPECT_EQ(entityDescriptor.entityID, result.entityID);
+	EXPECT_EQ(entityDescriptor.entityModelID, result.entityModelID);
+	EXPECT_EQ(entityDescriptor.entityCapabilities, result.entityCapabilities);
+	EXPECT_EQ(entityDescriptor.talkerStreamSources, result.talkerStreamSources);
+	EXPECT_EQ(entityDescriptor.availableIndex, result.availableIndex);
+	EXPECT_EQ(entityDescriptor.entityName, result.entityName);
+	EXPECT_EQ(entityDescriptor.vendorNameString, result.vendorNameString);
+	EXPECT_EQ(entityDescriptor.serialNumber, result.serialNumber);
+	EXPECT_EQ(entityDescriptor.configurationsCount, result.configurationsCount);
+	EXPECT_EQ(entityDescriptor.currentConfiguration, result.currentConfiguration);
+
+	EXPECT_THROW(la::avdecc::protocol::aemPayload::deserializeReadEntityDescriptorResponse({ ser.data(), ser.size() - 1u }, commonSize, status), la::avdecc::protocol::aemPayload::IncorrectPayloadSizeException);
+}
+
+TEST(AemPayloads, SerializeReadControlDescriptorResponse_LinearUInt8)
+{
+	auto ser = la::avdecc::Serializer<la::avdecc::protocol::AemAecpdu::MaximumPayloadBufferLength>{};
+	ser << la::avdecc::entity::model::ConfigurationIndex{ 0u } << std::uint16_t{ 0u } << la::avdecc::entity::model::DescriptorType::Control << std::uint16_t{ 0u };
+	ser << la::avdecc::entity::model::AvdeccFixedString{ "Test" };
+	ser << la::avdecc::entity::model::LocalizedStringReference{};
+	ser << std::uint32_t{ 1u } << std::uint32_t{ 2u } << std::uint16_t{ 3u }; // Dummy value
+	ser << la::avdecc::entity::model::ControlValueType::Type::ControlLinearUInt8;
+	ser << la::avdecc::UniqueIdentifier{ 0x90e0f00000000001 };
+	ser << std::uint32_t{ 4u }; // Dummy value
+	ser << std::uint16_t{ 104u }; // Values offset
+	ser << std::uint16_t{ 2u }; // Number of values
+	ser << la::avdecc::entity::model::DescriptorType::Invalid << la::avdecc::entity::model::DescriptorIndex{ 0u } << std::uint16_t{ 0u };
+	// Actual Control Values
+	ser << la::avdecc::MemoryBuffer{ std::vector<std::uint8_t>{ 0, 255, 1, 10, 20, 0, 0, 0, 0, 5, 50, 5, 10, 30, 0, 0, 0, 1 } };
+
+	auto const payload = la::avdecc::protocol::AemAecpdu::Payload{ ser.data(), ser.usedBytes() };
+	auto descriptor = la::avdecc::entity::model::ControlDescriptor{};
+	ASSERT_NO_THROW(descriptor = la::avdecc::protocol::aemPayload::deserializeReadControlDescriptorResponse(payload, 8u, static_cast<la::avdecc::protocol::AemAecpStatus>(la::avdecc::protocol::AemAecpStatus::Success)););
+
+	// Serializing the descriptor back should produce the exact same payload
+	auto outSer = la::avdecc::protocol::aemPayload::serializeReadDescriptorCommonResponse(la::avdecc::entity::model::ConfigurationIndex{ 0u }, la::avdecc::entity::model::DescriptorType::Control, la::avdecc::entity::model::DescriptorIndex{ 0u });
+	ASSERT_NO_THROW(la::avdecc::protocol::aemPayload::serializeReadControlDescriptorResponse(outSer, descriptor));
+	ASSERT_EQ(ser.usedBytes(), outSer.usedBytes());
+	EXPECT_EQ(0, std::memcmp(ser.data(), outSer.data(), ser.usedBytes()));
+}
+
+TEST(AemPayloads, SerializeReadStreamDescriptorResponse)
+{
+	auto descriptor = la::avdecc::entity::model::StreamDescriptor{};
+	descriptor.objectName = la::avdecc::entity::model::AvdeccFixedString{ "Stream" };
+	descriptor.currentFormat = la::avdecc::entity::model::StreamFormat{ 0x0205022000406000 };
+	descriptor.formats = { la::avdecc::entity::model::StreamFormat{ 0x0205022000406000 }, la::avdecc::entity::model::StreamFormat{ 0x0205022000806000 } };
+	descriptor.bufferLength = 8u;
+#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
+	descriptor.redundantStreams = { la::avdecc::entity::model::StreamIndex{ 1u } };
+#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
+
+	auto ser = la::avdecc::protocol::aemPayload::serializeReadDescriptorCommonResponse(la::avdecc::entity::model::ConfigurationIndex{ 0u }, la::avdecc::entity::model::DescriptorType::StreamInput, la::avdecc::entity::model::DescriptorIndex{ 0u });
+	ASSERT_NO_THROW(la::avdecc::protocol::aemPayload::serializeReadStreamDescriptorResponse(ser, descriptor));
+
+	auto const payload = la::avdecc::protocol::AemAecpdu::Payload{ ser.data(), ser.usedBytes() };
+	auto result = la::avdecc::entity::model::StreamDescriptor{};
+	ASSERT_NO_THROW(result = la::avdecc::protocol::aemPayload::deserializeReadStreamDescriptorResponse(payload, la::avdecc::protocol::aemPayload::AecpAemReadCommonDescriptorResponsePayloadSize, static_cast<la::avdecc::protocol::AemAecpStatus>(la::avdecc::protocol::AemAecpStatus::Success)););
+	EXPECT_EQ(descriptor.objectName, result.objectName);
+	EXPECT_EQ(descriptor.currentFormat, result.currentFormat);
+	EXPECT_EQ(descriptor.formats, result.formats);
+	EXPECT_EQ(descriptor.bufferLength, result.bufferLength);
+#ifdef ENABLE_AVDECC_FEATURE_REDUNDANCY
+	EXPECT_EQ(descriptor.redundantStreams, result.redundantStreams);
+#endif // ENABLE_AVDECC_FEATURE_REDUNDANCY
+}
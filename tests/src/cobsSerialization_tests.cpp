@@ -0,0 +1,115 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file cobsSerialization_tests.cpp
+* @author Christophe Calmejane
+*/
+
+// Internal API
+#include "protocolInterface/cobsSerialization.hpp"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+std::vector<std::uint8_t> encode(std::vector<std::uint8_t> const& input)
+{
+	auto output = std::vector<std::uint8_t>(input.size() + COBS_BUFFER_PAD(input.size()) + 1);
+	output.resize(la::avdecc::protocol::cobs::encode(input.data(), input.size(), output.data()));
+	return output;
+}
+} // namespace
+
+TEST(CobsSerialization, KnownVectors)
+{
+	// Examples from the COBS paper
+	EXPECT_EQ((std::vector<std::uint8_t>{ 0x01, 0x01 }), encode({ 0x00 }));
+	EXPECT_EQ((std::vector<std::uint8_t>{ 0x01, 0x01, 0x01 }), encode({ 0x00, 0x00 }));
+	EXPECT_EQ((std::vector<std::uint8_t>{ 0x03, 0x11, 0x22, 0x02, 0x33 }), encode({ 0x11, 0x22, 0x00, 0x33 }));
+	EXPECT_EQ((std::vector<std::uint8_t>{ 0x05, 0x11, 0x22, 0x33, 0x44 }), encode({ 0x11, 0x22, 0x33, 0x44 }));
+	EXPECT_EQ((std::vector<std::uint8_t>{ 0x02, 0x11, 0x01, 0x01, 0x01 }), encode({ 0x11, 0x00, 0x00, 0x00 }));
+}
+
+TEST(CobsSerialization, LongRun)
+{
+	// 254 non-zero bytes fill a whole block
+	auto input = std::vector<std::uint8_t>(254u, 0x42);
+	auto const encoded = encode(input);
+	ASSERT_EQ(256u, encoded.size());
+	EXPECT_EQ(0xFF, encoded[0]);
+	EXPECT_EQ(0x01, encoded[255]);
+
+	auto decoded = std::vector<std::uint8_t>(input.size());
+	EXPECT_EQ(input.size(), la::avdecc::protocol::cobs::decode(encoded.data(), encoded.size(), decoded.data(), decoded.size()));
+	EXPECT_EQ(input, decoded);
+}
+
+TEST(CobsSerialization, DecodeInPlaceMatchesDecode)
+{
+	auto generator = std::mt19937{ 42u };
+	auto distribution = std::uniform_int_distribution<int>{ 0, 255 };
+
+	for (auto length : { 0u, 1u, 2u, 253u, 254u, 255u, 508u, 1000u, 1500u })
+	{
+		for (auto zeroProbability : { 0, 8, 128 })
+		{
+			auto input = std::vector<std::uint8_t>(length);
+			for (auto& b : input)
+			{
+				b = (distribution(generator) < zeroProbability) ? 0u : static_cast<std::uint8_t>(1 + distribution(generator) % 255);
+			}
+
+			auto encoded = encode(input);
+			EXPECT_EQ(la::avdecc::protocol::cobs::findDelimiter(encoded.data(), encoded.data() + encoded.size()), encoded.data() + encoded.size()) << "Encoded data should not contain any delimiter";
+
+			auto decoded = std::vector<std::uint8_t>(input.size() + 1);
+			auto const decodedLength = la::avdecc::protocol::cobs::decode(encoded.data(), encoded.size(), decoded.data(), decoded.size());
+			decoded.resize(decodedLength);
+			EXPECT_EQ(input, decoded);
+
+			auto const inPlaceLength = la::avdecc::protocol::cobs::decodeInPlace(encoded.data(), encoded.size());
+			encoded.resize(inPlaceLength);
+			EXPECT_EQ(input, encoded);
+		}
+	}
+}
+
+TEST(CobsSerialization, DecodeInPlaceInvalid)
+{
+	// Code pointing past the end of the buffer
+	auto encoded = std::vector<std::uint8_t>{ 0x05, 0x11, 0x22 };
+	EXPECT_EQ(0u, la::avdecc::protocol::cobs::decodeInPlace(encoded.data(), encoded.size()));
+}
+
+TEST(CobsSerialization, FindDelimiter)
+{
+	auto const buffer = std::vector<std::uint8_t>{ 0x01, 0x02, 0x00, 0x03, 0x00 };
+	auto const* const begin = buffer.data();
+	auto const* const end = buffer.data() + buffer.size();
+
+	EXPECT_EQ(begin + 2, la::avdecc::protocol::cobs::findDelimiter(begin, end));
+	EXPECT_EQ(begin + 4, la::avdecc::protocol::cobs::findDelimiter(begin + 3, end));
+	EXPECT_EQ(begin + 2, la::avdecc::protocol::cobs::findDelimiter(begin, begin + 2 + 1));
+	EXPECT_EQ(begin + 2, la::avdecc::protocol::cobs::findDelimiter(begin, begin + 2));
+	EXPECT_EQ(end, la::avdecc::protocol::cobs::findDelimiter(end, end));
+}
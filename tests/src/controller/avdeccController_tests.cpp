@@ -29,10 +29,17 @@
 #include <la/avdecc/internals/protocolAemPayloadSizes.hpp>
 #include <la/avdecc/internals/entityModelControlValuesTraits.hpp>
 #include <la/avdecc/internals/streamFormatInfo.hpp>
+#ifdef ENABLE_AVDECC_FEATURE_JSON
+#	include <la/avdecc/internals/jsonTypes.hpp>
+#endif // ENABLE_AVDECC_FEATURE_JSON
 
 // Internal API
 #include "controller/avdeccControlledEntityImpl.hpp"
 #include "controller/avdeccControllerImpl.hpp"
+#ifdef ENABLE_AVDECC_FEATURE_JSON
+#	include "controller/avdeccControllerJsonTypes.hpp"
+#endif // ENABLE_AVDECC_FEATURE_JSON
+#include "controller/avdeccEntityModelCache.hpp"
 #include "entity/controllerEntityImpl.hpp"
 #include "la/avdecc/internals/entityModelTreeCommon.hpp"
 #include "la/avdecc/internals/entityModelTypes.hpp"
@@ -40,6 +47,7 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <atomic>
 #include <string>
 #include <thread>
 #include <chrono>
@@ -47,6 +55,9 @@
 #include <vector>
 #include <cstdint>
 #include <functional>
+#include <filesystem>
+#include <fstream>
+#include <random>
 
 static auto constexpr DefaultExecutorName = "avdecc::protocol::PI";
 
@@ -1318,6 +1329,483 @@ TEST(Controller, InvalidControlValues)
 	}
 }
 
+TEST(Controller, LazyControlValuesDecoding)
+{
+	using FanStatusValues = la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueDynamic<std::uint8_t>>;
+
+	class Obs final : public la::avdecc::controller::Controller::DefaultedObserver
+	{
+	public:
+		std::uint32_t notificationsCount{ 0u };
+		std::optional<std::uint8_t> lastValue{ std::nullopt };
+
+	private:
+		virtual void onControlValuesChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::entity::model::ControlIndex const /*controlIndex*/, la::avdecc::entity::model::ControlValues const& controlValues) noexcept override
+		{
+			++notificationsCount;
+			lastValue = controlValues.getValues<FanStatusValues>().getValues()[0].currentValue;
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(Obs);
+	};
+
+	auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::IgnoreAEMSanityChecks, la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics };
+	// Load entity
+	auto controller = la::avdecc::controller::Controller::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "VirtualInterface", 0x0001, la::avdecc::UniqueIdentifier{}, "en", nullptr, std::nullopt, nullptr);
+	auto const [error, message] = controller->loadVirtualEntityFromJson("data/ControlValueError.json", flags);
+	ASSERT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
+	ASSERT_STREQ("", message.c_str());
+
+	auto constexpr EntityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFF000001 };
+	auto constexpr ConfigurationIndex = la::avdecc::entity::model::ConfigurationIndex{ 0u };
+	auto constexpr ControlIndex = la::avdecc::entity::model::ControlIndex{ 1u }; // FanStatus, CONTROL_LINEAR_UINT8
+
+	auto& c = static_cast<la::avdecc::controller::ControllerImpl&>(*controller);
+	auto obs = Obs{};
+	controller->registerObserver(&obs);
+	controller->enableLazyControlValuesDecoding();
+
+	// Values received through an unsolicited notification
+	auto const receiveValue = [&c, EntityID, ControlIndex](std::uint8_t const value)
+	{
+		auto guard = c.getControlledEntityImplGuard(EntityID);
+		ASSERT_TRUE(!!guard);
+		EXPECT_TRUE(c.updateControlValues(*guard, ControlIndex, la::avdecc::MemoryBuffer{ &value, sizeof(value) }, la::avdecc::controller::TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull, true));
+	};
+	auto const isPendingDecoding = [&c, EntityID, ControlIndex]()
+	{
+		auto guard = c.getControlledEntityImplGuard(EntityID);
+		auto const packedIt = guard->_packedControlValues.find(ControlIndex);
+		return packedIt != guard->_packedControlValues.end() && packedIt->second.isDirty;
+	};
+	auto const isOutOfBounds = [&controller, EntityID, ControlIndex]()
+	{
+		auto const entity = controller->getControlledEntityGuard(EntityID);
+		return entity->getDiagnostics().controlCurrentValueOutOfBounds.count(ControlIndex) != 0;
+	};
+	auto const getCurrentValue = [&controller, EntityID, ConfigurationIndex, ControlIndex]()
+	{
+		auto const entity = controller->getControlledEntityGuard(EntityID);
+		return entity->getControlNode(ConfigurationIndex, ControlIndex).dynamicModel.values.getValues<FanStatusValues>().getValues()[0].currentValue;
+	};
+
+	// Not subscribed: values are decoded when accessed, observers are not notified
+	receiveValue(4u);
+	EXPECT_EQ(0u, obs.notificationsCount);
+	EXPECT_EQ(4u, getCurrentValue());
+
+	// Values received before subscribing are decoded and notified right away
+	receiveValue(8u);
+	controller->subscribeToControlValues(EntityID, ControlIndex);
+	EXPECT_EQ(1u, obs.notificationsCount);
+	EXPECT_EQ(8u, obs.lastValue);
+
+	// Subscribed: values are decoded and notified as soon as they are received
+	receiveValue(12u);
+	EXPECT_EQ(2u, obs.notificationsCount);
+	EXPECT_EQ(12u, obs.lastValue);
+	EXPECT_EQ(12u, getCurrentValue());
+
+	// Unsubscribed: back to lazy decoding
+	controller->unsubscribeFromControlValues(EntityID, ControlIndex);
+	receiveValue(16u);
+	EXPECT_EQ(2u, obs.notificationsCount);
+	EXPECT_EQ(16u, getCurrentValue());
+
+	// Only the accessed control is decoded
+	receiveValue(20u);
+	EXPECT_TRUE(isPendingDecoding());
+	{
+		auto const entity = controller->getControlledEntityGuard(EntityID);
+		entity->getControlNode(ConfigurationIndex, la::avdecc::entity::model::ControlIndex{ 0u });
+	}
+	EXPECT_TRUE(isPendingDecoding());
+	EXPECT_EQ(20u, getCurrentValue());
+	EXPECT_FALSE(isPendingDecoding());
+
+	// Values are validated when decoded
+	receiveValue(200u);
+	EXPECT_FALSE(isOutOfBounds());
+	EXPECT_EQ(200u, getCurrentValue());
+	EXPECT_TRUE(isOutOfBounds());
+	receiveValue(50u);
+	EXPECT_EQ(50u, getCurrentValue());
+	EXPECT_FALSE(isOutOfBounds());
+
+	// Malformed values are rejected when received
+	{
+		auto guard = c.getControlledEntityImplGuard(EntityID);
+		EXPECT_FALSE(c.updateControlValues(*guard, ControlIndex, la::avdecc::MemoryBuffer{}, la::avdecc::controller::TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull, true));
+	}
+	EXPECT_FALSE(isPendingDecoding());
+
+	// Command responses are always decoded (and notified) right away
+	{
+		auto const value = std::uint8_t{ 24u };
+		auto guard = c.getControlledEntityImplGuard(EntityID);
+		EXPECT_TRUE(c.updateControlValues(*guard, ControlIndex, la::avdecc::MemoryBuffer{ &value, sizeof(value) }, la::avdecc::controller::TreeModelAccessStrategy::NotFoundBehavior::LogAndReturnNull));
+	}
+	EXPECT_FALSE(isPendingDecoding());
+	EXPECT_EQ(3u, obs.notificationsCount);
+	EXPECT_EQ(24u, obs.lastValue);
+}
+
+TEST(Controller, EnumerationSchedulerConcurrencyLimit)
+{
+	using Scheduler = la::avdecc::controller::EnumerationScheduler;
+	using Priority = Scheduler::Priority;
+	using IDs = std::vector<la::avdecc::UniqueIdentifier>;
+	auto const makeID = [](std::uint64_t const value)
+	{
+		return la::avdecc::UniqueIdentifier{ 0x0001020304050000 + value };
+	};
+
+	auto scheduler = Scheduler{};
+
+	// No limit by default
+	EXPECT_TRUE(scheduler.requestEnumeration(makeID(1), Priority::Default));
+	EXPECT_TRUE(scheduler.requestEnumeration(makeID(2), Priority::Default));
+	EXPECT_EQ(IDs{}, scheduler.releaseEnumeration(makeID(1)));
+	EXPECT_EQ(IDs{}, scheduler.releaseEnumeration(makeID(2)));
+
+	// Limit to 2 concurrent enumerations
+	scheduler.setMaximumConcurrentEnumerations(2u);
+	EXPECT_TRUE(scheduler.requestEnumeration(makeID(1), Priority::Default));
+	EXPECT_TRUE(scheduler.requestEnumeration(makeID(2), Priority::Default));
+	EXPECT_FALSE(scheduler.requestEnumeration(makeID(3), Priority::Default));
+	EXPECT_FALSE(scheduler.requestEnumeration(makeID(4), Priority::UserDeclared, 1u));
+	EXPECT_FALSE(scheduler.requestEnumeration(makeID(5), Priority::UserDeclared, 0u));
+	EXPECT_FALSE(scheduler.requestEnumeration(makeID(6), Priority::CachedModel));
+	EXPECT_FALSE(scheduler.requestEnumeration(makeID(7), Priority::Default));
+	EXPECT_EQ(2u, scheduler.getActiveCount());
+	EXPECT_EQ(5u, scheduler.getQueuedCount());
+
+	// Requesting an active or queued entity again does nothing
+	EXPECT_FALSE(scheduler.requestEnumeration(makeID(1), Priority::Default));
+	EXPECT_FALSE(scheduler.requestEnumeration(makeID(3), Priority::CachedModel));
+	EXPECT_EQ(5u, scheduler.getQueuedCount());
+
+	// A queued entity going offline is simply removed
+	EXPECT_EQ(IDs{}, scheduler.releaseEnumeration(makeID(7)));
+	EXPECT_FALSE(scheduler.isQueued(makeID(7)));
+
+	// Releasing an unknown entity does nothing
+	EXPECT_EQ(IDs{}, scheduler.releaseEnumeration(makeID(8)));
+
+	// Cached model first, then user declared (by rank), then discovery order
+	EXPECT_EQ(IDs{ makeID(6) }, scheduler.releaseEnumeration(makeID(1)));
+	EXPECT_EQ(IDs{ makeID(5) }, scheduler.releaseEnumeration(makeID(2)));
+	EXPECT_EQ(IDs{ makeID(4) }, scheduler.releaseEnumeration(makeID(6)));
+
+	// Raising the limit starts the remaining entities
+	EXPECT_EQ(IDs{ makeID(3) }, scheduler.setMaximumConcurrentEnumerations(0u));
+	EXPECT_EQ(0u, scheduler.getQueuedCount());
+	EXPECT_EQ(3u, scheduler.getActiveCount());
+}
+
+TEST(Controller, ResyncDynamicInfoAfterUnsolicitedLoss)
+{
+	static constexpr auto ModelEntityID = la::avdecc::UniqueIdentifier{ 0x0001020304050607 };
+	static auto entityOnlinePromise = std::promise<void>{};
+	static auto getDynamicInfoPromise = std::promise<void>{};
+	static auto deregisterUnsolPromise = std::promise<void>{};
+
+	class ControllerObserver final : public la::avdecc::controller::Controller::DefaultedObserver
+	{
+	private:
+		virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
+		{
+			if (entity->getEntity().getEntityID() == ModelEntityID)
+			{
+				entityOnlinePromise.set_value();
+			}
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ControllerObserver);
+	};
+
+	// Track the queries received by the entity exposing the model, once armed
+	class ModelObserver final : public la::avdecc::protocol::ProtocolInterface::Observer
+	{
+	public:
+		std::atomic_bool isArmed{ false };
+
+	private:
+		virtual void onAecpCommand(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
+		{
+			if (!isArmed || aecpdu.getMessageType() != la::avdecc::protocol::AecpMessageType::AemCommand)
+			{
+				return;
+			}
+			auto const commandType = static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu).getCommandType();
+			if (commandType == la::avdecc::protocol::AemCommandType::GetDynamicInfo)
+			{
+				isArmed = false;
+				getDynamicInfoPromise.set_value();
+			}
+			else if (commandType == la::avdecc::protocol::AemCommandType::DeregisterUnsolicitedNotification)
+			{
+				isArmed = false;
+				deregisterUnsolPromise.set_value();
+			}
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ModelObserver);
+	};
+
+	// Create a controller using fast enumeration
+	auto controller = la::avdecc::controller::Controller::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "VirtualInterface", 0x0001, la::avdecc::UniqueIdentifier{}, "en", nullptr, std::nullopt, nullptr);
+	auto controllerObserver = ControllerObserver{};
+	controller->registerObserver(&controllerObserver);
+	controller->enableFastEnumeration();
+
+	// Create an entity answering the enumeration from its Entity Model
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	entityTree.dynamicModel.entityName = la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" };
+	entityTree.configurationTrees[la::avdecc::entity::model::ConfigurationIndex{ 0u }];
+	auto modelProtocolInterface = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("VirtualInterface", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06 } }, DefaultExecutorName));
+	auto const modelCommonInformation = la::avdecc::entity::Entity::CommonInformation{ ModelEntityID, la::avdecc::UniqueIdentifier{ 0x1122334455667788 }, la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported }, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+	auto const modelInterfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ la::networkInterface::MacAddress{ { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06 } }, 31u, 0u, std::nullopt, std::nullopt };
+	auto modelGuard = std::make_unique<la::avdecc::entity::LocalEntityGuard<la::avdecc::entity::ControllerEntityImpl>>(modelProtocolInterface.get(), modelCommonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, modelInterfaceInfo } }, &entityTree, nullptr);
+	auto modelObserver = ModelObserver{};
+	modelProtocolInterface->registerObserver(&modelObserver);
+
+	// Wait for the entity to be enumerated
+	static_cast<la::avdecc::entity::ControllerEntity&>(*modelGuard).enableEntityAdvertising(10);
+	ASSERT_NE(std::future_status::timeout, entityOnlinePromise.get_future().wait_for(std::chrono::seconds(5)));
+
+	auto& c = static_cast<la::avdecc::controller::ControllerImpl&>(*controller);
+	auto const notifyUnsolicited = [&c](la::avdecc::protocol::AecpSequenceID const sequenceID)
+	{
+		// Unsolicited notifications are processed with the ProtocolInterface locked
+		auto const lg = std::lock_guard{ *c._controller };
+		c.onAemAecpUnsolicitedReceived(c._controller, ModelEntityID, sequenceID);
+	};
+	auto const setEntityState = [&controller](bool const isPackedDynamicInfoSupported)
+	{
+		auto entityGuard = controller->getControlledEntityGuard(ModelEntityID);
+		ASSERT_TRUE(!!entityGuard);
+		auto& e = const_cast<la::avdecc::controller::ControlledEntityImpl&>(static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*entityGuard));
+		EXPECT_TRUE(e.isSubscribedToUnsolicitedNotifications());
+		// Losses are only detected for entities implementing Milan 1.2 (or later) unsolicited notifications
+		e.setMilanInfo(la::avdecc::entity::model::MilanInfo{ 1u });
+		e.setPackedDynamicInfoSupported(isPackedDynamicInfoSupported);
+	};
+
+	// Entity supporting GET_DYNAMIC_INFO: a lost notification triggers a resync and keeps the subscription
+	setEntityState(true);
+	notifyUnsolicited(la::avdecc::protocol::AecpSequenceID{ 10u });
+	modelObserver.isArmed = true;
+	notifyUnsolicited(la::avdecc::protocol::AecpSequenceID{ 12u });
+	ASSERT_NE(std::future_status::timeout, getDynamicInfoPromise.get_future().wait_for(std::chrono::seconds(2)));
+	{
+		auto const entityGuard = controller->getControlledEntityGuard(ModelEntityID);
+		ASSERT_TRUE(!!entityGuard);
+		EXPECT_EQ(1u, entityGuard->getAemAecpUnsolicitedLossCounter());
+		EXPECT_TRUE(entityGuard->isSubscribedToUnsolicitedNotifications());
+	}
+
+	// Entity not supporting GET_DYNAMIC_INFO: a lost notification unsubscribes from unsolicited notifications
+	setEntityState(false);
+	modelObserver.isArmed = true;
+	notifyUnsolicited(la::avdecc::protocol::AecpSequenceID{ 15u });
+	ASSERT_NE(std::future_status::timeout, deregisterUnsolPromise.get_future().wait_for(std::chrono::seconds(2)));
+	{
+		auto const entityGuard = controller->getControlledEntityGuard(ModelEntityID);
+		ASSERT_TRUE(!!entityGuard);
+		EXPECT_EQ(2u, entityGuard->getAemAecpUnsolicitedLossCounter());
+		EXPECT_FALSE(entityGuard->isSubscribedToUnsolicitedNotifications());
+	}
+
+	modelProtocolInterface->unregisterObserver(&modelObserver);
+}
+
+TEST(Controller, FastEnumerationFromEntityModel)
+{
+	static constexpr auto ModelEntityID = la::avdecc::UniqueIdentifier{ 0x0001020304050607 };
+
+	class ControllerObserver final : public la::avdecc::controller::Controller::DefaultedObserver
+	{
+	public:
+		std::promise<void> entityOnlinePromise{};
+
+	private:
+		virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
+		{
+			if (entity->getEntity().getEntityID() == ModelEntityID)
+			{
+				entityOnlinePromise.set_value();
+			}
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ControllerObserver);
+	};
+
+	// Count the AEM commands received by the entity exposing the model (one per round trip)
+	class ModelObserver final : public la::avdecc::protocol::ProtocolInterface::Observer
+	{
+	public:
+		std::atomic_size_t commandsCount{ 0u };
+		std::atomic_size_t dynamicInfoCommandsCount{ 0u };
+
+	private:
+		virtual void onAecpCommand(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
+		{
+			if (aecpdu.getMessageType() == la::avdecc::protocol::AecpMessageType::AemCommand)
+			{
+				++commandsCount;
+				if (static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu).getCommandType() == la::avdecc::protocol::AemCommandType::GetDynamicInfo)
+				{
+					++dynamicInfoCommandsCount;
+				}
+			}
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ModelObserver);
+	};
+
+	// Entity Model with dynamic values at all the levels queried after the descriptors
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	entityTree.dynamicModel.entityName = la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" };
+	{
+		auto& configTree = entityTree.configurationTrees[la::avdecc::entity::model::ConfigurationIndex{ 0u }];
+		auto& audioUnitTree = configTree.audioUnitTrees[la::avdecc::entity::model::AudioUnitIndex{ 0u }];
+		audioUnitTree.staticModel.samplingRates = { la::avdecc::entity::model::SamplingRate{ 0, 48000 }, la::avdecc::entity::model::SamplingRate{ 0, 96000 } };
+		audioUnitTree.dynamicModel.currentSamplingRate = la::avdecc::entity::model::SamplingRate{ 0, 96000 };
+		for (auto const streamIndex : { la::avdecc::entity::model::StreamIndex{ 0u }, la::avdecc::entity::model::StreamIndex{ 1u } })
+		{
+			auto& streamInputModels = configTree.streamInputModels[streamIndex];
+			streamInputModels.staticModel.formats = { la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100 } };
+			streamInputModels.dynamicModel.streamFormat = la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100 };
+			streamInputModels.dynamicModel.isStreamRunning = false;
+			auto& streamOutputModels = configTree.streamOutputModels[streamIndex];
+			streamOutputModels.staticModel.formats = { la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100 } };
+			streamOutputModels.dynamicModel.streamFormat = la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100 };
+			streamOutputModels.dynamicModel.presentationTimeOffset = std::chrono::nanoseconds{ 2000000 };
+			streamOutputModels.dynamicModel.streamDynamicInfo = la::avdecc::entity::model::StreamDynamicInfo{};
+			streamOutputModels.dynamicModel.streamDynamicInfo->streamID = la::avdecc::UniqueIdentifier{ 0x0001020304050000 + streamIndex };
+		}
+		configTree.clockSourceModels[la::avdecc::entity::model::ClockSourceIndex{ 0u }];
+		configTree.clockSourceModels[la::avdecc::entity::model::ClockSourceIndex{ 1u }];
+		auto& clockDomainModels = configTree.clockDomainModels[la::avdecc::entity::model::ClockDomainIndex{ 0u }];
+		clockDomainModels.staticModel.clockSources = { la::avdecc::entity::model::ClockSourceIndex{ 0u }, la::avdecc::entity::model::ClockSourceIndex{ 1u } };
+		clockDomainModels.dynamicModel.clockSourceIndex = la::avdecc::entity::model::ClockSourceIndex{ 1u };
+	}
+
+	// Enumerate the entity with a new controller, returning the count of AEM commands it received
+	auto const enumerate = [&entityTree](bool const isFastEnumeration)
+	{
+		auto controller = la::avdecc::controller::Controller::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "FastEnumerationInterface", 0x0001, la::avdecc::UniqueIdentifier{}, "en", nullptr, std::nullopt, nullptr);
+		auto controllerObserver = ControllerObserver{};
+		controller->registerObserver(&controllerObserver);
+		if (isFastEnumeration)
+		{
+			controller->enableFastEnumeration();
+		}
+
+		auto modelProtocolInterface = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("FastEnumerationInterface", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06 } }, DefaultExecutorName));
+		auto const modelCommonInformation = la::avdecc::entity::Entity::CommonInformation{ ModelEntityID, la::avdecc::UniqueIdentifier{ 0x1122334455667788 }, la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported }, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+		auto const modelInterfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ la::networkInterface::MacAddress{ { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06 } }, 31u, 0u, std::nullopt, std::nullopt };
+		auto modelGuard = std::make_unique<la::avdecc::entity::LocalEntityGuard<la::avdecc::entity::ControllerEntityImpl>>(modelProtocolInterface.get(), modelCommonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, modelInterfaceInfo } }, &entityTree, nullptr);
+		auto modelObserver = ModelObserver{};
+		modelProtocolInterface->registerObserver(&modelObserver);
+
+		// Wait for the entity to be enumerated
+		static_cast<la::avdecc::entity::ControllerEntity&>(*modelGuard).enableEntityAdvertising(10);
+		EXPECT_NE(std::future_status::timeout, controllerObserver.entityOnlinePromise.get_future().wait_for(std::chrono::seconds(5)));
+
+		// The dynamic values are the ones of the model, whatever the enumeration mode
+		{
+			auto const entityGuard = controller->getControlledEntityGuard(ModelEntityID);
+			EXPECT_TRUE(!!entityGuard);
+			if (entityGuard)
+			{
+				auto const configurationIndex = la::avdecc::entity::model::ConfigurationIndex{ 0u };
+				EXPECT_FALSE(entityGuard->gotFatalEnumerationError());
+				EXPECT_EQ(isFastEnumeration, entityGuard->isPackedDynamicInfoSupported());
+				EXPECT_EQ((la::avdecc::entity::model::SamplingRate{ 0, 96000 }), entityGuard->getAudioUnitNode(configurationIndex, 0u).dynamicModel.currentSamplingRate);
+				EXPECT_EQ(la::avdecc::entity::model::ClockSourceIndex{ 1u }, entityGuard->getClockDomainNode(configurationIndex, 0u).dynamicModel.clockSourceIndex);
+				EXPECT_EQ(std::optional<bool>{ false }, entityGuard->getStreamInputNode(configurationIndex, 1u).dynamicModel.isStreamRunning);
+				EXPECT_EQ(std::chrono::nanoseconds{ 2000000 }, entityGuard->getStreamOutputNode(configurationIndex, 1u).dynamicModel.presentationTimeOffset);
+				auto const& streamDynamicInfo = entityGuard->getStreamOutputNode(configurationIndex, 1u).dynamicModel.streamDynamicInfo;
+				EXPECT_TRUE(streamDynamicInfo && streamDynamicInfo->streamID == la::avdecc::UniqueIdentifier{ 0x0001020304050001 });
+			}
+		}
+		EXPECT_EQ(isFastEnumeration, modelObserver.dynamicInfoCommandsCount > 0u);
+
+		modelProtocolInterface->unregisterObserver(&modelObserver);
+		controller->unregisterObserver(&controllerObserver);
+		return modelObserver.commandsCount.load();
+	};
+
+	// The dynamic values are fetched in a few packed commands instead of one command per value (the controller never packs GET_STREAM_INFO)
+	auto const slowCommandsCount = enumerate(false);
+	auto const fastCommandsCount = enumerate(true);
+	EXPECT_LT(fastCommandsCount, slowCommandsCount);
+}
+
+TEST(Controller, EnumerateFromCaptureReplay)
+{
+	if (!la::avdecc::protocol::ProtocolInterface::isSupportedProtocolInterfaceType(la::avdecc::protocol::ProtocolInterface::Type::Replay))
+	{
+		GTEST_SKIP() << "Replay ProtocolInterface not supported";
+	}
+
+	static constexpr auto ModelEntityID = la::avdecc::UniqueIdentifier{ 0x0001020304050608 };
+	auto const filePath = (std::filesystem::temp_directory_path() / "avdecc_controller_replay.pcapng").string();
+
+	class ControllerObserver final : public la::avdecc::controller::Controller::DefaultedObserver
+	{
+	public:
+		std::promise<void> entityOnlinePromise{};
+
+	private:
+		virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
+		{
+			if (entity->getEntity().getEntityID() == ModelEntityID)
+			{
+				entityOnlinePromise.set_value();
+			}
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(ControllerObserver);
+	};
+
+	// Record a live enumeration of an entity answering from its Entity Model
+	{
+		auto controller = la::avdecc::controller::Controller::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "ReplayRecordingInterface", 0x0001, la::avdecc::UniqueIdentifier{}, "en", nullptr, std::nullopt, nullptr);
+		auto controllerObserver = ControllerObserver{};
+		controller->registerObserver(&controllerObserver);
+
+		auto entityTree = la::avdecc::entity::model::EntityTree{};
+		entityTree.dynamicModel.entityName = la::avdecc::entity::model::AvdeccFixedString{ "Recorded Entity" };
+		entityTree.configurationTrees[la::avdecc::entity::model::ConfigurationIndex{ 0u }];
+		auto modelProtocolInterface = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("ReplayRecordingInterface", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x08 } }, DefaultExecutorName));
+		ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, modelProtocolInterface->startFrameRecording(filePath, la::avdecc::protocol::ProtocolInterface::FrameRecorderConfiguration{}));
+		auto const modelCommonInformation = la::avdecc::entity::Entity::CommonInformation{ ModelEntityID, la::avdecc::UniqueIdentifier{ 0x1122334455667788 }, la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported }, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+		auto const modelInterfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ la::networkInterface::MacAddress{ { 0x00, 0x01, 0x02, 0x03, 0x04, 0x08 } }, 31u, 0u, std::nullopt, std::nullopt };
+		auto modelGuard = std::make_unique<la::avdecc::entity::LocalEntityGuard<la::avdecc::entity::ControllerEntityImpl>>(modelProtocolInterface.get(), modelCommonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, modelInterfaceInfo } }, &entityTree, nullptr);
+		static_cast<la::avdecc::entity::ControllerEntity&>(*modelGuard).enableEntityAdvertising(10);
+
+		ASSERT_NE(std::future_status::timeout, controllerObserver.entityOnlinePromise.get_future().wait_for(std::chrono::seconds(5)));
+		controller->unregisterObserver(&controllerObserver);
+		EXPECT_EQ(0u, modelProtocolInterface->stopFrameRecording().droppedFrames);
+	}
+
+	// Replay the capture: the replayed entity is enumerated by a new controller, its commands being answered from the capture
+	{
+		auto controller = la::avdecc::controller::Controller::create(la::avdecc::protocol::ProtocolInterface::Type::Replay, filePath + "@max", 0x0002, la::avdecc::UniqueIdentifier{}, "en", nullptr, std::nullopt, nullptr);
+
+		// The replay starts as soon as the controller entity is registered, the entity might already be enumerated
+		auto entityGuard = controller->getControlledEntityGuard(ModelEntityID);
+		auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{ 5 };
+		while (!entityGuard && std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds{ 5 });
+			entityGuard = controller->getControlledEntityGuard(ModelEntityID);
+		}
+		ASSERT_TRUE(!!entityGuard);
+		EXPECT_FALSE(entityGuard->gotFatalEnumerationError());
+		EXPECT_EQ(std::string{ "Recorded Entity" }, entityGuard->getEntityNode().dynamicModel.entityName.str());
+	}
+
+	std::filesystem::remove(filePath);
+}
+
 TEST(Controller, IdentifyAdvertisedButNoSuchIndex)
 {
 	auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::IgnoreAEMSanityChecks, la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics };
@@ -6931,6 +7419,133 @@ TEST(Controller, HashEntityModelV5)
 	EXPECT_STREQ("068D4565E93A67323C3D83A23ABC407FBCF7ED2FE7CFF6D29766938A3264F30D", checksum.value().c_str());
 }
 
+TEST(Controller, EntityModelCacheSharedModel)
+{
+	auto& entityModelCache = la::avdecc::controller::EntityModelCache::getInstance();
+	auto constexpr EntityModelID = la::avdecc::UniqueIdentifier{ 0x001B92FFFFFF0049 };
+	auto const wasEnabled = entityModelCache.isCacheEnabled();
+	entityModelCache.enableCache();
+
+	// Not cached yet
+	EXPECT_TRUE(entityModelCache.shouldCacheEntityModel(EntityModelID, false));
+	EXPECT_TRUE(entityModelCache.cacheEntityModel(EntityModelID, la::avdecc::controller::model::EntityNode{}, false));
+
+	// Incomplete model is only replaced by a complete one
+	EXPECT_FALSE(entityModelCache.shouldCacheEntityModel(EntityModelID, false));
+	EXPECT_TRUE(entityModelCache.shouldCacheEntityModel(EntityModelID, true));
+	EXPECT_TRUE(entityModelCache.cacheEntityModel(EntityModelID, la::avdecc::controller::model::EntityNode{}, true));
+	EXPECT_FALSE(entityModelCache.shouldCacheEntityModel(EntityModelID, true));
+
+	// Cached model is shared, not copied
+	auto const model1 = entityModelCache.getCachedEntityModel(EntityModelID);
+	auto const model2 = entityModelCache.getCachedEntityModel(EntityModelID);
+	ASSERT_NE(nullptr, model1);
+	EXPECT_EQ(model1.get(), model2.get());
+
+	// Nothing is cached when the cache is disabled
+	entityModelCache.disableCache();
+	EXPECT_FALSE(entityModelCache.shouldCacheEntityModel(la::avdecc::UniqueIdentifier{ 0x001B92FFFFFF004A }, true));
+	if (wasEnabled)
+	{
+		entityModelCache.enableCache();
+	}
+}
+
+#ifdef ENABLE_AVDECC_FEATURE_JSON
+TEST(Controller, EntityModelCachePersistence)
+{
+	auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan };
+	auto const& [error, msg, controlledEntity] = la::avdecc::controller::Controller::deserializeControlledEntityFromJson("data/SimpleEntity.json", flags);
+	ASSERT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, error);
+	auto const& entity = static_cast<la::avdecc::controller::ControlledEntityImpl const&>(*controlledEntity);
+	auto const entityModelID = entity.getEntity().getEntityModelID();
+	auto constexpr InvalidEntityModelID = la::avdecc::UniqueIdentifier{ 0x001B92FFFFFFFFFE };
+
+	// Use a unique directory so parallel test runs don't collide
+	auto const directory = std::filesystem::temp_directory_path() / ("avdeccEntityModelCachePersistence_" + std::to_string(std::random_device{}()));
+	auto const directoryPath = directory.string();
+	std::filesystem::remove_all(directory);
+
+	auto controller = la::avdecc::controller::Controller::create(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "VirtualInterface", 0x0001, la::avdecc::UniqueIdentifier{}, "en", nullptr, std::nullopt, nullptr);
+	auto& c = static_cast<la::avdecc::controller::ControllerImpl&>(*controller);
+	auto& entityModelCache = la::avdecc::controller::EntityModelCache::getInstance();
+	controller->enableEntityModelCache();
+	ASSERT_TRUE(controller->enableEntityModelCachePersistence(directoryPath));
+
+	// Persist the EntityModel
+	c.persistEntityModel(entity, true);
+	auto const filePath = directory / la::avdecc::controller::EntityModelCache::getPersistedEntityModelFileName(entityModelID);
+	EXPECT_TRUE(std::filesystem::exists(filePath));
+
+	// Load it back (validated against its checksum)
+	{
+		auto const persistedModel = la::avdecc::controller::ControllerImpl::loadPersistedEntityModel(directoryPath, entityModelID);
+		ASSERT_TRUE(persistedModel.has_value());
+		auto const& [entityNode, isFullModel] = *persistedModel;
+		EXPECT_TRUE(isFullModel);
+		EXPECT_EQ(entity.getEntityNode().configurations.size(), entityNode.configurations.size());
+	}
+
+	// A file that parses but fails its checksum, or without checksum, is rejected
+	{
+		auto const readObject = [&filePath]()
+		{
+			auto ifs = std::ifstream{ filePath, std::ios::binary | std::ios::in };
+			return nlohmann::json::from_msgpack(std::vector<std::uint8_t>{ std::istreambuf_iterator<char>{ ifs }, std::istreambuf_iterator<char>{} });
+		};
+		auto const writeObject = [&filePath](nlohmann::json const& object)
+		{
+			auto const binary = nlohmann::json::to_msgpack(object);
+			auto ofs = std::ofstream{ filePath, std::ios::binary | std::ios::out | std::ios::trunc };
+			ofs.write(reinterpret_cast<char const*>(binary.data()), binary.size());
+		};
+		auto const originalObject = readObject();
+
+		auto object = originalObject;
+		object[la::avdecc::controller::jsonSerializer::keyName::EntityModelCache_Checksum] = "0000";
+		writeObject(object);
+		EXPECT_FALSE(la::avdecc::controller::ControllerImpl::loadPersistedEntityModel(directoryPath, entityModelID).has_value());
+
+		object.erase(la::avdecc::controller::jsonSerializer::keyName::EntityModelCache_Checksum);
+		writeObject(object);
+		EXPECT_FALSE(la::avdecc::controller::ControllerImpl::loadPersistedEntityModel(directoryPath, entityModelID).has_value());
+
+		writeObject(originalObject);
+		EXPECT_TRUE(la::avdecc::controller::ControllerImpl::loadPersistedEntityModel(directoryPath, entityModelID).has_value());
+	}
+
+	// Write an invalid file
+	{
+		auto ofs = std::ofstream{ directory / la::avdecc::controller::EntityModelCache::getPersistedEntityModelFileName(InvalidEntityModelID), std::ios::binary | std::ios::out };
+		ofs << "Not an EntityModel";
+	}
+
+	// Persisted models are loaded in the background when persistence is enabled, invalid files are discarded
+	controller->disableEntityModelCachePersistence();
+	EXPECT_FALSE(entityModelCache.isPersistedEntityModel(InvalidEntityModelID));
+	ASSERT_TRUE(controller->enableEntityModelCachePersistence(directoryPath));
+	EXPECT_TRUE(entityModelCache.hasCachedEntityModel(entityModelID));
+	{
+		auto const invalidFilePath = directory / la::avdecc::controller::EntityModelCache::getPersistedEntityModelFileName(InvalidEntityModelID);
+		auto const isLoadingComplete = [&]()
+		{
+			return entityModelCache.getCachedEntityModel(entityModelID) != nullptr && !entityModelCache.isPersistedEntityModel(InvalidEntityModelID) && !std::filesystem::exists(invalidFilePath);
+		};
+		auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{ 5 };
+		while (!isLoadingComplete() && std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+		}
+		EXPECT_TRUE(isLoadingComplete());
+		EXPECT_FALSE(entityModelCache.hasCachedEntityModel(InvalidEntityModelID));
+	}
+
+	controller->disableEntityModelCachePersistence();
+	controller->disableEntityModelCache();
+	std::filesystem::remove_all(directory);
+}
+#endif // ENABLE_AVDECC_FEATURE_JSON
+
 TEST(Controller, GetMappingForInputClusterIdentification_ValidMappingInStaticAudioMaps)
 {
 	// Setup StreamPortNode with static audio mappings
@@ -0,0 +1,252 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controllerCoroutines_tests.cpp
+* @author Christophe Calmejane
+* @note Built as C++20, the coroutines layer is not available to C++17 code.
+*/
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+// Public API
+#	include <la/avdecc/internals/controllerCoroutines.hpp>
+#	include <la/avdecc/internals/protocolAdpdu.hpp>
+#	include <la/avdecc/executor.hpp>
+
+// Internal API
+#	include "entity/controllerEntityImpl.hpp"
+#	include "protocolInterface/protocolInterface_virtual.hpp"
+
+#	include <gtest/gtest.h>
+#	include <chrono>
+#	include <future>
+#	include <memory>
+#	include <thread>
+#	include <vector>
+
+namespace
+{
+auto constexpr DefaultExecutorName = "avdecc::protocol::PI";
+auto constexpr ModelEntityID = la::avdecc::UniqueIdentifier{ 0x0001020304050607 };
+auto constexpr SilentEntityID = la::avdecc::UniqueIdentifier{ 0x0001020304050608 };
+auto constexpr ModelMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06 } };
+auto constexpr SilentMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x01, 0x02, 0x03, 0x04, 0x07 } };
+auto constexpr ControllerMacAddress = la::networkInterface::MacAddress{ { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } };
+
+class Delegate final : public la::avdecc::entity::controller::DefaultedDelegate
+{
+public:
+	std::promise<void> entityOnlinePromise{};
+	std::promise<void> silentEntityOnlinePromise{};
+
+private:
+	virtual void onEntityOnline(la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::Entity const& /*entity*/) noexcept override
+	{
+		if (entityID == ModelEntityID)
+		{
+			entityOnlinePromise.set_value();
+		}
+		else if (entityID == SilentEntityID)
+		{
+			silentEntityOnlinePromise.set_value();
+		}
+	}
+};
+
+/** A ControllerEntity exposing an Entity Model, and a ControllerEntity (which discovered it) sending the commands */
+class ControllerCoroutines : public ::testing::Test
+{
+protected:
+	virtual void SetUp() override
+	{
+		_executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+		_entityTree.dynamicModel.entityName = la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" };
+		auto& configTree = _entityTree.configurationTrees[la::avdecc::entity::model::ConfigurationIndex{ 0u }];
+		configTree.audioUnitTrees[la::avdecc::entity::model::AudioUnitIndex{ 0u }].dynamicModel.currentSamplingRate = la::avdecc::entity::model::SamplingRate{ 0, 48000 };
+		for (auto streamIndex = la::avdecc::entity::model::StreamIndex{ 0u }; streamIndex < 4u; ++streamIndex)
+		{
+			configTree.streamInputModels[streamIndex].dynamicModel.streamFormat = la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100u + streamIndex };
+		}
+
+		_modelProtocolInterface.reset(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("VirtualInterface", ModelMacAddress, DefaultExecutorName));
+		auto const modelCommonInformation = la::avdecc::entity::Entity::CommonInformation{ ModelEntityID, la::avdecc::UniqueIdentifier{ 0x1122334455667788 }, la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported }, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+		auto const modelInterfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ ModelMacAddress, 31u, 0u, std::nullopt, std::nullopt };
+		_modelGuard = std::make_unique<EntityGuard>(_modelProtocolInterface.get(), modelCommonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, modelInterfaceInfo } }, &_entityTree, nullptr);
+
+		_controllerProtocolInterface.reset(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("VirtualInterface", ControllerMacAddress, DefaultExecutorName));
+		auto const commonInformation = la::avdecc::entity::Entity::CommonInformation{ la::avdecc::UniqueIdentifier{ 0x0102030405060708 }, la::avdecc::UniqueIdentifier{ 0x1122334455667788 }, la::avdecc::entity::EntityCapabilities{}, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+		auto const interfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ ControllerMacAddress, 31u, 0u, std::nullopt, std::nullopt };
+		_controllerGuard = std::make_unique<EntityGuard>(_controllerProtocolInterface.get(), commonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, interfaceInfo } }, nullptr, nullptr);
+		getController().setControllerDelegate(&_delegate);
+
+		// Wait for the entity to be discovered
+		static_cast<la::avdecc::entity::ControllerEntity&>(*_modelGuard).enableEntityAdvertising(10);
+		ASSERT_NE(std::future_status::timeout, _delegate.entityOnlinePromise.get_future().wait_for(std::chrono::seconds(2)));
+	}
+
+	virtual void TearDown() override
+	{
+		_controllerGuard.reset();
+		_silentProtocolInterface.reset();
+		_modelGuard.reset();
+		_controllerProtocolInterface.reset();
+		_modelProtocolInterface.reset();
+		_executorWrapper.reset();
+	}
+
+	la::avdecc::entity::ControllerEntity& getController() noexcept
+	{
+		return static_cast<la::avdecc::entity::ControllerEntity&>(*_controllerGuard);
+	}
+
+	/** Advertises an entity (SilentEntityID) that never responds to the commands */
+	void advertiseSilentEntity()
+	{
+		_silentProtocolInterface.reset(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("VirtualInterface", SilentMacAddress, DefaultExecutorName));
+
+		auto adpdu = la::avdecc::protocol::Adpdu{};
+		adpdu.setSrcAddress(SilentMacAddress);
+		adpdu.setDestAddress(la::avdecc::protocol::Adpdu::Multicast_Mac_Address);
+		adpdu.setMessageType(la::avdecc::protocol::AdpMessageType::EntityAvailable);
+		adpdu.setValidTime(31u);
+		adpdu.setEntityID(SilentEntityID);
+		adpdu.setEntityCapabilities(la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported });
+		adpdu.setAvailableIndex(1u);
+		_silentProtocolInterface->sendAdpMessage(adpdu);
+
+		ASSERT_NE(std::future_status::timeout, _delegate.silentEntityOnlinePromise.get_future().wait_for(std::chrono::seconds(2)));
+	}
+
+private:
+	using EntityGuard = la::avdecc::entity::LocalEntityGuard<la::avdecc::entity::ControllerEntityImpl>;
+
+	la::avdecc::ExecutorManager::ExecutorWrapper::UniquePointer _executorWrapper{ nullptr, nullptr };
+	la::avdecc::entity::model::EntityTree _entityTree{};
+	std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual> _modelProtocolInterface{};
+	std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual> _controllerProtocolInterface{};
+	std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual> _silentProtocolInterface{};
+	std::unique_ptr<EntityGuard> _modelGuard{};
+	std::unique_ptr<EntityGuard> _controllerGuard{};
+	Delegate _delegate{};
+};
+} // namespace
+
+TEST_F(ControllerCoroutines, SequentialCommands)
+{
+	namespace coroutine = la::avdecc::entity::controller::coroutine;
+	using Interface = la::avdecc::entity::controller::Interface;
+
+	auto const task = [](la::avdecc::entity::ControllerEntity const& controller) -> coroutine::Task<std::thread::id>
+	{
+		auto const [entityID, status, name] = co_await coroutine::command(controller, &Interface::getEntityName, ModelEntityID);
+		EXPECT_EQ(ModelEntityID, entityID);
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" }, name);
+
+		// Failed command
+		auto const [formatEntityID, formatStatus, streamIndex, streamFormat] = co_await coroutine::command(controller, &Interface::getStreamInputFormat, ModelEntityID, la::avdecc::entity::model::StreamIndex{ 8u });
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::NoSuchDescriptor, formatStatus);
+
+		// Resumed on the ProtocolInterface executor
+		auto options = coroutine::CommandOptions{};
+		options.executorName = DefaultExecutorName;
+		auto const [rateEntityID, rateStatus, audioUnitIndex, samplingRate] = co_await coroutine::command(controller, std::move(options), &Interface::getAudioUnitSamplingRate, ModelEntityID, la::avdecc::entity::model::AudioUnitIndex{ 0u });
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, rateStatus);
+		EXPECT_EQ((la::avdecc::entity::model::SamplingRate{ 0, 48000 }), samplingRate);
+
+		co_return std::this_thread::get_id();
+	};
+
+	auto const resumeThread = coroutine::syncWait(task(getController()));
+	EXPECT_EQ(la::avdecc::ExecutorManager::getInstance().getExecutorThread(DefaultExecutorName), resumeThread);
+}
+
+TEST_F(ControllerCoroutines, WhenAll)
+{
+	namespace coroutine = la::avdecc::entity::controller::coroutine;
+	using Interface = la::avdecc::entity::controller::Interface;
+
+	auto const getFormat = [](la::avdecc::entity::ControllerEntity const& controller, la::avdecc::entity::model::StreamIndex const streamIndex) -> coroutine::Task<la::avdecc::entity::model::StreamFormat>
+	{
+		auto const [entityID, status, index, streamFormat] = co_await coroutine::command(controller, &Interface::getStreamInputFormat, ModelEntityID, streamIndex);
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+		co_return streamFormat;
+	};
+
+	auto tasks = std::vector<coroutine::Task<la::avdecc::entity::model::StreamFormat>>{};
+	for (auto streamIndex = la::avdecc::entity::model::StreamIndex{ 0u }; streamIndex < 4u; ++streamIndex)
+	{
+		tasks.push_back(getFormat(getController(), streamIndex));
+	}
+
+	auto const formats = coroutine::syncWait(coroutine::whenAll(std::move(tasks)));
+	ASSERT_EQ(4u, formats.size());
+	for (auto streamIndex = la::avdecc::entity::model::StreamIndex{ 0u }; streamIndex < 4u; ++streamIndex)
+	{
+		EXPECT_EQ(la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100u + streamIndex }, formats[streamIndex]);
+	}
+
+	// Nothing to wait for
+	EXPECT_TRUE(coroutine::syncWait(coroutine::whenAll(std::vector<coroutine::Task<int>>{})).empty());
+}
+
+TEST_F(ControllerCoroutines, TimeoutAndCancellation)
+{
+	namespace coroutine = la::avdecc::entity::controller::coroutine;
+	using Interface = la::avdecc::entity::controller::Interface;
+
+	advertiseSilentEntity();
+
+	auto const getName = [](la::avdecc::entity::ControllerEntity const& controller, coroutine::CommandOptions options) -> coroutine::Task<la::avdecc::entity::LocalEntity::AemCommandStatus>
+	{
+		auto const [entityID, status, name] = co_await coroutine::command(controller, std::move(options), &Interface::getEntityName, SilentEntityID);
+		co_return status;
+	};
+
+	// Timeout shorter than the protocol one
+	{
+		auto const start = std::chrono::steady_clock::now();
+		auto const status = coroutine::syncWait(getName(getController(), coroutine::CommandOptions{ std::chrono::milliseconds{ 50 }, std::nullopt, {} }));
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::TimedOut, status);
+		EXPECT_GT(std::chrono::milliseconds{ 200 }, std::chrono::steady_clock::now() - start);
+	}
+
+	// Cancelled while awaiting the response
+	{
+		auto const token = coroutine::CancellationToken{};
+		auto canceller = std::thread{ [token]()
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+				token.cancel();
+			} };
+		EXPECT_THROW(coroutine::syncWait(getName(getController(), coroutine::CommandOptions{ std::nullopt, token, {} })), coroutine::CancelledException);
+		canceller.join();
+	}
+
+	// Already cancelled, the command is not sent
+	{
+		auto const token = coroutine::CancellationToken{};
+		token.cancel();
+		EXPECT_THROW(coroutine::syncWait(getName(getController(), coroutine::CommandOptions{ std::nullopt, token, {} })), coroutine::CancelledException);
+	}
+}
+
+#endif // __cpp_impl_coroutine
@@ -24,19 +24,27 @@
 
 // Public API
 #include <la/avdecc/internals/protocolAemAecpdu.hpp>
+#include <la/avdecc/internals/controllerCommandBatch.hpp>
+#include <la/avdecc/internals/entityModelControlValuesTraits.hpp>
+#include <la/avdecc/internals/entityModelControlValues.hpp>
 #include <la/avdecc/executor.hpp>
 
 // Internal API
 #include "entity/controllerEntityImpl.hpp"
+#include "entity/aemHandler.hpp"
 #include "protocolInterface/protocolInterface_virtual.hpp"
 #include "instrumentationObserver.hpp"
 
 #include <gtest/gtest.h>
+#include <any>
+#include <atomic>
 #include <string>
 #include <thread>
 #include <chrono>
 #include <list>
 #include <future>
+#include <mutex>
+#include <vector>
 
 static auto constexpr DefaultExecutorName = "avdecc::protocol::PI";
 
@@ -165,6 +173,638 @@ TEST(ControllerEntity, DetectMainAvbInterfaceLost)
 	ASSERT_NE(std::future_status::timeout, status);
 }
 
+/** Pair of local entities on a virtual interface: one exposing an Entity Model, the other one a controller discovering it */
+class EntityModelEntities final
+{
+public:
+	static constexpr auto ModelEntityID = la::avdecc::UniqueIdentifier{ 0x0001020304050607 };
+
+	/** Controller delegate signaling the discovery of the entity exposing the model, to be derived from to observe more events */
+	class Delegate : public la::avdecc::entity::controller::DefaultedDelegate
+	{
+	public:
+		std::future<void> getEntityOnlineFuture()
+		{
+			return _entityOnlinePromise.get_future();
+		}
+
+	private:
+		virtual void onEntityOnline(la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::Entity const& /*entity*/) noexcept override
+		{
+			if (entityID == ModelEntityID)
+			{
+				_entityOnlinePromise.set_value();
+			}
+		}
+
+		std::promise<void> _entityOnlinePromise{};
+	};
+
+	EntityModelEntities(la::avdecc::entity::model::EntityTree const& entityTree, Delegate& delegate)
+	{
+		// Create a ControllerEntity exposing the Entity Model
+		auto const modelCommonInformation = la::avdecc::entity::Entity::CommonInformation{ ModelEntityID, la::avdecc::UniqueIdentifier{ 0x1122334455667788 }, la::avdecc::entity::EntityCapabilities{ la::avdecc::entity::EntityCapability::AemSupported }, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+		auto const modelInterfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ la::networkInterface::MacAddress{ { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06 } }, 31u, 0u, std::nullopt, std::nullopt };
+		_modelGuard = std::make_unique<la::avdecc::entity::LocalEntityGuard<la::avdecc::entity::ControllerEntityImpl>>(_modelProtocolInterface.get(), modelCommonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, modelInterfaceInfo } }, &entityTree, nullptr);
+
+		// Create a ControllerEntity talking to the entity exposing the model
+		auto const commonInformation = la::avdecc::entity::Entity::CommonInformation{ la::avdecc::UniqueIdentifier{ 0x0102030405060708 }, la::avdecc::UniqueIdentifier{ 0x1122334455667788 }, la::avdecc::entity::EntityCapabilities{}, 0u, la::avdecc::entity::TalkerCapabilities{}, 0u, la::avdecc::entity::ListenerCapabilities{}, la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented }, std::nullopt, std::nullopt };
+		auto const interfaceInfo = la::avdecc::entity::Entity::InterfaceInformation{ la::networkInterface::MacAddress{ { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } }, 31u, 0u, std::nullopt, std::nullopt };
+		_controllerGuard = std::make_unique<la::avdecc::entity::LocalEntityGuard<la::avdecc::entity::ControllerEntityImpl>>(_controllerProtocolInterface.get(), commonInformation, la::avdecc::entity::Entity::InterfacesInformation{ { la::avdecc::entity::Entity::GlobalAvbInterfaceIndex, interfaceInfo } }, nullptr, nullptr);
+		getController().setControllerDelegate(&delegate);
+
+		// Advertise the entity exposing the model
+		getModelEntity().enableEntityAdvertising(10);
+		_entityOnlineFuture = delegate.getEntityOnlineFuture();
+	}
+
+	/** Returns true if the controller discovered the entity exposing the model in time */
+	bool waitForModelEntityOnline()
+	{
+		return _entityOnlineFuture.wait_for(std::chrono::seconds(2)) != std::future_status::timeout;
+	}
+
+	la::avdecc::entity::ControllerEntity& getModelEntity() noexcept
+	{
+		return static_cast<la::avdecc::entity::ControllerEntity&>(*_modelGuard);
+	}
+
+	la::avdecc::entity::ControllerEntity& getController() noexcept
+	{
+		return static_cast<la::avdecc::entity::ControllerEntity&>(*_controllerGuard);
+	}
+
+	la::avdecc::protocol::ProtocolInterfaceVirtual& getModelProtocolInterface() noexcept
+	{
+		return *_modelProtocolInterface;
+	}
+
+	void destroyModelEntity() noexcept
+	{
+		_modelGuard.reset();
+	}
+
+	// Deleted compiler auto-generated methods
+	EntityModelEntities(EntityModelEntities const&) = delete;
+	EntityModelEntities(EntityModelEntities&&) = delete;
+	EntityModelEntities& operator=(EntityModelEntities const&) = delete;
+	EntityModelEntities& operator=(EntityModelEntities&&) = delete;
+
+private:
+	using ControllerEntityGuard = std::unique_ptr<la::avdecc::entity::LocalEntityGuard<la::avdecc::entity::ControllerEntityImpl>>;
+
+	la::avdecc::ExecutorManager::ExecutorWrapper::UniquePointer _executorWrapper{ la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest)) };
+	std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual> _modelProtocolInterface{ la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("VirtualInterface", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06 } }, DefaultExecutorName) };
+	std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual> _controllerProtocolInterface{ la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("VirtualInterface", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } }, DefaultExecutorName) };
+	ControllerEntityGuard _modelGuard{};
+	ControllerEntityGuard _controllerGuard{};
+	std::future<void> _entityOnlineFuture{};
+};
+
+TEST(ControllerEntity, ReadDescriptorsFromEntityModel)
+{
+	static constexpr auto ModelEntityID = EntityModelEntities::ModelEntityID;
+	// Build an Entity Model with descriptors at all levels of the tree
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	entityTree.dynamicModel.entityName = la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" };
+	{
+		auto& configTree = entityTree.configurationTrees[la::avdecc::entity::model::ConfigurationIndex{ 0u }];
+		configTree.dynamicModel.objectName = la::avdecc::entity::model::AvdeccFixedString{ "Config" };
+
+		auto& audioUnitTree = configTree.audioUnitTrees[la::avdecc::entity::model::AudioUnitIndex{ 0u }];
+		audioUnitTree.staticModel.numberOfStreamInputPorts = 1u;
+		audioUnitTree.staticModel.samplingRates = { la::avdecc::entity::model::SamplingRate{ 0, 48000 }, la::avdecc::entity::model::SamplingRate{ 0, 96000 } };
+		audioUnitTree.dynamicModel.currentSamplingRate = la::avdecc::entity::model::SamplingRate{ 0, 48000 };
+
+		auto& streamPortTree = audioUnitTree.streamPortInputTrees[la::avdecc::entity::model::StreamPortIndex{ 0u }];
+		streamPortTree.staticModel.numberOfClusters = 1u;
+		streamPortTree.staticModel.numberOfMaps = 1u;
+		streamPortTree.audioClusterModels[la::avdecc::entity::model::ClusterIndex{ 0u }].staticModel.channelCount = 1u;
+		streamPortTree.audioMapModels[la::avdecc::entity::model::MapIndex{ 0u }].staticModel.mappings = { la::avdecc::entity::model::AudioMapping{ 0u, 1u, 0u, 0u } };
+
+		auto& streamModels = configTree.streamInputModels[la::avdecc::entity::model::StreamIndex{ 0u }];
+		streamModels.staticModel.formats = { la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100 }, la::avdecc::entity::model::StreamFormat{ 0x00A0020240000200 } };
+		streamModels.dynamicModel.objectName = la::avdecc::entity::model::AvdeccFixedString{ "Input" };
+		streamModels.dynamicModel.streamFormat = la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100 };
+
+		auto& localeTree = configTree.localeTrees[la::avdecc::entity::model::LocaleIndex{ 0u }];
+		localeTree.staticModel.localeID = la::avdecc::entity::model::AvdeccFixedString{ "en" };
+		localeTree.staticModel.numberOfStringDescriptors = 1u;
+		localeTree.stringsModels[la::avdecc::entity::model::StringsIndex{ 0u }].staticModel.strings[0] = la::avdecc::entity::model::AvdeccFixedString{ "Hello" };
+
+		auto& controlModels = configTree.controlModels[la::avdecc::entity::model::ControlIndex{ 0u }];
+		controlModels.staticModel.controlValueType = la::avdecc::entity::model::ControlValueType{ false, false, la::avdecc::entity::model::ControlValueType::Type::ControlLinearUInt8 };
+		controlModels.staticModel.numberOfValues = 1u;
+		controlModels.staticModel.values = la::avdecc::entity::model::ControlValues{ la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueStatic<std::uint8_t>>{ { la::avdecc::entity::model::LinearValueStatic<std::uint8_t>{ 0u, 100u, 1u, 50u } } } };
+		controlModels.dynamicModel.values = la::avdecc::entity::model::ControlValues{ la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueDynamic<std::uint8_t>>{ { la::avdecc::entity::model::LinearValueDynamic<std::uint8_t>{ 42u } } } };
+	}
+
+	// Create the entity exposing the Entity Model and a controller, and wait for the entity to be discovered
+	auto delegate = EntityModelEntities::Delegate{};
+	auto entities = EntityModelEntities{ entityTree, delegate };
+	ASSERT_TRUE(entities.waitForModelEntityOnline());
+	auto& modelEntity = entities.getModelEntity();
+	auto& controller = entities.getController();
+
+	// Read all the descriptors of the model
+	{
+		auto promise = std::promise<la::avdecc::entity::model::ConfigurationDescriptor>{};
+		controller.readConfigurationDescriptor(ModelEntityID, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const /*configurationIndex*/, la::avdecc::entity::model::ConfigurationDescriptor const& descriptor)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(descriptor);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		auto const descriptor = future.get();
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ "Config" }, descriptor.objectName);
+		EXPECT_EQ(1u, descriptor.descriptorCounts.at(la::avdecc::entity::model::DescriptorType::StreamInput));
+	}
+	{
+		auto promise = std::promise<la::avdecc::entity::model::AudioUnitDescriptor>{};
+		controller.readAudioUnitDescriptor(ModelEntityID, 0u, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const /*configurationIndex*/, la::avdecc::entity::model::AudioUnitIndex const /*audioUnitIndex*/, la::avdecc::entity::model::AudioUnitDescriptor const& descriptor)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(descriptor);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		auto const descriptor = future.get();
+		EXPECT_EQ(2u, descriptor.samplingRates.size());
+		EXPECT_EQ((la::avdecc::entity::model::SamplingRate{ 0, 48000 }), descriptor.currentSamplingRate);
+	}
+	{
+		auto promise = std::promise<la::avdecc::entity::model::AudioMapDescriptor>{};
+		controller.readAudioMapDescriptor(ModelEntityID, 0u, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const /*configurationIndex*/, la::avdecc::entity::model::MapIndex const /*mapIndex*/, la::avdecc::entity::model::AudioMapDescriptor const& descriptor)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(descriptor);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		auto const descriptor = future.get();
+		ASSERT_EQ(1u, descriptor.mappings.size());
+		EXPECT_EQ(1u, descriptor.mappings[0].streamChannel);
+	}
+	{
+		auto promise = std::promise<la::avdecc::entity::model::StringsDescriptor>{};
+		controller.readStringsDescriptor(ModelEntityID, 0u, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const /*configurationIndex*/, la::avdecc::entity::model::StringsIndex const /*stringsIndex*/, la::avdecc::entity::model::StringsDescriptor const& descriptor)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(descriptor);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ "Hello" }, future.get().strings[0]);
+	}
+	{
+		auto promise = std::promise<la::avdecc::entity::model::ControlDescriptor>{};
+		controller.readControlDescriptor(ModelEntityID, 0u, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const /*configurationIndex*/, la::avdecc::entity::model::ControlIndex const /*controlIndex*/, la::avdecc::entity::model::ControlDescriptor const& descriptor)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(descriptor);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		auto const descriptor = future.get();
+		auto const dynamicValues = descriptor.valuesDynamic.getValues<la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueDynamic<std::uint8_t>>>();
+		ASSERT_EQ(1u, dynamicValues.getValues().size());
+		EXPECT_EQ(42u, dynamicValues.getValues()[0].currentValue);
+	}
+
+	// Reading a descriptor not in the model is left to the entity (which does not handle it)
+	{
+		auto promise = std::promise<la::avdecc::entity::LocalEntity::AemCommandStatus>{};
+		controller.readStreamOutputDescriptor(ModelEntityID, 0u, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const /*configurationIndex*/, la::avdecc::entity::model::StreamIndex const /*streamIndex*/, la::avdecc::entity::model::StreamDescriptor const& /*descriptor*/)
+			{
+				promise.set_value(status);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::NotImplemented, future.get());
+	}
+
+	// Modifying the dynamic fields of the model is reflected without notifying the entity
+	auto const readStreamInput = [&controller]()
+	{
+		auto promise = std::promise<la::avdecc::entity::model::StreamDescriptor>{};
+		controller.readStreamInputDescriptor(ModelEntityID, 0u, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const /*configurationIndex*/, la::avdecc::entity::model::StreamIndex const /*streamIndex*/, la::avdecc::entity::model::StreamDescriptor const& descriptor)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(descriptor);
+			});
+		auto future = promise.get_future();
+		EXPECT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		return future.get();
+	};
+	auto& streamInputModels = entityTree.configurationTrees[0u].streamInputModels[0u];
+	{
+		auto const descriptor = readStreamInput();
+		EXPECT_EQ(2u, descriptor.formats.size());
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ "Input" }, descriptor.objectName);
+		EXPECT_EQ(streamInputModels.dynamicModel.streamFormat, descriptor.currentFormat);
+	}
+	streamInputModels.dynamicModel.objectName = la::avdecc::entity::model::AvdeccFixedString{ "Renamed" };
+	streamInputModels.dynamicModel.streamFormat = *std::next(streamInputModels.staticModel.formats.begin());
+	{
+		auto const descriptor = readStreamInput();
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ "Renamed" }, descriptor.objectName);
+		EXPECT_EQ(streamInputModels.dynamicModel.streamFormat, descriptor.currentFormat);
+	}
+
+	// Adding a descriptor is only reflected once the entity has been notified
+	entityTree.configurationTrees[0u].streamOutputModels[0u].staticModel = streamInputModels.staticModel;
+	modelEntity.notifyEntityModelChanged();
+	{
+		auto promise = std::promise<la::avdecc::entity::LocalEntity::AemCommandStatus>{};
+		controller.readStreamOutputDescriptor(ModelEntityID, 0u, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const /*configurationIndex*/, la::avdecc::entity::model::StreamIndex const /*streamIndex*/, la::avdecc::entity::model::StreamDescriptor const& /*descriptor*/)
+			{
+				promise.set_value(status);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, future.get());
+	}
+}
+
+TEST(ControllerEntity, UnsolicitedNotificationsFromEntityModel)
+{
+	static constexpr auto ModelEntityID = EntityModelEntities::ModelEntityID;
+	class Delegate final : public EntityModelEntities::Delegate
+	{
+	public:
+		std::promise<void> notificationsPromise{};
+		std::mutex notificationsLock{};
+		std::vector<std::uint8_t> notifiedValues{};
+
+	private:
+		virtual void onControlValuesChanged(la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ControlIndex const /*controlIndex*/, la::avdecc::MemoryBuffer const& packedControlValues) noexcept override
+		{
+			if (entityID == ModelEntityID && packedControlValues.size() == 1u)
+			{
+				auto const lg = std::lock_guard{ notificationsLock };
+				notifiedValues.push_back(packedControlValues.data()[0]);
+				if (notifiedValues.size() == 2u)
+				{
+					notificationsPromise.set_value();
+				}
+			}
+		}
+	};
+
+	// Build an Entity Model with a single CONTROL
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	auto& controlModels = entityTree.configurationTrees[la::avdecc::entity::model::ConfigurationIndex{ 0u }].controlModels[la::avdecc::entity::model::ControlIndex{ 0u }];
+	controlModels.staticModel.controlValueType = la::avdecc::entity::model::ControlValueType{ false, false, la::avdecc::entity::model::ControlValueType::Type::ControlLinearUInt8 };
+	controlModels.staticModel.numberOfValues = 1u;
+	controlModels.staticModel.values = la::avdecc::entity::model::ControlValues{ la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueStatic<std::uint8_t>>{ { la::avdecc::entity::model::LinearValueStatic<std::uint8_t>{ 0u, 100u, 1u, 50u } } } };
+	auto const setControlValue = [&controlModels](std::uint8_t const value)
+	{
+		controlModels.dynamicModel.values = la::avdecc::entity::model::ControlValues{ la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueDynamic<std::uint8_t>>{ { la::avdecc::entity::model::LinearValueDynamic<std::uint8_t>{ value } } } };
+	};
+	setControlValue(0u);
+
+	// Create the entity exposing the Entity Model and a controller, and wait for the entity to be discovered
+	auto delegate = Delegate{};
+	auto entities = EntityModelEntities{ entityTree, delegate };
+	ASSERT_TRUE(entities.waitForModelEntityOnline());
+	auto& modelEntity = entities.getModelEntity();
+	auto& controller = entities.getController();
+
+	auto const readControlValue = [&controller]()
+	{
+		auto promise = std::promise<std::uint8_t>{};
+		controller.readControlDescriptor(ModelEntityID, 0u, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const /*configurationIndex*/, la::avdecc::entity::model::ControlIndex const /*controlIndex*/, la::avdecc::entity::model::ControlDescriptor const& descriptor)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				auto const dynamicValues = descriptor.valuesDynamic.getValues<la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueDynamic<std::uint8_t>>>();
+				promise.set_value(dynamicValues.getValues().empty() ? std::uint8_t{ 0xFF } : dynamicValues.getValues()[0].currentValue);
+			});
+		auto future = promise.get_future();
+		EXPECT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		return future.get();
+	};
+	auto const sendRegistration = [&controller](bool const isRegister)
+	{
+		auto promise = std::promise<la::avdecc::entity::LocalEntity::AemCommandStatus>{};
+		auto const handler = [&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status)
+		{
+			promise.set_value(status);
+		};
+		if (isRegister)
+		{
+			controller.registerUnsolicitedNotifications(ModelEntityID, handler);
+		}
+		else
+		{
+			controller.unregisterUnsolicitedNotifications(ModelEntityID, handler);
+		}
+		auto future = promise.get_future();
+		EXPECT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		return future.get();
+	};
+
+	EXPECT_EQ(0u, readControlValue());
+	EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, sendRegistration(true));
+
+	// Rapid changes: the first one is sent right away, the others are coalesced into a single notification with the latest values
+	for (auto const value : { std::uint8_t{ 1u }, std::uint8_t{ 2u }, std::uint8_t{ 3u } })
+	{
+		setControlValue(value);
+		modelEntity.notifyControlValuesChanged(0u);
+	}
+	ASSERT_NE(std::future_status::timeout, delegate.notificationsPromise.get_future().wait_for(std::chrono::seconds(2)));
+	std::this_thread::sleep_for(la::avdecc::entity::model::AemHandler::UnsolicitedNotificationMinimumInterval * 2);
+	{
+		auto const lg = std::lock_guard{ delegate.notificationsLock };
+		EXPECT_EQ((std::vector<std::uint8_t>{ 1u, 3u }), delegate.notifiedValues);
+	}
+
+	// The served CONTROL descriptor follows the notified values
+	EXPECT_EQ(3u, readControlValue());
+
+	// No more notifications once unregistered
+	EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, sendRegistration(false));
+	setControlValue(4u);
+	modelEntity.notifyControlValuesChanged(0u);
+	std::this_thread::sleep_for(la::avdecc::entity::model::AemHandler::UnsolicitedNotificationMinimumInterval * 2);
+	{
+		auto const lg = std::lock_guard{ delegate.notificationsLock };
+		EXPECT_EQ(2u, delegate.notifiedValues.size());
+	}
+
+	// Destroying the entity while holding the ProtocolInterface lock, with a coalesced notification due, must not deadlock
+	EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, sendRegistration(true));
+	for (auto const value : { std::uint8_t{ 5u }, std::uint8_t{ 6u } })
+	{
+		setControlValue(value);
+		modelEntity.notifyControlValuesChanged(0u);
+	}
+	{
+		auto const lg = std::lock_guard{ entities.getModelProtocolInterface() };
+		std::this_thread::sleep_for(la::avdecc::entity::model::AemHandler::UnsolicitedNotificationMinimumInterval * 2);
+		entities.destroyModelEntity();
+	}
+	std::this_thread::sleep_for(la::avdecc::entity::model::AemHandler::UnsolicitedNotificationMinimumInterval);
+	{
+		auto const lg = std::lock_guard{ delegate.notificationsLock };
+		EXPECT_EQ((std::vector<std::uint8_t>{ 1u, 3u, 5u }), delegate.notifiedValues);
+	}
+}
+
+TEST(ControllerEntity, DynamicInfoFromEntityModel)
+{
+	static constexpr auto ModelEntityID = EntityModelEntities::ModelEntityID;
+	// Count the AEM commands received by the entity exposing the model (one per round trip)
+	class Observer final : public la::avdecc::protocol::ProtocolInterface::Observer
+	{
+	public:
+		std::atomic_size_t commandsCount{ 0u };
+
+	private:
+		virtual void onAecpCommand(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
+		{
+			if (aecpdu.getMessageType() == la::avdecc::protocol::AecpMessageType::AemCommand)
+			{
+				++commandsCount;
+			}
+		}
+		DECLARE_AVDECC_OBSERVER_GUARD(Observer);
+	};
+
+	// Build an Entity Model with the dynamic values a controller queries after enumeration
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	entityTree.dynamicModel.entityName = la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" };
+	entityTree.dynamicModel.counters = la::avdecc::entity::model::EntityCounters{ { la::avdecc::entity::EntityCounterValidFlag::EntitySpecific1, 7u } };
+	{
+		auto& configTree = entityTree.configurationTrees[la::avdecc::entity::model::ConfigurationIndex{ 0u }];
+		configTree.audioUnitTrees[la::avdecc::entity::model::AudioUnitIndex{ 0u }].dynamicModel.currentSamplingRate = la::avdecc::entity::model::SamplingRate{ 0, 96000 };
+		configTree.streamInputModels[la::avdecc::entity::model::StreamIndex{ 0u }].dynamicModel.streamFormat = la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100 };
+		configTree.streamOutputModels[la::avdecc::entity::model::StreamIndex{ 0u }].dynamicModel.presentationTimeOffset = std::chrono::nanoseconds{ 2000000 };
+		configTree.clockSourceModels[la::avdecc::entity::model::ClockSourceIndex{ 0u }];
+		configTree.clockSourceModels[la::avdecc::entity::model::ClockSourceIndex{ 1u }];
+		configTree.clockDomainModels[la::avdecc::entity::model::ClockDomainIndex{ 0u }].dynamicModel.clockSourceIndex = la::avdecc::entity::model::ClockSourceIndex{ 1u };
+		configTree.memoryObjectModels[la::avdecc::entity::model::MemoryObjectIndex{ 0u }].dynamicModel.length = 1234u;
+	}
+
+	// Create the entity exposing the Entity Model and a controller, and wait for the entity to be discovered
+	auto delegate = EntityModelEntities::Delegate{};
+	auto entities = EntityModelEntities{ entityTree, delegate };
+	ASSERT_TRUE(entities.waitForModelEntityOnline());
+	auto& controller = entities.getController();
+	auto observer = Observer{};
+	entities.getModelProtocolInterface().registerObserver(&observer);
+
+	// Query the values with individual commands, one round trip each
+	{
+		auto promise = std::promise<la::avdecc::entity::model::ConfigurationIndex>{};
+		controller.getConfiguration(ModelEntityID,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ConfigurationIndex const configurationIndex)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(configurationIndex);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ(0u, future.get());
+	}
+	{
+		auto promise = std::promise<la::avdecc::entity::model::StreamFormat>{};
+		controller.getStreamInputFormat(ModelEntityID, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::StreamIndex const /*streamIndex*/, la::avdecc::entity::model::StreamFormat const streamFormat)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(streamFormat);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ(la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100 }, future.get());
+	}
+	{
+		auto promise = std::promise<la::avdecc::entity::model::AvdeccFixedString>{};
+		controller.getEntityName(ModelEntityID,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::AvdeccFixedString const& entityName)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(entityName);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" }, future.get());
+	}
+	{
+		auto promise = std::promise<la::avdecc::entity::model::SamplingRate>{};
+		controller.getAudioUnitSamplingRate(ModelEntityID, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::AudioUnitIndex const /*audioUnitIndex*/, la::avdecc::entity::model::SamplingRate const samplingRate)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(samplingRate);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ((la::avdecc::entity::model::SamplingRate{ 0, 96000 }), future.get());
+	}
+	{
+		auto promise = std::promise<la::avdecc::entity::model::ClockSourceIndex>{};
+		controller.getClockSource(ModelEntityID, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::ClockDomainIndex const /*clockDomainIndex*/, la::avdecc::entity::model::ClockSourceIndex const clockSourceIndex)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(clockSourceIndex);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ(1u, future.get());
+	}
+	{
+		auto promise = std::promise<std::chrono::nanoseconds>{};
+		controller.getMaxTransitTime(ModelEntityID, 0u,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::model::StreamIndex const /*streamIndex*/, std::chrono::nanoseconds const& maxTransitTime)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(maxTransitTime);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ(std::chrono::nanoseconds{ 2000000 }, future.get());
+	}
+	EXPECT_EQ(6u, observer.commandsCount.load());
+
+	// Query the same values (and more) packed in a single GET_DYNAMIC_INFO
+	{
+		auto const parameters = la::avdecc::entity::controller::DynamicInfoParameters{
+			{ la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemCommandType::GetConfiguration, {} },
+			{ la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemCommandType::GetStreamFormat, { la::avdecc::entity::model::DescriptorType::StreamInput, la::avdecc::entity::model::DescriptorIndex{ 0u } } },
+			{ la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemCommandType::GetName, { la::avdecc::entity::model::ConfigurationIndex{ 0u }, la::avdecc::entity::model::DescriptorType::Entity, la::avdecc::entity::model::DescriptorIndex{ 0u }, std::uint16_t{ 0u } } },
+			{ la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemCommandType::GetSamplingRate, { la::avdecc::entity::model::DescriptorType::AudioUnit, la::avdecc::entity::model::DescriptorIndex{ 0u } } },
+			{ la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemCommandType::GetClockSource, { la::avdecc::entity::model::DescriptorIndex{ 0u } } },
+			{ la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemCommandType::GetMaxTransitTime, { la::avdecc::entity::model::StreamIndex{ 0u } } },
+			{ la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemCommandType::GetMemoryObjectLength, { la::avdecc::entity::model::ConfigurationIndex{ 0u }, la::avdecc::entity::model::MemoryObjectIndex{ 0u } } },
+			{ la::avdecc::entity::LocalEntity::AemCommandStatus::Success, la::avdecc::protocol::AemCommandType::GetCounters, { la::avdecc::entity::model::DescriptorType::Entity, la::avdecc::entity::model::DescriptorIndex{ 0u } } },
+		};
+		auto promise = std::promise<la::avdecc::entity::controller::DynamicInfoParameters>{};
+		controller.getDynamicInfo(ModelEntityID, parameters,
+			[&promise](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const status, la::avdecc::entity::controller::DynamicInfoParameters const& parameters)
+			{
+				EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, status);
+				promise.set_value(parameters);
+			});
+		auto future = promise.get_future();
+		ASSERT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		auto const results = future.get();
+		ASSERT_EQ(parameters.size(), results.size());
+		for (auto const& result : results)
+		{
+			EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, result.status);
+		}
+		EXPECT_EQ(0u, std::any_cast<la::avdecc::entity::model::ConfigurationIndex>(results[0].arguments.at(0)));
+		EXPECT_EQ(la::avdecc::entity::model::StreamFormat{ 0x00A0020140000100 }, std::any_cast<la::avdecc::entity::model::StreamFormat>(results[1].arguments.at(2)));
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" }, std::any_cast<la::avdecc::entity::model::AvdeccFixedString>(results[2].arguments.at(4)));
+		EXPECT_EQ((la::avdecc::entity::model::SamplingRate{ 0, 96000 }), std::any_cast<la::avdecc::entity::model::SamplingRate>(results[3].arguments.at(2)));
+		EXPECT_EQ(1u, std::any_cast<la::avdecc::entity::model::ClockSourceIndex>(results[4].arguments.at(1)));
+		EXPECT_EQ(2000000u, std::any_cast<std::uint64_t>(results[5].arguments.at(1)));
+		EXPECT_EQ(1234u, std::any_cast<std::uint64_t>(results[6].arguments.at(2)));
+		auto const validCounters = la::avdecc::entity::EntityCounterValidFlags{ la::avdecc::entity::EntityCounterValidFlag::EntitySpecific1 };
+		EXPECT_EQ(validCounters.value(), std::any_cast<la::avdecc::entity::model::DescriptorCounterValidFlag>(results[7].arguments.at(2)));
+		EXPECT_EQ(7u, std::any_cast<la::avdecc::entity::model::DescriptorCounters>(results[7].arguments.at(3))[validCounters.getPosition(la::avdecc::entity::EntityCounterValidFlag::EntitySpecific1)]);
+	}
+	EXPECT_EQ(7u, observer.commandsCount.load());
+
+	entities.getModelProtocolInterface().unregisterObserver(&observer);
+}
+
+TEST(ControllerEntity, CommandBatch)
+{
+	static constexpr auto ModelEntityID = EntityModelEntities::ModelEntityID;
+	static constexpr auto UnknownEntityID = la::avdecc::UniqueIdentifier{ 0x0001020304050609 };
+
+	// Build an Entity Model answering the GET commands
+	auto entityTree = la::avdecc::entity::model::EntityTree{};
+	entityTree.dynamicModel.entityName = la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" };
+	entityTree.configurationTrees[la::avdecc::entity::model::ConfigurationIndex{ 0u }].audioUnitTrees[la::avdecc::entity::model::AudioUnitIndex{ 0u }].dynamicModel.currentSamplingRate = la::avdecc::entity::model::SamplingRate{ 0, 48000 };
+
+	// Create the entity exposing the Entity Model and a controller, and wait for the entity to be discovered
+	auto delegate = EntityModelEntities::Delegate{};
+	auto entities = EntityModelEntities{ entityTree, delegate };
+	ASSERT_TRUE(entities.waitForModelEntityOnline());
+	auto& controller = entities.getController();
+
+	// Same commands for both policies, the third one failing
+	auto entityName = la::avdecc::entity::model::AvdeccFixedString{};
+	auto const fillBatch = [&entityName](la::avdecc::entity::controller::CommandBatch& batch)
+	{
+		batch.add(&la::avdecc::entity::controller::Interface::getConfiguration, ModelEntityID);
+		batch.add(&la::avdecc::entity::controller::Interface::getEntityName, ModelEntityID,
+			[&entityName](la::avdecc::entity::controller::Interface const* const /*controller*/, la::avdecc::UniqueIdentifier const /*entityID*/, la::avdecc::entity::LocalEntity::AemCommandStatus const /*status*/, la::avdecc::entity::model::AvdeccFixedString const& name)
+			{
+				entityName = name;
+			});
+		batch.add(&la::avdecc::entity::controller::Interface::getStreamInputFormat, ModelEntityID, 5u);
+		batch.add(&la::avdecc::entity::controller::Interface::getAudioUnitSamplingRate, ModelEntityID, 0u);
+	};
+	auto const submitBatch = [](la::avdecc::entity::controller::CommandBatch& batch)
+	{
+		auto promise = std::promise<la::avdecc::entity::controller::CommandBatch::Results>{};
+		batch.submit(
+			[&promise](la::avdecc::entity::controller::CommandBatch::Results const& results)
+			{
+				promise.set_value(results);
+			});
+		auto future = promise.get_future();
+		EXPECT_NE(std::future_status::timeout, future.wait_for(std::chrono::seconds(2)));
+		return future.get();
+	};
+
+	// Best effort: all commands sent, one completion with every result
+	{
+		auto batch = la::avdecc::entity::controller::CommandBatch{ controller };
+		fillBatch(batch);
+		batch.add(&la::avdecc::entity::controller::Interface::getConfiguration, UnknownEntityID);
+		EXPECT_EQ(5u, batch.size());
+
+		auto const results = submitBatch(batch);
+		EXPECT_EQ(0u, batch.size());
+		ASSERT_EQ(5u, results.size());
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, results[0].status);
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, results[1].status);
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::NoSuchDescriptor, results[2].status);
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, results[3].status);
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::UnknownEntity, results[4].status);
+		EXPECT_EQ(UnknownEntityID, results[4].targetEntityID);
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" }, entityName);
+	}
+
+	// Stop on first error: the commands following the failed one are skipped
+	{
+		entityName = {};
+		auto batch = la::avdecc::entity::controller::CommandBatch{ controller, la::avdecc::entity::controller::CommandBatch::ErrorPolicy::StopOnFirstError };
+		fillBatch(batch);
+
+		auto const results = submitBatch(batch);
+		ASSERT_EQ(4u, results.size());
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, results[0].status);
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, results[1].status);
+		EXPECT_EQ(la::avdecc::entity::LocalEntity::AemCommandStatus::NoSuchDescriptor, results[2].status);
+		EXPECT_FALSE(results[3].status.has_value());
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ "Model Entity" }, entityName);
+	}
+
+	// Empty batch completes right away
+	{
+		auto batch = la::avdecc::entity::controller::CommandBatch{ controller };
+		EXPECT_TRUE(submitBatch(batch).empty());
+	}
+}
+
 //TEST(ControllerEntity, DestroyWhileSending)
 //{
 //	static std::promise<void> commandResultPromise{};
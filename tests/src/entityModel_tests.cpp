@@ -25,6 +25,8 @@
 // Public API
 #include <la/avdecc/utils.hpp>
 #include <la/avdecc/internals/entityModelTreeDynamic.hpp>
+#include <la/avdecc/internals/entityModelControlValues.hpp>
+#include <la/avdecc/internals/entityModelControlValuesTraits.hpp>
 
 #include <gtest/gtest.h>
 
@@ -297,3 +299,123 @@ TEST(EntityModel, StreamOutputCountersConcatenate)
 		}
 	}
 }
+
+TEST(EntityModel, ControlValuesStorage)
+{
+	using LinearDynamic = la::avdecc::entity::model::LinearValues<la::avdecc::entity::model::LinearValueDynamic<std::int16_t>>;
+	using ArrayDynamic = la::avdecc::entity::model::ArrayValueDynamic<std::uint8_t>;
+	using Utf8Dynamic = la::avdecc::entity::model::UTF8StringValueDynamic;
+
+	auto linear = LinearDynamic{};
+	linear.addValue({ -10 });
+	linear.addValue({ 20 });
+	auto array = ArrayDynamic{};
+	array.currentValues = { 1u, 2u, 3u };
+	auto utf8 = Utf8Dynamic{};
+	utf8.currentValue[0] = 'A';
+
+	auto linearValues = la::avdecc::entity::model::ControlValues{ linear };
+	auto arrayValues = la::avdecc::entity::model::ControlValues{ array };
+	auto utf8Values = la::avdecc::entity::model::ControlValues{ utf8 }; // Too big to be stored inline
+
+	EXPECT_EQ(linear, linearValues.getValues<LinearDynamic>());
+	EXPECT_EQ(array, arrayValues.getValues<ArrayDynamic>());
+	EXPECT_EQ(utf8, utf8Values.getValues<Utf8Dynamic>());
+	EXPECT_THROW(linearValues.getValues<ArrayDynamic>(), std::invalid_argument);
+	EXPECT_THROW(la::avdecc::entity::model::ControlValues{}.getValues<LinearDynamic>(), std::invalid_argument);
+
+	// Copy
+	{
+		auto copy = linearValues;
+		EXPECT_TRUE(copy.isEqualTo<LinearDynamic>(linearValues));
+		auto utf8Copy = utf8Values;
+		EXPECT_TRUE(utf8Copy.isEqualTo<Utf8Dynamic>(utf8Values));
+	}
+
+	// Copy assignment, with the same and with a different type
+	{
+		auto other = LinearDynamic{};
+		other.addValue({ 5 });
+		auto assigned = la::avdecc::entity::model::ControlValues{ other };
+		assigned = linearValues;
+		EXPECT_EQ(2u, assigned.size());
+		EXPECT_EQ(linear, assigned.getValues<LinearDynamic>());
+		assigned = utf8Values;
+		EXPECT_EQ(la::avdecc::entity::model::ControlValueType::Type::ControlUtf8, assigned.getType());
+		EXPECT_EQ(utf8, assigned.getValues<Utf8Dynamic>());
+		assigned = arrayValues;
+		EXPECT_EQ(array, assigned.getValues<ArrayDynamic>());
+	}
+
+	// Move
+	{
+		auto moved = std::move(arrayValues);
+		EXPECT_EQ(array, moved.getValues<ArrayDynamic>());
+		auto movedUtf8 = la::avdecc::entity::model::ControlValues{};
+		movedUtf8 = std::move(utf8Values);
+		EXPECT_EQ(utf8, movedUtf8.getValues<Utf8Dynamic>());
+	}
+}
+
+TEST(EntityModel, InternedAvdeccFixedString)
+{
+	using Interned = la::avdecc::entity::model::InternedAvdeccFixedString;
+
+	auto const str1 = la::avdecc::entity::model::AvdeccFixedString{ std::string{ "Interned String 1" } };
+	auto const str2 = la::avdecc::entity::model::AvdeccFixedString{ std::string{ "Interned String 2" } };
+
+	auto const interned1 = Interned{ str1 };
+	auto const poolSize = Interned::getPoolSize();
+	auto const interned1Again = Interned{ la::avdecc::entity::model::AvdeccFixedString{ std::string{ "Interned String 1" } } };
+	auto const interned2 = Interned{ str2 };
+
+	// Same string shares the same storage
+	EXPECT_EQ(interned1, interned1Again);
+	EXPECT_EQ(&interned1.get(), &interned1Again.get());
+	EXPECT_EQ(Interned::hash{}(interned1), Interned::hash{}(interned1Again));
+	EXPECT_EQ(poolSize + 1u, Interned::getPoolSize());
+
+	// Different strings
+	EXPECT_NE(interned1, interned2);
+	EXPECT_EQ(str1, interned1.get());
+	EXPECT_EQ(str2, static_cast<la::avdecc::entity::model::AvdeccFixedString const&>(interned2));
+
+	// Default constructed is the empty string
+	auto const empty = Interned{};
+	EXPECT_TRUE(empty.get().empty());
+	EXPECT_EQ(empty, Interned{ la::avdecc::entity::model::AvdeccFixedString{} });
+
+	// Copy
+	auto copy = empty;
+	copy = interned2;
+	EXPECT_EQ(interned2, copy);
+}
+
+TEST(EntityModel, InternedAvdeccFixedStringEviction)
+{
+	using Interned = la::avdecc::entity::model::InternedAvdeccFixedString;
+
+	auto const poolSize = Interned::getPoolSize();
+	{
+		auto interned = std::optional<Interned>{ Interned{ la::avdecc::entity::model::AvdeccFixedString{ std::string{ "Evicted String" } } } };
+		auto copy = *interned;
+		auto moved = std::move(copy);
+		EXPECT_EQ(poolSize + 1u, Interned::getPoolSize());
+
+		// Still referenced by the other handles
+		interned.reset();
+		EXPECT_EQ(poolSize + 1u, Interned::getPoolSize());
+		EXPECT_EQ(la::avdecc::entity::model::AvdeccFixedString{ std::string{ "Evicted String" } }, moved.get());
+
+		// Reassigning the last handle releases the string
+		moved = Interned{};
+		EXPECT_EQ(poolSize, Interned::getPoolSize());
+	}
+
+	// Interning the string again adds it back
+	{
+		auto const interned = Interned{ la::avdecc::entity::model::AvdeccFixedString{ std::string{ "Evicted String" } } };
+		EXPECT_EQ(poolSize + 1u, Interned::getPoolSize());
+	}
+	EXPECT_EQ(poolSize, Interned::getPoolSize());
+}
@@ -30,6 +30,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 /***********************************************************/
 /* AEM tests                                               */
 /***********************************************************/
@@ -54,3 +58,104 @@ TEST(Aem, SerializeFrame)
 
 #pragma message("TODO: Check raw buffer values")
 }
+
+namespace
+{
+la::avdecc::protocol::SerializationBuffer serializeAemResponse(std::vector<std::uint8_t> const& payload)
+{
+	auto frame = la::avdecc::protocol::AemAecpdu::create(true);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*frame);
+	aem.setTargetEntityID(la::avdecc::UniqueIdentifier{ 0x0001020304050607 });
+	aem.setControllerEntityID(la::avdecc::UniqueIdentifier{ 0x08090A0B0C0D0E0F });
+	aem.setSequenceID(0x1234);
+	aem.setCommandType(la::avdecc::protocol::AemCommandType::ReadDescriptor);
+	aem.setCommandSpecificData(payload.data(), payload.size());
+
+	auto buffer = la::avdecc::protocol::SerializationBuffer{};
+	la::avdecc::protocol::serialize<la::avdecc::protocol::AvtpduControl>(aem, buffer);
+	la::avdecc::protocol::serialize<la::avdecc::protocol::Aecpdu>(aem, buffer);
+	return buffer;
+}
+} // namespace
+
+TEST(Aem, DeserializeCopiesPayload)
+{
+	auto const payload = std::vector<std::uint8_t>{ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+	auto const buffer = serializeAemResponse(payload);
+
+	auto frame = la::avdecc::protocol::AemAecpdu::create(true);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*frame);
+	auto des = la::avdecc::protocol::DeserializationBuffer{ buffer.data(), buffer.size() };
+	la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(&aem, des);
+	la::avdecc::protocol::deserialize<la::avdecc::protocol::Aecpdu>(&aem, des);
+
+	EXPECT_FALSE(aem.isPayloadBorrowed());
+	auto const [data, size] = aem.getPayload();
+	ASSERT_EQ(payload.size(), size);
+	EXPECT_EQ(0, std::memcmp(payload.data(), data, size));
+	EXPECT_TRUE(static_cast<std::uint8_t const*>(data) < buffer.data() || static_cast<std::uint8_t const*>(data) >= buffer.data() + buffer.size());
+}
+
+TEST(Aem, DeserializeBorrowsPayload)
+{
+	auto const payload = std::vector<std::uint8_t>{ 0x10, 0x11, 0x12, 0x13, 0x14, 0x15 };
+	auto const buffer = serializeAemResponse(payload);
+
+	auto frame = la::avdecc::protocol::AemAecpdu::create(true);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*frame);
+	auto des = la::avdecc::protocol::DeserializationBuffer{ buffer.data(), buffer.size() };
+	des.setBorrowingAllowed(true);
+	la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(&aem, des);
+	la::avdecc::protocol::deserialize<la::avdecc::protocol::Aecpdu>(&aem, des);
+
+	// Header fields
+	EXPECT_EQ(la::avdecc::protocol::AecpMessageType::AemResponse, aem.getMessageType());
+	EXPECT_EQ(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, aem.getTargetEntityID());
+	EXPECT_EQ(la::avdecc::UniqueIdentifier{ 0x08090A0B0C0D0E0F }, aem.getControllerEntityID());
+	EXPECT_EQ(0x1234, aem.getSequenceID());
+	EXPECT_EQ(la::avdecc::protocol::AemCommandType::ReadDescriptor, aem.getCommandType());
+
+	// Payload is referencing the buffer
+	EXPECT_TRUE(aem.isPayloadBorrowed());
+	auto const [data, size] = aem.getPayload();
+	ASSERT_EQ(payload.size(), size);
+	EXPECT_EQ(buffer.data() + buffer.size() - payload.size(), data);
+
+	// Serializing a borrowed payload
+	auto reserialized = la::avdecc::protocol::SerializationBuffer{};
+	la::avdecc::protocol::serialize<la::avdecc::protocol::AvtpduControl>(aem, reserialized);
+	la::avdecc::protocol::serialize<la::avdecc::protocol::Aecpdu>(aem, reserialized);
+	ASSERT_EQ(buffer.size(), reserialized.size());
+	EXPECT_EQ(0, std::memcmp(buffer.data(), reserialized.data(), buffer.size()));
+}
+
+TEST(Aem, CopyOwnsBorrowedPayload)
+{
+	auto const payload = std::vector<std::uint8_t>{ 0x20, 0x21, 0x22, 0x23 };
+	auto const buffer = serializeAemResponse(payload);
+	auto frameData = std::vector<std::uint8_t>(buffer.data(), buffer.data() + buffer.size());
+
+	auto frame = la::avdecc::protocol::AemAecpdu::create(true);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*frame);
+	auto des = la::avdecc::protocol::DeserializationBuffer{ frameData.data(), frameData.size() };
+	des.setBorrowingAllowed(true);
+	la::avdecc::protocol::deserialize<la::avdecc::protocol::AvtpduControl>(&aem, des);
+	la::avdecc::protocol::deserialize<la::avdecc::protocol::Aecpdu>(&aem, des);
+	ASSERT_TRUE(aem.isPayloadBorrowed());
+
+	auto const copy = aem;
+	auto assigned = la::avdecc::protocol::AemAecpdu{ false };
+	assigned = aem;
+
+	// Overwrite the original frame, copies must not be affected
+	std::fill(frameData.begin(), frameData.end(), std::uint8_t{ 0xff });
+
+	for (auto const* const pdu : std::vector<la::avdecc::protocol::AemAecpdu const*>{ &copy, &assigned })
+	{
+		EXPECT_FALSE(pdu->isPayloadBorrowed());
+		EXPECT_EQ(la::avdecc::protocol::AemCommandType::ReadDescriptor, pdu->getCommandType());
+		auto const [data, size] = pdu->getPayload();
+		ASSERT_EQ(payload.size(), size);
+		EXPECT_EQ(0, std::memcmp(payload.data(), data, size));
+	}
+}
@@ -0,0 +1,186 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolBulkEndian_tests.cpp
+* @author Christophe Calmejane
+*/
+
+// Internal API
+#include "protocol/protocolBulkEndian.hpp"
+#include "protocol/protocolAemPayloads.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+std::vector<std::uint8_t> makeBytes(std::size_t const size)
+{
+	auto bytes = std::vector<std::uint8_t>(size);
+	for (auto i = std::size_t{ 0u }; i < size; ++i)
+	{
+		bytes[i] = static_cast<std::uint8_t>(i * 7u + 3u);
+	}
+	return bytes;
+}
+
+/** Compares the vectorized path with the scalar one, for counts covering the SIMD blocks and the remaining values, and for unaligned source and destination */
+template<std::size_t ValueSize>
+void checkSwapBytesArray()
+{
+	static constexpr auto MaxCount = std::size_t{ 70u };
+	static constexpr auto MaxMisalignment = std::size_t{ 3u };
+	auto const source = makeBytes(MaxCount * ValueSize + MaxMisalignment);
+
+	for (auto count = std::size_t{ 0u }; count <= MaxCount; ++count)
+	{
+		for (auto srcOffset = std::size_t{ 0u }; srcOffset <= MaxMisalignment; ++srcOffset)
+		{
+			for (auto dstOffset = std::size_t{ 0u }; dstOffset <= MaxMisalignment; ++dstOffset)
+			{
+				auto expected = std::vector<std::uint8_t>(MaxCount * ValueSize + MaxMisalignment, 0xAA);
+				auto result = expected;
+				la::avdecc::protocol::detail::swapBytesArrayScalar<ValueSize>(expected.data() + dstOffset, source.data() + srcOffset, count);
+				la::avdecc::protocol::swapBytesArray<ValueSize>(result.data() + dstOffset, source.data() + srcOffset, count);
+				ASSERT_EQ(expected, result) << "ValueSize=" << ValueSize << " count=" << count << " srcOffset=" << srcOffset << " dstOffset=" << dstOffset;
+			}
+		}
+	}
+}
+
+template<typename T>
+void checkLoadStoreBigEndianArray()
+{
+	static constexpr auto Count = std::size_t{ 37u };
+	auto const wire = makeBytes(Count * sizeof(T));
+
+	// Load must match the scalar network to host conversion
+	auto values = std::vector<T>(Count);
+	la::avdecc::protocol::loadBigEndianArray<sizeof(T)>(values.data(), wire.data(), Count);
+	for (auto i = std::size_t{ 0u }; i < Count; ++i)
+	{
+		auto raw = T{};
+		std::memcpy(&raw, wire.data() + i * sizeof(T), sizeof(T));
+		auto const expected = AVDECC_UNPACK_TYPE(raw, T);
+		EXPECT_EQ(expected, values[i]);
+	}
+
+	// Store must give back the original bytes
+	auto stored = std::vector<std::uint8_t>(Count * sizeof(T));
+	la::avdecc::protocol::storeBigEndianArray<sizeof(T)>(stored.data(), values.data(), Count);
+	EXPECT_EQ(wire, stored);
+}
+} // namespace
+
+TEST(BulkEndian, SwapBytesArray16)
+{
+	checkSwapBytesArray<2>();
+}
+
+TEST(BulkEndian, SwapBytesArray32)
+{
+	checkSwapBytesArray<4>();
+}
+
+TEST(BulkEndian, SwapBytesArray64)
+{
+	checkSwapBytesArray<8>();
+}
+
+TEST(BulkEndian, SwapBytesArrayValues)
+{
+	auto const source = std::vector<std::uint8_t>{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+	auto result = std::vector<std::uint8_t>(source.size());
+
+	la::avdecc::protocol::swapBytesArray<2>(result.data(), source.data(), 4u);
+	EXPECT_EQ((std::vector<std::uint8_t>{ 0x02, 0x01, 0x04, 0x03, 0x06, 0x05, 0x08, 0x07 }), result);
+	la::avdecc::protocol::swapBytesArray<4>(result.data(), source.data(), 2u);
+	EXPECT_EQ((std::vector<std::uint8_t>{ 0x04, 0x03, 0x02, 0x01, 0x08, 0x07, 0x06, 0x05 }), result);
+	la::avdecc::protocol::swapBytesArray<8>(result.data(), source.data(), 1u);
+	EXPECT_EQ((std::vector<std::uint8_t>{ 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01 }), result);
+}
+
+TEST(BulkEndian, LoadStoreBigEndianArray)
+{
+	checkLoadStoreBigEndianArray<std::uint16_t>();
+	checkLoadStoreBigEndianArray<std::uint32_t>();
+	checkLoadStoreBigEndianArray<std::uint64_t>();
+}
+
+TEST(BulkEndian, ForEachBigEndianValue)
+{
+	static constexpr auto Count = std::size_t{ 41u }; // More than 2 batches, with remaining values
+	auto const wire = makeBytes(Count * sizeof(std::uint32_t));
+
+	auto values = std::vector<std::uint32_t>{};
+	la::avdecc::protocol::forEachBigEndianValue<sizeof(std::uint32_t)>(wire.data(), Count,
+		[&values](std::uint32_t const value)
+		{
+			values.push_back(value);
+		});
+
+	ASSERT_EQ(Count, values.size());
+	for (auto i = std::size_t{ 0u }; i < Count; ++i)
+	{
+		auto raw = std::uint32_t{};
+		std::memcpy(&raw, wire.data() + i * sizeof(raw), sizeof(raw));
+		auto const expected = AVDECC_UNPACK_DWORD(raw);
+		EXPECT_EQ(expected, values[i]);
+	}
+}
+
+TEST(BulkEndian, AudioMappingsPayload)
+{
+	auto mappings = la::avdecc::entity::model::AudioMappings{};
+	for (auto i = 0u; i < 50u; ++i)
+	{
+		mappings.push_back(la::avdecc::entity::model::AudioMapping{ static_cast<la::avdecc::entity::model::StreamIndex>(i), static_cast<std::uint16_t>(i + 0x0100), static_cast<la::avdecc::entity::model::ClusterIndex>(i + 0x0200), static_cast<std::uint16_t>(i + 0x0300) });
+	}
+
+	auto const ser = la::avdecc::protocol::aemPayload::serializeAddAudioMappingsCommand(la::avdecc::entity::model::DescriptorType::StreamPortInput, 1u, mappings);
+
+	// Check the wire format of the first mapping
+	auto const* const firstMapping = ser.data() + la::avdecc::protocol::aemPayload::AecpAemAddAudioMappingsCommandPayloadMinSize;
+	EXPECT_EQ((std::vector<std::uint8_t>{ 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00 }), (std::vector<std::uint8_t>{ firstMapping, firstMapping + 8 }));
+
+	auto const [descriptorType, descriptorIndex, result] = la::avdecc::protocol::aemPayload::deserializeAddAudioMappingsCommand({ ser.data(), ser.size() });
+	EXPECT_EQ(la::avdecc::entity::model::DescriptorType::StreamPortInput, descriptorType);
+	EXPECT_EQ(1u, descriptorIndex);
+	EXPECT_EQ(mappings, result);
+}
+
+TEST(BulkEndian, CountersPayload)
+{
+	auto counters = la::avdecc::entity::model::DescriptorCounters{};
+	for (auto i = 0u; i < counters.size(); ++i)
+	{
+		counters[i] = 0x01020300u + i;
+	}
+
+	auto const ser = la::avdecc::protocol::aemPayload::serializeGetCountersResponse(la::avdecc::entity::model::DescriptorType::AvbInterface, 0u, la::avdecc::entity::model::DescriptorCounterValidFlag{ 0x3u }, counters);
+	auto const [descriptorType, descriptorIndex, validCounters, result] = la::avdecc::protocol::aemPayload::deserializeGetCountersResponse(la::avdecc::entity::LocalEntity::AemCommandStatus::Success, { ser.data(), ser.size() });
+	EXPECT_EQ(la::avdecc::entity::model::DescriptorType::AvbInterface, descriptorType);
+	EXPECT_EQ(0u, descriptorIndex);
+	EXPECT_EQ(0x3u, validCounters);
+	EXPECT_EQ(counters, result);
+}
@@ -0,0 +1,451 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_composite_tests.cpp
+* @author Christophe Calmejane
+*/
+
+// Public API
+#include <la/avdecc/executor.hpp>
+#include <la/avdecc/internals/protocolAdpdu.hpp>
+#include <la/avdecc/internals/protocolAemAecpdu.hpp>
+
+// Internal API
+#include "protocolInterface/protocolInterface_composite.hpp"
+#include "protocolInterface/protocolInterface_virtual.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+static auto constexpr DefaultExecutorName = "avdecc::protocol::PI";
+static auto const CompositeMacAddressA = la::networkInterface::MacAddress{ 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static auto const CompositeMacAddressB = la::networkInterface::MacAddress{ 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static auto const DeviceMacAddressA = la::networkInterface::MacAddress{ 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02 };
+static auto const DeviceMacAddressB = la::networkInterface::MacAddress{ 0x0b, 0x00, 0x00, 0x00, 0x00, 0x02 };
+
+la::avdecc::protocol::ProtocolInterface::UniquePointer createVirtualInterface(std::string const& networkName, la::networkInterface::MacAddress const& macAddress)
+{
+	return la::avdecc::protocol::ProtocolInterface::UniquePointer{ la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual(networkName, macAddress, DefaultExecutorName),
+		[](la::avdecc::protocol::ProtocolInterface* self)
+		{
+			delete self;
+		} };
+}
+
+la::avdecc::protocol::Adpdu buildAdpdu(la::networkInterface::MacAddress const& srcAddress, la::avdecc::UniqueIdentifier const entityID, std::uint32_t const availableIndex)
+{
+	auto adpdu = la::avdecc::protocol::Adpdu{};
+	// Set Ether2 fields
+	adpdu.setSrcAddress(srcAddress);
+	adpdu.setDestAddress(la::avdecc::protocol::Adpdu::Multicast_Mac_Address);
+	// Set ADP fields
+	adpdu.setMessageType(la::avdecc::protocol::AdpMessageType::EntityAvailable);
+	adpdu.setValidTime(31);
+	adpdu.setEntityID(entityID);
+	adpdu.setEntityModelID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+	adpdu.setEntityCapabilities({});
+	adpdu.setTalkerStreamSources(0);
+	adpdu.setTalkerCapabilities({});
+	adpdu.setListenerStreamSinks(0);
+	adpdu.setListenerCapabilities({});
+	adpdu.setControllerCapabilities(la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented });
+	adpdu.setAvailableIndex(availableIndex);
+	adpdu.setGptpGrandmasterID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+	adpdu.setGptpDomainNumber(0);
+	adpdu.setIdentifyControlIndex(0);
+	adpdu.setInterfaceIndex(0);
+	adpdu.setAssociationID(la::avdecc::UniqueIdentifier{});
+	return adpdu;
+}
+
+la::avdecc::protocol::AemAecpdu buildAemAecpdu(la::networkInterface::MacAddress const& srcAddress, la::networkInterface::MacAddress const& destAddress, bool const isResponse)
+{
+	auto aecpdu = la::avdecc::protocol::AemAecpdu{ isResponse };
+	aecpdu.setSrcAddress(srcAddress);
+	aecpdu.setDestAddress(destAddress);
+	aecpdu.setStatus(la::avdecc::protocol::AemAecpStatus::Success);
+	aecpdu.setTargetEntityID(la::avdecc::UniqueIdentifier{ 0x0001020304050607 });
+	aecpdu.setControllerEntityID(la::avdecc::UniqueIdentifier{ 0x0807060504030201 });
+	aecpdu.setSequenceID(1u);
+	aecpdu.setUnsolicited(false);
+	aecpdu.setCommandType(la::avdecc::protocol::AemCommandType::EntityAvailable);
+	return aecpdu;
+}
+
+/** Records low level messages received by a ProtocolInterface */
+class RecordingObserver final : public la::avdecc::protocol::ProtocolInterface::Observer
+{
+public:
+	struct Message
+	{
+		la::networkInterface::MacAddress srcAddress{};
+		la::networkInterface::MacAddress destAddress{};
+		std::uint32_t availableIndex{ 0u };
+	};
+
+	template<class Predicate>
+	bool waitFor(Predicate&& predicate)
+	{
+		auto lock = std::unique_lock{ _lock };
+		return _condition.wait_for(lock, std::chrono::seconds(2),
+			[this, &predicate]()
+			{
+				return predicate(*this);
+			});
+	}
+
+	std::vector<Message> adpdus{};
+	std::vector<Message> aecpdus{};
+	std::size_t remoteEntityOnlineCount{ 0u };
+	std::size_t transportErrorCount{ 0u };
+
+private:
+	virtual void onTransportError(la::avdecc::protocol::ProtocolInterface* const /*pi*/) noexcept override
+	{
+		auto const lg = std::lock_guard{ _lock };
+		++transportErrorCount;
+		_condition.notify_all();
+	}
+	virtual void onRemoteEntityOnline(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::entity::Entity const& /*entity*/) noexcept override
+	{
+		auto const lg = std::lock_guard{ _lock };
+		++remoteEntityOnlineCount;
+		_condition.notify_all();
+	}
+	virtual void onAdpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Adpdu const& adpdu) noexcept override
+	{
+		auto const lg = std::lock_guard{ _lock };
+		adpdus.push_back(Message{ adpdu.getSrcAddress(), adpdu.getDestAddress(), adpdu.getAvailableIndex() });
+		_condition.notify_all();
+	}
+	virtual void onAecpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
+	{
+		auto const lg = std::lock_guard{ _lock };
+		aecpdus.push_back(Message{ aecpdu.getSrcAddress(), aecpdu.getDestAddress() });
+		_condition.notify_all();
+	}
+
+	std::mutex _lock{};
+	std::condition_variable _condition{};
+	DECLARE_AVDECC_OBSERVER_GUARD(RecordingObserver);
+};
+
+std::size_t countFrom(std::vector<RecordingObserver::Message> const& messages, la::networkInterface::MacAddress const& srcAddress)
+{
+	auto count = std::size_t{ 0u };
+	for (auto const& message : messages)
+	{
+		if (message.srcAddress == srcAddress)
+		{
+			++count;
+		}
+	}
+	return count;
+}
+
+} // namespace
+
+TEST(ProtocolInterfaceComposite, NoInterface)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	// Not using EXPECT_THROW, we want to check the error code inside our custom exception
+	try
+	{
+		la::avdecc::protocol::ProtocolInterface::createComposite({});
+		EXPECT_FALSE(true); // We expect an exception to have been raised
+	}
+	catch (la::avdecc::protocol::ProtocolInterface::Exception const& e)
+	{
+		EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::InvalidParameters, e.getError());
+	}
+}
+
+TEST(ProtocolInterfaceComposite, DifferentExecutors)
+{
+	static auto constexpr OtherExecutorName = "avdecc::protocol::PI::Other";
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto const otherExecutorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(OtherExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(OtherExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	auto interfaces = std::vector<la::avdecc::protocol::ProtocolInterface::UniquePointer>{};
+	interfaces.push_back(createVirtualInterface("CompositeExecutorsA", CompositeMacAddressA));
+	interfaces.push_back(la::avdecc::protocol::ProtocolInterface::UniquePointer{ la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("CompositeExecutorsB", CompositeMacAddressB, OtherExecutorName),
+		[](la::avdecc::protocol::ProtocolInterface* self)
+		{
+			delete self;
+		} });
+
+	// Not using EXPECT_THROW, we want to check the error code inside our custom exception
+	try
+	{
+		la::avdecc::protocol::ProtocolInterface::createComposite(std::move(interfaces));
+		EXPECT_FALSE(true); // We expect an exception to have been raised
+	}
+	catch (la::avdecc::protocol::ProtocolInterface::Exception const& e)
+	{
+		EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::InvalidParameters, e.getError());
+	}
+}
+
+TEST(ProtocolInterfaceComposite, AdpSentOnAllInterfaces)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	auto deviceA = createVirtualInterface("CompositeAdpA", DeviceMacAddressA);
+	auto deviceB = createVirtualInterface("CompositeAdpB", DeviceMacAddressB);
+	auto interfaces = std::vector<la::avdecc::protocol::ProtocolInterface::UniquePointer>{};
+	interfaces.push_back(createVirtualInterface("CompositeAdpA", CompositeMacAddressA));
+	interfaces.push_back(createVirtualInterface("CompositeAdpB", CompositeMacAddressB));
+	auto composite = la::avdecc::protocol::ProtocolInterface::createComposite(std::move(interfaces));
+
+	// The composite uses the MacAddress of the primary interface
+	EXPECT_EQ(CompositeMacAddressA, composite->getMacAddress());
+
+	auto observerA = RecordingObserver{};
+	auto observerB = RecordingObserver{};
+	deviceA->registerObserver(&observerA);
+	deviceB->registerObserver(&observerB);
+
+	// Discovery message is sent on both networks, using the MacAddress of each interface
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, composite->discoverRemoteEntities());
+	EXPECT_TRUE(observerA.waitFor(
+		[](auto const& obs)
+		{
+			return countFrom(obs.adpdus, CompositeMacAddressA) == 1u;
+		}));
+	EXPECT_TRUE(observerB.waitFor(
+		[](auto const& obs)
+		{
+			return countFrom(obs.adpdus, CompositeMacAddressB) == 1u;
+		}));
+	EXPECT_EQ(0u, countFrom(observerB.adpdus, CompositeMacAddressA));
+}
+
+TEST(ProtocolInterfaceComposite, DuplicateAdpProcessedOnce)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	auto deviceA = createVirtualInterface("CompositeDuplicateA", DeviceMacAddressA);
+	auto deviceB = createVirtualInterface("CompositeDuplicateB", DeviceMacAddressB);
+	auto interfaces = std::vector<la::avdecc::protocol::ProtocolInterface::UniquePointer>{};
+	interfaces.push_back(createVirtualInterface("CompositeDuplicateA", CompositeMacAddressA));
+	interfaces.push_back(createVirtualInterface("CompositeDuplicateB", CompositeMacAddressB));
+	auto composite = la::avdecc::protocol::ProtocolInterface::createComposite(std::move(interfaces));
+
+	auto observer = RecordingObserver{};
+	composite->registerObserver(&observer);
+
+	// Same entity, seen on both networks (same sender)
+	auto const entityMacAddress = la::networkInterface::MacAddress{ 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01 };
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x0001020304050607 };
+
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, deviceA->sendAdpMessage(buildAdpdu(entityMacAddress, entityID, 1u)));
+	ASSERT_TRUE(observer.waitFor(
+		[](auto const& obs)
+		{
+			return obs.adpdus.size() == 1u;
+		}));
+
+	// Duplicate on the other network is dropped, next advertisement is processed
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, deviceB->sendAdpMessage(buildAdpdu(entityMacAddress, entityID, 1u)));
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, deviceA->sendAdpMessage(buildAdpdu(entityMacAddress, entityID, 2u)));
+	ASSERT_TRUE(observer.waitFor(
+		[](auto const& obs)
+		{
+			return obs.adpdus.size() == 2u;
+		}));
+
+	EXPECT_EQ(1u, observer.adpdus[0].availableIndex);
+	EXPECT_EQ(2u, observer.adpdus[1].availableIndex);
+	EXPECT_EQ(1u, observer.remoteEntityOnlineCount);
+
+	composite->unregisterObserver(&observer);
+}
+
+TEST(ProtocolInterfaceComposite, SameEntitySeenOnBothLinks)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	// Entity reachable from both links (segments bridged together): same MacAddress on both networks
+	auto const entityMacAddress = la::networkInterface::MacAddress{ 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01 };
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x0001020304050607 };
+	auto entityA = createVirtualInterface("CompositeBridgedA", entityMacAddress);
+	auto entityB = createVirtualInterface("CompositeBridgedB", entityMacAddress);
+	auto interfaces = std::vector<la::avdecc::protocol::ProtocolInterface::UniquePointer>{};
+	interfaces.push_back(createVirtualInterface("CompositeBridgedA", CompositeMacAddressA));
+	interfaces.push_back(createVirtualInterface("CompositeBridgedB", CompositeMacAddressB));
+	auto composite = la::avdecc::protocol::ProtocolInterface::createComposite(std::move(interfaces));
+
+	auto compositeObserver = RecordingObserver{};
+	auto observerA = RecordingObserver{};
+	auto observerB = RecordingObserver{};
+	composite->registerObserver(&compositeObserver);
+	entityA->registerObserver(&observerA);
+	entityB->registerObserver(&observerB);
+
+	// Entity first seen on the primary link
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, entityA->sendAdpMessage(buildAdpdu(entityMacAddress, entityID, 1u)));
+	ASSERT_TRUE(compositeObserver.waitFor(
+		[&entityMacAddress](auto const& obs)
+		{
+			return countFrom(obs.adpdus, entityMacAddress) == 1u;
+		}));
+
+	// Then each advertisement is received on both links, not always first on the same one
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, entityB->sendAdpMessage(buildAdpdu(entityMacAddress, entityID, 1u)));
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, entityB->sendAdpMessage(buildAdpdu(entityMacAddress, entityID, 2u)));
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, entityA->sendAdpMessage(buildAdpdu(entityMacAddress, entityID, 2u)));
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, entityA->sendAdpMessage(buildAdpdu(entityMacAddress, entityID, 3u)));
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, entityB->sendAdpMessage(buildAdpdu(entityMacAddress, entityID, 3u)));
+
+	// Markers sent last on each link (messages of a link are processed in order), once received all the advertisements have been processed
+	auto const markerMacAddressA = la::networkInterface::MacAddress{ 0x0c, 0x00, 0x00, 0x00, 0x00, 0x02 };
+	auto const markerMacAddressB = la::networkInterface::MacAddress{ 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03 };
+	auto markerA = createVirtualInterface("CompositeBridgedA", markerMacAddressA);
+	auto markerB = createVirtualInterface("CompositeBridgedB", markerMacAddressB);
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, markerA->sendAdpMessage(buildAdpdu(markerMacAddressA, la::avdecc::UniqueIdentifier{ 0x0001020304050608 }, 1u)));
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, markerB->sendAdpMessage(buildAdpdu(markerMacAddressB, la::avdecc::UniqueIdentifier{ 0x0001020304050609 }, 1u)));
+	ASSERT_TRUE(compositeObserver.waitFor(
+		[&markerMacAddressA, &markerMacAddressB](auto const& obs)
+		{
+			return countFrom(obs.adpdus, markerMacAddressA) == 1u && countFrom(obs.adpdus, markerMacAddressB) == 1u;
+		}));
+
+	// Only the advertisements from the first link are processed: a single entity, discovered once
+	ASSERT_EQ(3u, countFrom(compositeObserver.adpdus, entityMacAddress));
+	auto expectedAvailableIndex = 1u;
+	for (auto const& adpdu : compositeObserver.adpdus)
+	{
+		if (adpdu.srcAddress == entityMacAddress)
+		{
+			EXPECT_EQ(expectedAvailableIndex++, adpdu.availableIndex);
+		}
+	}
+	EXPECT_EQ(3u, compositeObserver.remoteEntityOnlineCount); // The entity and the markers
+
+	// Commands to the entity are only sent on the link it is followed through
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, composite->sendAecpMessage(buildAemAecpdu(composite->getMacAddress(), entityMacAddress, false)));
+	EXPECT_TRUE(observerA.waitFor(
+		[](auto const& obs)
+		{
+			return countFrom(obs.aecpdus, CompositeMacAddressA) == 1u;
+		}));
+	EXPECT_EQ(0u, countFrom(observerB.aecpdus, CompositeMacAddressB));
+
+	composite->unregisterObserver(&compositeObserver);
+}
+
+TEST(ProtocolInterfaceComposite, AecpRoutedBackOnArrivalInterface)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	auto deviceA = createVirtualInterface("CompositeAecpA", DeviceMacAddressA);
+	auto deviceB = createVirtualInterface("CompositeAecpB", DeviceMacAddressB);
+	auto interfaces = std::vector<la::avdecc::protocol::ProtocolInterface::UniquePointer>{};
+	interfaces.push_back(createVirtualInterface("CompositeAecpA", CompositeMacAddressA));
+	interfaces.push_back(createVirtualInterface("CompositeAecpB", CompositeMacAddressB));
+	auto composite = la::avdecc::protocol::ProtocolInterface::createComposite(std::move(interfaces));
+
+	auto compositeObserver = RecordingObserver{};
+	auto observerA = RecordingObserver{};
+	auto observerB = RecordingObserver{};
+	composite->registerObserver(&compositeObserver);
+	deviceA->registerObserver(&observerA);
+	deviceB->registerObserver(&observerB);
+
+	// Command received on the secondary interface
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, deviceB->sendAecpMessage(buildAemAecpdu(DeviceMacAddressB, CompositeMacAddressB, false)));
+	ASSERT_TRUE(compositeObserver.waitFor(
+		[](auto const& obs)
+		{
+			return countFrom(obs.aecpdus, DeviceMacAddressB) == 1u;
+		}));
+
+	// Response is sent back on the secondary interface, with its MacAddress
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, composite->sendAecpMessage(buildAemAecpdu(composite->getMacAddress(), DeviceMacAddressB, true)));
+	EXPECT_TRUE(observerB.waitFor(
+		[](auto const& obs)
+		{
+			return countFrom(obs.aecpdus, CompositeMacAddressB) == 1u;
+		}));
+
+	// Unknown destination uses the primary interface
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, composite->sendAecpMessage(buildAemAecpdu(composite->getMacAddress(), DeviceMacAddressA, false)));
+	EXPECT_TRUE(observerA.waitFor(
+		[](auto const& obs)
+		{
+			return countFrom(obs.aecpdus, CompositeMacAddressA) == 1u;
+		}));
+	EXPECT_EQ(0u, countFrom(observerA.aecpdus, CompositeMacAddressB));
+	EXPECT_EQ(1u, observerB.aecpdus.size());
+
+	composite->unregisterObserver(&compositeObserver);
+}
+
+TEST(ProtocolInterfaceComposite, TransportErrorWhenAllInterfacesFailed)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	auto* const interfaceA = la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("CompositeTransportA", CompositeMacAddressA, DefaultExecutorName);
+	auto* const interfaceB = la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("CompositeTransportB", CompositeMacAddressB, DefaultExecutorName);
+	auto const deleter = [](la::avdecc::protocol::ProtocolInterface* self)
+	{
+		delete self;
+	};
+	auto interfaces = std::vector<la::avdecc::protocol::ProtocolInterface::UniquePointer>{};
+	interfaces.push_back(la::avdecc::protocol::ProtocolInterface::UniquePointer{ interfaceA, deleter });
+	interfaces.push_back(la::avdecc::protocol::ProtocolInterface::UniquePointer{ interfaceB, deleter });
+	auto composite = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceComposite>(la::avdecc::protocol::ProtocolInterfaceComposite::createRawProtocolInterfaceComposite(std::move(interfaces)));
+
+	auto observer = RecordingObserver{};
+	composite->registerObserver(&observer);
+	EXPECT_EQ(2u, composite->getProtocolInterfacesCount());
+	EXPECT_EQ(2u, composite->getActiveProtocolInterfacesCount());
+
+	// Losing one interface is not critical
+	interfaceA->forceTransportError();
+	for (auto retry = 0u; retry < 200u && composite->getActiveProtocolInterfacesCount() != 1u; ++retry)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	EXPECT_EQ(1u, composite->getActiveProtocolInterfacesCount());
+	EXPECT_EQ(0u, observer.transportErrorCount);
+	EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, composite->discoverRemoteEntities());
+
+	// Losing all of them is
+	interfaceB->forceTransportError();
+	EXPECT_TRUE(observer.waitFor(
+		[](auto const& obs)
+		{
+			return obs.transportErrorCount == 1u;
+		}));
+	EXPECT_EQ(0u, composite->getActiveProtocolInterfacesCount());
+	EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::TransportError, composite->discoverRemoteEntities());
+
+	composite->unregisterObserver(&observer);
+}
@@ -0,0 +1,323 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_proxy_tests.cpp
+* @author Christophe Calmejane
+*/
+
+// Public API
+#include <la/avdecc/executor.hpp>
+#include <la/avdecc/internals/serialization.hpp>
+#include <la/avdecc/internals/protocolAdpdu.hpp>
+#include <la/avdecc/internals/protocolAemAecpdu.hpp>
+
+// Internal API
+#include "protocolInterface/protocolInterface_proxy.hpp"
+#include "protocolInterface/protocolInterface_virtual.hpp"
+#include "protocolInterface/proxyProtocol.hpp"
+#include "protocolInterface/proxyServer.hpp"
+
+#include <gtest/gtest.h>
+#include <future>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+static auto constexpr DefaultExecutorName = "avdecc::protocol::PI";
+static auto const NetworkMacAddress = la::networkInterface::MacAddress{ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 };
+static auto const DeviceMacAddress = la::networkInterface::MacAddress{ 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b };
+
+la::avdecc::protocol::Adpdu buildAdpdu(la::networkInterface::MacAddress const& srcAddress, la::avdecc::UniqueIdentifier const entityID)
+{
+	auto adpdu = la::avdecc::protocol::Adpdu{};
+	// Set Ether2 fields
+	adpdu.setSrcAddress(srcAddress);
+	adpdu.setDestAddress(la::avdecc::protocol::Adpdu::Multicast_Mac_Address);
+	// Set ADP fields
+	adpdu.setMessageType(la::avdecc::protocol::AdpMessageType::EntityAvailable);
+	adpdu.setValidTime(31);
+	adpdu.setEntityID(entityID);
+	adpdu.setEntityModelID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+	adpdu.setEntityCapabilities({});
+	adpdu.setTalkerStreamSources(0);
+	adpdu.setTalkerCapabilities({});
+	adpdu.setListenerStreamSinks(0);
+	adpdu.setListenerCapabilities({});
+	adpdu.setControllerCapabilities(la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented });
+	adpdu.setAvailableIndex(1);
+	adpdu.setGptpGrandmasterID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+	adpdu.setGptpDomainNumber(0);
+	adpdu.setIdentifyControlIndex(0);
+	adpdu.setInterfaceIndex(0);
+	adpdu.setAssociationID(la::avdecc::UniqueIdentifier{});
+	return adpdu;
+}
+
+class Observer final : public la::avdecc::protocol::ProtocolInterface::Observer
+{
+public:
+	std::future<la::avdecc::protocol::Adpdu> getAdpdu(la::avdecc::UniqueIdentifier const entityID)
+	{
+		_expectedEntityID = entityID;
+		return _adpduPromise.get_future();
+	}
+	std::future<la::avdecc::protocol::AemCommandType> getAemCommand()
+	{
+		return _aemPromise.get_future();
+	}
+
+private:
+	virtual void onAdpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Adpdu const& adpdu) noexcept override
+	{
+		if (adpdu.getEntityID() == _expectedEntityID && !_adpduReceived)
+		{
+			_adpduReceived = true;
+			_adpduPromise.set_value(adpdu);
+		}
+	}
+	virtual void onAecpduReceived(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::protocol::Aecpdu const& aecpdu) noexcept override
+	{
+		if (aecpdu.getMessageType() == la::avdecc::protocol::AecpMessageType::AemCommand && !_aemReceived)
+		{
+			_aemReceived = true;
+			_aemPromise.set_value(static_cast<la::avdecc::protocol::AemAecpdu const&>(aecpdu).getCommandType());
+		}
+	}
+
+	la::avdecc::UniqueIdentifier _expectedEntityID{};
+	bool _adpduReceived{ false };
+	std::promise<la::avdecc::protocol::Adpdu> _adpduPromise{};
+	bool _aemReceived{ false };
+	std::promise<la::avdecc::protocol::AemCommandType> _aemPromise{};
+	DECLARE_AVDECC_OBSERVER_GUARD(Observer);
+};
+} // namespace
+
+TEST(ProxyProtocol, MessageReaderFragmentedStream)
+{
+	auto stream = std::vector<std::uint8_t>{};
+	auto const payload = std::vector<std::uint8_t>{ 0xfa, 0x00, 0x01, 0x02 };
+	la::avdecc::protocol::proxy::appendMessage(stream, la::avdecc::protocol::proxy::MessageType::LinkUp, NetworkMacAddress, nullptr, 0u);
+	la::avdecc::protocol::proxy::appendMessage(stream, la::avdecc::protocol::proxy::MessageType::AvdeccFromAps, DeviceMacAddress, payload.data(), payload.size());
+	ASSERT_EQ(2 * la::avdecc::protocol::proxy::HeaderLength + payload.size(), stream.size());
+
+	// Feed one byte at a time, then all at once
+	for (auto const chunkSize : { std::size_t{ 1u }, stream.size() })
+	{
+		auto reader = la::avdecc::protocol::proxy::MessageReader{};
+		auto types = std::vector<la::avdecc::protocol::proxy::MessageType>{};
+		auto addresses = std::vector<la::networkInterface::MacAddress>{};
+		auto payloads = std::vector<std::vector<std::uint8_t>>{};
+		for (auto offset = std::size_t{ 0u }; offset < stream.size(); offset += chunkSize)
+		{
+			auto const result = reader.feed(stream.data() + offset, std::min(chunkSize, stream.size() - offset),
+				[&](la::avdecc::protocol::proxy::MessageType const messageType, la::networkInterface::MacAddress const& address, std::uint8_t const* const data, std::size_t const length)
+				{
+					types.push_back(messageType);
+					addresses.push_back(address);
+					payloads.emplace_back(data, data + length);
+				});
+			ASSERT_TRUE(result);
+		}
+
+		ASSERT_EQ(2u, types.size());
+		EXPECT_EQ(la::avdecc::protocol::proxy::MessageType::LinkUp, types[0]);
+		EXPECT_EQ(NetworkMacAddress, addresses[0]);
+		EXPECT_TRUE(payloads[0].empty());
+		EXPECT_EQ(la::avdecc::protocol::proxy::MessageType::AvdeccFromAps, types[1]);
+		EXPECT_EQ(DeviceMacAddress, addresses[1]);
+		EXPECT_EQ(payload, payloads[1]);
+	}
+}
+
+TEST(ProxyProtocol, MessageReaderInvalidStream)
+{
+	auto reader = la::avdecc::protocol::proxy::MessageReader{};
+	auto const handler = [](la::avdecc::protocol::proxy::MessageType const, la::networkInterface::MacAddress const&, std::uint8_t const* const, std::size_t const) {};
+
+	// Unsupported version
+	{
+		auto const stream = std::vector<std::uint8_t>{ 0x01, 0x00, 0x00, 0x00, 0, 0, 0, 0, 0, 0, 0, 0 };
+		EXPECT_FALSE(reader.feed(stream.data(), stream.size(), handler));
+	}
+	// Payload too big
+	{
+		auto const stream = std::vector<std::uint8_t>{ 0x00, 0x05, 0xff, 0xff, 0, 0, 0, 0, 0, 0, 0, 0 };
+		EXPECT_FALSE(la::avdecc::protocol::proxy::MessageReader{}.feed(stream.data(), stream.size(), handler));
+	}
+}
+
+TEST(ProxyProtocol, HttpHandshake)
+{
+	auto const request = la::avdecc::protocol::proxy::makeConnectRequest("localhost", 17221);
+	auto const* const requestData = reinterpret_cast<std::uint8_t const*>(request.data());
+	EXPECT_FALSE(la::avdecc::protocol::proxy::getHttpHeaderLength(requestData, request.size() - 1));
+	auto const requestLength = la::avdecc::protocol::proxy::getHttpHeaderLength(requestData, request.size());
+	ASSERT_TRUE(requestLength);
+	EXPECT_EQ(request.size(), *requestLength);
+	EXPECT_TRUE(la::avdecc::protocol::proxy::isConnectRequest(requestData, *requestLength));
+
+	auto const accepted = la::avdecc::protocol::proxy::makeConnectResponse(true);
+	EXPECT_TRUE(la::avdecc::protocol::proxy::isSuccessfulResponse(reinterpret_cast<std::uint8_t const*>(accepted.data()), accepted.size()));
+	auto const refused = la::avdecc::protocol::proxy::makeConnectResponse(false);
+	EXPECT_FALSE(la::avdecc::protocol::proxy::isSuccessfulResponse(reinterpret_cast<std::uint8_t const*>(refused.data()), refused.size()));
+}
+
+TEST(ProtocolInterfaceProxy, InvalidServerAddress)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	for (auto const& name : { std::string{ "" }, std::string{ "[::1" }, std::string{ "localhost:0" }, std::string{ "localhost:99999" }, std::string{ "localhost:port" } })
+	{
+		try
+		{
+			auto intfc = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceProxy>(la::avdecc::protocol::ProtocolInterfaceProxy::createRawProtocolInterfaceProxy(name, DefaultExecutorName));
+			FAIL() << "Should throw for '" << name << "'";
+		}
+		catch (la::avdecc::protocol::ProtocolInterface::Exception const& e)
+		{
+			EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::InvalidParameters, e.getError()) << name;
+		}
+	}
+}
+
+TEST(ProtocolInterfaceProxy, ConnectionRefused)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	// Get a free port, then close it
+	auto port = std::uint16_t{ 0u };
+	{
+		auto network = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("ProxyConnectionRefused", NetworkMacAddress, DefaultExecutorName));
+		auto const server = la::avdecc::protocol::ProxyServer::create(*network, 0u, "127.0.0.1");
+		port = server->getPort();
+	}
+	ASSERT_NE(0u, port);
+
+	try
+	{
+		auto intfc = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceProxy>(la::avdecc::protocol::ProtocolInterfaceProxy::createRawProtocolInterfaceProxy("127.0.0.1:" + std::to_string(port), DefaultExecutorName));
+		FAIL() << "Should throw";
+	}
+	catch (la::avdecc::protocol::ProtocolInterface::Exception const& e)
+	{
+		EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::TransportError, e.getError());
+	}
+}
+
+TEST(ProtocolInterfaceProxy, Localhost)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	// Virtual network with the proxy server interface and a device
+	auto network = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("ProxyLocalhost", NetworkMacAddress, DefaultExecutorName));
+	auto device = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("ProxyLocalhost", DeviceMacAddress, DefaultExecutorName));
+	auto const server = la::avdecc::protocol::ProxyServer::create(*network, 0u, "127.0.0.1");
+	ASSERT_NE(0u, server->getPort());
+
+	// Remote client
+	auto client = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceProxy>(la::avdecc::protocol::ProtocolInterfaceProxy::createRawProtocolInterfaceProxy("127.0.0.1:" + std::to_string(server->getPort()), DefaultExecutorName));
+	EXPECT_EQ(NetworkMacAddress, client->getMacAddress()); // MAC address announced by the server
+	EXPECT_EQ(1u, server->getConnectedClientsCount());
+
+	auto clientObserver = Observer{};
+	auto deviceObserver = Observer{};
+	client->registerObserver(&clientObserver);
+	device->registerObserver(&deviceObserver);
+
+	// Device to client
+	{
+		auto const entityID = la::avdecc::UniqueIdentifier{ 0x0001020304050607 };
+		auto fut = clientObserver.getAdpdu(entityID);
+		ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, device->sendAdpMessage(buildAdpdu(DeviceMacAddress, entityID)));
+		ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(2)));
+		auto const adpdu = fut.get();
+		EXPECT_EQ(DeviceMacAddress, adpdu.getSrcAddress());
+	}
+
+	// Client to device
+	{
+		auto const entityID = la::avdecc::UniqueIdentifier{ 0x0807060504030201 };
+		auto fut = deviceObserver.getAdpdu(entityID);
+		ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, client->sendAdpMessage(buildAdpdu(client->getMacAddress(), entityID)));
+		ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(2)));
+		auto const adpdu = fut.get();
+		EXPECT_EQ(NetworkMacAddress, adpdu.getSrcAddress());
+	}
+
+	// AEM command from client to device
+	{
+		auto fut = deviceObserver.getAemCommand();
+		auto aecpdu = la::avdecc::protocol::AemAecpdu{ false };
+		aecpdu.setSrcAddress(client->getMacAddress());
+		aecpdu.setDestAddress(DeviceMacAddress);
+		aecpdu.setStatus(la::avdecc::protocol::AemAecpStatus::Success);
+		aecpdu.setTargetEntityID(la::avdecc::UniqueIdentifier{ 0x0001020304050607 });
+		aecpdu.setControllerEntityID(la::avdecc::UniqueIdentifier{ 0x0807060504030201 });
+		aecpdu.setSequenceID(1u);
+		aecpdu.setUnsolicited(false);
+		aecpdu.setCommandType(la::avdecc::protocol::AemCommandType::EntityAvailable);
+		ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, client->sendAecpMessage(aecpdu));
+		ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(2)));
+		EXPECT_EQ(la::avdecc::protocol::AemCommandType::EntityAvailable, fut.get());
+	}
+
+	client->unregisterObserver(&clientObserver);
+	device->unregisterObserver(&deviceObserver);
+}
+
+TEST(ProtocolInterfaceProxy, ServerClosesConnection)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	class TransportObserver final : public la::avdecc::protocol::ProtocolInterface::Observer
+	{
+	public:
+		std::future<void> getFuture()
+		{
+			return _transportErrorPromise.get_future();
+		}
+
+	private:
+		virtual void onTransportError(la::avdecc::protocol::ProtocolInterface* const /*pi*/) noexcept override
+		{
+			_transportErrorPromise.set_value();
+		}
+		std::promise<void> _transportErrorPromise{};
+		DECLARE_AVDECC_OBSERVER_GUARD(TransportObserver);
+	};
+
+	auto network = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("ProxyServerCloses", NetworkMacAddress, DefaultExecutorName));
+	auto server = la::avdecc::protocol::ProxyServer::create(*network, 0u, "127.0.0.1");
+	auto client = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceProxy>(la::avdecc::protocol::ProtocolInterfaceProxy::createRawProtocolInterfaceProxy("127.0.0.1:" + std::to_string(server->getPort()), DefaultExecutorName));
+	auto obs = TransportObserver{};
+	auto fut = obs.getFuture();
+	client->registerObserver(&obs);
+
+	server.reset();
+
+	EXPECT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(2)));
+	EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::TransportError, client->sendAdpMessage(buildAdpdu(client->getMacAddress(), la::avdecc::UniqueIdentifier{ 0x0001020304050607 })));
+	client->unregisterObserver(&obs);
+}
@@ -0,0 +1,320 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolInterface_replay_tests.cpp
+* @author Christophe Calmejane
+*/
+
+// Public API
+#include <la/avdecc/executor.hpp>
+#include <la/avdecc/internals/serialization.hpp>
+#include <la/avdecc/internals/protocolAdpdu.hpp>
+
+// Internal API
+#include "protocolInterface/protocolInterface_replay.hpp"
+#include "protocolInterface/captureFile.hpp"
+
+#include <gtest/gtest.h>
+#include <future>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <optional>
+#include <vector>
+
+namespace
+{
+static auto constexpr DefaultExecutorName = "avdecc::protocol::PI";
+
+la::avdecc::protocol::SerializationBuffer buildAdpFrame(la::avdecc::UniqueIdentifier const entityID, std::uint32_t const availableIndex)
+{
+	auto adpdu = la::avdecc::protocol::Adpdu{};
+	// Set Ether2 fields
+	adpdu.setSrcAddress({ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 });
+	adpdu.setDestAddress(la::avdecc::protocol::Adpdu::Multicast_Mac_Address);
+	// Set ADP fields
+	adpdu.setMessageType(la::avdecc::protocol::AdpMessageType::EntityAvailable);
+	adpdu.setValidTime(31);
+	adpdu.setEntityID(entityID);
+	adpdu.setEntityModelID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+	adpdu.setEntityCapabilities({});
+	adpdu.setTalkerStreamSources(0);
+	adpdu.setTalkerCapabilities({});
+	adpdu.setListenerStreamSinks(0);
+	adpdu.setListenerCapabilities({});
+	adpdu.setControllerCapabilities(la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented });
+	adpdu.setAvailableIndex(availableIndex);
+	adpdu.setGptpGrandmasterID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+	adpdu.setGptpDomainNumber(0);
+	adpdu.setIdentifyControlIndex(0);
+	adpdu.setInterfaceIndex(0);
+	adpdu.setAssociationID(la::avdecc::UniqueIdentifier{});
+
+	auto buffer = la::avdecc::protocol::SerializationBuffer{};
+	la::avdecc::protocol::serialize<la::avdecc::protocol::EtherLayer2>(adpdu, buffer);
+	la::avdecc::protocol::serialize<la::avdecc::protocol::AvtpduControl>(adpdu, buffer);
+	la::avdecc::protocol::serialize<la::avdecc::protocol::Adpdu>(adpdu, buffer);
+	return buffer;
+}
+
+template<typename T>
+void writeValue(std::ofstream& stream, T const value)
+{
+	// Capture files written in host byte order (readers detect it using the magic number)
+	stream.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+void writePadding(std::ofstream& stream, std::size_t const length)
+{
+	for (auto i = length; i % 4 != 0; ++i)
+	{
+		writeValue(stream, std::uint8_t{ 0u });
+	}
+}
+
+std::string writePcapFile(std::string const& fileName, std::vector<la::avdecc::protocol::SerializationBuffer> const& frames, std::uint32_t const intervalUsec = 1000u)
+{
+	auto const filePath = (std::filesystem::temp_directory_path() / fileName).string();
+	auto stream = std::ofstream{ filePath, std::ios::binary | std::ios::trunc };
+
+	// Global header
+	writeValue(stream, std::uint32_t{ 0xa1b2c3d4 });
+	writeValue(stream, std::uint16_t{ 2u });
+	writeValue(stream, std::uint16_t{ 4u });
+	writeValue(stream, std::int32_t{ 0 });
+	writeValue(stream, std::uint32_t{ 0u });
+	writeValue(stream, std::uint32_t{ 65535u });
+	writeValue(stream, std::uint32_t{ 1u });
+
+	// Records (1 ms apart by default)
+	auto usec = std::uint64_t{ 0u };
+	for (auto const& frame : frames)
+	{
+		writeValue(stream, static_cast<std::uint32_t>(1000u + usec / 1000000u));
+		writeValue(stream, static_cast<std::uint32_t>(usec % 1000000u));
+		writeValue(stream, static_cast<std::uint32_t>(frame.size()));
+		writeValue(stream, static_cast<std::uint32_t>(frame.size()));
+		stream.write(reinterpret_cast<char const*>(frame.data()), frame.size());
+		usec += intervalUsec;
+	}
+
+	return filePath;
+}
+
+std::string writePcapNgFile(std::string const& fileName, std::vector<la::avdecc::protocol::SerializationBuffer> const& frames, std::optional<std::uint8_t> const timestampResolution = std::nullopt, std::uint64_t const firstTimestamp = 1000000u, std::uint64_t const interval = 1000u)
+{
+	auto const filePath = (std::filesystem::temp_directory_path() / fileName).string();
+	auto stream = std::ofstream{ filePath, std::ios::binary | std::ios::trunc };
+
+	// Section Header Block
+	writeValue(stream, std::uint32_t{ 0x0A0D0D0A });
+	writeValue(stream, std::uint32_t{ 28u });
+	writeValue(stream, std::uint32_t{ 0x1A2B3C4D });
+	writeValue(stream, std::uint16_t{ 1u });
+	writeValue(stream, std::uint16_t{ 0u });
+	writeValue(stream, std::int64_t{ -1 });
+	writeValue(stream, std::uint32_t{ 28u });
+
+	// Interface Description Block (with an optional if_tsresol option)
+	auto const interfaceBlockLength = std::uint32_t{ timestampResolution ? 32u : 20u };
+	writeValue(stream, std::uint32_t{ 1u });
+	writeValue(stream, interfaceBlockLength);
+	writeValue(stream, std::uint16_t{ 1u });
+	writeValue(stream, std::uint16_t{ 0u });
+	writeValue(stream, std::uint32_t{ 65535u });
+	if (timestampResolution)
+	{
+		writeValue(stream, std::uint16_t{ 9u });
+		writeValue(stream, std::uint16_t{ 1u });
+		writeValue(stream, *timestampResolution);
+		writePadding(stream, 1u);
+		writeValue(stream, std::uint32_t{ 0u });
+	}
+	writeValue(stream, interfaceBlockLength);
+
+	// Enhanced Packet Blocks (1 ms apart by default, microseconds resolution)
+	auto timestamp = firstTimestamp;
+	for (auto const& frame : frames)
+	{
+		auto const paddedLength = static_cast<std::uint32_t>((frame.size() + 3u) & ~std::size_t{ 3u });
+		auto const blockLength = std::uint32_t{ 32u } + paddedLength;
+		writeValue(stream, std::uint32_t{ 6u });
+		writeValue(stream, blockLength);
+		writeValue(stream, std::uint32_t{ 0u });
+		writeValue(stream, static_cast<std::uint32_t>(timestamp >> 32));
+		writeValue(stream, static_cast<std::uint32_t>(timestamp & 0xFFFFFFFF));
+		writeValue(stream, static_cast<std::uint32_t>(frame.size()));
+		writeValue(stream, static_cast<std::uint32_t>(frame.size()));
+		stream.write(reinterpret_cast<char const*>(frame.data()), frame.size());
+		writePadding(stream, frame.size());
+		writeValue(stream, blockLength);
+		timestamp += interval;
+	}
+
+	return filePath;
+}
+
+class Observer : public la::avdecc::protocol::ProtocolInterface::Observer
+{
+public:
+	std::size_t getOnlineCount() const noexcept
+	{
+		return _onlineCount;
+	}
+
+private:
+	virtual void onRemoteEntityOnline(la::avdecc::protocol::ProtocolInterface* const /*pi*/, la::avdecc::entity::Entity const& /*entity*/) noexcept override
+	{
+		++_onlineCount;
+	}
+	std::atomic<std::size_t> _onlineCount{ 0u };
+	DECLARE_AVDECC_OBSERVER_GUARD(Observer);
+};
+
+void replayFile(std::string const& filePath, std::string const& speed)
+{
+	auto obs = Observer{};
+	auto intfc = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceReplay>(la::avdecc::protocol::ProtocolInterfaceReplay::createRawProtocolInterfaceReplay(filePath + speed, DefaultExecutorName));
+	intfc->registerObserver(&obs);
+
+	// Replay only starts once requested, so no frame is missed by the observer
+	EXPECT_FALSE(intfc->waitForReplayCompletion(std::chrono::milliseconds(20)));
+	EXPECT_EQ(0u, intfc->getInjectedFramesCount());
+	intfc->startReplay();
+
+	ASSERT_TRUE(intfc->waitForReplayCompletion(std::chrono::seconds(5)));
+	EXPECT_EQ(3u, intfc->getInjectedFramesCount());
+	EXPECT_EQ(2u, obs.getOnlineCount());
+
+	intfc->unregisterObserver(&obs);
+}
+} // namespace
+
+TEST(ProtocolInterfaceReplay, InvalidFile)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+
+	// Not using EXPECT_THROW, we want to check the error code inside our custom exception
+	try
+	{
+		std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceReplay>(la::avdecc::protocol::ProtocolInterfaceReplay::createRawProtocolInterfaceReplay("/this/file/does/not/exist.pcap", DefaultExecutorName));
+		EXPECT_FALSE(true); // We expect an exception to have been raised
+	}
+	catch (la::avdecc::protocol::ProtocolInterface::Exception const& e)
+	{
+		EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::InterfaceNotFound, e.getError());
+	}
+}
+
+TEST(ProtocolInterfaceReplay, InvalidSpeed)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto const filePath = writePcapFile("avdecc_replay_invalid_speed.pcap", { buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, 1u) });
+
+	try
+	{
+		std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceReplay>(la::avdecc::protocol::ProtocolInterfaceReplay::createRawProtocolInterfaceReplay(filePath + "@fast", DefaultExecutorName));
+		EXPECT_FALSE(true); // We expect an exception to have been raised
+	}
+	catch (la::avdecc::protocol::ProtocolInterface::Exception const& e)
+	{
+		EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::InvalidParameters, e.getError());
+	}
+
+	std::remove(filePath.c_str());
+}
+
+TEST(ProtocolInterfaceReplay, ReplayPcap)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto const filePath = writePcapFile("avdecc_replay.pcap", { buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, 1u), buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, 2u), buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050608 }, 1u) });
+
+	replayFile(filePath, "@max");
+
+	std::remove(filePath.c_str());
+}
+
+TEST(ProtocolInterfaceReplay, ReplayPcapNgRealTime)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto const filePath = writePcapNgFile("avdecc_replay.pcapng", { buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, 1u), buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, 2u), buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050608 }, 1u) });
+
+	auto const startTime = std::chrono::steady_clock::now();
+	replayFile(filePath, "");
+	// Frames are 1 msec apart, real time replay should take at least 2 msec
+	EXPECT_LE(std::chrono::milliseconds{ 2 }, std::chrono::steady_clock::now() - startTime);
+
+	std::remove(filePath.c_str());
+}
+
+TEST(ProtocolInterfaceReplay, PauseResume)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	// Frames 200 msec apart
+	auto const filePath = writePcapFile("avdecc_replay_pause.pcap", { buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, 1u), buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050608 }, 1u) }, 200000u);
+
+	auto intfc = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceReplay>(la::avdecc::protocol::ProtocolInterfaceReplay::createRawProtocolInterfaceReplay(filePath, DefaultExecutorName));
+	intfc->startReplay();
+
+	// Wait for the first frame, then pause before the second one
+	auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{ 2 };
+	while (intfc->getInjectedFramesCount() == 0u && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+	}
+	intfc->pauseReplay();
+	ASSERT_EQ(1u, intfc->getInjectedFramesCount());
+
+	// Nothing is injected while paused, even past the capture timing of the second frame
+	EXPECT_FALSE(intfc->waitForReplayCompletion(std::chrono::milliseconds(400)));
+	EXPECT_EQ(1u, intfc->getInjectedFramesCount());
+
+	// Resume
+	intfc->startReplay();
+	ASSERT_TRUE(intfc->waitForReplayCompletion(std::chrono::seconds(5)));
+	EXPECT_EQ(2u, intfc->getInjectedFramesCount());
+
+	intfc.reset();
+	std::remove(filePath.c_str());
+}
+
+TEST(ProtocolInterfaceReplay, PcapNgFineTimestampResolution)
+{
+	// 2^-40 second resolution, timestamps too large to be multiplied by 1e9 in 64 bits
+	auto constexpr TicksPerSecond = std::uint64_t{ 1u } << 40;
+	auto const filePath = writePcapNgFile("avdecc_replay_resolution.pcapng", { buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, 1u), buildAdpFrame(la::avdecc::UniqueIdentifier{ 0x0001020304050607 }, 2u) }, std::uint8_t{ 0x80 | 40u }, TicksPerSecond * 3u + TicksPerSecond / 2u, TicksPerSecond / 4u - 1u);
+
+	{
+		auto reader = la::avdecc::protocol::captureFile::Reader{ filePath };
+		auto const frame1 = reader.readNextFrame();
+		ASSERT_TRUE(frame1.has_value());
+		EXPECT_EQ(std::chrono::nanoseconds{ 3500000000 }, frame1->timestamp);
+		auto const frame2 = reader.readNextFrame();
+		ASSERT_TRUE(frame2.has_value());
+		// 3.75 sec minus one tick (about 0.9 nsec), truncated
+		EXPECT_EQ(std::chrono::nanoseconds{ 3749999999 }, frame2->timestamp);
+		EXPECT_FALSE(reader.readNextFrame().has_value());
+	}
+
+	std::remove(filePath.c_str());
+}
@@ -27,11 +27,16 @@
 
 // Internal API
 #include "protocolInterface/protocolInterface_virtual.hpp"
+#include "protocolInterface/captureFile.hpp"
 #include "instrumentationObserver.hpp"
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <future>
 #include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
 
 static auto constexpr DefaultExecutorName = "avdecc::protocol::PI";
 
@@ -254,3 +259,160 @@ TEST(ProtocolInterfaceVirtual, InjectPacket)
 	auto const status = entityOnlinePromise.get_future().wait_for(std::chrono::milliseconds(10));
 	ASSERT_NE(std::future_status::timeout, status);
 }
+
+static la::avdecc::protocol::Adpdu makeFrameRecordingAdpdu(la::networkInterface::MacAddress const& srcAddress)
+{
+	auto adpdu = la::avdecc::protocol::Adpdu{};
+	// Set Ether2 fields
+	adpdu.setSrcAddress(srcAddress);
+	adpdu.setDestAddress(la::avdecc::protocol::Adpdu::Multicast_Mac_Address);
+	// Set ADP fields
+	adpdu.setMessageType(la::avdecc::protocol::AdpMessageType::EntityAvailable);
+	adpdu.setValidTime(2);
+	adpdu.setEntityID(la::avdecc::UniqueIdentifier{ 0x0001020304050607 });
+	adpdu.setEntityModelID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+	adpdu.setEntityCapabilities({});
+	adpdu.setTalkerStreamSources(0);
+	adpdu.setTalkerCapabilities({});
+	adpdu.setListenerStreamSinks(0);
+	adpdu.setListenerCapabilities({});
+	adpdu.setControllerCapabilities(la::avdecc::entity::ControllerCapabilities{ la::avdecc::entity::ControllerCapability::Implemented });
+	adpdu.setAvailableIndex(1);
+	adpdu.setGptpGrandmasterID(la::avdecc::UniqueIdentifier::getNullUniqueIdentifier());
+	adpdu.setGptpDomainNumber(0);
+	adpdu.setIdentifyControlIndex(0);
+	adpdu.setInterfaceIndex(0);
+	adpdu.setAssociationID(la::avdecc::UniqueIdentifier{});
+	return adpdu;
+}
+
+TEST(ProtocolInterfaceVirtual, FrameRecordingInvalidParameters)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto intfc = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("FrameRecordingInvalidParameters", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } }, DefaultExecutorName));
+
+	auto configuration = la::avdecc::protocol::ProtocolInterface::FrameRecorderConfiguration{};
+	configuration.ringSize = 0u;
+	EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::InvalidParameters, intfc->startFrameRecording((std::filesystem::temp_directory_path() / "avdecc_invalid.pcapng").string(), configuration));
+
+	EXPECT_EQ(la::avdecc::protocol::ProtocolInterface::Error::InvalidParameters, intfc->startFrameRecording("/this/directory/does/not/exist/capture.pcapng", la::avdecc::protocol::ProtocolInterface::FrameRecorderConfiguration{}));
+}
+
+TEST(ProtocolInterfaceVirtual, FrameRecording)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto const filePath = (std::filesystem::temp_directory_path() / "avdecc_recording.pcapng").string();
+
+	auto intfc1 = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("FrameRecording", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } }, DefaultExecutorName));
+	auto intfc2 = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("FrameRecording", { { 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b } }, DefaultExecutorName));
+
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, intfc1->startFrameRecording(filePath, la::avdecc::protocol::ProtocolInterface::FrameRecorderConfiguration{}));
+
+	// Send a message from the recording interface, and another one from the other interface
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, intfc1->sendAdpMessage(makeFrameRecordingAdpdu(intfc1->getMacAddress())));
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, intfc2->sendAdpMessage(makeFrameRecordingAdpdu(intfc2->getMacAddress())));
+
+	// Inbound frames are recorded from the virtual interface thread, wait for all of them to be written (our outbound message, and both messages received back)
+	auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{ 2 };
+	while (intfc1->getFrameRecorderStatistics().recordedFrames < 3u && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+	}
+
+	auto const statistics = intfc1->stopFrameRecording();
+	EXPECT_EQ(0u, statistics.droppedFrames);
+	ASSERT_EQ(3u, statistics.recordedFrames);
+
+	// Read back the recording
+	auto reader = la::avdecc::protocol::captureFile::Reader{ filePath };
+	auto framesCount = std::uint64_t{ 0u };
+	auto foundOutbound = false;
+	auto foundInbound = false;
+	while (auto const frame = reader.readNextFrame())
+	{
+		++framesCount;
+		ASSERT_LE(la::avdecc::protocol::EtherLayer2::HeaderLength, frame->data.size());
+		auto const* const srcAddress = frame->data.data() + 6;
+		if (std::equal(srcAddress, srcAddress + 6, intfc1->getMacAddress().begin()))
+		{
+			foundOutbound = true;
+		}
+		if (std::equal(srcAddress, srcAddress + 6, intfc2->getMacAddress().begin()))
+		{
+			foundInbound = true;
+		}
+	}
+	EXPECT_EQ(statistics.recordedFrames, framesCount);
+	EXPECT_TRUE(foundOutbound);
+	EXPECT_TRUE(foundInbound);
+
+	std::remove(filePath.c_str());
+}
+
+TEST(ProtocolInterfaceVirtual, FrameRecordingStopWhileSending)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto const filePath = (std::filesystem::temp_directory_path() / "avdecc_stop_while_sending.pcapng").string();
+
+	auto intfc = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("FrameRecordingStopWhileSending", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } }, DefaultExecutorName));
+
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, intfc->startFrameRecording(filePath, la::avdecc::protocol::ProtocolInterface::FrameRecorderConfiguration{}));
+
+	// Keep sending from another thread while the recording is stopped
+	auto shouldTerminate = std::atomic_bool{ false };
+	auto sender = std::thread(
+		[&intfc, &shouldTerminate]
+		{
+			while (!shouldTerminate)
+			{
+				intfc->sendAdpMessage(makeFrameRecordingAdpdu(intfc->getMacAddress()));
+			}
+		});
+	std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+	auto const statistics = intfc->stopFrameRecording();
+	std::this_thread::sleep_for(std::chrono::milliseconds{ 5 });
+	shouldTerminate = true;
+	sender.join();
+
+	// Every frame accepted by the recorder must have been written before stopFrameRecording returned
+	auto reader = la::avdecc::protocol::captureFile::Reader{ filePath };
+	auto framesCount = std::uint64_t{ 0u };
+	while (reader.readNextFrame())
+	{
+		++framesCount;
+	}
+	EXPECT_LT(0u, statistics.recordedFrames);
+	EXPECT_EQ(statistics.recordedFrames, framesCount);
+
+	std::remove(filePath.c_str());
+}
+
+TEST(ProtocolInterfaceVirtual, FrameRecordingRotation)
+{
+	auto const executorWrapper = la::avdecc::ExecutorManager::getInstance().registerExecutor(DefaultExecutorName, la::avdecc::ExecutorWithDispatchQueue::create(DefaultExecutorName, la::avdecc::utils::ThreadPriority::Highest));
+	auto const filePath = (std::filesystem::temp_directory_path() / "avdecc_rotation.pcapng").string();
+	auto const rotatedFilePath = (std::filesystem::temp_directory_path() / "avdecc_rotation.1.pcapng").string();
+
+	auto intfc = std::unique_ptr<la::avdecc::protocol::ProtocolInterfaceVirtual>(la::avdecc::protocol::ProtocolInterfaceVirtual::createRawProtocolInterfaceVirtual("FrameRecordingRotation", { { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 } }, DefaultExecutorName));
+
+	auto configuration = la::avdecc::protocol::ProtocolInterface::FrameRecorderConfiguration{};
+	configuration.maxFileSize = 1u; // Rotate after each frame
+	configuration.maxFiles = 2u;
+	ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, intfc->startFrameRecording(filePath, configuration));
+
+	for (auto i = 0u; i < 3u; ++i)
+	{
+		ASSERT_EQ(la::avdecc::protocol::ProtocolInterface::Error::NoError, intfc->sendAdpMessage(makeFrameRecordingAdpdu(intfc->getMacAddress())));
+	}
+
+	auto const statistics = intfc->stopFrameRecording();
+	EXPECT_EQ(statistics.recordedFrames, statistics.rotations);
+	EXPECT_TRUE(std::filesystem::exists(filePath));
+	EXPECT_TRUE(std::filesystem::exists(rotatedFilePath));
+
+	// Oldest file should have been removed (only 2 files kept)
+	EXPECT_FALSE(std::filesystem::exists((std::filesystem::temp_directory_path() / "avdecc_rotation.2.pcapng").string()));
+
+	std::remove(filePath.c_str());
+	std::remove(rotatedFilePath.c_str());
+}
@@ -0,0 +1,151 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics and its contributors
+
+* This file is part of LA_avdecc.
+
+* LA_avdecc is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* LA_avdecc is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with LA_avdecc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file protocolPduPool_tests.cpp
+* @author Christophe Calmejane
+*/
+
+// Public API
+#include <la/avdecc/internals/protocolAemAecpdu.hpp>
+#include <la/avdecc/internals/protocolAaAecpdu.hpp>
+#include <la/avdecc/internals/protocolMvuAecpdu.hpp>
+#include <la/avdecc/internals/protocolAcmpdu.hpp>
+#include <la/avdecc/internals/protocolAdpdu.hpp>
+
+// Internal API
+#include "protocol/protocolPduPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(PduPool, StorageIsReused)
+{
+	auto& pool = la::avdecc::protocol::PduPool<la::avdecc::protocol::AemAecpdu>::getInstance();
+
+	// Make sure at least one storage block is cached
+	{
+		auto const frame = la::avdecc::protocol::AemAecpdu::create(false);
+	}
+	auto const before = pool.getStatistics();
+	ASSERT_LT(0u, before.cached);
+
+	{
+		auto const frame = la::avdecc::protocol::AemAecpdu::create(true);
+		auto const& aem = static_cast<la::avdecc::protocol::AemAecpdu const&>(*frame);
+		EXPECT_EQ(la::avdecc::protocol::AecpMessageType::AemResponse, aem.getMessageType());
+
+		auto const during = pool.getStatistics();
+		EXPECT_EQ(before.inUse + 1u, during.inUse);
+		EXPECT_EQ(before.cached - 1u, during.cached);
+		EXPECT_EQ(before.heapAllocations, during.heapAllocations);
+		EXPECT_EQ(before.reusedAllocations + 1u, during.reusedAllocations);
+	}
+
+	auto const after = pool.getStatistics();
+	EXPECT_EQ(before.inUse, after.inUse);
+	EXPECT_EQ(before.cached, after.cached);
+}
+
+TEST(PduPool, ResponseCopyUsesPool)
+{
+	auto& pool = la::avdecc::protocol::PduPool<la::avdecc::protocol::AemAecpdu>::getInstance();
+
+	auto const command = la::avdecc::protocol::AemAecpdu::create(false);
+	auto& aem = static_cast<la::avdecc::protocol::AemAecpdu&>(*command);
+	aem.setCommandType(la::avdecc::protocol::AemCommandType::ReadDescriptor);
+	auto const before = pool.getStatistics();
+
+	{
+		auto const response = command->responseCopy();
+		auto const& aemResponse = static_cast<la::avdecc::protocol::AemAecpdu const&>(*response);
+		EXPECT_EQ(la::avdecc::protocol::AecpMessageType::AemResponse, aemResponse.getMessageType());
+		EXPECT_EQ(la::avdecc::protocol::AemCommandType::ReadDescriptor, aemResponse.getCommandType());
+		EXPECT_EQ(before.inUse + 1u, pool.getStatistics().inUse);
+	}
+
+	EXPECT_EQ(before.inUse, pool.getStatistics().inUse);
+}
+
+TEST(PduPool, AllPduTypes)
+{
+	auto const aa = la::avdecc::protocol::AaAecpdu::create(false);
+	auto const mvu = la::avdecc::protocol::MvuAecpdu::create(true);
+	auto const acmp = la::avdecc::protocol::Acmpdu::create();
+	auto const adp = la::avdecc::protocol::Adpdu::create();
+
+	EXPECT_LT(0u, la::avdecc::protocol::PduPool<la::avdecc::protocol::AaAecpdu>::getInstance().getStatistics().inUse);
+	EXPECT_LT(0u, la::avdecc::protocol::PduPool<la::avdecc::protocol::MvuAecpdu>::getInstance().getStatistics().inUse);
+	EXPECT_LT(0u, la::avdecc::protocol::PduPool<la::avdecc::protocol::Acmpdu>::getInstance().getStatistics().inUse);
+	EXPECT_LT(0u, la::avdecc::protocol::PduPool<la::avdecc::protocol::Adpdu>::getInstance().getStatistics().inUse);
+
+	auto const acmpCopy = acmp->copy();
+	EXPECT_LT(1u, la::avdecc::protocol::PduPool<la::avdecc::protocol::Acmpdu>::getInstance().getStatistics().inUse);
+}
+
+TEST(PduPool, ConcurrentCreateDestroy)
+{
+	auto& pool = la::avdecc::protocol::PduPool<la::avdecc::protocol::AemAecpdu>::getInstance();
+	auto const before = pool.getStatistics();
+
+	auto constexpr ThreadsCount = 4u;
+	auto constexpr LoopsCount = 2000u;
+	auto threads = std::vector<std::thread>{};
+	for (auto t = 0u; t < ThreadsCount; ++t)
+	{
+		threads.emplace_back(
+			[]()
+			{
+				for (auto i = 0u; i < LoopsCount; ++i)
+				{
+					auto const first = la::avdecc::protocol::AemAecpdu::create(false);
+					auto const second = first->responseCopy();
+				}
+			});
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	auto const after = pool.getStatistics();
+	EXPECT_EQ(before.inUse, after.inUse);
+	// At most 2 objects per thread alive at the same time, all other allocations must have been served from the freelist
+	EXPECT_LE(after.heapAllocations - before.heapAllocations, ThreadsCount * 2u);
+}
+
+TEST(PduPool, Trim)
+{
+	auto& pool = la::avdecc::protocol::PduPool<la::avdecc::protocol::Adpdu>::getInstance();
+
+	{
+		auto const adp = la::avdecc::protocol::Adpdu::create();
+	}
+	ASSERT_LT(0u, pool.getStatistics().cached);
+
+	pool.trim();
+	EXPECT_EQ(0u, pool.getStatistics().cached);
+
+	// Pool still usable after trim
+	auto const before = pool.getStatistics();
+	auto const adp = la::avdecc::protocol::Adpdu::create();
+	EXPECT_EQ(before.heapAllocations + 1u, pool.getStatistics().heapAllocations);
+}
@@ -26,7 +26,11 @@
 #include <la/avdecc/utils.hpp>
 
 #include <gtest/gtest.h>
+#include <array>
 #include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 class UtilsTest : public ::testing::Test
 {
@@ -206,3 +210,185 @@ TEST_F(UtilsTest, Pow)
 	EXPECT_EQ(256u, pow2_8);
 	EXPECT_EQ(32768u, pow2_15);
 }
+
+namespace
+{
+int dispatchTimesTwo(int const value)
+{
+	return value * 2;
+}
+} // namespace
+
+TEST_F(UtilsTest, DispatchTable)
+{
+	// Compile-time table
+	static constexpr auto s_Dispatch = la::avdecc::utils::DispatchTable<int(int const value), 8>{
+		{ 1u, &dispatchTimesTwo },
+		{ 5u,
+			[](int const value)
+			{
+				return value + 5;
+			} },
+	};
+	static_assert(s_Dispatch.find(0u) == nullptr, "Unregistered key should not have a handler");
+
+	EXPECT_EQ(8u, s_Dispatch.size());
+	ASSERT_NE(nullptr, s_Dispatch.find(1u));
+	EXPECT_EQ(6, s_Dispatch.find(1u)(3));
+	ASSERT_NE(nullptr, s_Dispatch.find(5u));
+	EXPECT_EQ(8, s_Dispatch.find(5u)(3));
+
+	// Fallback for unknown keys
+	EXPECT_EQ(nullptr, s_Dispatch.find(2u));
+	EXPECT_EQ(nullptr, s_Dispatch.find(8u));
+	EXPECT_EQ(nullptr, s_Dispatch.find(0xffff));
+}
+
+TEST_F(UtilsTest, DispatchTable_InvalidKeys)
+{
+	using Table = la::avdecc::utils::DispatchTable<int(int const value), 4>;
+	EXPECT_THROW(Table({ { 4u, &dispatchTimesTwo } }), std::out_of_range);
+	EXPECT_THROW(Table({ { 1u, &dispatchTimesTwo }, { 1u, &dispatchTimesTwo } }), std::invalid_argument);
+}
+
+TEST_F(UtilsTest, MemoryArena)
+{
+	auto arena = la::avdecc::utils::MemoryArena{};
+
+	// Chunks are aligned and do not overlap
+	auto* const first = arena.allocate(1u);
+	auto* const second = arena.allocate(24u);
+	EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(first) % la::avdecc::utils::MemoryArena::Alignment);
+	EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(second) % la::avdecc::utils::MemoryArena::Alignment);
+	EXPECT_NE(first, second);
+
+	// Small chunks are recycled for the same size
+	arena.deallocate(second, 24u);
+	EXPECT_EQ(second, arena.allocate(24u));
+
+	// Medium chunks (up to a quarter of a block) are recycled for the same power of 2 size class
+	auto* const medium = arena.allocate(472u);
+	arena.deallocate(medium, 472u);
+	EXPECT_EQ(medium, arena.allocate(500u));
+	auto* const quarter = arena.allocate(la::avdecc::utils::MemoryArena::DefaultBlockSize / 4);
+	arena.deallocate(quarter, la::avdecc::utils::MemoryArena::DefaultBlockSize / 4);
+	EXPECT_EQ(quarter, arena.allocate(1000u));
+
+	// Big chunks are allocated from the heap
+	auto* const big = arena.allocate(la::avdecc::utils::MemoryArena::DefaultBlockSize);
+	ASSERT_NE(nullptr, big);
+	arena.deallocate(big, la::avdecc::utils::MemoryArena::DefaultBlockSize);
+
+	// More than a block
+	for (auto i = 0u; i < 1000u; ++i)
+	{
+		EXPECT_NE(nullptr, arena.allocate(100u));
+	}
+}
+
+TEST_F(UtilsTest, MemoryArena_InitialBuffer)
+{
+	alignas(std::max_align_t) std::uint8_t buffer[256];
+	auto arena = la::avdecc::utils::MemoryArena{ buffer + 1, sizeof(buffer) - 1 };
+
+	// First chunks are taken from the (aligned) initial buffer
+	auto* const chunk = static_cast<std::uint8_t*>(arena.allocate(64u));
+	EXPECT_EQ(buffer + la::avdecc::utils::MemoryArena::Alignment, chunk);
+	EXPECT_EQ(chunk + 64, arena.allocate(64u));
+
+	// Then from allocated blocks
+	auto* const other = static_cast<std::uint8_t*>(arena.allocate(128u));
+	EXPECT_TRUE(other < buffer || other >= buffer + sizeof(buffer));
+
+	// Blocks are not released while a chunk is still in use
+	arena.deallocate(chunk, 64u);
+	arena.deallocate(other, 128u);
+	EXPECT_FALSE(arena.releaseIfUnused());
+
+	// Then the initial buffer is used again
+	arena.deallocate(chunk + 64, 64u);
+	EXPECT_TRUE(arena.releaseIfUnused());
+	EXPECT_EQ(chunk, arena.allocate(32u));
+}
+
+TEST_F(UtilsTest, ArenaAllocator)
+{
+	auto arena = la::avdecc::utils::MemoryArena{};
+	using Allocator = la::avdecc::utils::ArenaAllocator<std::uint32_t>;
+	using Set = std::unordered_set<std::uint32_t, std::hash<std::uint32_t>, std::equal_to<std::uint32_t>, Allocator>;
+	using Map = std::unordered_map<std::uint16_t, Set, std::hash<std::uint16_t>, std::equal_to<std::uint16_t>, la::avdecc::utils::ArenaAllocator<std::pair<std::uint16_t const, Set>>>;
+
+	auto map = Map{ Map::allocator_type{ arena } };
+	for (auto round = 0u; round < 3u; ++round)
+	{
+		for (auto key = std::uint16_t{ 0u }; key < 4u; ++key)
+		{
+			auto& set = map.try_emplace(key, Set::allocator_type{ arena }).first->second;
+			for (auto value = 0u; value < 500u; ++value)
+			{
+				set.insert(value);
+			}
+		}
+		for (auto const& [key, set] : map)
+		{
+			EXPECT_EQ(500u, set.size());
+			EXPECT_EQ(Allocator{ arena }, set.get_allocator());
+		}
+		map.clear();
+	}
+
+	// Allocators from different arenas are not equal
+	auto otherArena = la::avdecc::utils::MemoryArena{};
+	EXPECT_NE(Allocator{ arena }, Allocator{ otherArena });
+}
+
+TEST_F(UtilsTest, InlineFunction)
+{
+	using Function = la::avdecc::utils::InlineFunction<int(int), 32u>;
+	auto const smallCapture = std::array<std::uint8_t, 16>{};
+	auto const largeCapture = std::array<std::uint8_t, 200>{};
+	auto const smallLambda = [smallCapture](int const value)
+	{
+		return value + smallCapture[0] + 1;
+	};
+	auto const largeLambda = [largeCapture](int const value)
+	{
+		return value + largeCapture[0] + 2;
+	};
+	static_assert(Function::isStoredInline<decltype(smallLambda)>(), "Small callable should be stored inline");
+	static_assert(!Function::isStoredInline<decltype(largeLambda)>(), "Large callable should not be stored inline");
+
+	auto f = Function{};
+	EXPECT_FALSE(!!f);
+	EXPECT_TRUE(f == nullptr);
+	EXPECT_THROW(f(0), std::bad_function_call);
+
+	// Inline target
+	f = Function{ smallLambda };
+	ASSERT_TRUE(!!f);
+	EXPECT_EQ(11, f(10));
+
+	// Pooled target, moved around
+	auto g = Function{ largeLambda };
+	EXPECT_EQ(12, g(10));
+	f = std::move(g);
+	EXPECT_TRUE(g == nullptr);
+	EXPECT_EQ(12, f(10));
+
+	// Move-only target, destroyed exactly once
+	auto counter = std::make_shared<int>(0);
+	{
+		auto h = Function{ [ptr = std::make_unique<std::shared_ptr<int>>(counter)](int const value)
+			{
+				return value + static_cast<int>(ptr->use_count());
+			} };
+		EXPECT_EQ(2, counter.use_count());
+		auto i = std::move(h);
+		EXPECT_EQ(2, counter.use_count());
+		EXPECT_EQ(2, i(0));
+	}
+	EXPECT_EQ(1, counter.use_count());
+
+	f.reset();
+	EXPECT_TRUE(f == nullptr);
+}